@@ -119,5 +119,6 @@ defineTest(CheckOptionalDependency) {
 
 swiftConfig(static) { DEFINES *= WITH_STATIC }
 swiftConfig(assertsInRelease) { DEFINES *= QT_FORCE_ASSERTS }
+swiftConfig(tracing) { DEFINES *= BLACK_USE_TRACING }
 msvc { DEFINES *= BLACK_USE_CRASHPAD }
 macos { DEFINES *= BLACK_USE_CRASHPAD }
@@ -55,6 +55,22 @@ int main(int argc, char *argv[])
         qtout << "6e .. string utils vs.regex" << Qt::endl;
         qtout << "6f .. string concatenation (+=, arg, ..)" << Qt::endl;
         qtout << "6g .. const &QString vs. QStringLiteral" << Qt::endl;
+        qtout << "6h .. FSD aircraft config parsing (JSON merge vs. incremental parser)" << Qt::endl;
+        qtout << "6i .. Model set building and validation (30k models)" << Qt::endl;
+        qtout << "6j .. Interned callsigns, per callsign maps (1000 aircraft)" << Qt::endl;
+        qtout << "6k .. Sorting model set / aircraft views by column (keys vs. compare)" << Qt::endl;
+        qtout << "6l .. METAR decoding (regular expressions vs. single pass, 6000 reports)" << Qt::endl;
+        qtout << "6m .. VATSIM data file parsing (QJsonDocument vs. streaming vs. incremental)" << Qt::endl;
+        qtout << "6n .. File logging from 4 threads (synchronous vs. ring buffer, 200k messages)" << Qt::endl;
+        qtout << "6o .. Physical quantities in situation statistics (same unit vs. converted)" << Qt::endl;
+        qtout << "6p .. Closest/in range of 40k positions (linear vs. spatial index)" << Qt::endl;
+        qtout << "6q .. Filtering 30k models while typing (linear vs. filter index)" << Qt::endl;
+        qtout << "6r .. Model string and airport ICAO lookups (list vs. DB snapshot)" << Qt::endl;
+        qtout << "6s .. Trace zone overhead (no zone vs. disabled vs. enabled)" << Qt::endl;
+        qtout << "6t .. Cache file of 30k models and 40k airports (JSON DOM vs. streaming)" << Qt::endl;
+        qtout << "6u .. Model set of 30k models, resident memory per process (list vs. memory-mapped image)" << Qt::endl;
+        qtout << "6v .. Situation histories of 100/500/1500 aircraft (all vs. 50 rendered)" << Qt::endl;
+        qtout << "6w .. Relative distance and bearing of 300/40k objects (per object vs. batch)" << Qt::endl;
         qtout << "7 .. Algorithms" << Qt::endl;
         qtout << "8 .. File/Directory" << Qt::endl;
         qtout << "-----" << Qt::endl;
@@ -73,6 +89,22 @@ int main(int argc, char *argv[])
         else if (s.startsWith("6e")) { CSamplesPerformance::samplesStringUtilsVsRegEx(qtout); }
         else if (s.startsWith("6f")) { CSamplesPerformance::samplesStringConcat(qtout); }
         else if (s.startsWith("6g")) { CSamplesPerformance::samplesStringLiteralVsConstQString(qtout); }
+        else if (s.startsWith("6h")) { CSamplesPerformance::samplesAircraftPartsParsing(qtout); }
+        else if (s.startsWith("6i")) { CSamplesPerformance::samplesModelSetBuilding(qtout); }
+        else if (s.startsWith("6j")) { CSamplesPerformance::samplesInternedCallsigns(qtout); }
+        else if (s.startsWith("6k")) { CSamplesPerformance::samplesModelSorting(qtout); }
+        else if (s.startsWith("6l")) { CSamplesPerformance::samplesMetarDecoding(qtout); }
+        else if (s.startsWith("6m")) { CSamplesPerformance::samplesVatsimDataFileParsing(qtout); }
+        else if (s.startsWith("6n")) { CSamplesPerformance::samplesFileLogging(qtout); }
+        else if (s.startsWith("6o")) { CSamplesPerformance::samplesPhysicalQuantities(qtout); }
+        else if (s.startsWith("6p")) { CSamplesPerformance::samplesGeoIndex(qtout); }
+        else if (s.startsWith("6q")) { CSamplesPerformance::samplesModelFiltering(qtout); }
+        else if (s.startsWith("6r")) { CSamplesPerformance::samplesDbSnapshots(qtout); }
+        else if (s.startsWith("6s")) { CSamplesPerformance::samplesTracerOverhead(qtout); }
+        else if (s.startsWith("6t")) { CSamplesPerformance::samplesJsonStreaming(qtout); }
+        else if (s.startsWith("6u")) { CSamplesPerformance::samplesModelSetImage(qtout); }
+        else if (s.startsWith("6v")) { CSamplesPerformance::samplesSituationHistories(qtout); }
+        else if (s.startsWith("6w")) { CSamplesPerformance::samplesRelativePositions(qtout); }
         else if (s.startsWith("7"))  { CSamplesAlgorithm::samples(); }
         else if (s.startsWith("8"))  { CSamplesFile::samples(qtout); }
         else if (s.startsWith("x"))  { break; }
@@ -11,26 +11,61 @@
 
 #include "samplesperformance.h"
 #include "blackcore/db/databasereader.h"
+#include "blackcore/modelsetbuilder.h"
+#include "blackcore/vatsim/vatsimdatafileparser.h"
+#include "blackgui/models/aircraftmodelfilter.h"
+#include "blackgui/models/aircraftmodelfilterindex.h"
+#include "blackgui/models/aircraftmodellistmodel.h"
+#include "blackgui/models/simulatedaircraftlistmodel.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
 #include "blackmisc/simulation/distributorlist.h"
+#include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
 #include "blackmisc/aviation/aircrafticaocodelist.h"
+#include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/aircraftpartsdelta.h"
 #include "blackmisc/aviation/aircraftsituation.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/airportlist.h"
 #include "blackmisc/aviation/altitude.h"
 #include "blackmisc/aviation/atcstation.h"
 #include "blackmisc/aviation/atcstationlist.h"
 #include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/flightplan.h"
 #include "blackmisc/aviation/liverylist.h"
+#include "blackmisc/weather/metardecoder.h"
+#include "blackmisc/weather/metarlist.h"
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/coordinategeodeticlist.h"
+#include "blackmisc/geo/geoindex.h"
 #include "blackmisc/math/mathutils.h"
+#include "blackmisc/pq/frequency.h"
+#include "blackmisc/pq/speed.h"
 #include "blackmisc/pq/units.h"
+#include "blackmisc/network/user.h"
 #include "blackmisc/test/testing.h"
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/directoryutils.h"
 #include "blackmisc/stringutils.h"
-
+#include "blackmisc/variantmap.h"
+#include "blackmisc/json.h"
+#include "blackmisc/fileutils.h"
+#include "blackmisc/internedstring.h"
+#include "blackmisc/jsonstreamreader.h"
+#include "blackmisc/jsonstreamwriter.h"
+#include "blackmisc/parallel.h"
+#include "blackmisc/processinfo.h"
+#include "blackmisc/filelogger.h"
+#include "blackmisc/logcategories.h"
+#include "blackmisc/tracer.h"
+
+#include <QBuffer>
 #include <QDateTime>
 #include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QList>
 #include <QRegExp>
 #include <QRegularExpression>
@@ -38,13 +73,23 @@
 #include <QString>
 #include <QStringList>
 #include <QStringBuilder>
+#include <QTemporaryDir>
+#include <QTemporaryFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
 #include <QTextStream>
 #include <QElapsedTimer>
 #include <QVector>
 #include <Qt>
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
 #include <iterator>
+#include <vector>
 
+using namespace BlackCore;
 using namespace BlackMisc;
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::Geo;
@@ -53,7 +98,10 @@ using namespace BlackMisc::Network;
 using namespace BlackMisc::PhysicalQuantities;
 using namespace BlackMisc::Simulation;
 using namespace BlackMisc::Test;
+using namespace BlackMisc::Weather;
 using namespace BlackCore::Db;
+using namespace BlackCore::Vatsim;
+using namespace BlackGui::Models;
 
 namespace BlackSample
 {
@@ -668,6 +716,222 @@ namespace BlackSample
         return EXIT_SUCCESS;
     }
 
+    int CSamplesPerformance::samplesAircraftPartsParsing(QTextStream &out)
+    {
+        // typical traffic: one full packet, followed by incremental changes
+        const QStringList packets(
+        {
+            R"({"config":{"is_full_data":true,"lights":{"strobe_on":false,"landing_on":false,"taxi_on":true,"beacon_on":true,"nav_on":true,"logo_on":true},"gear_down":true,"flaps_pct":0,"spoilers_out":false,"engines":{"1":{"on":true},"2":{"on":true}},"on_ground":true}})",
+            R"({"config":{"lights":{"taxi_on":false,"landing_on":true}}})",
+            R"({"config":{"flaps_pct":20}})",
+            R"({"config":{"lights":{"strobe_on":true}}})",
+            R"({"config":{"on_ground":false}})",
+            R"({"config":{"gear_down":false}})",
+            R"({"config":{"flaps_pct":0,"lights":{"landing_on":false}}})",
+            R"({"config":{"engines":{"2":{"on":false}}}})"
+        });
+        const int loop = 25000;
+
+        QElapsedTimer time;
+        time.start();
+        CAircraftParts jsonParts;
+        for (int i = 0; i < loop; i++)
+        {
+            for (const QString &packet : packets)
+            {
+                const QJsonDocument doc = QJsonDocument::fromJson(packet.toUtf8());
+                const QJsonObject config = doc.object().value("config").toObject();
+                if (config.value(CAircraftParts::attributeNameIsFullJson()).toBool())
+                {
+                    jsonParts = CAircraftParts();
+                    jsonParts.convertFromJson(config);
+                }
+                else
+                {
+                    jsonParts.convertFromJson(Json::applyIncrementalObject(jsonParts.toJson(), config));
+                }
+            }
+        }
+        const qint64 jsonMs = time.elapsed();
+        out << "JSON document and merge, " << loop * packets.size() << " packets: " << jsonMs << "ms" << Qt::endl;
+
+        time.start();
+        CAircraftParts deltaParts;
+        for (int i = 0; i < loop; i++)
+        {
+            for (const QString &packet : packets)
+            {
+                const CAircraftPartsDelta delta = CAircraftPartsDelta::fromPacket(packet);
+                if (delta.isFullData()) { deltaParts = CAircraftParts(); }
+                delta.applyTo(deltaParts);
+            }
+        }
+        const qint64 deltaMs = time.elapsed();
+        out << "incremental parser,     " << loop * packets.size() << " packets: " << deltaMs << "ms" << Qt::endl;
+        out << "same result: " << boolToYesNo(jsonParts == deltaParts) << Qt::endl;
+
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesModelSetBuilding(QTextStream &out)
+    {
+        const int numberOfModels = 30000;
+        const int numberOfFiles = 3000;
+        CAircraftModelList models = CSamplesPerformance::createModels(numberOfModels, 100);
+        CDistributorList distributors;
+        for (int i = 0; i < 100; i += 2) { distributors.push_back(CDistributor(QString::number(i), "Foo", {}, {}, CSimulatorInfo::FSX)); }
+        distributors.resetOrder();
+
+        // every 10th model is in a file, some files are missing
+        QTemporaryDir dir;
+        if (!dir.isValid()) { out << "No temp.directory" << Qt::endl; return EXIT_FAILURE; }
+        for (int i = 0; i < numberOfFiles; i++)
+        {
+            const QString fn = CFileUtils::appendFilePaths(dir.path(), QStringLiteral("aircraft%1.cfg").arg(i));
+            if (i % 50 != 0) { CFileUtils::writeStringToFile(QStringLiteral("[fltsim.0]"), fn); }
+        }
+        for (int i = 0; i < models.size(); i++)
+        {
+            models[i].setFileName(CFileUtils::appendFilePaths(dir.path(), QStringLiteral("aircraft%1.cfg").arg(i % numberOfFiles)));
+        }
+        out << "Models: " << models.size() << ", files: " << numberOfFiles << ", threads: " << CParallel::maxThreads() << Qt::endl;
+
+        // former sequential steps of the model set builder
+        QElapsedTimer time;
+        time.start();
+        CAircraftModelList sequentialSet = models.findByDistributors(distributors);
+        sequentialSet = sequentialSet.findWithKnownAircraftDesignator();
+        sequentialSet = sequentialSet.matchesSimulator(CSimulatorInfo::fsx());
+        sequentialSet.setModelMode(CAircraftModel::Include);
+        sequentialSet.resetOrder();
+        sequentialSet.updateDistributorOrder(distributors);
+        sequentialSet.sortBy(&CAircraftModel::getDistributorOrder);
+        out << "sequential filter and distributor order: " << time.elapsed() << "ms" << Qt::endl;
+
+        time.start();
+        CModelSetBuilder builder;
+        const CAircraftModelList parallelSet = builder.buildModelSet(CSimulatorInfo::fsx(), models, {}, CModelSetBuilder::GivenDistributorsOnly | CModelSetBuilder::SortByDistributors, distributors);
+        out << "parallel filter and distributor order:   " << time.elapsed() << "ms" << Qt::endl;
+        out << builder.getLastStageTimingsInfo() << Qt::endl;
+        out << "same models: " << boolToYesNo(sequentialSet.getModelStringSet() == parallelSet.getModelStringSet()) << Qt::endl;
+
+        // the former DB consolidation looked up each model by copying and scanning the DB models
+        const int lookups = 500;
+        time.start();
+        int found = 0;
+        for (int i = 0; i < lookups; i++)
+        {
+            const CAircraftModelList dbModels(models); // copy as done by the web data services
+            if (dbModels.findFirstByModelStringOrDefault(QString::number(numberOfModels - 1 - i)).hasModelString()) { found++; }
+        }
+        const qint64 linearMs = time.elapsed();
+        out << "DB model lookup by scan, " << lookups << " models: " << linearMs << "ms, extrapolated " << numberOfModels << " models: " << (linearMs * numberOfModels / lookups) << "ms" << Qt::endl;
+
+        // file existence checks
+        time.start();
+        int existing = 0;
+        for (const CAircraftModel &model : std::as_const(models))
+        {
+            if (model.hasExistingCorrespondingFile()) { existing++; }
+        }
+        out << "sequential file checks: " << time.elapsed() << "ms, existing " << existing << Qt::endl;
+
+        time.start();
+        CAircraftModelList valid;
+        CAircraftModelList invalid;
+        std::atomic_bool stopped { false };
+        models.validateFiles(valid, invalid, false, -1, stopped, {}, false);
+        out << "parallel file validation: " << time.elapsed() << "ms, valid " << valid.size() << " invalid " << invalid.size() << Qt::endl;
+
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesInternedCallsigns(QTextStream &out)
+    {
+        const int numberOfAircraft = 1000;
+        const int numberOfMaps = 8; // situations, parts, last modified, offsets, log messages ... in the remote aircraft provider
+        const int updates = 200;    // packets per aircraft
+
+        // every packet creates its own callsign string, as done by the FSD parser
+        const auto callsignString = [](int i) { return QStringLiteral("DLH%1").arg(1000 + i); };
+
+        const int internedBefore = CInternedString::getInternedCount();
+        qint64 memoryBefore = CProcessInfo::currentProcessResidentMemoryBytes();
+        QVector<QHash<QString, int>> stringMaps(numberOfMaps);
+        for (QHash<QString, int> &map : stringMaps)
+        {
+            for (int i = 0; i < numberOfAircraft; i++) { map.insert(callsignString(i), i); }
+        }
+        const qint64 stringMapsBytes = CProcessInfo::currentProcessResidentMemoryBytes() - memoryBefore;
+
+        memoryBefore = CProcessInfo::currentProcessResidentMemoryBytes();
+        QVector<QHash<CCallsign, int>> callsignMaps(numberOfMaps);
+        for (QHash<CCallsign, int> &map : callsignMaps)
+        {
+            for (int i = 0; i < numberOfAircraft; i++) { map.insert(CCallsign(callsignString(i)), i); }
+        }
+        const qint64 callsignMapsBytes = CProcessInfo::currentProcessResidentMemoryBytes() - memoryBefore;
+        out << "Maps " << numberOfMaps << " x " << numberOfAircraft << " aircraft, resident memory QString keys: " << stringMapsBytes / 1024 << "kB, interned callsign keys: " << callsignMapsBytes / 1024 << "kB" << Qt::endl;
+        out << "Interned callsigns: " << (CInternedString::getInternedCount() - internedBefore) << ", intern table: " << CInternedString::getInternedBytes() / 1024 << "kB (all strings)" << Qt::endl;
+
+        // lookup in all maps per packet
+        QElapsedTimer time;
+        time.start();
+        qint64 sum = 0;
+        for (int u = 0; u < updates; u++)
+        {
+            for (int i = 0; i < numberOfAircraft; i++)
+            {
+                const QString cs = callsignString(i).trimmed().toUpper();
+                for (const QHash<QString, int> &map : std::as_const(stringMaps)) { sum += map.value(cs); }
+            }
+        }
+        out << "QString keys, " << updates * numberOfAircraft << " packets x " << numberOfMaps << " lookups: " << time.elapsed() << "ms" << Qt::endl;
+
+        time.start();
+        for (int u = 0; u < updates; u++)
+        {
+            for (int i = 0; i < numberOfAircraft; i++)
+            {
+                const CCallsign cs(callsignString(i));
+                for (const QHash<CCallsign, int> &map : std::as_const(callsignMaps)) { sum -= map.value(cs); }
+            }
+        }
+        out << "callsign keys,  " << updates * numberOfAircraft << " packets x " << numberOfMaps << " lookups: " << time.elapsed() << "ms" << Qt::endl;
+
+        // pure lookups, callsign already parsed
+        QVector<QString> strings;
+        QVector<CCallsign> callsigns;
+        for (int i = 0; i < numberOfAircraft; i++)
+        {
+            strings.push_back(callsignString(i));
+            callsigns.push_back(CCallsign(strings.back()));
+        }
+
+        time.start();
+        for (int u = 0; u < updates; u++)
+        {
+            for (const QString &cs : std::as_const(strings))
+            {
+                for (const QHash<QString, int> &map : std::as_const(stringMaps)) { sum += map.value(cs); }
+            }
+        }
+        out << "QString keys, lookups only: " << time.elapsed() << "ms" << Qt::endl;
+
+        time.start();
+        for (int u = 0; u < updates; u++)
+        {
+            for (const CCallsign &cs : std::as_const(callsigns))
+            {
+                for (const QHash<CCallsign, int> &map : std::as_const(callsignMaps)) { sum -= map.value(cs); }
+            }
+        }
+        out << "callsign keys, lookups only: " << time.elapsed() << "ms" << Qt::endl;
+        out << "same values: " << boolToYesNo(sum == 0) << Qt::endl;
+
+        return EXIT_SUCCESS;
+    }
+
     CAircraftSituationList CSamplesPerformance::createSituations(qint64 baseTimeEpoch, int numberOfCallsigns, int numberOfTimes)
     {
         CAircraftSituationList situations;
@@ -685,6 +949,734 @@ namespace BlackSample
         return situations;
     }
 
+    namespace
+    {
+        //! Sort all sortable columns, by keys and by comparing objects
+        template <class Model>
+        void sortColumns(QTextStream &out, Model &model, const typename Model::ContainerType &container)
+        {
+            QElapsedTimer time;
+            const CColumns &columns = model.getColumns();
+            for (int column = 0; column < columns.size(); column++)
+            {
+                if (!columns.isSortable(column)) { continue; }
+                model.setSortWithKeys(false);
+                time.start();
+                const auto byCompare = model.sortContainerByColumn(container, column, Qt::AscendingOrder);
+                const qint64 compareMs = time.elapsed();
+
+                model.setSortWithKeys(true);
+                time.start();
+                const auto byKeys = model.sortContainerByColumn(container, column, Qt::AscendingOrder);
+                const qint64 keysMs = time.elapsed();
+
+                out << "  " << columns.columnToName(column).leftJustified(25) << " compare: " << compareMs << "ms keys: " << keysMs << "ms" <<
+                    (byCompare.size() == byKeys.size() ? "" : " size mismatch") << Qt::endl;
+            }
+        }
+    }
+
+    int CSamplesPerformance::samplesModelSorting(QTextStream &out)
+    {
+        const CAircraftModelList models = CSamplesPerformance::createModels(15000, 100);
+        CAircraftModelListModel modelSetModel(CAircraftModelListModel::OwnModelSet);
+        out << "Model set view, " << models.size() << " models" << Qt::endl;
+        sortColumns(out, modelSetModel, models);
+
+        const CCoordinateGeodetic ownPosition(50.0, 8.0, 1000.0);
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < 1500; i++)
+        {
+            const CCallsign cs(QStringLiteral("DLH%1").arg(i));
+            CAircraftSituation situation(cs, CCoordinateGeodetic(40.0 + CMathUtils::randomDouble(20.0), CMathUtils::randomDouble(20.0), CMathUtils::randomDouble(40000.0)));
+            aircraft.push_back(CSimulatedAircraft(cs, models[i], CUser("1", "Pilot", cs), situation));
+        }
+        aircraft.calculcateAndUpdateRelativeDistanceAndBearing(ownPosition);
+        CSimulatedAircraftListModel aircraftModel;
+        out << "Aircraft in range view, " << aircraft.size() << " aircraft" << Qt::endl;
+        sortColumns(out, aircraftModel, aircraft);
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesMetarDecoding(QTextStream &out)
+    {
+        // the recorded file repeated to about the size of the worldwide METAR file
+        const QStringList recorded = CFileUtils::readFileToString(CSwiftDirectories::testFilesDirectory(), "metars.txt").split('\n', Qt::SkipEmptyParts);
+        if (recorded.isEmpty())
+        {
+            out << "No METAR test file in " << CSwiftDirectories::testFilesDirectory() << Qt::endl;
+            return EXIT_FAILURE;
+        }
+        QStringList metars;
+        while (metars.size() < 6000) { metars.append(recorded); }
+
+        const CMetarDecoder decoder;
+        QElapsedTimer time;
+        time.start();
+        int validRegExp = 0;
+        for (const QString &metar : std::as_const(metars))
+        {
+            if (decoder.decodeWithRegularExpressions(metar).hasMessage()) { validRegExp++; }
+        }
+        const qint64 regExpMs = time.elapsed();
+
+        time.start();
+        int validSinglePass = 0;
+        for (const QString &metar : std::as_const(metars))
+        {
+            if (decoder.decode(metar).hasMessage()) { validSinglePass++; }
+        }
+        const qint64 singlePassMs = time.elapsed();
+
+        time.start();
+        const CMetarList decoded = decoder.decodeAll(metars);
+        const qint64 parallelMs = time.elapsed();
+
+        out << "METARs: " << metars.size() << ", valid: " << validRegExp << " " << validSinglePass << " " << decoded.size() << Qt::endl;
+        out << "regular expressions: " << regExpMs << "ms, " << (regExpMs > 0 ? metars.size() * 1000 / regExpMs : 0) << " reports/s" << Qt::endl;
+        out << "single pass:         " << singlePassMs << "ms, " << (singlePassMs > 0 ? metars.size() * 1000 / singlePassMs : 0) << " reports/s" << Qt::endl;
+        out << "single pass, " << CParallel::maxThreads() << " threads: " << parallelMs << "ms, " << (parallelMs > 0 ? metars.size() * 1000 / parallelMs : 0) << " reports/s" << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesVatsimDataFileParsing(QTextStream &out)
+    {
+        // a recorded file if available, otherwise a synthesized one of the same size
+        QByteArray first = CFileUtils::readFileToString(CSwiftDirectories::testFilesDirectory(), "vatsim-data.json").toUtf8();
+        if (first.isEmpty()) { first = createVatsimDataFile(0); }
+        const QByteArray second = createVatsimDataFile(1);
+        const int times = 10;
+
+        // QJsonDocument DOM, all entries decoded as before
+        QElapsedTimer time;
+        time.start();
+        int domObjects = 0;
+        for (int t = 0; t < times; t++)
+        {
+            const QJsonDocument jsonDoc = QJsonDocument::fromJson(t % 2 ? second : first);
+            CSimulatedAircraftList aircraft;
+            for (const QJsonValue &value : jsonDoc["pilots"].toArray())
+            {
+                const QJsonObject pilot = value.toObject();
+                const CCallsign callsign(pilot["callsign"].toString());
+                const CUser user(pilot["cid"].toString(), pilot["name"].toString(), callsign);
+                const CCoordinateGeodetic position(pilot["latitude"].toDouble(), pilot["longitude"].toDouble(), pilot["altitude"].toInt());
+                const CAircraftSituation situation(callsign, position, CHeading(pilot["heading"].toInt(), CAngleUnit::deg()), {}, {}, CSpeed(pilot["groundspeed"].toInt(), CSpeedUnit::kts()));
+                aircraft.push_back(CSimulatedAircraft(callsign, user, situation));
+                aircraft.back().setAircraftIcaoCode(CFlightPlan::aircraftIcaoCodeFromEquipmentCode(pilot["flight_plan"]["aircraft"].toString().trimmed()));
+            }
+            CAtcStationList stations;
+            for (const QString section : { "controllers", "atis" })
+            {
+                for (const QJsonValue &value : jsonDoc[section].toArray())
+                {
+                    const QJsonObject controller = value.toObject();
+                    const CCallsign callsign(controller["callsign"].toString());
+                    const CUser user(controller["cid"].toString(), controller["name"].toString(), callsign);
+                    QStringList atis;
+                    for (const QJsonValue &line : controller["text_atis"].toArray()) { atis.push_back(line.toString()); }
+                    stations.push_back(CAtcStation(callsign, user, CFrequency(controller["frequency"].toString().toDouble(), CFrequencyUnit::kHz()), {},
+                                                   CLength(controller["visual_range"].toInt(), CLengthUnit::NM()), true, {}, {}, CInformationMessage(CInformationMessage::ATIS, atis.join('\n'))));
+                }
+            }
+            domObjects = aircraft.size() + stations.size();
+        }
+        const qint64 domMs = time.elapsed();
+
+        // streaming, a new parser each time, so all entries are decoded
+        time.start();
+        int streamingStrings = 0;
+        for (int t = 0; t < times; t++)
+        {
+            CVatsimDataFileParser parser;
+            parser.parse(t % 2 ? second : first);
+            streamingStrings = parser.getStringsDecoded();
+        }
+        const qint64 streamingMs = time.elapsed();
+
+        // incremental, alternating files like the periodic reads
+        CVatsimDataFileParser incremental;
+        incremental.parse(first);
+        time.start();
+        int created = 0;
+        int reused = 0;
+        int incrementalStrings = 0;
+        for (int t = 1; t <= times; t++)
+        {
+            incremental.parse(t % 2 ? second : first);
+            created = incremental.getCreatedObjects();
+            reused = incremental.getReusedObjects();
+            incrementalStrings = incremental.getStringsDecoded();
+        }
+        const qint64 incrementalMs = time.elapsed();
+
+        out << "VATSIM data file: " << first.size() / 1000 << "kB, " << incremental.getAircraft().size() << " pilots, " << incremental.getAtcStations().size() << " ATC stations, " << times << " parses" << Qt::endl;
+        out << "QJsonDocument: " << domMs << "ms, objects decoded: " << domObjects << Qt::endl;
+        out << "streaming:     " << streamingMs << "ms, objects decoded: " << domObjects << ", strings decoded: " << streamingStrings << Qt::endl;
+        out << "incremental:   " << incrementalMs << "ms, objects decoded: " << created << ", reused: " << reused << ", strings decoded: " << incrementalStrings << Qt::endl;
+        out << "changed aircraft: " << incremental.getChangedAircraft().size() << ", removed: " << incremental.getRemovedAircraft().size() << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesFileLogging(QTextStream &out)
+    {
+        constexpr int Threads = 4;
+        constexpr int PerThread = 50000;
+        const QStringList categories({ CLogCategories::network(), CLogCategories::driver(), CLogCategories::interpolator(), CLogCategories::matching() });
+
+        // logs from several threads, returns the caller side latency of each call in ns
+        const auto logFromThreads = [&](const std::function<void (const CStatusMessage &)> &log, qint64 &totalMs)
+        {
+            QVector<QVector<qint64>> latencies(Threads);
+            std::vector<QThread *> threads;
+            QElapsedTimer total;
+            total.start();
+            for (int t = 0; t < Threads; t++)
+            {
+                threads.push_back(QThread::create([&, t]
+                {
+                    QVector<qint64> &threadLatencies = latencies[t];
+                    threadLatencies.reserve(PerThread);
+                    QElapsedTimer call;
+                    for (int i = 0; i < PerThread; i++)
+                    {
+                        const CStatusMessage::StatusSeverity severity = i % 10 ? CStatusMessage::SeverityDebug : CStatusMessage::SeverityWarning;
+                        const CStatusMessage msg(CLogCategoryList(CLogCategory(categories.at(i % categories.size()))), severity, QStringLiteral("Message %1 of thread %2").arg(i).arg(t));
+                        call.start();
+                        log(msg);
+                        threadLatencies.push_back(call.nsecsElapsed());
+                    }
+                }));
+                threads.back()->start();
+            }
+            for (QThread *thread : threads)
+            {
+                thread->wait();
+                delete thread;
+            }
+            totalMs = qMax(total.elapsed(), 1LL);
+
+            QVector<qint64> all;
+            for (const QVector<qint64> &l : latencies) { all += l; }
+            std::sort(all.begin(), all.end());
+            return all;
+        };
+        const auto printResult = [&](const QString &name, qint64 totalMs, const QVector<qint64> &latencies)
+        {
+            out << name << (Threads * PerThread * 1000LL / totalMs) << " messages/s, latency p50 " << latencies.at(latencies.size() / 2)
+                << "ns, p99 " << latencies.at(latencies.size() * 99 / 100) << "ns, max " << latencies.last() / 1000 << "us" << Qt::endl;
+        };
+
+        // synchronous, formatted and written with endl by the calling thread as before
+        QTemporaryFile file;
+        file.open();
+        QTextStream stream(&file);
+        stream.setCodec("UTF-8");
+        QMutex mutex;
+        QString previousCategories;
+        qint64 syncMs = 0;
+        const QVector<qint64> syncLatencies = logFromThreads([&](const CStatusMessage &msg)
+        {
+            QMutexLocker lock(&mutex);
+            const QString cats = msg.getCategoriesAsString();
+            if (cats != previousCategories)
+            {
+                stream << u"\n[" % cats % u']' << Qt::endl;
+                previousCategories = cats;
+            }
+            stream << (QDateTime::currentDateTime().toString(QStringLiteral("hh:mm:ss ")) % msg.getSeverityAsString() % u": " % msg.getMessage()) << Qt::endl;
+        }, syncMs);
+
+        // ring buffer and writer thread
+        CFileLogger logger;
+        logger.changeLogPattern(CLogPattern().withSeverityAtOrAbove(CStatusMessage::SeverityDebug));
+        qint64 asyncMs = 0;
+        const QVector<qint64> asyncLatencies = logFromThreads([&](const CStatusMessage &msg) { logger.writeStatusMessageToFile(msg); }, asyncMs);
+        logger.close();
+
+        out << "File logging, " << Threads << " threads, " << Threads * PerThread << " messages, 10% warnings" << Qt::endl;
+        printResult("synchronous: ", syncMs, syncLatencies);
+        printResult("ring buffer: ", asyncMs, asyncLatencies);
+        out << "written: " << logger.getWrittenMessages() << ", dropped: " << logger.getDroppedMessages() << Qt::endl;
+        const QHash<QString, qint64> dropped = logger.getDroppedMessagesByCategory();
+        for (auto it = dropped.cbegin(); it != dropped.cend(); ++it) { out << "  dropped " << it.key() << ": " << it.value() << Qt::endl; }
+        out << "log file: " << CFileLogger::getLogFilePath() << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesPhysicalQuantities(QTextStream &out)
+    {
+        // 1000 aircraft with 6 situations each, as used for the situation change
+        constexpr int Aircraft = 1000;
+        constexpr int Situations = 6;
+        constexpr int Rounds = 50;
+
+        // values in the units the statistics are calculated in (ft, kts), and in units requiring conversions (m, km/h)
+        QList<CAircraftSituationList> sameUnit;
+        QList<CAircraftSituationList> otherUnit;
+        for (int a = 0; a < Aircraft; a++)
+        {
+            CAircraftSituationList same;
+            CAircraftSituationList other;
+            const CCallsign callsign("CS" + QString::number(a));
+            for (int s = 0; s < Situations; s++)
+            {
+                CAircraftSituation situation(callsign, CCoordinateGeodetic(a % 90, a % 180, 0));
+                situation.setMSecsSinceEpoch(DeltaTime * s);
+                situation.setAltitude(CAltitude(1000.0 + a + 10 * s, CAltitude::MeanSeaLevel, CLengthUnit::ft()));
+                situation.setGroundSpeed(CSpeed(100.0 + s, CSpeedUnit::kts()));
+                same.push_back(situation);
+
+                CAltitude altitude(situation.getAltitude());
+                altitude.switchUnit(CLengthUnit::m());
+                situation.setAltitude(altitude);
+                situation.setGroundSpeed(situation.getGroundSpeed().switchedUnit(CSpeedUnit::km_h()));
+                other.push_back(situation);
+            }
+            sameUnit.push_back(same);
+            otherUnit.push_back(other);
+        }
+
+        // statistics as in CAircraftSituationChange
+        const auto statistics = [](const QList<CAircraftSituationList> &lists)
+        {
+            double sum = 0;
+            for (int r = 0; r < Rounds; r++)
+            {
+                for (const CAircraftSituationList &situations : lists)
+                {
+                    sum += situations.altitudeStandardDeviationAndMean().second.value(CLengthUnit::ft());
+                    sum += situations.groundSpeedStandardDeviationAndMean().second.value(CSpeedUnit::kts());
+                }
+            }
+            return sum;
+        };
+
+        // comparisons and arithmetic as in the altitude/ground speed handling
+        const auto compare = [](const QList<CAircraftSituationList> &lists)
+        {
+            const CAltitude threshold(1500, CAltitude::MeanSeaLevel, CLengthUnit::ft());
+            const CSpeed slow(101, CSpeedUnit::kts());
+            int count = 0;
+            for (int r = 0; r < Rounds; r++)
+            {
+                for (const CAircraftSituationList &situations : lists)
+                {
+                    CLength delta(0, CLengthUnit::ft());
+                    for (const CAircraftSituation &situation : situations)
+                    {
+                        if (situation.getAltitude() > threshold) { count++; }
+                        if (situation.getGroundSpeed() < slow) { count++; }
+                        delta += situation.getAltitude() - threshold;
+                    }
+                    if (delta.isPositiveWithEpsilonConsidered()) { count++; }
+                }
+            }
+            return count;
+        };
+
+        QElapsedTimer time;
+        time.start();
+        const double sumSame = statistics(sameUnit);
+        const qint64 statisticsSameMs = time.elapsed();
+        time.start();
+        const double sumOther = statistics(otherUnit);
+        const qint64 statisticsOtherMs = time.elapsed();
+
+        time.start();
+        const int countSame = compare(sameUnit);
+        const qint64 compareSameMs = time.elapsed();
+        time.start();
+        const int countOther = compare(otherUnit);
+        const qint64 compareOtherMs = time.elapsed();
+
+        out << "Situations: " << Aircraft << "x" << Situations << ", rounds: " << Rounds << Qt::endl;
+        out << "statistics, same unit (ft, kts):   " << statisticsSameMs << "ms " << QString::number(sumSame, 'f', 0) << Qt::endl;
+        out << "statistics, converted (m, km/h):   " << statisticsOtherMs << "ms " << QString::number(sumOther, 'f', 0) << Qt::endl;
+        out << "comparisons, same unit (ft, kts):  " << compareSameMs << "ms " << countSame << Qt::endl;
+        out << "comparisons, converted (m, km/h):  " << compareOtherMs << "ms " << countOther << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesGeoIndex(QTextStream &out)
+    {
+        // about the number of airports in the DB
+        constexpr int Positions = 40000;
+        constexpr int Queries = 1000;
+        CCoordinateGeodeticList positions;
+        for (int i = 0; i < Positions; i++)
+        {
+            positions.push_back(CCoordinateGeodetic(CMathUtils::randomDouble(180.0) - 90.0, CMathUtils::randomDouble(360.0) - 180.0, 0));
+        }
+        CCoordinateGeodeticList references;
+        for (int i = 0; i < Queries; i++)
+        {
+            references.push_back(CCoordinateGeodetic(CMathUtils::randomDouble(180.0) - 90.0, CMathUtils::randomDouble(360.0) - 180.0, 0));
+        }
+        const CLength range(100, CLengthUnit::NM());
+
+        QElapsedTimer time;
+        time.start();
+        const CGeoObjectIndex<CCoordinateGeodetic, CCoordinateGeodeticList> index(positions);
+        const qint64 buildMs = time.elapsed();
+
+        int linearFound = 0;
+        time.start();
+        for (const CCoordinateGeodetic &reference : std::as_const(references)) { linearFound += positions.findClosest(20, reference).size(); }
+        const qint64 linearClosestMs = time.elapsed();
+
+        int indexFound = 0;
+        time.start();
+        for (const CCoordinateGeodetic &reference : std::as_const(references)) { indexFound += index.findClosest(20, reference).size(); }
+        const qint64 indexClosestMs = time.elapsed();
+
+        int linearInRange = 0;
+        time.start();
+        for (const CCoordinateGeodetic &reference : std::as_const(references)) { linearInRange += positions.findWithinRange(reference, range).size(); }
+        const qint64 linearRangeMs = time.elapsed();
+
+        int indexInRange = 0;
+        time.start();
+        for (const CCoordinateGeodetic &reference : std::as_const(references)) { indexInRange += index.findWithinRange(reference, range).size(); }
+        const qint64 indexRangeMs = time.elapsed();
+
+        out << "Positions: " << Positions << ", queries: " << Queries << ", index built in " << buildMs << "ms" << Qt::endl;
+        out << "closest 20, linear: " << linearClosestMs << "ms, index: " << indexClosestMs << "ms (" << linearFound << "/" << indexFound << ")" << Qt::endl;
+        out << "within " << range.valueRoundedWithUnit(0) << ", linear: " << linearRangeMs << "ms, index: " << indexRangeMs << "ms (" << linearInRange << "/" << indexInRange << ")" << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesModelFiltering(QTextStream &out)
+    {
+        const CAircraftModelList models = CSamplesPerformance::createModels(30000, 300);
+        QElapsedTimer time;
+        time.start();
+        const CAircraftModelFilterIndex index(models);
+        out << "Model filter index of " << models.size() << " models built in " << time.elapsed() << "ms" << Qt::endl;
+
+        // typing a model string and an aircraft ICAO code, one filter per keystroke
+        const QString modelKey("12345");
+        const QString aircraftIcao("A12");
+        qint64 linearMs = 0;
+        qint64 indexMs = 0;
+        for (int i = 1; i <= modelKey.length() + aircraftIcao.length(); i++)
+        {
+            const QString key = modelKey.left(i) + '*';
+            const QString icao = i > modelKey.length() ? QStringLiteral("*%1*").arg(aircraftIcao.left(i - modelKey.length())) : QString();
+            const CAircraftModelFilter filter(-1, key, {}, CAircraftModel::All, BlackMisc::Db::All, Qt::PartiallyChecked, Qt::PartiallyChecked,
+                                              icao, {}, {}, {}, {}, {}, {});
+            time.start();
+            const CAircraftModelList linear = filter.filter(models);
+            const qint64 keystrokeLinearMs = time.elapsed();
+            time.start();
+            const CAircraftModelList indexed = filter.filter(index);
+            const qint64 keystrokeIndexMs = time.elapsed();
+            linearMs += keystrokeLinearMs;
+            indexMs += keystrokeIndexMs;
+            out << "  '" << key << "' '" << icao << "' linear: " << keystrokeLinearMs << "ms index: " << keystrokeIndexMs << "ms, " << indexed.size() << " models" <<
+                (linear == indexed ? "" : " mismatch") << Qt::endl;
+        }
+        out << "Typing, linear: " << linearMs << "ms index: " << indexMs << "ms" << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesDbSnapshots(QTextStream &out)
+    {
+        constexpr int Queries = 2000;
+        const CAircraftModelList models = CSamplesPerformance::createModels(30000, 300);
+        CAirportList airports;
+        for (int i = 0; i < 40000; i++)
+        {
+            // AA00 .. ZZ59, unique codes
+            airports.push_back(CAirport(QString(QChar('A' + i % 26)) + QChar('A' + (i / 26) % 26) + QStringLiteral("%1").arg(i / 676, 2, 10, QChar('0'))));
+        }
+        QStringList modelStrings;
+        QStringList icaos;
+        for (int i = 0; i < Queries; i++)
+        {
+            modelStrings.push_back(models[CMathUtils::randomInteger(0, models.size() - 1)].getModelString());
+            icaos.push_back(airports[CMathUtils::randomInteger(0, airports.size() - 1)].getIcaoAsString());
+        }
+
+        QElapsedTimer time;
+        time.start();
+        const CAircraftModelSnapshot modelSnapshot(models, [](const CAircraftModel &model) { return model.getModelString(); });
+        const CAirportSnapshot airportSnapshot(airports, [](const CAirport &airport) { return airport.getIcaoAsString(); });
+        out << "Snapshots of " << models.size() << " models and " << airports.size() << " airports built in " << time.elapsed() << "ms" << Qt::endl;
+
+        int linearFound = 0;
+        time.start();
+        for (const QString &modelString : std::as_const(modelStrings)) { linearFound += models.findFirstByModelStringOrDefault(modelString).hasModelString(); }
+        const qint64 linearModelsMs = time.elapsed();
+
+        int snapshotFound = 0;
+        time.start();
+        for (const QString &modelString : std::as_const(modelStrings)) { snapshotFound += modelSnapshot.findByName(modelString).findFirstByModelStringOrDefault(modelString).hasModelString(); }
+        const qint64 snapshotModelsMs = time.elapsed();
+        out << Queries << " models by model string, list: " << linearModelsMs << "ms, snapshot: " << snapshotModelsMs << "ms (" << linearFound << "/" << snapshotFound << ")" << Qt::endl;
+
+        linearFound = 0;
+        time.start();
+        for (const QString &icao : std::as_const(icaos)) { linearFound += airports.findFirstByIcao(icao).hasValidIcaoCode(); }
+        const qint64 linearAirportsMs = time.elapsed();
+
+        snapshotFound = 0;
+        time.start();
+        for (const QString &icao : std::as_const(icaos)) { snapshotFound += airportSnapshot.findByName(icao).findFirstByIcao(icao).hasValidIcaoCode(); }
+        const qint64 snapshotAirportsMs = time.elapsed();
+        out << Queries << " airports by ICAO, list: " << linearAirportsMs << "ms, snapshot: " << snapshotAirportsMs << "ms (" << linearFound << "/" << snapshotFound << ")" << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesTracerOverhead(QTextStream &out)
+    {
+        constexpr int Runs = 10000000;
+        constexpr int EnabledRuns = 10000; // fits into the thread buffer
+        volatile double sink = 0;
+        const auto work = [&sink](int i) { sink = sink + std::sqrt(static_cast<double>(i)); };
+
+        // no zone, same as BLACK_TRACE_ZONE without BLACK_USE_TRACING
+        QElapsedTimer time;
+        time.start();
+        for (int i = 0; i < Runs; i++) { work(i); }
+        const qint64 baselineNs = time.nsecsElapsed();
+
+        // zone compiled in, tracing disabled
+        CTracer::setEnabled(false);
+        time.start();
+        for (int i = 0; i < Runs; i++) { const CTracer::Zone zone("sample", "sample"); work(i); }
+        const qint64 disabledNs = time.nsecsElapsed();
+
+        // tracing enabled, all zones and every 100th zone
+        CTracer::clear();
+        CTracer::setEnabled(true);
+        time.start();
+        for (int i = 0; i < EnabledRuns; i++) { const CTracer::Zone zone("sample", "sample"); work(i); }
+        const qint64 enabledNs = time.nsecsElapsed();
+
+        CTracer::setSamplingInterval(100);
+        time.start();
+        for (int i = 0; i < Runs; i++) { const CTracer::Zone zone("sample", "sample"); work(i); }
+        const qint64 sampledNs = time.nsecsElapsed();
+        CTracer::setEnabled(false);
+        CTracer::setSamplingInterval(1);
+
+        time.start();
+        const QJsonObject trace = CTracer::toChromeTrace();
+        const qint64 exportMs = time.elapsed();
+
+        out << Runs << " runs, no zone: " << baselineNs / 1000000 << "ms, zone disabled: " << disabledNs / 1000000 << "ms, "
+            << "overhead " << static_cast<double>(disabledNs - baselineNs) / Runs << "ns/zone" << Qt::endl;
+        out << EnabledRuns << " runs, zone enabled: " << static_cast<double>(enabledNs) / EnabledRuns << "ns/run" << Qt::endl;
+        out << Runs << " runs, every 100th zone: " << sampledNs / 1000000 << "ms, " << static_cast<double>(sampledNs) / Runs << "ns/run" << Qt::endl;
+        out << "Exported " << trace.value("traceEvents").toArray().size() << " events in " << exportMs << "ms, dropped " << trace.value("otherData").toObject().value("droppedEvents").toInt() << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesJsonStreaming(QTextStream &out)
+    {
+        CAirportList airports;
+        for (int i = 0; i < 40000; i++)
+        {
+            airports.push_back(CAirport(QString(QChar('A' + i % 26)) + QChar('A' + (i / 26) % 26) + QStringLiteral("%1").arg(i / 676, 2, 10, QChar('0'))));
+        }
+        const CVariantMap values
+        {
+            { "models", CVariant::from(CSamplesPerformance::createModels(30000, 300)) },
+            { "airports", CVariant::from(airports) }
+        };
+
+        // like the value cache writes its files
+        QElapsedTimer time;
+        time.start();
+        const QByteArray domJson = QJsonDocument(values.toMemoizedJson()).toJson();
+        const qint64 domWriteMs = time.elapsed();
+
+        QByteArray streamJson;
+        time.start();
+        {
+            QBuffer buffer(&streamJson);
+            buffer.open(QIODevice::WriteOnly);
+            CJsonStreamWriter writer(&buffer);
+            values.writeMemoizedJson(writer);
+        }
+        const qint64 streamWriteMs = time.elapsed();
+        out << "Written, DOM: " << domWriteMs << "ms " << domJson.size() << " bytes, streaming: " << streamWriteMs << "ms " << streamJson.size() << " bytes" << Qt::endl;
+
+        CVariantMap domValues;
+        time.start();
+        domValues.convertFromMemoizedJsonNoThrow(QJsonDocument::fromJson(streamJson).object(), {}, {});
+        const qint64 domReadMs = time.elapsed();
+
+        CVariantMap streamValues;
+        time.start();
+        CJsonStreamReader reader(streamJson);
+        reader.readNext();
+        streamValues.readMemoizedJsonNoThrow(reader, {}, {});
+        const qint64 streamReadMs = time.elapsed();
+        out << "Read, DOM: " << domReadMs << "ms, streaming: " << streamReadMs << "ms" << (domValues == streamValues && domValues.size() == values.size() ? "" : " mismatch") << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesModelSetImage(QTextStream &out)
+    {
+        constexpr int Queries = 1000;
+        const QTemporaryDir dir;
+        const QString fileName = dir.filePath("modelset.modelsetimage");
+
+        // like loaded from the model set cache
+        const qint64 baselineBytes = CProcessInfo::currentProcessResidentMemoryBytes();
+        CAircraftModelList models;
+        models.convertFromMemoizedJson(CSamplesPerformance::createModels(30000, 300).toMemoizedJson());
+        const qint64 listBytes = CProcessInfo::currentProcessResidentMemoryBytes() - baselineBytes;
+
+        QElapsedTimer time;
+        time.start();
+        const CStatusMessage msg = CAircraftModelSetImage::writeImage(models, CSimulatorInfo::fsx(), QDateTime::currentMSecsSinceEpoch(), fileName);
+        out << msg.getMessage() << " in " << time.elapsed() << "ms" << Qt::endl;
+        if (msg.isFailure()) { return EXIT_FAILURE; }
+
+        // pages of the mapped file, shared by all processes mapping the image
+        const qint64 beforeMappingBytes = CProcessInfo::currentProcessResidentMemoryBytes();
+        time.start();
+        const CAircraftModelSetImage image(fileName);
+        int characters = 0;
+        for (int i = 0; i < image.size(); ++i)
+        {
+            const CAircraftModelImageView view = image.at(i);
+            characters += view.getModelString().size() + view.getName().size() + view.getAircraftIcaoCodeDesignator().size() + view.getLiveryCombinedCode().size();
+        }
+        const qint64 mapMs = time.elapsed();
+        const qint64 imageBytes = CProcessInfo::currentProcessResidentMemoryBytes() - beforeMappingBytes;
+        out << "Resident memory, list: " << listBytes / 1024 << "KB, image: " << imageBytes / 1024 << "KB of " << image.getMappedBytes() / 1024 << "KB mapped"
+            << " (mapped and all views read in " << mapMs << "ms, " << characters << " characters)" << Qt::endl;
+
+        // per process: before, core (matcher) and GUI (view) each held a full list,
+        // now both map the image, the core materializes the matching candidates, the GUI the displayed rows
+        const QString icao = models.front().getAircraftIcaoCodeDesignator();
+        const qint64 beforeCandidatesBytes = CProcessInfo::currentProcessResidentMemoryBytes();
+        QVector<CAircraftModelImageView> candidateViews;
+        for (int i = 0; i < image.size(); ++i)
+        {
+            const CAircraftModelImageView view = image.at(i);
+            if (view.getAircraftIcaoCodeDesignator().compare(icao, Qt::CaseInsensitive) == 0) { candidateViews.push_back(view); }
+        }
+        const CAircraftModelList candidates = CAircraftModelSetImage::toAircraftModelList(candidateViews);
+        const qint64 candidatesBytes = CProcessInfo::currentProcessResidentMemoryBytes() - beforeCandidatesBytes;
+
+        constexpr int VisibleRows = 50;
+        const qint64 beforeRowsBytes = CProcessInfo::currentProcessResidentMemoryBytes();
+        QStringList cells;
+        for (int i = 0; i < VisibleRows && i < image.size(); ++i)
+        {
+            const CAircraftModelImageView view = image.at(i);
+            cells << view.getModelString().toString() << view.getAircraftIcaoCodeDesignator().toString() << view.getLiveryCombinedCode().toString() << view.getName().toString();
+        }
+        const CAircraftModel selected = image.at(0).toAircraftModel();
+        const qint64 rowsBytes = CProcessInfo::currentProcessResidentMemoryBytes() - beforeRowsBytes;
+        out << "Resident memory per process, before: core " << listBytes / 1024 << "KB, GUI " << listBytes / 1024 << "KB" << Qt::endl;
+        out << "Resident memory per process, after: core " << (imageBytes + candidatesBytes) / 1024 << "KB (" << candidates.size() << " '" << icao << "' candidates), GUI "
+            << (imageBytes + rowsBytes) / 1024 << "KB (" << VisibleRows << " rows, " << cells.size() << " cells, '" << selected.getModelString() << "' selected)"
+            << ", of which " << imageBytes / 1024 << "KB image pages are shared" << Qt::endl;
+
+        QStringList modelStrings;
+        for (int i = 0; i < Queries; i++) { modelStrings.push_back(models[CMathUtils::randomInteger(0, models.size() - 1)].getModelString().toLower()); }
+        int found = 0;
+        time.start();
+        for (const QString &modelString : std::as_const(modelStrings)) { found += models.containsModelString(modelString); }
+        const qint64 listMs = time.elapsed();
+        time.start();
+        for (const QString &modelString : std::as_const(modelStrings)) { found += image.findByModelString(modelString).toAircraftModel().hasModelString(); }
+        const qint64 imageMs = time.elapsed();
+        out << Queries << " model strings, list: " << listMs << "ms, image (materialized): " << imageMs << "ms (" << found << "/" << 2 * Queries << ")" << Qt::endl;
+
+        time.start();
+        const CAircraftModelList materialized = image.toAircraftModelList();
+        out << "Materialized " << materialized.size() << " models in " << time.elapsed() << "ms" << (materialized == models ? "" : " mismatch") << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesSituationHistories(QTextStream &out)
+    {
+        constexpr int Updates = 60;  // 5 minutes of slow position updates
+        constexpr int Rendered = 50; // typical max. number of rendered aircraft
+        for (int numberOfAircraft : { 100, 500, 1500 })
+        {
+            for (bool allRendered : { true, false })
+            {
+                CRemoteAircraftProviderDummy provider;
+                provider.enableReverseLookupMessages(RevLogEnabledSimplified);
+                const qint64 startMs = QDateTime::currentMSecsSinceEpoch() - Updates * 5000;
+                QElapsedTimer time;
+                time.start();
+                for (int a = 0; a < numberOfAircraft; a++)
+                {
+                    const CCallsign cs(QStringLiteral("SWIFT%1").arg(a));
+                    CSimulatedAircraft aircraft(cs, CUser("123456", "Joe Doe"), CAircraftSituation(cs));
+                    aircraft.setRendered(allRendered || a < Rendered);
+                    provider.insertNewAircraft(aircraft);
+                    for (int m = 0; m < 20; m++) { provider.addReverseLookupMessage(cs, QStringLiteral("Reverse lookup step %1 of aircraft %2").arg(m).arg(cs.asString())); }
+                    for (int i = 0; i < Updates; i++)
+                    {
+                        const qint64 ts = startMs + i * 5000;
+                        CAircraftSituation situation(cs, CCoordinateGeodetic(40.0 + CMathUtils::randomDouble(20.0), CMathUtils::randomDouble(20.0), CMathUtils::randomDouble(40000.0)));
+                        situation.setMSecsSinceEpoch(ts);
+                        situation.setTimeOffsetMs(6000);
+                        provider.insertNewSituation(situation);
+
+                        CAircraftParts parts(i % 100);
+                        parts.setMSecsSinceEpoch(ts);
+                        parts.setTimeOffsetMs(6000);
+                        provider.insertNewAircraftParts(cs, parts, false);
+                    }
+                }
+                out << numberOfAircraft << " aircraft, " << (allRendered ? "all" : QString::number(Rendered)) << " rendered, " << time.elapsed() << "ms" << Qt::endl;
+                out << provider.getHistoryStatisticsInfo(", ") << Qt::endl;
+            }
+        }
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesRelativePositions(QTextStream &out)
+    {
+        constexpr int Repetitions = 20;
+        const CCoordinateGeodetic position(48.353783, 11.786086, 1500.0);
+        for (int number : { 300, 40000 })
+        {
+            CAtcStationList stations;
+            for (int i = 0; i < number; i++)
+            {
+                CAtcStation station(QStringLiteral("STATION%1_TWR").arg(i));
+                station.setPosition(CCoordinateGeodetic(CMathUtils::randomDouble(178.0) - 89.0, CMathUtils::randomDouble(358.0) - 179.0, 0.0));
+                stations.push_back(station);
+            }
+
+            QElapsedTimer time;
+            time.start();
+            for (int r = 0; r < Repetitions; r++)
+            {
+                for (CAtcStation &station : stations) { station.calculcateAndUpdateRelativeDistanceAndBearing(position); }
+            }
+            const qint64 perObjectNs = time.nsecsElapsed() / Repetitions;
+            const CAtcStationList perObject = stations;
+
+            time.start();
+            for (int r = 0; r < Repetitions; r++)
+            {
+                stations.calculcateAndUpdateRelativeDistanceAndBearing(position);
+            }
+            const qint64 batchNs = time.nsecsElapsed() / Repetitions;
+
+            double maxDeviationM = 0;
+            for (int i = 0; i < number; i++)
+            {
+                maxDeviationM = std::max(maxDeviationM, std::abs(perObject[i].getRelativeDistance().value(CLengthUnit::m()) - stations[i].getRelativeDistance().value(CLengthUnit::m())));
+            }
+            out << number << " objects, per object " << perObjectNs / 1000 << "us, batch " << batchNs / 1000 << "us, max. deviation " << maxDeviationM << "m" << Qt::endl;
+        }
+        return EXIT_SUCCESS;
+    }
+
     CAircraftModelList CSamplesPerformance::createModels(int numberOfModels, int numberOfMemoParts)
     {
         CAircraftIcaoCodeList aircraftIcaos;
@@ -709,6 +1701,50 @@ namespace BlackSample
         return models;
     }
 
+    QByteArray CSamplesPerformance::createVatsimDataFile(int revision)
+    {
+        static const QStringList aircraftTypes({ "H/A388/L", "B738/M-SDE2E3FGHIRWY/LB1", "A320/M-SDE2E3FGHIJ1RWXY/LB1", "C172/L-G/C", "H/B77W/L", "E190/M-SDFGHIRWY/S" });
+        QByteArray json;
+        json.reserve(4000000);
+        json += "{\"general\": {\"version\": 3, \"reload\": 1, \"update\": \"2021060110000" + QByteArray::number(revision) +
+                "\", \"update_timestamp\": \"2021-06-01T10:00:" + QByteArray::number(10 + revision) + ".1234567Z\", \"connected_clients\": 1900, \"unique_users\": 1850},\n\"pilots\": [";
+        const int firstPilot = revision * 50; // 50 leave, 50 join
+        for (int i = firstPilot; i < firstPilot + 1500; i++)
+        {
+            const bool moved = (i % 10) < 3 && revision > 0;
+            const QByteArray callsign = "SWF" + QByteArray::number(i);
+            if (i > firstPilot) { json += ",\n"; }
+            json += "{\"cid\": " + QByteArray::number(1000000 + i) + ", \"name\": \"Pilot " + QByteArray::number(i) + " EDDF\", \"callsign\": \"" + callsign +
+                    "\", \"server\": \"GERMANY\", \"pilot_rating\": 0, \"latitude\": " + QByteArray::number(-60.0 + (i % 1200) * 0.1 + (moved ? 0.01 * revision : 0.0), 'f', 5) +
+                    ", \"longitude\": " + QByteArray::number(-170.0 + (i % 3400) * 0.1, 'f', 5) + ", \"altitude\": " + QByteArray::number(moved ? 30000 + revision * 100 : 35000) +
+                    ", \"groundspeed\": " + QByteArray::number(i % 2 ? 0 : 450) + ", \"transponder\": \"" + QByteArray::number(1000 + i % 6000) + "\", \"heading\": " + QByteArray::number(i % 360) +
+                    ", \"qnh_i_hg\": 29.92, \"qnh_mb\": 1013, \"flight_plan\": ";
+            if (i % 7 == 0) { json += "null"; }
+            else
+            {
+                json += "{\"flight_rules\": \"I\", \"aircraft\": \"" + aircraftTypes[i % aircraftTypes.size()].toLatin1() +
+                        "\", \"aircraft_faa\": \"\", \"aircraft_short\": \"\", \"departure\": \"EDDF\", \"arrival\": \"KJFK\", \"alternate\": \"KBOS\", \"cruise_tas\": \"470\", \"altitude\": \"35000\", "
+                        "\"deptime\": \"1000\", \"enroute_time\": \"0800\", \"fuel_time\": \"1000\", \"remarks\": \"PBN/A1B1C1D1L1O1S2 DOF/210601 REG/DAIXX /V/\", "
+                        "\"route\": \"MARUN Y180 BITSI T180 UNOKO DCT RUDUS DCT NEBIN NATW JOOPY DCT\", \"revision_id\": 1, \"assigned_transponder\": \"0000\"}";
+            }
+            json += ", \"logon_time\": \"2021-06-01T08:00:00Z\", \"last_updated\": \"2021-06-01T10:00:" + QByteArray::number(10 + revision) + "Z\"}";
+        }
+        json += "],\n\"controllers\": [";
+        for (int i = 0; i < 400; i++)
+        {
+            const bool isAtis = i >= 300;
+            if (i == 300) { json += "],\n\"atis\": ["; }
+            else if (i > 0) { json += ",\n"; }
+            json += "{\"cid\": " + QByteArray::number(1500000 + i) + ", \"name\": \"Controller " + QByteArray::number(i) + "\", \"callsign\": \"SWF" + QByteArray::number(i) +
+                    (isAtis ? "_ATIS" : "_TWR") + "\", \"frequency\": \"1" + QByteArray::number(18000 + i * 25) + "\", \"facility\": 4, \"rating\": 3, \"server\": \"GERMANY\", \"visual_range\": 50, "
+                    "\"text_atis\": " + (i % 3 == 0 ? QByteArray("null") : "[\"SWF" + QByteArray::number(i) + " INFORMATION " + QByteArray(1, static_cast<char>('A' + revision % 26)) + "\", \"RWY 25R\", \"QNH 1013\"]") +
+                    ", \"last_updated\": \"2021-06-01T10:00:00Z\", \"logon_time\": \"2021-06-01T08:00:00Z\"}";
+        }
+        json += "],\n\"servers\": [{\"ident\": \"GERMANY\", \"hostname_or_ip\": \"1.2.3.4\", \"location\": \"Germany\", \"name\": \"GERMANY\", \"clients_connection_allowed\": 1}],\n"
+                "\"prefiles\": [], \"facilities\": [{\"id\": 0, \"short\": \"OBS\", \"long\": \"Observer\"}], \"ratings\": [{\"id\": 1, \"short\": \"OBS\", \"long\": \"Observer\"}]}";
+        return json;
+    }
+
     void CSamplesPerformance::calculateDistance(int n)
     {
         if (n < 1) { return; }
@@ -53,6 +53,54 @@ namespace BlackSample
         //! Callsign based hash/map comparison
         static int sampleQMapVsQHashByCallsign(QTextStream &out);
 
+        //! FSD aircraft config packets, JSON merge vs. incremental parts parser
+        static int samplesAircraftPartsParsing(QTextStream &out);
+
+        //! Model set building and file validation, sequential vs. parallel chunks over 30k models
+        static int samplesModelSetBuilding(QTextStream &out);
+
+        //! Interned callsigns, 1000 aircraft and the per callsign maps of the remote aircraft provider
+        static int samplesInternedCallsigns(QTextStream &out);
+
+        //! Sorting the model set and aircraft in range views by column, keys vs. object comparison
+        static int samplesModelSorting(QTextStream &out);
+
+        //! Decoding the worldwide METARs, regular expressions vs. single pass vs. parallel
+        static int samplesMetarDecoding(QTextStream &out);
+
+        //! Parsing the VATSIM data file, QJsonDocument vs. streaming vs. incremental
+        static int samplesVatsimDataFileParsing(QTextStream &out);
+
+        //! Logging to file from several threads, synchronous vs. ring buffer and writer thread
+        static int samplesFileLogging(QTextStream &out);
+
+        //! Physical quantities in situation statistics and comparisons, same unit vs. converted
+        static int samplesPhysicalQuantities(QTextStream &out);
+
+        //! Closest and within range queries on 40k positions, linear vs. spatial index
+        static int samplesGeoIndex(QTextStream &out);
+
+        //! Filtering 30k models while typing, linear vs. filter index
+        static int samplesModelFiltering(QTextStream &out);
+
+        //! Lookups in 30k models and 40k airports, list vs. DB snapshot
+        static int samplesDbSnapshots(QTextStream &out);
+
+        //! Overhead of trace zones, disabled vs. enabled vs. sampled
+        static int samplesTracerOverhead(QTextStream &out);
+
+        //! Cache file of 30k models and 40k airports, JSON DOM vs. streaming
+        static int samplesJsonStreaming(QTextStream &out);
+
+        //! Model set of 30k models, resident memory of list vs. memory-mapped image
+        static int samplesModelSetImage(QTextStream &out);
+
+        //! Situation histories of 100/500/1500 aircraft, all vs. some rendered
+        static int samplesSituationHistories(QTextStream &out);
+
+        //! Relative distances and bearings, per object and as batch
+        static int samplesRelativePositions(QTextStream &out);
+
     private:
         static const qint64 DeltaTime = 10;
 
@@ -62,6 +110,10 @@ namespace BlackSample
         //! Model values for testing
         static BlackMisc::Simulation::CAircraftModelList createModels(int numberOfModels, int numberOfMemoParts);
 
+        //! VATSIM data file (v3) with about 1500 pilots and 400 controllers/ATIS
+        //! \remark each revision moves 30% of the pilots, 50 pilots leave and 50 join
+        static QByteArray createVatsimDataFile(int revision);
+
         //! Calculate n times distance (greater circle distance)
         static void calculateDistance(int n);
 
@@ -15,6 +15,8 @@
 #include "samplesfsuipc.h"
 #include "samplesmodelmapping.h"
 #include "samplesvpilotrules.h"
+#include "samplestrafficload.h"
+#include "samplesinterpolationtrace.h"
 #include "blackcore/application.h"
 #include "blackmisc/directoryutils.h"
 
@@ -51,6 +53,9 @@ int main(int argc, char *argv[])
         streamOut << "4 .. vPilot rules"  << Qt::endl;
         streamOut << "5 .. P3D cfg files" << Qt::endl;
         streamOut << "6 .. FSUIPC read"   << Qt::endl;
+        streamOut << "7 .. Traffic load test (50 .. 2000 aircraft)" << Qt::endl;
+        streamOut << "8 .. Convert interpolation trace (HTML, KML, CSV)" << Qt::endl;
+        streamOut << "9 .. Frame budget scheduler (1000 aircraft)" << Qt::endl;
         streamOut << "x .. exit" << Qt::endl;
         QString i = streamIn.readLine().toLower().trimmed();
 
@@ -61,6 +66,9 @@ int main(int argc, char *argv[])
         else if (i.startsWith("4")) { CSamplesVPilotRules::samples(streamOut, streamIn); }
         else if (i.startsWith("5")) { CSamplesP3D::samplesMisc(streamOut); }
         else if (i.startsWith("6")) { CSamplesFsuipc::samplesFsuipc(streamOut); }
+        else if (i.startsWith("7")) { CSamplesTrafficLoad::samples(streamOut); }
+        else if (i.startsWith("8")) { CSamplesInterpolationTrace::samples(streamOut, streamIn); }
+        else if (i.startsWith("9")) { CSamplesTrafficLoad::samplesFrameBudget(streamOut); }
         else if (i.startsWith("x")) { run = false; streamOut << "terminating" << Qt::endl; }
 
         streamOut << Qt::endl;
@@ -0,0 +1,53 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+//! \ingroup sampleblackmiscsim
+
+#include "samplesinterpolationtrace.h"
+#include "blackmisc/simulation/interpolationlogger.h"
+#include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/statusmessagelist.h"
+#include "blackmisc/fileutils.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QStringList>
+#include <QTextStream>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackSample
+{
+    void CSamplesInterpolationTrace::samples(QTextStream &streamOut, QTextStream &streamIn)
+    {
+        // latest trace in the log directory as default
+        const QDir logDir(CInterpolationLogger::getLogDirectory());
+        const QStringList traces = logDir.entryList(QStringList({ CInterpolationLogger::filePatternTrace() }), QDir::Files, QDir::Time);
+        const QString latest = traces.isEmpty() ? QString() : logDir.absoluteFilePath(traces.first());
+
+        streamOut << "Trace file [" << latest << "]: " << Qt::flush;
+        QString traceFile = streamIn.readLine().trimmed();
+        if (traceFile.isEmpty()) { traceFile = latest; }
+        if (!QFileInfo::exists(traceFile))
+        {
+            streamOut << "No trace file '" << traceFile << "'" << Qt::endl;
+            return;
+        }
+
+        streamOut << "Callsigns, separated by space [all]: " << Qt::flush;
+        const QStringList callsigns = streamIn.readLine().simplified().split(' ', Qt::SkipEmptyParts);
+        const CStatusMessageList msgs = CInterpolationLogger::convertTraceFile(traceFile, CCallsignSet(callsigns), QFileInfo(traceFile).absolutePath());
+        for (const CStatusMessage &msg : msgs)
+        {
+            streamOut << msg.getSeverityAsString() << ": " << msg.getMessage() << Qt::endl;
+        }
+    }
+} // namespace
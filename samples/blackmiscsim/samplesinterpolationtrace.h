@@ -0,0 +1,28 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+//! \ingroup sampleblackmiscsim
+
+#ifndef BLACKSAMPLE_SAMPLESINTERPOLATIONTRACE_H
+#define BLACKSAMPLE_SAMPLESINTERPOLATIONTRACE_H
+
+class QTextStream;
+
+namespace BlackSample
+{
+    //! Offline converter for binary interpolation traces
+    class CSamplesInterpolationTrace
+    {
+    public:
+        //! Convert a trace file (".drv logint trace write") into HTML, KML and CSV files
+        static void samples(QTextStream &streamOut, QTextStream &streamIn);
+    };
+} // namespace
+
+#endif
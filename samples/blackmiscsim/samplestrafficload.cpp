@@ -0,0 +1,200 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+//! \ingroup sampleblackmiscsim
+
+#include "samplestrafficload.h"
+#include "blackmisc/simulation/interpolatormulti.h"
+#include "blackmisc/simulation/framebudgetscheduler.h"
+#include "blackmisc/simulation/interpolationrenderingsetup.h"
+#include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/test/trafficgenerator.h"
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/processinfo.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QTextStream>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::Simulation;
+using namespace BlackMisc::Test;
+
+namespace BlackSample
+{
+    void CSamplesTrafficLoad::samples(QTextStream &streamOut)
+    {
+        streamOut << "Traffic load test (interpolation as in emulated driver, 60 updates/sec, 20secs simulated time)" << Qt::endl;
+        streamOut << "aircraft | avg.update ms | max.update ms | interpolations/s | memory/aircraft KB" << Qt::endl;
+        for (int n : { 50, 100, 250, 500, 1000, 1500, 2000 })
+        {
+            CSamplesTrafficLoad::loadTest(streamOut, n, 20);
+        }
+    }
+
+    void CSamplesTrafficLoad::loadTest(QTextStream &streamOut, int numberOfAircraft, int simulatedSecs, int updateRateHz)
+    {
+        constexpr qint64 NetworkUpdateMs = 5000; // normal position updates
+        const qint64 frameMs = 1000 / qMax(1, updateRateHz);
+        const qint64 startTime = QDateTime::currentMSecsSinceEpoch();
+        const CCoordinateGeodetic center(48.353889, 11.786111, 1487.0); // EDDM
+
+        // provider and synthetic traffic, the provider keeps the same history as in a real session
+        const qint64 memoryBefore = CProcessInfo::currentProcessResidentMemoryBytes();
+        CRemoteAircraftProviderDummy provider;
+        const CTrafficGenerator traffic(center, numberOfAircraft, startTime);
+        traffic.prefillProvider(provider, startTime, NetworkUpdateMs, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+
+        // same as in CSimulatorEmulated::physicallyAddRemoteAircraft
+        CInterpolationAndRenderingSetupGlobal globalSetup;
+        QHash<CCallsign, CInterpolatorMultiWrapper> interpolators;
+        QHash<CCallsign, CInterpolationAndRenderingSetupPerCallsign> setups;
+        for (int i = 0; i < traffic.size(); i++)
+        {
+            const CSimulatedAircraft aircraft = traffic.getAircraft(i);
+            const CCallsign cs = aircraft.getCallsign();
+            interpolators.insert(cs, CInterpolatorMultiWrapper(cs, nullptr, nullptr, &provider));
+            interpolators[cs].interpolator()->initCorrespondingModel(aircraft.getModel());
+            setups.insert(cs, CInterpolationAndRenderingSetupPerCallsign(cs, globalSetup));
+        }
+        QCoreApplication::processEvents();
+        const qint64 memoryAfter = CProcessInfo::currentProcessResidentMemoryBytes();
+
+        // same as in CSimulatorEmulated::updateRemoteAircraft
+        qint64 totalNs = 0;
+        qint64 maxNs = 0;
+        qint64 interpolations = 0;
+        int runs = 0;
+        QElapsedTimer timer;
+        qint64 lastFeed = startTime;
+        for (qint64 now = startTime + frameMs; now <= startTime + simulatedSecs * 1000; now += frameMs)
+        {
+            traffic.feedProvider(provider, lastFeed, now, NetworkUpdateMs);
+            lastFeed = now;
+
+            timer.start();
+            int aircraftNumber = 0;
+            for (auto it = interpolators.begin(); it != interpolators.end(); ++it)
+            {
+                CInterpolatorMulti *im = it.value();
+                const CInterpolationResult result = im->getInterpolation(now, *setups.constFind(it.key()), aircraftNumber++);
+                const CAircraftSituation s = result;
+                const CAircraftParts p = result;
+                Q_UNUSED(s)
+                Q_UNUSED(p)
+                interpolations++;
+            }
+            const qint64 ns = timer.nsecsElapsed();
+            totalNs += ns;
+            maxNs = qMax(maxNs, ns);
+            runs++;
+        }
+
+        const double avgMs = runs > 0 ? totalNs / 1.0e6 / runs : 0.0;
+        const double maxMs = maxNs / 1.0e6;
+        const double perSec = totalNs > 0 ? interpolations * 1.0e9 / totalNs : 0.0;
+        const double kbPerAircraft = (memoryBefore > 0 && memoryAfter > memoryBefore) ? (memoryAfter - memoryBefore) / 1024.0 / numberOfAircraft : 0.0;
+
+        streamOut << QStringLiteral("%1 | %2 | %3 | %4 | %5")
+                  .arg(numberOfAircraft, 8)
+                  .arg(avgMs, 13, 'f', 3)
+                  .arg(maxMs, 13, 'f', 3)
+                  .arg(perSec, 16, 'f', 0)
+                  .arg(kbPerAircraft, 18, 'f', 1) << Qt::endl;
+    }
+
+    void CSamplesTrafficLoad::samplesFrameBudget(QTextStream &streamOut)
+    {
+        streamOut << "Frame budget scheduler (emulated driver loop, 1000 aircraft, 60 updates/sec, 20secs simulated time)" << Qt::endl;
+        streamOut << "budget ms | avg.update ms | max.update ms | interpolations/s | tiers" << Qt::endl;
+        for (double budgetMs : { 0.0, 5.0, 2.0 })
+        {
+            CSamplesTrafficLoad::frameBudgetTest(streamOut, 1000, 20, budgetMs);
+        }
+    }
+
+    void CSamplesTrafficLoad::frameBudgetTest(QTextStream &streamOut, int numberOfAircraft, int simulatedSecs, double budgetMs)
+    {
+        constexpr qint64 NetworkUpdateMs = 5000;
+        constexpr qint64 FrameMs = 1000 / 60;
+        const qint64 startTime = QDateTime::currentMSecsSinceEpoch();
+        const CCoordinateGeodetic center(48.353889, 11.786111, 1487.0); // EDDM, also own aircraft
+
+        CRemoteAircraftProviderDummy provider;
+        const CTrafficGenerator traffic(center, numberOfAircraft, startTime);
+        traffic.prefillProvider(provider, startTime, NetworkUpdateMs, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+
+        CInterpolationAndRenderingSetupGlobal globalSetup;
+        QHash<CCallsign, CInterpolatorMultiWrapper> interpolators;
+        QHash<CCallsign, CInterpolationAndRenderingSetupPerCallsign> setups;
+        for (int i = 0; i < traffic.size(); i++)
+        {
+            const CSimulatedAircraft aircraft = traffic.getAircraft(i);
+            const CCallsign cs = aircraft.getCallsign();
+            interpolators.insert(cs, CInterpolatorMultiWrapper(cs, nullptr, nullptr, &provider));
+            interpolators[cs].interpolator()->initCorrespondingModel(aircraft.getModel());
+            setups.insert(cs, CInterpolationAndRenderingSetupPerCallsign(cs, globalSetup));
+        }
+
+        // same as in CSimulatorEmulated::updateRemoteAircraft, last sent situations as in ISimulator
+        CFrameBudgetScheduler scheduler(budgetMs);
+        scheduler.setEnabled(budgetMs > 0);
+        CAircraftSituationPerCallsign lastSent;
+        qint64 totalNs = 0;
+        qint64 maxNs = 0;
+        qint64 interpolations = 0;
+        int runs = 0;
+        QElapsedTimer timer;
+        qint64 lastFeed = startTime;
+        for (qint64 now = startTime + FrameMs; now <= startTime + simulatedSecs * 1000; now += FrameMs)
+        {
+            traffic.feedProvider(provider, lastFeed, now, NetworkUpdateMs);
+            lastFeed = now;
+
+            timer.start();
+            int aircraftNumber = 0;
+            for (auto it = interpolators.begin(); it != interpolators.end(); ++it)
+            {
+                const auto last = lastSent.constFind(it.key());
+                const bool due = last == lastSent.constEnd() ?
+                                 scheduler.isDue(it.key(), CFrameBudgetScheduler::Near) :
+                                 scheduler.isDue(it.key(), last.value(), center);
+                if (!due) { aircraftNumber++; continue; }
+
+                CInterpolatorMulti *im = it.value();
+                const CInterpolationResult result = im->getInterpolation(now, *setups.constFind(it.key()), aircraftNumber++);
+                const CAircraftSituation s = result;
+                const CAircraftParts p = result;
+                if (result.getInterpolationStatus().hasValidSituation()) { lastSent.insert(it.key(), s); }
+                Q_UNUSED(p)
+                interpolations++;
+            }
+            const qint64 ns = timer.nsecsElapsed();
+            scheduler.endFrame(now, ns / 1.0e6);
+            totalNs += ns;
+            maxNs = qMax(maxNs, ns);
+            runs++;
+        }
+
+        const double avgMs = runs > 0 ? totalNs / 1.0e6 / runs : 0.0;
+        const double maxMs = maxNs / 1.0e6;
+        const double perSec = totalNs > 0 ? interpolations * 1.0e9 / totalNs : 0.0;
+        streamOut << QStringLiteral("%1 | %2 | %3 | %4 | %5")
+                  .arg(budgetMs > 0 ? QString::number(budgetMs, 'f', 1) : QStringLiteral("off"), 9)
+                  .arg(avgMs, 13, 'f', 3)
+                  .arg(maxMs, 13, 'f', 3)
+                  .arg(perSec, 16, 'f', 0)
+                  .arg(scheduler.getStatisticsInfo()) << Qt::endl;
+    }
+} // namespace
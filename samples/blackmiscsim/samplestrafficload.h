@@ -0,0 +1,47 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+//! \ingroup sampleblackmiscsim
+
+#ifndef BLACKSAMPLE_SAMPLESTRAFFICLOAD_H
+#define BLACKSAMPLE_SAMPLESTRAFFICLOAD_H
+
+#include <QtGlobal>
+
+class QTextStream;
+
+namespace BlackSample
+{
+    //! Headless load test of the interpolation stack as used by the emulated driver
+    class CSamplesTrafficLoad
+    {
+    public:
+        //! Scaling benchmark for N = 50 ... 2000 aircraft
+        static void samples(QTextStream &streamOut);
+
+        //! Single load test run
+        //! \param streamOut       output
+        //! \param numberOfAircraft synthetic remote aircraft
+        //! \param simulatedSecs   simulated time
+        //! \param updateRateHz    remote aircraft update rate ("frame rate" of the driver)
+        static void loadTest(QTextStream &streamOut, int numberOfAircraft, int simulatedSecs, int updateRateHz = 60);
+
+        //! Emulated driver update loop with and without BlackMisc::Simulation::CFrameBudgetScheduler
+        static void samplesFrameBudget(QTextStream &streamOut);
+
+        //! Single frame budget run
+        //! \param streamOut        output
+        //! \param numberOfAircraft synthetic remote aircraft
+        //! \param simulatedSecs    simulated time
+        //! \param budgetMs         budget per update run, 0 disables the scheduler
+        static void frameBudgetTest(QTextStream &streamOut, int numberOfAircraft, int simulatedSecs, double budgetMs);
+    };
+} // namespace
+
+#endif
@@ -11,6 +11,7 @@
 #include "blackcore/afv/audio/input.h"
 #include "blacksound/audioutilities.h"
 #include "blackmisc/logmessage.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/verify.h"
 
 #include <QtGlobal>
@@ -165,6 +166,7 @@ namespace BlackCore::Afv::Audio
 
     void CInput::audioInDataAvailable(const QByteArray &frame)
     {
+        BLACK_TRACE_ZONE("AFV input", "audio");
         QVector<qint16> samples = convertBytesTo16BitPCM(frame);
 
         if (m_inputFormat.channelCount() == 2)
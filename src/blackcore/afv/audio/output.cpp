@@ -10,6 +10,7 @@
 #include "blacksound/audioutilities.h"
 #include "blackmisc/metadatautils.h"
 #include "blackmisc/logmessage.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/verify.h"
 
 #include <QDebug>
@@ -34,6 +35,7 @@ namespace BlackCore::Afv::Audio
 
     qint64 CAudioOutputBuffer::readData(char *data, qint64 maxlen)
     {
+        BLACK_TRACE_ZONE("AFV output", "audio");
         const int sampleBytes  = m_outputFormat.sampleSize() / 8;
         const int channelCount = m_outputFormat.channelCount();
         const qint64 count     = maxlen / (sampleBytes * channelCount);
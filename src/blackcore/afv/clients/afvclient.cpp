@@ -15,6 +15,7 @@
 #include "blackmisc/audio/audiodeviceinfolist.h"
 #include "blackmisc/threadutils.h"
 #include "blackmisc/stringutils.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/verify.h"
 
 #ifdef Q_OS_WIN
@@ -948,6 +949,7 @@ namespace BlackCore::Afv::Clients
 
     void CAfvClient::audioOutDataAvailable(const AudioRxOnTransceiversDto &dto)
     {
+        BLACK_TRACE_ZONE("AFV receive", "audio");
         IAudioDto audioData;
         audioData.audio           = QByteArray(dto.audio.data(), static_cast<int>(dto.audio.size()));
         audioData.callsign        = QString::fromStdString(dto.callsign);
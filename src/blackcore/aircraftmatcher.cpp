@@ -24,6 +24,8 @@
 #include "blackmisc/directoryutils.h"
 
 #include <QList>
+#include <QMetaObject>
+#include <QMutexLocker>
 #include <QStringList>
 #include <QtGlobal>
 #include <QPair>
@@ -51,6 +53,11 @@ namespace BlackCore
             const CAircraftCategoryList categories = sApp->getWebDataServices()->getAircraftCategories();
             m_categoryMatcher.setCategories(categories);
         }
+
+        m_releaseTimer.setObjectName(this->objectName() + ":releaseTimer");
+        m_releaseTimer.setSingleShot(true);
+        m_releaseTimer.setInterval(MaterializedReleaseMs);
+        connect(&m_releaseTimer, &QTimer::timeout, this, &CAircraftMatcher::releaseMaterializedModels);
     }
 
     CAircraftMatcher::CAircraftMatcher(QObject *parent) : CAircraftMatcher(CAircraftMatcherSetup(), parent)
@@ -252,9 +259,13 @@ namespace BlackCore
 
     CAircraftModel CAircraftMatcher::getClosestMatch(const CSimulatedAircraft &remoteAircraft, MatchingLog whatToLog, CStatusMessageList *log, bool useMatchingScript) const
     {
-        CAircraftModelList modelSet(m_modelSet); // Models for this matching
         const CAircraftMatcherSetup setup = m_setup;
 
+        // without log and matching script the whole set is only needed if there is no exact model string match
+        const bool exactMatchOnly = whatToLog == MatchingLogNothing || !log;
+        const bool usesMatchingScript = useMatchingScript && setup.doRunMsMatchingStageScript();
+        CAircraftModelList modelSet = this->getModelSetForMatching(remoteAircraft, exactMatchOnly && !usesMatchingScript && setup.getMatchingMode().testFlag(CAircraftMatcherSetup::ByModelString)); // Models for this matching
+
         static const QString format("hh:mm:ss.zzz");
         static const QString m1("--- Start matching: UTC %1 ---");
         static const QString m2("Input model: '%1' '%2'");
@@ -1248,6 +1259,33 @@ namespace BlackCore
         return icao;
     }
 
+    const CAircraftModelList &CAircraftMatcher::getModelSetRef() const
+    {
+        if (m_modelSetImage) { this->getModelSetForMatching(); } // materialize
+        return m_modelSet;
+    }
+
+    int CAircraftMatcher::getModelSetCount() const
+    {
+        if (!m_modelSetImage) { return m_modelSet.sizeInt(); }
+        int count = 0;
+        for (int i = 0; i < m_modelSetImage->size(); i++)
+        {
+            if (this->isMatchable(m_modelSetImage->at(i))) { count++; }
+        }
+        return count;
+    }
+
+    bool CAircraftMatcher::hasModels() const
+    {
+        if (!m_modelSetImage) { return !m_modelSet.isEmpty(); }
+        for (int i = 0; i < m_modelSetImage->size(); i++)
+        {
+            if (this->isMatchable(m_modelSetImage->at(i))) { return true; }
+        }
+        return false;
+    }
+
     int CAircraftMatcher::setModelSet(const CAircraftModelList &models, const CSimulatorInfo &simulator, bool forced)
     {
         if (!simulator.isSingleSimulator()) { return 0; }
@@ -1257,7 +1295,7 @@ namespace BlackCore
         const int r2 = modelsCleaned.removeIfExcluded();
 
         // sane simulator and model count? (minor risk of not updating when a model was changed)
-        if (!forced && m_simulator == simulator && m_modelSet.size() == modelsCleaned.size())
+        if (!forced && !m_modelSetImage && m_simulator == simulator && m_modelSet.size() == modelsCleaned.size())
         {
             return m_modelSet.size();
         }
@@ -1291,30 +1329,91 @@ namespace BlackCore
         }
 
         // set values
-        m_modelSet  = modelsCleaned;
+        {
+            QMutexLocker l(&m_modelSetMutex);
+            m_modelSet = modelsCleaned;
+            m_modelSetImage.reset();
+        }
+        m_disabledModelStrings.clear();
         m_simulator = simulator;
         m_modelSetInfo = QStringLiteral("Set: '%1' entries: %2").arg(simulator.toQString()).arg(modelsCleaned.size());
         return models.size();
     }
 
+    int CAircraftMatcher::setModelSetImage(const QSharedPointer<const CAircraftModelSetImage> &image, const CSimulatorInfo &simulator, bool forced)
+    {
+        if (!image || !simulator.isSingleSimulator()) { return 0; }
+        if (!forced && m_simulator == simulator && m_modelSetImage == image) { return image->size(); }
+
+        // same checks as for a model list, but on the views
+        int withoutString = 0;
+        int excluded = 0;
+        QSet<QString> modelStrings;
+        QStringList duplicates;
+        for (int i = 0; i < image->size(); i++)
+        {
+            const CAircraftModelImageView model = image->at(i);
+            if (model.getModelString().isEmpty()) { withoutString++; continue; }
+            if (model.getModelMode() == CAircraftModel::Exclude) { excluded++; continue; }
+            const QString modelString = model.getModelString().toString().toUpper();
+            if (modelStrings.contains(modelString)) { duplicates.push_back(modelString); }
+            else { modelStrings.insert(modelString); }
+        }
+
+        const int count = image->size() - withoutString - excluded;
+        if (count < 1)
+        {
+            // error to force popup
+            CLogMessage(this).error(u"No models for matching ('%1'), swift without a model set will not work!") << simulator.toQString();
+        }
+        else if (!duplicates.isEmpty())
+        {
+            CLogMessage(this).error(u"Found model duplicate strings, check models: '%1'") << duplicates.join(", ");
+        }
+        else if ((withoutString + excluded) > 0)
+        {
+            CLogMessage(this).validationWarning(u"Removed models for matcher, without string #: %1, excluded #: %2.") << withoutString << excluded;
+        }
+        else
+        {
+            CLogMessage(this).validationInfo(u"Set %1 models from image in matcher, simulator '%2'") << count << simulator.toQString();
+        }
+
+        // set values, materialized when needed
+        {
+            QMutexLocker l(&m_modelSetMutex);
+            m_modelSet.clear();
+            m_modelSetImage = image;
+        }
+        m_disabledModelStrings.clear();
+        m_simulator = simulator;
+        m_modelSetInfo = QStringLiteral("Set: '%1' entries: %2").arg(simulator.toQString()).arg(count);
+        return image->size();
+    }
+
     void CAircraftMatcher::disableModelsForMatching(const CAircraftModelList &removedModels, bool incremental)
     {
         if (incremental)
         {
-            m_modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
             m_disabledModels.push_back(removedModels);
         }
         else
         {
             this->restoreDisabledModels();
             m_disabledModels = removedModels;
-            m_modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
         }
+        for (const CAircraftModel &model : removedModels) { m_disabledModelStrings.insert(model.getModelString().toUpper()); }
+
+        QMutexLocker l(&m_modelSetMutex);
+        m_modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
     }
 
     void CAircraftMatcher::restoreDisabledModels()
     {
-        m_modelSet.replaceOrAddModelsWithString(m_disabledModels, Qt::CaseInsensitive);
+        m_disabledModelStrings.clear();
+        QMutexLocker l(&m_modelSetMutex);
+        if (m_modelSetImage) { m_modelSet.clear(); } // materialized again with the restored models
+        else { m_modelSet.replaceOrAddModelsWithString(m_disabledModels, Qt::CaseInsensitive); }
     }
 
     void CAircraftMatcher::setDefaultModel(const CAircraftModel &defaultModel)
@@ -1327,7 +1426,7 @@ namespace BlackCore
     {
         Q_UNUSED(livery)
         Q_ASSERT_X(sApp && sApp->hasWebDataServices(), Q_FUNC_INFO, "Missing web data services");
-        if (m_modelSet.isEmpty())   { return; } // ignore empty sets to not create silly stats
+        if (!this->hasModels())     { return; } // ignore empty sets to not create silly stats
         if (sessionId.isEmpty())    { return; }
         if (aircraftIcao.isEmpty()) { return; }
 
@@ -1351,13 +1450,13 @@ namespace BlackCore
         CMatchingStatisticsEntry::EntryType type = CMatchingStatisticsEntry::Missing;
         if (airlineIcaoChecked.hasValidDesignator())
         {
-            type = m_modelSet.containsModelsWithAircraftAndAirlineIcaoDesignator(aircraftIcao, airlineIcao) ?
+            type = this->containsModelsWithAircraftAndAirlineIcaoDesignator(aircraftIcao, airlineIcao) ?
                    CMatchingStatisticsEntry::Found :
                    CMatchingStatisticsEntry::Missing;
         }
         else
         {
-            type = m_modelSet.containsModelsWithAircraftAndAirlineIcaoDesignator(aircraftIcao, airlineIcao) ?
+            type = this->containsModelsWithAircraftAndAirlineIcaoDesignator(aircraftIcao, airlineIcao) ?
                    CMatchingStatisticsEntry::Found :
                    CMatchingStatisticsEntry::Missing;
 
@@ -1391,6 +1490,62 @@ namespace BlackCore
         return CFileUtils::writeStringToFile(json, CFileUtils::appendFilePathsAndFixUnc(CSwiftDirectories::logDirectory(), QStringLiteral("removed models %1.json").arg(ts)));
     }
 
+    bool CAircraftMatcher::isMatchable(const CAircraftModelImageView &model) const
+    {
+        if (!model.isValid() || model.getModelString().isEmpty()) { return false; }
+        if (model.getModelMode() == CAircraftModel::Exclude) { return false; }
+        return m_disabledModelStrings.isEmpty() || !m_disabledModelStrings.contains(model.getModelString().toString().toUpper());
+    }
+
+    CAircraftModelList CAircraftMatcher::getModelSetForMatching() const
+    {
+        QMutexLocker l(&m_modelSetMutex);
+        if (!m_modelSetImage) { return m_modelSet; }
+        if (m_modelSet.isEmpty())
+        {
+            QVector<CAircraftModelImageView> models;
+            models.reserve(m_modelSetImage->size());
+            for (int i = 0; i < m_modelSetImage->size(); i++)
+            {
+                const CAircraftModelImageView model = m_modelSetImage->at(i);
+                if (this->isMatchable(model)) { models.push_back(model); }
+            }
+            m_modelSet = CAircraftModelSetImage::toAircraftModelList(models);
+        }
+
+        // matching usually happens in bursts, e.g. after connecting, keep the models until not used for a while
+        QMetaObject::invokeMethod(&m_releaseTimer, "start");
+        return m_modelSet;
+    }
+
+    CAircraftModelList CAircraftMatcher::getModelSetForMatching(const CSimulatedAircraft &remoteAircraft, bool exactMatchOnly) const
+    {
+        if (exactMatchOnly && m_modelSetImage && remoteAircraft.hasModelString() && !remoteAircraft.getModel().hasManuallySetString())
+        {
+            const CAircraftModelImageView model = m_modelSetImage->findByModelString(remoteAircraft.getModelString());
+            if (this->isMatchable(model)) { return CAircraftModelList({ model.toAircraftModel() }); }
+        }
+        return this->getModelSetForMatching();
+    }
+
+    bool CAircraftMatcher::containsModelsWithAircraftAndAirlineIcaoDesignator(const QString &aircraftDesignator, const QString &airlineDesignator) const
+    {
+        if (!m_modelSetImage) { return m_modelSet.containsModelsWithAircraftAndAirlineIcaoDesignator(aircraftDesignator, airlineDesignator); }
+        for (int i = 0; i < m_modelSetImage->size(); i++)
+        {
+            const CAircraftModelImageView model = m_modelSetImage->at(i);
+            if (model.getAircraftIcaoCodeDesignator().compare(aircraftDesignator) != 0 || model.getAirlineIcaoCodeDesignator().compare(airlineDesignator) != 0) { continue; }
+            if (this->isMatchable(model)) { return true; }
+        }
+        return false;
+    }
+
+    void CAircraftMatcher::releaseMaterializedModels()
+    {
+        QMutexLocker l(&m_modelSetMutex);
+        if (m_modelSetImage) { m_modelSet.clear(); }
+    }
+
     CAircraftModelList CAircraftMatcher::getClosestMatchStepwiseReduceImplementation(const CAircraftModelList &modelSet, const CAircraftMatcherSetup &setup, const CCategoryMatcher &categoryMatcher, const CSimulatedAircraft &remoteAircraft, MatchingLog whatToLog, CStatusMessageList *log)
     {
         CAircraftModelList matchedModels(modelSet);
@@ -16,6 +16,7 @@
 #include "blackmisc/simulation/aircraftmodelsetprovider.h"
 #include "blackmisc/simulation/aircraftmatchersetup.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
 #include "blackmisc/simulation/matchingscriptmisc.h"
 #include "blackmisc/simulation/matchingstatistics.h"
 #include "blackmisc/simulation/matchinglog.h"
@@ -25,10 +26,13 @@
 #include "blackmisc/variant.h"
 
 #include <QFlags>
+#include <QMutex>
 #include <QObject>
 #include <QString>
 #include <QPair>
 #include <QSet>
+#include <QSharedPointer>
+#include <QTimer>
 
 namespace BlackMisc
 {
@@ -262,21 +266,34 @@ namespace BlackCore
         static BlackMisc::Aviation::CAirlineIcaoCode callsignToAirline(const BlackMisc::Aviation::CCallsign &callsign, BlackMisc::CStatusMessageList *log = nullptr);
 
         //! \copydoc BlackMisc::Simulation::IAircraftModelSetProvider::getModelSet
-        virtual BlackMisc::Simulation::CAircraftModelList getModelSet() const override { return m_modelSet; }
+        //! \remark with a model set image the models are materialized
+        virtual BlackMisc::Simulation::CAircraftModelList getModelSet() const override { return this->getModelSetForMatching(); }
 
         //! Model set as reference
-        virtual const BlackMisc::Simulation::CAircraftModelList &getModelSetRef() const { return m_modelSet; }
+        //! \remark with a model set image the materialized models, valid until released after MaterializedReleaseMs
+        virtual const BlackMisc::Simulation::CAircraftModelList &getModelSetRef() const;
 
         //! Model set count
-        virtual int getModelSetCount() const override { return m_modelSet.sizeInt(); }
+        virtual int getModelSetCount() const override;
 
         //! Models
-        bool hasModels() const { return !m_modelSet.isEmpty(); }
+        bool hasModels() const;
 
         //! Set the models we want to use
         //! \note uses a set from "somewhere else" so it can also be used with arbitrary sets for testing
         int setModelSet(const BlackMisc::Simulation::CAircraftModelList &models, const BlackMisc::Simulation::CSimulatorInfo &simulator, bool forced);
 
+        //! Use the memory-mapped image of the model set, no copy of the models is kept
+        //! \remark models are materialized when needed for matching and released when not used for MaterializedReleaseMs,
+        //!         an exact model string match only materializes the found model
+        int setModelSetImage(const QSharedPointer<const BlackMisc::Simulation::CAircraftModelSetImage> &image, const BlackMisc::Simulation::CSimulatorInfo &simulator, bool forced);
+
+        //! Using a model set image?
+        bool isUsingModelSetImage() const { return !m_modelSetImage.isNull(); }
+
+        //! Materialized models of a model set image are released after this time
+        static constexpr int MaterializedReleaseMs = 60 * 1000;
+
         //! Remove a model for matching
         //! \remark effective until new set is set
         void disableModelsForMatching(const BlackMisc::Simulation::CAircraftModelList &removedModels, bool incremental);
@@ -313,6 +330,21 @@ namespace BlackCore
         //! Save the disabled models if any
         bool saveDisabledForMatchingModels();
 
+        //! Model of the image used for matching? Not without model string, excluded or disabled
+        bool isMatchable(const BlackMisc::Simulation::CAircraftModelImageView &model) const;
+
+        //! The models for matching, materialized from the model set image if needed
+        BlackMisc::Simulation::CAircraftModelList getModelSetForMatching() const;
+
+        //! The models for matching, only the exactly matching model if it can be found in the model set image
+        BlackMisc::Simulation::CAircraftModelList getModelSetForMatching(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool exactMatchOnly) const;
+
+        //! Model set contains models with aircraft and airline designator?
+        bool containsModelsWithAircraftAndAirlineIcaoDesignator(const QString &aircraftDesignator, const QString &airlineDesignator) const;
+
+        //! Release the materialized models of a model set image
+        void releaseMaterializedModels();
+
         //! The search based implementation
         static BlackMisc::Simulation::CAircraftModelList getClosestMatchStepwiseReduceImplementation(
             const BlackMisc::Simulation::CAircraftModelList &modelSet, const BlackMisc::Simulation::CAircraftMatcherSetup &setup,
@@ -401,8 +433,12 @@ namespace BlackCore
 
         BlackMisc::Simulation::CAircraftMatcherSetup m_setup;           //!< setup
         BlackMisc::Simulation::CAircraftModel        m_defaultModel;    //!< model to be used as default model
-        BlackMisc::Simulation::CAircraftModelList    m_modelSet;        //!< models used for model matching
+        mutable BlackMisc::Simulation::CAircraftModelList m_modelSet;   //!< models used for model matching, materialized with an image
         BlackMisc::Simulation::CAircraftModelList    m_disabledModels;  //!< disabled models for matching
+        QSet<QString>                                m_disabledModelStrings; //!< upper case strings of the disabled models
+        QSharedPointer<const BlackMisc::Simulation::CAircraftModelSetImage> m_modelSetImage; //!< model set image, if used
+        mutable QMutex                               m_modelSetMutex;   //!< guards the materialized models
+        mutable QTimer                               m_releaseTimer { this }; //!< releases the materialized models
         BlackMisc::Simulation::CSimulatorInfo        m_simulator;       //!< simulator (optional)
         BlackMisc::Simulation::CMatchingStatistics   m_statistics;      //!< matching statistics
         BlackMisc::Simulation::CCategoryMatcher      m_categoryMatcher; //!< the category matcher
@@ -361,9 +361,7 @@ namespace BlackCore
 
     void CAirspaceMonitor::testAddAircraftParts(const CCallsign &callsign, const CAircraftParts &parts, bool incremental)
     {
-        this->onAircraftConfigReceived(callsign,
-                                       incremental ? parts.toIncrementalJson() : parts.toFullJson(),
-                                       5000);
+        this->onAircraftConfigReceived(callsign, CAircraftPartsDelta::fromParts(parts, !incremental), 5000);
     }
 
     const QString &CAirspaceMonitor::enumFlagToString(CAirspaceMonitor::MatchingReadinessFlag r)
@@ -680,6 +678,7 @@ namespace BlackCore
             this->addReverseLookupMessage(callsign, m);
 
             emit this->readyForModelMatching(remoteAircraft);
+            this->compactReverseLookupMessages(callsign); // lookup done, free the messages
         }
         else
         {
@@ -1404,8 +1403,7 @@ namespace BlackCore
             onIcaoCodesReceived(situation.getCallsign(), aircraftIcao, airlineIcao, airlineIcao);
         }
 
-        //! \fixme Converting CAircraftParts to JSON then converting JSON right back to CAircraftParts, should just directly use CAircraftParts without conversion.
-        onAircraftConfigReceived(situation.getCallsign(), parts.toFullJson(), currentOffsetMs);
+        onAircraftConfigReceived(situation.getCallsign(), CAircraftPartsDelta::fromParts(parts, true), currentOffsetMs);
     }
 
     void CAirspaceMonitor::onConnectionStatusChanged(CConnectionStatus oldStatus, CConnectionStatus newStatus)
@@ -1506,14 +1504,14 @@ namespace BlackCore
 
     }
 
-    void CAirspaceMonitor::onAircraftConfigReceived(const CCallsign &callsign, const QJsonObject &jsonObject, qint64 currentOffsetMs)
+    void CAirspaceMonitor::onAircraftConfigReceived(const CCallsign &callsign, const CAircraftPartsDelta &delta, qint64 currentOffsetMs)
     {
         Q_ASSERT(CThreadUtils::isInThisThread(this));
         BLACK_AUDIT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Need callsign");
         if (callsign.isEmpty()) { return; }
 
         // store parts
-        this->storeAircraftParts(callsign, jsonObject, currentOffsetMs);
+        this->storeAircraftParts(callsign, delta, currentOffsetMs);
 
         // update client capability
         CClient client = this->getClientOrDefaultForCallsign(callsign);
@@ -452,7 +452,7 @@ namespace BlackCore
         void onReceivedAtcBookings(const BlackMisc::Aviation::CAtcStationList &bookedStations);
         void onReadUnchangedAtcBookings();
         void onReceivedVatsimDataFile();
-        void onAircraftConfigReceived(const BlackMisc::Aviation::CCallsign &callsign, const QJsonObject &jsonObject, qint64 currentOffsetMs);
+        void onAircraftConfigReceived(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::Aviation::CAircraftPartsDelta &delta, qint64 currentOffsetMs);
         void onAircraftInterimUpdateReceived(const BlackMisc::Aviation::CAircraftSituation &situation);
         void onAircraftVisualUpdateReceived(const BlackMisc::Aviation::CAircraftSituation &situation);
         void onAircraftSimDataUpdateReceived(const BlackMisc::Aviation::CAircraftSituation &situation, const BlackMisc::Aviation::CAircraftParts &parts, qint64 currentOffsetMs, const QString &aircraftIcao, const QString &airlineIcao);
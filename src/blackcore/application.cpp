@@ -25,6 +25,7 @@
 #include "blackmisc/datacache.h"
 #include "blackmisc/dbusserver.h"
 #include "blackmisc/swiftdirectories.h"
+#include "blackmisc/taskpool.h"
 #include "blackmisc/directoryutils.h"
 #include "blackmisc/eventloop.h"
 #include "blackmisc/filelogger.h"
@@ -38,6 +39,8 @@
 #include "blackmisc/slot.h"
 #include "blackmisc/stringutils.h"
 #include "blackmisc/threadutils.h"
+#include "blackmisc/timeline.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/verify.h"
 
 #include <stdbool.h>
@@ -171,6 +174,10 @@ namespace BlackCore
             connect(this, &CApplication::startUpCompleted, this, &CApplication::onStartUpCompleted, Qt::QueuedConnection);
             connect(this, &CApplication::coreFacadeStarted, this, &CApplication::onCoreFacadeStarted, Qt::QueuedConnection);
 
+            // startup timeline ends when the core facade (including the model set) is started, later cache reloads are no startup stages
+            connect(this, &CApplication::coreFacadeStarted, this, [] { CTimeline::startup().setRecording(false); }, Qt::QueuedConnection);
+            connect(this, &CApplication::startUpCompleted, this, [] { CTimeline::startup().setRecording(false); }, Qt::QueuedConnection);
+
             if (!this->getApplicationInfo().isUnitTest())
             {
                 m_inputManager = new CInputManager(this);
@@ -183,6 +190,7 @@ namespace BlackCore
                 {
                     CLogMessage(cat).debug(u"Worker named '%1' still exists after application destroyed") << worker->objectName();
                 }
+                CLogMessage(cat).debug(u"Task pool: %1") << CTaskPool::instance().getStatistics().toQString();
             });
         }
     }
@@ -393,6 +401,7 @@ namespace BlackCore
             //! \fixme KB 9/17 waiting for setup reader here is supposed to be replaced by explicitly waiting for reader
             if (!m_setupReader->isSetupAvailable())
             {
+                CTimeline::Stage stage(CTimeline::startup(), QStringLiteral("Load setup"), QStringLiteral("startup"));
                 msgs = this->requestReloadOfSetupAndVersion();
                 if (msgs.isFailure()) { break; }
                 if (msgs.isSuccess()) { msgs.push_back(this->waitForSetup()); }
@@ -956,7 +965,10 @@ namespace BlackCore
         this->startWebDataServices();
 
         const CStatusMessageList msgs(CStatusMessage(this).info(u"Will start core facade now"));
-        m_coreFacade.reset(new CCoreFacade(m_coreFacadeConfig));
+        {
+            CTimeline::Stage stage(CTimeline::startup(), QStringLiteral("Start core facade"), QStringLiteral("startup"));
+            m_coreFacade.reset(new CCoreFacade(m_coreFacadeConfig));
+        }
         emit this->coreFacadeStarted();
         return msgs;
     }
@@ -1051,6 +1063,22 @@ namespace BlackCore
         m_cmdTestCrashpad = QCommandLineOption({ "testcp", "testcrashpad" },
                                                QCoreApplication::translate("application", "Trigger crashpad situation."));
         this->addParserOption(m_cmdTestCrashpad);
+
+        // startup timeline
+        m_cmdStartupTrace = QCommandLineOption({ "strace", "startuptrace" },
+                                               QCoreApplication::translate("application", "Write the startup timeline as Chrome trace JSON file on shutdown."),
+                                               "startuptrace");
+        this->addParserOption(m_cmdStartupTrace);
+
+        // hot path tracing, zones only exist if compiled with BLACK_USE_TRACING
+        m_cmdTrace = QCommandLineOption({ "trace" },
+                                        QCoreApplication::translate("application", "Trace hot paths and write them as Chrome trace JSON file on shutdown."),
+                                        "trace");
+        this->addParserOption(m_cmdTrace);
+        m_cmdTraceSampling = QCommandLineOption({ "tracesampling" },
+                                                QCoreApplication::translate("application", "Trace only every n-th zone."),
+                                                "tracesampling");
+        this->addParserOption(m_cmdTraceSampling);
     }
 
     bool CApplication::isSet(const QCommandLineOption &option) const
@@ -1082,6 +1110,18 @@ namespace BlackCore
         // info that we will shutdown
         emit this->aboutToShutdown();
 
+        // startup analysis
+        if (m_parsed && this->isParserOptionSet(m_cmdStartupTrace))
+        {
+            CTimeline::startup().setRecording(false);
+            CLogMessage::preformatted(CTimeline::startup().writeChromeTraceFile(m_parser.value(m_cmdStartupTrace)));
+        }
+        if (m_parsed && this->isParserOptionSet(m_cmdTrace))
+        {
+            CTracer::setEnabled(false);
+            CLogMessage::preformatted(CTracer::writeChromeTraceFile(m_parser.value(m_cmdTrace)));
+        }
+
         // Release all input devices to not cause any accidental hotkey triggers anymore.
         // This is also necessary to properly free platform specific instances at a defined point in time.
         if (m_inputManager)
@@ -1484,6 +1524,24 @@ namespace BlackCore
         // Hookin, other parsing
         if (!this->parsingHookIn()) { return false; }
 
+        // startup timeline, only recorded if it is written
+        if (m_parser.isSet(m_cmdStartupTrace)) { CTimeline::startup().setRecording(true); }
+
+        // hot path tracing
+        if (m_parser.isSet(m_cmdTrace))
+        {
+            if (m_parser.isSet(m_cmdTraceSampling)) { CTracer::setSamplingInterval(m_parser.value(m_cmdTraceSampling).toInt()); }
+            CTracer::setEnabled(true);
+#ifndef BLACK_USE_TRACING
+            CLogMessage(this).warning(u"Tracing requested, but this build has no trace zones (config 'tracing'), the trace will be empty");
+#endif
+            // keep the thread buffers empty, the latest events are kept until written on shutdown
+            QTimer *drainTimer = new QTimer(this);
+            drainTimer->setObjectName("CApplication::traceDrainTimer");
+            connect(drainTimer, &QTimer::timeout, this, [] { CTracer::drain(); });
+            drainTimer->start(1000);
+        }
+
         // setup reader
         m_setupReader->parseCmdLineArguments();
         m_parsed = true;
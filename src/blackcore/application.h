@@ -654,6 +654,9 @@ namespace BlackCore
         QCommandLineOption m_cmdClearCache    {"clearcache"};   //!< Clear cache
         QCommandLineOption m_cmdTestCrashpad  {"testcrashpad"}; //!< Test a crasphpad upload
         QCommandLineOption m_cmdSkipSingleApp {"skipsa"};       //!< Skip test for single application
+        QCommandLineOption m_cmdStartupTrace  {"startuptrace"}; //!< Write startup timeline as Chrome trace
+        QCommandLineOption m_cmdTrace         {"trace"};        //!< Trace hot paths, write as Chrome trace
+        QCommandLineOption m_cmdTraceSampling {"tracesampling"}; //!< Record every n-th trace zone
         bool               m_parsed    = false;                 //!< Parsing accomplished?
         bool               m_started   = false;                 //!< Started with success?
         bool               m_singleApplication = true;          //!< Only one instance of that application
@@ -1021,8 +1021,10 @@ namespace BlackCore::Context
     QString CContextNetwork::getNetworkStatistics(bool reset, const QString &separator)
     {
         if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
-        if (!m_fsdClient) { return QString(); }
-        return m_fsdClient->getNetworkStatisticsAsText(reset, separator);
+        const QString histories = m_airspace ? m_airspace->getHistoryStatisticsInfo(separator) : QString();
+        if (!m_fsdClient) { return histories; }
+        const QString statistics = m_fsdClient->getNetworkStatisticsAsText(reset, separator);
+        return histories.isEmpty() ? statistics : statistics % separator % histories;
     }
 
     bool CContextNetwork::setNetworkStatisticsEnable(bool enabled)
@@ -11,6 +11,7 @@
 #include "blackcore/context/contextsimulatorimpl.h"
 #include "blackcore/context/contextsimulatorproxy.h"
 #include "blackmisc/dbusserver.h"
+#include "blackmisc/simulation/data/modelcaches.h"
 #include "blackmisc/pq/units.h"
 
 #include <QFlag>
@@ -18,6 +19,7 @@
 using namespace BlackConfig;
 using namespace BlackMisc;
 using namespace BlackMisc::Simulation;
+using namespace BlackMisc::Simulation::Data;
 using namespace BlackMisc::PhysicalQuantities;
 
 namespace BlackCore::Context
@@ -79,6 +81,22 @@ namespace BlackCore::Context
         return this->updateCurrentSettings(settings);
     }
 
+    QSharedPointer<const CAircraftModelSetImage> IContextSimulator::getModelSetImage() const
+    {
+        return IContextSimulator::getModelSetImage(this->getModelSetLoaderSimulator());
+    }
+
+    QSharedPointer<const CAircraftModelSetImage> IContextSimulator::getModelSetImage(const CSimulatorInfo &simulator)
+    {
+        if (!simulator.isSingleSimulator()) { return {}; }
+
+        // only used if it is the set of the core, e.g. not if the core runs on another machine
+        const CCentralMultiSimulatorModelSetCachesProvider &caches = CCentralMultiSimulatorModelSetCachesProvider::modelCachesInstance();
+        const QSharedPointer<const CAircraftModelSetImage> image = caches.getModelSetImage(simulator);
+        if (!image || image->isEmpty() || !caches.isModelSetImageCurrent(*image, simulator)) { return {}; }
+        return image;
+    }
+
     bool IContextSimulator::isSimulatorAvailable() const
     {
         return CBuildConfig::isCompiledWithFlightSimulatorSupport() && !this->getSimulatorPluginInfo().isUnspecified();
@@ -19,6 +19,7 @@
 #include "blackmisc/weather/weathergrid.h"
 #include "blackmisc/simulation/settings/simulatorsettings.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
 #include "blackmisc/simulation/aircraftmatchersetup.h"
 #include "blackmisc/simulation/matchingstatistics.h"
 #include "blackmisc/simulation/matchinglog.h"
@@ -36,6 +37,7 @@
 #include "blackconfig/buildconfig.h"
 
 #include <QObject>
+#include <QSharedPointer>
 #include <QString>
 
 // clazy:excludeall=const-signal-or-slot
@@ -275,6 +277,14 @@ namespace BlackCore::Context
         //! Time synchronization offset
         virtual BlackMisc::PhysicalQuantities::CTime getTimeSynchronizationOffset() const = 0;
 
+        //! Memory-mapped image of the current model set, if it is available on this machine and current
+        //! \remark views and lookups can use it without materializing the whole model set or transferring it via DBus
+        //! \remark null if the core runs on another machine or there is no image yet, then use getModelSet()
+        QSharedPointer<const BlackMisc::Simulation::CAircraftModelSetImage> getModelSetImage() const;
+
+        //! Memory-mapped image of the model set of the simulator, if it is available and current
+        static QSharedPointer<const BlackMisc::Simulation::CAircraftModelSetImage> getModelSetImage(const BlackMisc::Simulation::CSimulatorInfo &simulator);
+
         //! Simulator avialable (driver available)?
         bool isSimulatorAvailable() const;
 
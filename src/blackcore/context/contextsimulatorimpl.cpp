@@ -21,6 +21,7 @@
 #include "blackmisc/simulation/xplane/xplaneutil.h"
 #include "blackmisc/simulation/fscommon/fscommonutil.h"
 #include "blackmisc/simulation/matchingutils.h"
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/pq/units.h"
 #include "blackmisc/mixin/mixincompare.h"
@@ -31,6 +32,7 @@
 #include "blackmisc/logmessage.h"
 #include "blackmisc/statusmessage.h"
 #include "blackmisc/threadutils.h"
+#include "blackmisc/timeline.h"
 #include "blackmisc/verify.h"
 #include "blackconfig/buildconfig.h"
 
@@ -70,6 +72,10 @@ namespace BlackCore::Context
         Q_ASSERT_X(sApp, Q_FUNC_INFO, "Need sApp");
         MatchingLog logMatchingMessages = CBuildConfig::isLocalDeveloperDebugBuild() ? MatchingLogAll : MatchingLogSimplified;
         m_logMatchingMessages = logMatchingMessages;
+
+        // the last used model set is deserialized in the background while the plugins are collected
+        const CSimulatorInfo lastModelSetSimulator = m_modelSetSimulator.get();
+        if (lastModelSetSimulator.isSingleSimulator()) { CCentralMultiSimulatorModelSetCachesProvider::modelCachesInstance().admitCache(lastModelSetSimulator); }
         m_plugins->collectPlugins();
         this->restoreSimulatorPlugins();
 
@@ -264,8 +270,7 @@ namespace BlackCore::Context
         if (m_debugEnabled) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
         if (this->isSimulatorAvailable()) { return; } // if a plugin is loaded, do ignore this
         m_modelSetSimulator.set(simulator);
-        const CAircraftModelList models = this->getModelSet(); // cache synced
-        m_aircraftMatcher.setModelSet(models, simulator, false);
+        this->setMatcherModelSet(simulator, false);
     }
 
     CSimulatorInfo CContextSimulator::simulatorsWithInitializedModelSet() const
@@ -299,6 +304,7 @@ namespace BlackCore::Context
     bool CContextSimulator::isKnownModelInSet(const QString &modelString) const
     {
         if (m_debugEnabled) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
+        if (const auto image = this->getModelSetImage()) { return image->containsModelString(modelString); }
         const bool known = this->getModelSet().containsModelString(modelString);
         return known;
     }
@@ -374,6 +380,11 @@ namespace BlackCore::Context
         if (m_debugEnabled) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO << modelString; }
         if (!m_simulatorPlugin.second || m_simulatorPlugin.first.isUnspecified()) { return CAircraftModelList(); }
 
+        if (const auto image = this->getModelSetImage())
+        {
+            // only the found models are materialized
+            return CAircraftModelSetImage::toAircraftModelList(image->findModelsStartingWith(modelString));
+        }
         return this->getModelSet().findModelsStartingWith(modelString);
     }
 
@@ -506,8 +517,7 @@ namespace BlackCore::Context
         Q_ASSERT_X(simInfo.isSingleSimulator(), Q_FUNC_INFO, "need single simulator");
 
         m_modelSetSimulator.set(simInfo);
-        const CAircraftModelList modelSetModels = this->getModelSet(); // synced
-        m_aircraftMatcher.setModelSet(modelSetModels, simInfo, true);
+        this->setMatcherModelSet(simInfo, true);
         m_aircraftMatcher.setDefaultModel(simulator->getDefaultModel());
 
         bool c = connect(simulator, &ISimulator::simulatorStatusChanged, this, &CContextSimulator::onSimulatorStatusChanged);
@@ -752,6 +762,7 @@ namespace BlackCore::Context
         if (!this->isSimulatorAvailable()) { return; }
         m_simulatorPlugin.second->logicallyRemoveRemoteAircraft(callsign);
         m_failoverAddingCounts.remove(callsign);
+        this->clearMatchingMessages(callsign);
     }
 
     void CContextSimulator::onSimulatorStatusChanged(ISimulator::SimulatorStatus status)
@@ -1305,10 +1316,37 @@ namespace BlackCore::Context
     void CContextSimulator::initByLastUsedModelSet()
     {
         // no models in matcher, but in cache, we can set them as default
+        CTimeline::Stage stage(CTimeline::startup(), QStringLiteral("Init model set"), QStringLiteral("startup"));
         const CSimulatorInfo simulator(m_modelSetSimulator.get());
         CCentralMultiSimulatorModelSetCachesProvider::modelCachesInstance().synchronizeCache(simulator);
-        const CAircraftModelList models(this->getModelSet()); //synced
-        CLogMessage(this).info(u"Init aircraft matcher with %1 models from set for '%2'") << models.size() << simulator.toQString();
-        m_aircraftMatcher.setModelSet(models, simulator, false);
+        this->setMatcherModelSet(simulator, false);
+        CLogMessage(this).info(u"Init aircraft matcher with %1 models from set for '%2'") << m_aircraftMatcher.getModelSetCount() << simulator.toQString();
+    }
+
+    void CContextSimulator::ensureModelSetImage(const CSimulatorInfo &simulator)
+    {
+        if (!simulator.isSingleSimulator()) { return; }
+        CCentralMultiSimulatorModelSetCachesProvider &caches = CCentralMultiSimulatorModelSetCachesProvider::modelCachesInstance();
+        const QSharedPointer<const CAircraftModelSetImage> image = caches.getModelSetImage(simulator);
+        if (image && caches.isModelSetImageCurrent(*image, simulator)) { return; }
+
+        // set saved before images were written, or by another version
+        const CStatusMessage msg = caches.writeModelSetImage(simulator);
+        CLogMessage::preformatted(msg);
+    }
+
+    void CContextSimulator::setMatcherModelSet(const CSimulatorInfo &simulator, bool forced)
+    {
+        this->ensureModelSetImage(simulator);
+        const QSharedPointer<const CAircraftModelSetImage> image = IContextSimulator::getModelSetImage(simulator);
+        if (image)
+        {
+            m_aircraftMatcher.setModelSetImage(image, simulator, forced);
+        }
+        else
+        {
+            // no image could be written, use the cached set
+            m_aircraftMatcher.setModelSet(this->getModelSet(), simulator, forced); // synced
+        }
     }
 } // namespace
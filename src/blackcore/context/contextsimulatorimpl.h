@@ -43,6 +43,7 @@
 #include <QPair>
 #include <QString>
 #include <QPointer>
+#include <QSharedPointer>
 
 // clazy:excludeall=const-signal-or-slot
 
@@ -275,6 +276,13 @@ namespace BlackCore
             //! Load the last know model set
             void initByLastUsedModelSet();
 
+            //! Write the model set image if there is none for the set, so other processes can map it
+            void ensureModelSetImage(const BlackMisc::Simulation::CSimulatorInfo &simulator);
+
+            //! Set the model set of the matcher, the memory-mapped image is used if there is one
+            //! \remark the matcher only materializes the models it needs for matching
+            void setMatcherModelSet(const BlackMisc::Simulation::CSimulatorInfo &simulator, bool forced);
+
             //! Init and set validator
             void setValidator(const BlackMisc::Simulation::CSimulatorInfo &simulator);
 
@@ -36,9 +36,25 @@ namespace BlackCore::Db
         return m_airportCache.get();
     }
 
+    QSharedPointer<const CAirportIndex> CAirportDataReader::getAirportsIndex() const
+    {
+        const qint64 ts = m_airportCache.getTimestampMsSinceEpoch();
+        return m_airportsIndex.get(ts, [&] { return CAirportIndex(this->getAirports()); });
+    }
+
+    QSharedPointer<const CAirportSnapshot> CAirportDataReader::getAirportsSnapshot() const
+    {
+        const qint64 ts = m_airportCache.getTimestampMsSinceEpoch();
+        return m_airportsSnapshot.get(ts, [&]
+        {
+            return CAirportSnapshot(this->getAirports(), [](const CAirport &airport) { return airport.getIcaoAsString(); }, ts);
+        });
+    }
+
     CAirport CAirportDataReader::getAirportForIcaoDesignator(const QString &designator) const
     {
-        return this->getAirports().findFirstByIcao(CAirportIcaoCode(designator));
+        const CAirportIcaoCode icao(designator);
+        return this->getAirportsSnapshot()->findByName(icao.asString()).findFirstByIcao(icao);
     }
 
     CAirport CAirportDataReader::getAirportForNameOrLocation(const QString &nameOrLocation) const
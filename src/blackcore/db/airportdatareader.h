@@ -18,6 +18,7 @@
 #include "blackmisc/network/entityflags.h"
 
 #include <QNetworkAccessManager>
+#include <QSharedPointer>
 #include <atomic>
 
 namespace BlackCore::Db
@@ -35,6 +36,14 @@ namespace BlackCore::Db
         //! \threadsafe
         BlackMisc::Aviation::CAirportList getAirports() const;
 
+        //! Airports with a spatial index, built on first use and rebuilt if the airports changed
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CAirportIndex> getAirportsIndex() const;
+
+        //! Airports with lookup by DB key and ICAO code, rebuilt if the airports changed
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CAirportSnapshot> getAirportsSnapshot() const;
+
         //! Returns airport for designator (or default)
         //! \threadsafe
         BlackMisc::Aviation::CAirport getAirportForIcaoDesignator(const QString &designator) const;
@@ -70,6 +79,9 @@ namespace BlackCore::Db
         BlackMisc::CData<BlackCore::Data::TDbAirportCache> m_airportCache {this, &CAirportDataReader::airportCacheChanged}; //!< cache file
         std::atomic_bool m_syncedAirportCache { false }; //!< already synchronized?
 
+        BlackMisc::Db::CDbSnapshotHolder<BlackMisc::Aviation::CAirportIndex>    m_airportsIndex;    //!< spatial index of the cached airports
+        BlackMisc::Db::CDbSnapshotHolder<BlackMisc::Aviation::CAirportSnapshot> m_airportsSnapshot; //!< snapshot of the cached airports
+
         //! Reader URL (we read from where?) used to detect changes of location
         BlackMisc::CData<BlackCore::Data::TDbModelReaderBaseUrl> m_readerUrlCache {this, &CAirportDataReader::baseUrlCacheChanged };
 
@@ -12,7 +12,10 @@
 #include "blackmisc/logmessage.h"
 #include "blackmisc/fileutils.h"
 #include "blackmisc/compressutils.h"
+#include "blackmisc/parallel.h"
 #include <QElapsedTimer>
+#include <QHash>
+#include <numeric>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Json;
@@ -60,8 +63,13 @@ namespace BlackCore::Db
 
     CAircraftModel CDatabaseUtils::consolidateModelWithDbData(const CAircraftModel &model, const CAircraftModel &dbModel, bool force, bool *modified)
     {
-        Q_ASSERT_X(sApp, Q_FUNC_INFO, "Missing application object");
-        Q_ASSERT_X(sApp->hasWebDataServices(), Q_FUNC_INFO, "No web services");
+        return CDatabaseUtils::consolidateModelWithDbData(model, dbModel, nullptr, force, modified);
+    }
+
+    CAircraftModel CDatabaseUtils::consolidateModelWithDbData(const CAircraftModel &model, const CAircraftModel &dbModel, const DbDataSnapshot *snapshot, bool force, bool *modified)
+    {
+        Q_ASSERT_X(snapshot || sApp, Q_FUNC_INFO, "Missing application object");
+        Q_ASSERT_X(snapshot || sApp->hasWebDataServices(), Q_FUNC_INFO, "No web services");
 
         if (modified) { *modified = false; }
         if (!model.hasModelString()) { return model; }
@@ -84,7 +92,9 @@ namespace BlackCore::Db
         CAircraftModel consolidatedModel(model); // copy over
         if (!consolidatedModel.getLivery().hasValidDbKey())
         {
-            const CLivery dbLivery(sApp->getWebDataServices()->smartLiverySelector(consolidatedModel.getLivery()));
+            const CLivery dbLivery(snapshot ?
+                                   snapshot->liveries.smartLiverySelector(consolidatedModel.getLivery()) :
+                                   sApp->getWebDataServices()->smartLiverySelector(consolidatedModel.getLivery()));
             if (dbLivery.hasValidDbKey())
             {
                 if (modified) { *modified = true; }
@@ -94,7 +104,9 @@ namespace BlackCore::Db
         if (!consolidatedModel.getAircraftIcaoCode().hasValidDbKey() && consolidatedModel.hasAircraftDesignator())
         {
             // try to find DB aircraft ICAO here
-            const CAircraftIcaoCode dbIcao(sApp->getWebDataServices()->smartAircraftIcaoSelector(consolidatedModel.getAircraftIcaoCode()));
+            const CAircraftIcaoCode dbIcao(snapshot ?
+                                           snapshot->aircraftIcaos.smartAircraftIcaoSelector(consolidatedModel.getAircraftIcaoCode()) :
+                                           sApp->getWebDataServices()->smartAircraftIcaoSelector(consolidatedModel.getAircraftIcaoCode()));
             if (dbIcao.hasValidDbKey())
             {
                 if (modified) { *modified = true; }
@@ -102,7 +114,7 @@ namespace BlackCore::Db
             }
         }
 
-        const CDistributor dbDistributor(sApp->getWebDataServices()->getDistributors().smartDistributorSelector(model.getDistributor(), model));
+        const CDistributor dbDistributor((snapshot ? snapshot->distributors : sApp->getWebDataServices()->getDistributors()).smartDistributorSelector(model.getDistributor(), model));
         if (dbDistributor.isLoadedFromDb())
         {
             if (modified) { *modified = true; }
@@ -270,6 +282,54 @@ namespace BlackCore::Db
         return c;
     }
 
+    int CDatabaseUtils::consolidateModelsWithDbDataInParallel(CAircraftModelList &models, bool force)
+    {
+        if (models.isEmpty()) { return 0; }
+        if (!hasDbAircraftData()) { return 0; }
+
+        QElapsedTimer timer;
+        timer.start();
+
+        // copy the DB data once, looking up the DB model per model copied the whole DB model list
+        const CWebDataServices *webDataServices = sApp->getWebDataServices();
+        const CAircraftModelList dbModels = webDataServices->getModels();
+        DbDataSnapshot snapshot;
+        snapshot.liveries = webDataServices->getLiveries();
+        snapshot.aircraftIcaos = webDataServices->getAircraftIcaoCodes();
+        snapshot.distributors = webDataServices->getDistributors();
+
+        // same as findFirstByModelStringOrDefault, case insensitive and first model wins
+        QHash<QString, int> dbModelIndexes;
+        dbModelIndexes.reserve(dbModels.size());
+        for (int i = 0; i < dbModels.size(); i++)
+        {
+            const QString ms = dbModels[i].getModelString().toUpper();
+            if (ms.isEmpty() || dbModelIndexes.contains(ms)) { continue; }
+            dbModelIndexes.insert(ms, i);
+        }
+
+        const auto first = models.begin(); // detach once, chunks write disjoint ranges
+        const QVector<int> counts = CParallel::mapChunks<int>(models.size(), 250, [&](int begin, int end)
+        {
+            int c = 0;
+            for (int i = begin; i < end; i++)
+            {
+                CAircraftModel &model = first[i];
+                if (!force && model.isLoadedFromDb()) { continue; }
+                if (!model.hasModelString()) { continue; }
+                const int dbIndex = dbModelIndexes.value(model.getModelString().toUpper(), -1);
+                bool modified = false;
+                model = CDatabaseUtils::consolidateModelWithDbData(model, dbIndex >= 0 ? dbModels[dbIndex] : CAircraftModel(), &snapshot, force, &modified);
+                if (modified || model.hasValidDbKey()) { c++; }
+            }
+            return c;
+        });
+
+        const int c = std::accumulate(counts.cbegin(), counts.cend(), 0);
+        CLogMessage(static_cast<CDatabaseUtils *>(nullptr)).info(u"Consolidated %1 models in %2ms (%3 chunks)") << models.size() << timer.elapsed() << counts.size();
+        return c;
+    }
+
     int CDatabaseUtils::consolidateModelsWithDbData(const CAircraftModelList &dbModels, CAircraftModelList &simulatorModels, bool force)
     {
         if (dbModels.isEmpty() || simulatorModels.isEmpty()) { return 0; }
@@ -13,8 +13,12 @@
 
 #include "blackcore/progress.h"
 #include "blackcore/blackcoreexport.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
 #include "blackmisc/simulation/aircraftmodel.h"
 #include "blackmisc/simulation/autopublishdata.h"
+#include "blackmisc/simulation/distributorlist.h"
+#include "blackmisc/aviation/aircrafticaocodelist.h"
+#include "blackmisc/aviation/liverylist.h"
 
 #include <QHttpPart>
 #include <QUrlQuery>
@@ -61,6 +65,11 @@ namespace BlackCore::Db
         //! Consolidate models with DB data
         static int consolidateModelsWithDbDataAllowsGuiRefresh(BlackMisc::Simulation::CAircraftModelList &models, bool force, bool processEvents);
 
+        //! Consolidate models with DB data, chunks of models are consolidated in parallel
+        //! \remark the DB data are copied once and DB models are looked up by an index, no per model access to the web data services
+        //! \remark blocking, not for the GUI thread with big lists
+        static int consolidateModelsWithDbDataInParallel(BlackMisc::Simulation::CAircraftModelList &models, bool force);
+
         //! Consolidate models with DB data (simpler/faster version of CAircraftModel::consolidateModelWithDbData)
         static int consolidateModelsWithDbModelAndDistributor(BlackMisc::Simulation::CAircraftModelList &models, bool force);
 
@@ -116,6 +125,19 @@ namespace BlackCore::Db
         //! Which auto-publish data did change?
         //! \sa CAutoPublishData::analyzeAgainstDBData
         static BlackMisc::Simulation::ChangedAutoPublishData autoPublishDataChanged(const BlackMisc::Simulation::CAircraftModel &model, const BlackMisc::PhysicalQuantities::CLength &cg, const BlackMisc::Simulation::CSimulatorInfo &simulator);
+
+    private:
+        //! DB data used when consolidating models
+        struct DbDataSnapshot
+        {
+            BlackMisc::Aviation::CLiveryList liveries;                //!< DB liveries
+            BlackMisc::Aviation::CAircraftIcaoCodeList aircraftIcaos; //!< DB aircraft ICAO codes
+            BlackMisc::Simulation::CDistributorList distributors;     //!< DB distributors
+        };
+
+        //! Consolidate model data with DB data
+        //! \remark if snapshot is null the DB data are taken from the web data services
+        static BlackMisc::Simulation::CAircraftModel consolidateModelWithDbData(const BlackMisc::Simulation::CAircraftModel &model, const BlackMisc::Simulation::CAircraftModel &dbModel, const DbDataSnapshot *snapshot, bool force, bool *modified);
     };
 } // ns
 #endif // guard
@@ -54,14 +54,23 @@ namespace BlackCore::Db
         return m_aircraftIcaoCache.get();
     }
 
+    QSharedPointer<const CAircraftIcaoCodeSnapshot> CIcaoDataReader::getAircraftIcaoCodesSnapshot() const
+    {
+        const qint64 ts = m_aircraftIcaoCache.getTimestampMsSinceEpoch();
+        return m_aircraftIcaoSnapshot.get(ts, [&]
+        {
+            return CAircraftIcaoCodeSnapshot(this->getAircraftIcaoCodes(), [](const CAircraftIcaoCode &code) { return code.getDesignator(); }, ts);
+        });
+    }
+
     CAircraftIcaoCode CIcaoDataReader::getAircraftIcaoCodeForDesignator(const QString &designator) const
     {
-        return this->getAircraftIcaoCodes().findFirstByDesignatorAndRank(designator);
+        return this->getAircraftIcaoCodesSnapshot()->findByName(designator).findFirstByDesignatorAndRank(designator);
     }
 
     CAircraftIcaoCodeList CIcaoDataReader::getAircraftIcaoCodesForDesignator(const QString &designator) const
     {
-        return this->getAircraftIcaoCodes().findByDesignator(designator);
+        return this->getAircraftIcaoCodesSnapshot()->findByName(designator).findByDesignator(designator);
     }
 
     CAircraftIcaoCodeList CIcaoDataReader::getAircraftIcaoCodesForIataCode(const QString &iataCode) const
@@ -71,12 +80,12 @@ namespace BlackCore::Db
 
     CAircraftIcaoCode CIcaoDataReader::getAircraftIcaoCodeForDbKey(int key) const
     {
-        return this->getAircraftIcaoCodes().findByKey(key);
+        return this->getAircraftIcaoCodesSnapshot()->findByDbKey(key);
     }
 
     bool CIcaoDataReader::containsAircraftIcaoDesignator(const QString &designator) const
     {
-        return this->getAircraftIcaoCodes().containsDesignator(designator);
+        return this->getAircraftIcaoCodesSnapshot()->findByName(designator).containsDesignator(designator);
     }
 
     CAirlineIcaoCodeList CIcaoDataReader::getAirlineIcaoCodes() const
@@ -84,6 +93,15 @@ namespace BlackCore::Db
         return m_airlineIcaoCache.get();
     }
 
+    QSharedPointer<const CAirlineIcaoCodeSnapshot> CIcaoDataReader::getAirlineIcaoCodesSnapshot() const
+    {
+        const qint64 ts = m_airlineIcaoCache.getTimestampMsSinceEpoch();
+        return m_airlineIcaoSnapshot.get(ts, [&]
+        {
+            return CAirlineIcaoCodeSnapshot(this->getAirlineIcaoCodes(), [](const CAirlineIcaoCode &code) { return code.getDesignator(); }, ts);
+        });
+    }
+
     CAircraftIcaoCode CIcaoDataReader::smartAircraftIcaoSelector(const CAircraftIcaoCode &icaoPattern) const
     {
         CAircraftIcaoCodeList codes(getAircraftIcaoCodes()); // thread safe copy
@@ -107,17 +125,17 @@ namespace BlackCore::Db
 
     CAirlineIcaoCodeList CIcaoDataReader::getAirlineIcaoCodesForDesignator(const QString &designator) const
     {
-        return this->getAirlineIcaoCodes().findByVDesignator(designator);
+        return this->getAirlineIcaoCodesForVDesignatorCandidates(designator).findByVDesignator(designator);
     }
 
     bool CIcaoDataReader::containsAirlineIcaoDesignator(const QString &designator) const
     {
-        return this->getAirlineIcaoCodes().containsVDesignator(designator);
+        return this->getAirlineIcaoCodesForVDesignatorCandidates(designator).containsVDesignator(designator);
     }
 
     CAirlineIcaoCode CIcaoDataReader::getAirlineIcaoCodeForUniqueDesignatorOrDefault(const QString &designator, bool preferOperatingAirlines) const
     {
-        return this->getAirlineIcaoCodes().findByUniqueVDesignatorOrDefault(designator, preferOperatingAirlines);
+        return this->getAirlineIcaoCodesForVDesignatorCandidates(designator).findByUniqueVDesignatorOrDefault(designator, preferOperatingAirlines);
     }
 
     CAirlineIcaoCodeList CIcaoDataReader::getAirlineIcaoCodesForIataCode(const QString &iataCode) const
@@ -130,9 +148,19 @@ namespace BlackCore::Db
         return this->getAirlineIcaoCodes().findByUniqueIataCodeOrDefault(iataCode);
     }
 
+    CAirlineIcaoCodeList CIcaoDataReader::getAirlineIcaoCodesForVDesignatorCandidates(const QString &designator) const
+    {
+        // the snapshot is by designator, a virtual airline "VDLH" has the designator "DLH"
+        const QSharedPointer<const CAirlineIcaoCodeSnapshot> snapshot = this->getAirlineIcaoCodesSnapshot();
+        CAirlineIcaoCodeList candidates = snapshot->findByName(designator);
+        const QString d = designator.trimmed();
+        if (d.length() > 3 && d.startsWith('V', Qt::CaseInsensitive)) { candidates.push_back(snapshot->findByName(d.mid(1))); }
+        return candidates;
+    }
+
     CAirlineIcaoCode CIcaoDataReader::getAirlineIcaoCodeForDbKey(int key) const
     {
-        return this->getAirlineIcaoCodes().findByKey(key);
+        return this->getAirlineIcaoCodesSnapshot()->findByDbKey(key);
     }
 
     CAirlineIcaoCode CIcaoDataReader::smartAirlineIcaoSelector(const CAirlineIcaoCode &icaoPattern, const CCallsign &callsign) const
@@ -716,7 +744,7 @@ namespace BlackCore::Db
 
         for (const auto &pair : fileContents)
         {
-            CWorker::fromTask(this, Q_FUNC_INFO, [pair, directory]
+            CWorker::fromTask(this, Q_FUNC_INFO, CTaskPool::LowPriority, [pair, directory]
             {
                 CFileUtils::writeStringToFile(CFileUtils::appendFilePaths(directory.absolutePath(), CDbInfo::entityToSharedName(pair.first)), pair.second);
             });
@@ -24,6 +24,7 @@
 
 #include <QObject>
 #include <QReadWriteLock>
+#include <QSharedPointer>
 #include <QString>
 #include <atomic>
 
@@ -45,6 +46,10 @@ namespace BlackCore::Db
         //! \threadsafe
         BlackMisc::Aviation::CAircraftIcaoCodeList getAircraftIcaoCodes() const;
 
+        //! Aircraft ICAO codes with lookup by DB key and designator, rebuilt if the codes changed
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CAircraftIcaoCodeSnapshot> getAircraftIcaoCodesSnapshot() const;
+
         //! Get aircraft ICAO information count
         //! \threadsafe
         int getAircraftIcaoCodesCount() const;
@@ -93,6 +98,10 @@ namespace BlackCore::Db
         //! \threadsafe
         BlackMisc::Aviation::CAirlineIcaoCodeList getAirlineIcaoCodes() const;
 
+        //! Airline ICAO codes with lookup by DB key and designator, rebuilt if the codes changed
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CAirlineIcaoCodeSnapshot> getAirlineIcaoCodesSnapshot() const;
+
         //! Get airline ICAO information count
         //! \threadsafe
         int getAirlineIcaoCodesCount() const;
@@ -168,6 +177,8 @@ namespace BlackCore::Db
         std::atomic_bool m_syncedAirlineIcaoCache  { false }; //!< already synchronized?
         std::atomic_bool m_syncedCountryCache      { false }; //!< already synchronized?
         std::atomic_bool m_syncedCategories        { false }; //!< already synchronized?
+        BlackMisc::Db::CDbSnapshotHolder<BlackMisc::Aviation::CAircraftIcaoCodeSnapshot> m_aircraftIcaoSnapshot; //!< snapshot of the cached aircraft ICAO codes
+        BlackMisc::Db::CDbSnapshotHolder<BlackMisc::Aviation::CAirlineIcaoCodeSnapshot>  m_airlineIcaoSnapshot;  //!< snapshot of the cached airline ICAO codes
 
         //! \copydoc CDatabaseReader::read
         virtual void read(BlackMisc::Network::CEntityFlags::Entity entities,
@@ -206,6 +217,10 @@ namespace BlackCore::Db
         //! Update reader URL
         void updateReaderUrl(const BlackMisc::Network::CUrl &url);
 
+        //! Airline ICAO codes which could match the V-designator
+        //! \threadsafe
+        BlackMisc::Aviation::CAirlineIcaoCodeList getAirlineIcaoCodesForVDesignatorCandidates(const QString &designator) const;
+
         //! URL
         BlackMisc::Network::CUrl getAircraftIcaoUrl(BlackMisc::Db::CDbFlags::DataRetrievalModeFlag mode) const;
 
@@ -54,11 +54,19 @@ namespace BlackCore::Db
         return m_liveryCache.get();
     }
 
+    QSharedPointer<const CLiverySnapshot> CModelDataReader::getLiveriesSnapshot() const
+    {
+        const qint64 ts = m_liveryCache.getTimestampMsSinceEpoch();
+        return m_liveriesSnapshot.get(ts, [&]
+        {
+            return CLiverySnapshot(this->getLiveries(), [](const CLivery &livery) { return livery.getCombinedCode(); }, ts);
+        });
+    }
+
     CLivery CModelDataReader::getLiveryForCombinedCode(const QString &combinedCode) const
     {
         if (!CLivery::isValidCombinedCode(combinedCode)) { return CLivery(); }
-        const CLiveryList liveries(getLiveries());
-        return liveries.findByCombinedCode(combinedCode);
+        return this->getLiveriesSnapshot()->findByName(combinedCode).findByCombinedCode(combinedCode);
     }
 
     CLivery CModelDataReader::getStdLiveryForAirlineVDesignator(const CAirlineIcaoCode &icao) const
@@ -71,8 +79,7 @@ namespace BlackCore::Db
     CLivery CModelDataReader::getLiveryForDbKey(int id) const
     {
         if (id < 0) { return CLivery(); }
-        const CLiveryList liveries(getLiveries());
-        return liveries.findByKey(id);
+        return this->getLiveriesSnapshot()->findByDbKey(id);
     }
 
     CLivery CModelDataReader::smartLiverySelector(const CLivery &liveryPattern) const
@@ -98,24 +105,31 @@ namespace BlackCore::Db
         return m_modelCache.get();
     }
 
+    QSharedPointer<const CAircraftModelSnapshot> CModelDataReader::getModelsSnapshot() const
+    {
+        const qint64 ts = m_modelCache.getTimestampMsSinceEpoch();
+        return m_modelsSnapshot.get(ts, [&]
+        {
+            return CAircraftModelSnapshot(this->getModels(), [](const CAircraftModel &model) { return model.getModelString(); }, ts);
+        });
+    }
+
     CAircraftModel CModelDataReader::getModelForModelString(const QString &modelString) const
     {
         if (modelString.isEmpty()) { return CAircraftModel(); }
-        const CAircraftModelList models(this->getModels());
-        return models.findFirstByModelStringOrDefault(modelString);
+        return this->getModelsSnapshot()->findByName(modelString).findFirstByModelStringOrDefault(modelString);
     }
 
     bool CModelDataReader::containsModelString(const QString &modelString) const
     {
         if (modelString.isEmpty()) { return false; }
-        return this->getModels().containsModelString(modelString);
+        return this->getModelsSnapshot()->findByName(modelString).containsModelString(modelString);
     }
 
     CAircraftModel CModelDataReader::getModelForDbKey(int dbKey) const
     {
         if (dbKey < 0) { return CAircraftModel(); }
-        const CAircraftModelList models(this->getModels());
-        return models.findByKey(dbKey);
+        return this->getModelsSnapshot()->findByDbKey(dbKey);
     }
 
     QSet<QString> CModelDataReader::getAircraftDesignatorsForAirline(const CAirlineIcaoCode &code) const
@@ -623,7 +637,7 @@ namespace BlackCore::Db
 
         for (const auto &pair : fileContents)
         {
-            CWorker::fromTask(this, Q_FUNC_INFO, [pair, directory]
+            CWorker::fromTask(this, Q_FUNC_INFO, CTaskPool::LowPriority, [pair, directory]
             {
                 CFileUtils::writeStringToFile(CFileUtils::appendFilePaths(directory.absolutePath(), pair.first), pair.second);
             });
@@ -29,6 +29,7 @@
 #include <QString>
 #include <QStringList>
 #include <QSet>
+#include <QSharedPointer>
 
 class QNetworkReply;
 
@@ -47,6 +48,10 @@ namespace BlackCore::Db
         //! \threadsafe
         BlackMisc::Aviation::CLiveryList getLiveries() const;
 
+        //! Liveries with lookup by DB key and combined code, rebuilt if the liveries changed
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CLiverySnapshot> getLiveriesSnapshot() const;
+
         //! Get aircraft livery for code
         //! \threadsafe
         BlackMisc::Aviation::CLivery getLiveryForCombinedCode(const QString &combinedCode) const;
@@ -75,6 +80,10 @@ namespace BlackCore::Db
         //! \threadsafe
         BlackMisc::Simulation::CAircraftModelList getModels() const;
 
+        //! Models with lookup by DB key and model string, rebuilt if the models changed
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Simulation::CAircraftModelSnapshot> getModelsSnapshot() const;
+
         //! Get model for string
         //! \threadsafe
         BlackMisc::Simulation::CAircraftModel getModelForModelString(const QString &modelString) const;
@@ -160,6 +169,8 @@ namespace BlackCore::Db
         std::atomic_bool m_syncedLiveryCache { false }; //!< already synchronized?
         std::atomic_bool m_syncedModelCache  { false }; //!< already synchronized?
         std::atomic_bool m_syncedDistributorCache { false }; //!< already synchronized?
+        BlackMisc::Db::CDbSnapshotHolder<BlackMisc::Aviation::CLiverySnapshot> m_liveriesSnapshot;      //!< snapshot of the cached liveries
+        BlackMisc::Db::CDbSnapshotHolder<BlackMisc::Simulation::CAircraftModelSnapshot> m_modelsSnapshot; //!< snapshot of the cached models
 
         //! \copydoc CDatabaseReader::read
         virtual void read(BlackMisc::Network::CEntityFlags::Entity entities = BlackMisc::Network::CEntityFlags::DistributorLiveryModel,
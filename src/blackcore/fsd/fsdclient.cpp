@@ -45,6 +45,7 @@
 #include "blackmisc/network/rawfsdmessage.h"
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/threadutils.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/range.h"
 #include "blackmisc/verify.h"
@@ -315,13 +316,13 @@ namespace BlackCore::Fsd
         if (m.isPilot())
         {
             const AddPilot pilotLogin(callsign, cid, password, m_pilotRating, m_protocolRevision, m_simType, name);
-            sendQueudedMessage(pilotLogin);
+            sendQueudedMessage(pilotLogin, CFsdSendQueue::PriorityControl);
             CStatusMessage(this).info(u"Sending login as '%1' '%2' '%3' '%4' '%5' '%6'") << callsign << cid << toQString(m_pilotRating) << m_protocolRevision << toQString(m_simType) << name;
         }
         else if (m.isObserver())
         {
             const AddAtc addAtc(callsign, name, cid, password, m_atcRating, m_protocolRevision);
-            sendQueudedMessage(addAtc);
+            sendQueudedMessage(addAtc, CFsdSendQueue::PriorityControl);
             CStatusMessage(this).info(u"Sending OBS login as '%1' '%2' '%3' '%4' '%5'") << callsign << cid << toQString(m_atcRating) << m_protocolRevision << name;
         }
 
@@ -335,14 +336,14 @@ namespace BlackCore::Fsd
     {
         const QString cid = this->getServer().getUser().getId();
         const DeletePilot deletePilot(m_ownCallsign.getFsdCallsignString(), cid);
-        sendQueudedMessage(deletePilot);
+        sendDirectMessage(deletePilot); // socket is closed right after, queue is not flushed anymore
     }
 
     void CFSDClient::sendDeleteAtc()
     {
         const QString cid = this->getServer().getUser().getId();
         const DeleteAtc deleteAtc(getOwnCallsignAsString(), cid);
-        sendQueudedMessage(deleteAtc);
+        sendDirectMessage(deleteAtc); // socket is closed right after, queue is not flushed anymore
     }
 
     void CFSDClient::sendPilotDataUpdate()
@@ -377,7 +378,7 @@ namespace BlackCore::Fsd
                                             myAircraft.getBank().value(CAngleUnit::deg()),
                                             myAircraft.getHeading().normalizedTo360Degrees().value(CAngleUnit::deg()),
                                             myAircraft.getParts().isOnGround());
-            sendQueudedMessage(pilotDataUpdate);
+            sendQueudedMessage(pilotDataUpdate, CFsdSendQueue::PriorityPosition, PilotDataUpdate::pdu());
         }
     }
 
@@ -399,7 +400,7 @@ namespace BlackCore::Fsd
         for (const auto &receiver : std::as_const(m_interimPositionReceivers))
         {
             interimPilotDataUpdate.setReceiver(receiver.asString());
-            sendQueudedMessage(interimPilotDataUpdate);
+            sendQueudedMessage(interimPilotDataUpdate, CFsdSendQueue::PriorityPosition, InterimPilotDataUpdate::pdu() % receiver.asString());
             // statistics
         }
     }
@@ -451,22 +452,22 @@ namespace BlackCore::Fsd
 
         if (m_stoppedSendingVisualPositions)
         {
-            sendQueudedMessage(visualPilotDataUpdate.toStopped());
+            sendQueudedMessage(visualPilotDataUpdate.toStopped(), CFsdSendQueue::PriorityPosition, VisualPilotDataStopped::pdu());
         }
         else if (m_visualPositionUpdateSentCount++ % 25 == 0)
         {
-            sendQueudedMessage(visualPilotDataUpdate.toPeriodic());
+            sendQueudedMessage(visualPilotDataUpdate.toPeriodic(), CFsdSendQueue::PriorityPosition, VisualPilotDataPeriodic::pdu());
         }
         else
         {
-            sendQueudedMessage(visualPilotDataUpdate);
+            sendQueudedMessage(visualPilotDataUpdate, CFsdSendQueue::PriorityPosition, VisualPilotDataUpdate::pdu());
         }
     }
 
     void CFSDClient::sendAtcDataUpdate(double latitude, double longitude)
     {
         const AtcDataUpdate atcDataUpdate(getOwnCallsignAsString(), 199998, CFacilityType::OBS, 300, AtcRating::Observer, latitude, longitude, 0);
-        sendQueudedMessage(atcDataUpdate);
+        sendQueudedMessage(atcDataUpdate, CFsdSendQueue::PriorityPosition, AtcDataUpdate::pdu());
     }
 
     void CFSDClient::sendPing(const QString &receiver)
@@ -620,7 +621,7 @@ namespace BlackCore::Fsd
         {
             if (message.getRecipientCallsign().isEmpty()) { continue; }
             const TextMessage textMessage(ownCallsign, message.getRecipientCallsign().getFsdCallsignString(), message.getMessage());
-            sendQueudedMessage(textMessage);
+            sendQueudedMessage(textMessage, CFsdSendQueue::PriorityText);
             increaseStatisticsValue(QStringLiteral("sendTextMessages.PM"));
             emit textMessageSent(message);
         }
@@ -670,7 +671,7 @@ namespace BlackCore::Fsd
         else if (receiverGroup == TextMessageGroups::AllSups)         { receiver = QStringLiteral("*S"); }
         else { return; }
         const TextMessage textMessage(getOwnCallsignAsString(), receiver, message);
-        sendQueudedMessage(textMessage);
+        sendQueudedMessage(textMessage, CFsdSendQueue::PriorityText);
         if(receiver == QStringLiteral("*S"))
         {
             const CCallsign sender(getOwnCallsignAsString());
@@ -697,7 +698,7 @@ namespace BlackCore::Fsd
         }
 
         const TextMessage radioMessage(getOwnCallsignAsString(), receivers.join('&'), message);
-        sendQueudedMessage(radioMessage);
+        sendQueudedMessage(radioMessage, CFsdSendQueue::PriorityText);
         increaseStatisticsValue(QStringLiteral("sendTextMessages"));
     }
 
@@ -828,20 +829,25 @@ namespace BlackCore::Fsd
         if (!m_unitTestMode)  { m_socket->write(bufferEncoded); }
 
         // remove CR/LF and emit
-        emitRawFsdMessage(message.trimmed(), true);
+        if (m_unitTestMode || m_rawFsdMessagesEnabled) { emitRawFsdMessage(message.trimmed(), true); }
     }
 
     void CFSDClient::sendQueuedMessage()
     {
-        if (m_queuedFsdMessages.isEmpty()) { return; }
-        const int s = m_queuedFsdMessages.size();
-        this->sendMessageString(m_queuedFsdMessages.dequeue());
+        if (m_resetSendQueueStatistics)
+        {
+            m_resetSendQueueStatistics = false;
+            m_sendQueue.resetStatistics();
+        }
+        if (m_sendQueue.isEmpty()) { return; }
 
-        // send up to 6 at once
-        if (s > 5)  { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 10) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 20) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 30) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
+        // rate shaping, send up to 6 at once, more if we are falling behind
+        const int s = m_sendQueue.size();
+        int maxMessages = 1;
+        if (s > 5)  { maxMessages++; }
+        if (s > 10) { maxMessages++; }
+        if (s > 20) { maxMessages++; }
+        if (s > 30) { maxMessages++; }
 
         // overload
         // no idea, if we ever get here
@@ -849,14 +855,28 @@ namespace BlackCore::Fsd
         {
             const StatusSeverity severity = s > 75 ? SeverityWarning : SeverityInfo;
             CLogMessage(this).log(severity, u"Too many queued messages (%1), bulk send!") << s;
-            int sendNo = 10;
-            if (s > 75)  { sendNo = 20; }
-            if (s > 100) { sendNo = 30; }
+            maxMessages += 10;
+            if (s > 75)  { maxMessages += 10; }
+            if (s > 100) { maxMessages += 10; }
+        }
 
-            for (int i = 0; i < sendNo; i++)
-            {
-                this->sendMessageString(m_queuedFsdMessages.dequeue());
-            }
+        // all messages of this tick in one write
+        const bool raw = m_printToConsole || m_rawFsdMessagesEnabled;
+        m_sentMessages.clear();
+        const int sent = m_sendQueue.takeBatch(m_fsdTextCodec, m_sendBuffer, maxMessages, raw ? &m_sentMessages : nullptr, QDateTime::currentMSecsSinceEpoch());
+        if (sent < 1) { return; }
+        m_socket->write(m_sendBuffer);
+
+        for (const QString &message : std::as_const(m_sentMessages))
+        {
+            if (m_printToConsole) { qDebug() << "FSD Sent=>" << message; }
+            emitRawFsdMessage(message.trimmed(), true);
+        }
+
+        if (m_statistics)
+        {
+            QWriteLocker l(&m_lockStatistics);
+            m_sendQueueStatistics = m_sendQueue.getStatistics();
         }
     }
 
@@ -1004,7 +1024,7 @@ namespace BlackCore::Fsd
         vatsim_get_system_unique_id(sysuid.data());
         const QString cid = m_server.getUser().getId();
         const ClientIdentification clientIdentification(getOwnCallsignAsString(), vatsim_auth_get_client_id(m_clientAuth), m_clientName, m_versionMajor, m_versionMinor, cid, sysuid.data(), fsdChallenge);
-        this->sendQueudedMessage(clientIdentification);
+        this->sendQueudedMessage(clientIdentification, CFsdSendQueue::PriorityControl);
 
         if (getServer().getEcosystem().isSystem(CEcosystem::VATSIM))
         {
@@ -1475,18 +1495,15 @@ namespace BlackCore::Fsd
 
             const CCallsign callsign(clientQuery.sender(), CCallsign::Aircraft);
 
-            QJsonParseError parserError;
-            const QByteArray json = aircraftConfigJson.toUtf8();
-            const QJsonDocument doc = QJsonDocument::fromJson(json, &parserError);
-
-            if (parserError.error != QJsonParseError::NoError)
+            // single pass parsing, no QJsonDocument for the frequent incremental packets
+            const CAircraftPartsDelta delta = CAircraftPartsDelta::fromPacket(aircraftConfigJson);
+            if (!delta.isValid())
             {
-                CLogMessage(this).warning(u"Failed to parse aircraft config packet: '%1' packet: '%2'") << parserError.errorString() << QString(json);
+                CLogMessage(this).warning(u"Failed to parse aircraft config packet: '%1' packet: '%2'") << delta.getErrorMessage() << aircraftConfigJson;
                 return; // we cannot parse the packet, so we give up here
             }
 
-            const QJsonObject packet = doc.object();
-            if (packet == JsonPackets::aircraftConfigRequest())
+            if (delta.isFullDataRequest() && !delta.hasConfig())
             {
                 // this MUST work for NOT IN RANGE aircraft as well
                 // Here we send our OWN parts
@@ -1501,11 +1518,10 @@ namespace BlackCore::Fsd
             const bool inRange = isAircraftInRange(callsign);
             if (!inRange) { return; } // sort out all broadcasted we DO NOT NEED
             if (!getSetupForServer().receiveAircraftParts()) { return; }
-            const QJsonObject config = doc.object().value("config").toObject();
-            if (config.isEmpty()) { return; }
+            if (delta.getAttributesCount() < 1) { return; }
 
             const qint64 offsetTimeMs = currentOffsetTime(callsign);
-            emit aircraftConfigReceived(clientQuery.sender(), config, offsetTimeMs);
+            emit aircraftConfigReceived(clientQuery.sender(), delta, offsetTimeMs);
         }
     }
 
@@ -1942,7 +1958,7 @@ namespace BlackCore::Fsd
         m_lastPositionUpdate.clear();
         m_lastOffsetTimes.clear();
         m_atcStations.clear();
-        m_queuedFsdMessages.clear();
+        m_sendQueue.clear();
         m_sentAircraftConfig = CAircraftParts::null();
         m_loginSince = -1;
     }
@@ -2114,6 +2130,8 @@ namespace BlackCore::Fsd
         QWriteLocker l(&m_lockStatistics);
         m_callStatistics.clear();
         m_callByTime.clear();
+        m_sendQueueStatistics = {};
+        m_resetSendQueueStatistics = true;
     }
 
     QString CFSDClient::getNetworkStatisticsAsText(bool reset, const QString &separator)
@@ -2121,14 +2139,16 @@ namespace BlackCore::Fsd
         QVector<std::pair<int, QString>> transformed;
         QMap <QString, int> callStatistics;
         QVector <QPair<qint64, QString>> callByTime;
+        CFsdSendQueue::Statistics sendQueueStatistics;
 
         {
             QReadLocker l(&m_lockStatistics);
             callStatistics = m_callStatistics;
             callByTime     = m_callByTime;
+            sendQueueStatistics = m_sendQueueStatistics;
         }
 
-        if (callStatistics.isEmpty()) { return QString(); }
+        if (callStatistics.isEmpty() && sendQueueStatistics.sentMessages < 1) { return QString(); }
         for (const auto [key, value] : makePairsRange(std::as_const(callStatistics)))
         {
             // key is pair.first, value is pair.second
@@ -2138,6 +2158,7 @@ namespace BlackCore::Fsd
         // sorted by value
         std::sort(transformed.begin(), transformed.end(), std::greater<>());
         QString stats;
+        if (sendQueueStatistics.sentMessages > 0) { stats = sendQueueStatistics.toQString(); }
         for (const auto &pair : transformed)
         {
             stats +=
@@ -2175,6 +2196,7 @@ namespace BlackCore::Fsd
     void CFSDClient::readDataFromSocketMaxLines(int maxLines)
     {
         if (m_socket->bytesAvailable() < 1) { return; }
+        BLACK_TRACE_ZONE("FSD read", "fsd");
 
         int lines = 0;
 
@@ -2206,6 +2228,7 @@ namespace BlackCore::Fsd
             }
 
         }
+        BLACK_TRACE_COUNTER("FSD lines read", lines);
     }
 
     QString CFSDClient::socketErrorString(QAbstractSocket::SocketError error) const
@@ -2226,6 +2249,7 @@ namespace BlackCore::Fsd
 
     void CFSDClient::parseMessage(const QString &lineRaw)
     {
+        BLACK_TRACE_ZONE("FSD parse", "fsd");
         MessageType messageType = MessageType::Unknown;
         QString cmd;
         const QString line = lineRaw.trimmed();
@@ -2350,7 +2374,7 @@ namespace BlackCore::Fsd
         m_positionUpdateTimer.start(c_updatePostionIntervalMsec);
         m_scheduledConfigUpdate.start(c_processingIntervalMsec);
         m_fsdSendMessageTimer.start(c_sendFsdMsgIntervalMsec);
-        m_queuedFsdMessages.clear(); // clear everything before the timer is started
+        m_sendQueue.clear(); // clear everything before the timer is started
 
         // interim positions
         if (this->isInterimPositionSendingEnabledForServer()) { m_interimPositionUpdateTimer.start(c_updateInterimPostionIntervalMsec); }
@@ -15,6 +15,7 @@
 #include "blackcore/vatsim/vatsimsettings.h"
 #include "blackcore/fsd/enums.h"
 #include "blackcore/fsd/messagebase.h"
+#include "blackcore/fsd/fsdsendqueue.h"
 
 #include "blackmisc/simulation/ownaircraftprovider.h"
 #include "blackmisc/simulation/remoteaircraftprovider.h"
@@ -24,6 +25,7 @@
 #include "blackmisc/aviation/flightplan.h"
 #include "blackmisc/aviation/informationmessage.h"
 #include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/aircraftpartsdelta.h"
 #include "blackmisc/network/rawfsdmessage.h"
 #include "blackmisc/network/connectionstatus.h"
 #include "blackmisc/network/loginmode.h"
@@ -46,7 +48,7 @@
 #include <QTimer>
 #include <QTextCodec>
 #include <QReadWriteLock>
-#include <QQueue>
+#include <QDateTime>
 
 #include <atomic>
 
@@ -216,7 +218,7 @@ namespace BlackCore::Fsd
         void pongReceived(const QString &sender, double elapsedTimeMs);
         void flightPlanReceived(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::Aviation::CFlightPlan &flightPlan);
         void textMessagesReceived(const BlackMisc::Network::CTextMessageList &messages);
-        void aircraftConfigReceived(const QString &sender, const QJsonObject &config, qint64 currentOffsetTimeMs);
+        void aircraftConfigReceived(const QString &sender, const BlackMisc::Aviation::CAircraftPartsDelta &delta, qint64 currentOffsetTimeMs);
         void validAtcResponseReceived(const QString &callsign, bool isValidAtc);
         void capabilityResponseReceived(const BlackMisc::Aviation::CCallsign &sender, BlackMisc::Network::CClient::Capabilities capabilities);
         void com1FrequencyResponseReceived(const QString &sender, const BlackMisc::PhysicalQuantities::CFrequency &frequency);
@@ -286,8 +288,11 @@ namespace BlackCore::Fsd
         //! @}
 
         //! Message send to FSD
+        //! \param message     the message
+        //! \param priority    class of the message in the send queue
+        //! \param coalesceKey if not empty, a queued message with the same key is replaced (superseded updates)
         template <class T>
-        void sendQueudedMessage(const T &message)
+        void sendQueudedMessage(const T &message, CFsdSendQueue::Priority priority = CFsdSendQueue::PriorityQuery, const QString &coalesceKey = {})
         {
             if (!message.isValid()) { return; }
             if (m_unitTestMode)
@@ -295,7 +300,7 @@ namespace BlackCore::Fsd
                 this->sendDirectMessage(message);
                 return;
             }
-            m_queuedFsdMessages.enqueue(messageToFSDString(message));
+            m_sendQueue.enqueue(messageToFSDString(message), priority, coalesceKey, QDateTime::currentMSecsSinceEpoch());
         }
 
         //! Message send to FSD
@@ -567,7 +572,11 @@ namespace BlackCore::Fsd
         mutable QReadWriteLock m_lockUserClientBuffered { QReadWriteLock::Recursive }; //!< for user, client and buffered data
         QString getOwnCallsignAsString() const { QReadLocker l(&m_lockUserClientBuffered); return m_ownCallsign.asString(); }
 
-        QQueue<QString> m_queuedFsdMessages;
+        CFsdSendQueue m_sendQueue;       //!< outbound messages, FSD thread only
+        QByteArray    m_sendBuffer;      //!< encoded batch written to the socket
+        QStringList   m_sentMessages;    //!< messages of the batch, for the raw FSD messages
+        CFsdSendQueue::Statistics m_sendQueueStatistics;   //!< copy for other threads, guarded by m_lockStatistics
+        std::atomic_bool m_resetSendQueueStatistics { false }; //!< reset in FSD thread
 
         //! An illegal FSD state has been detected
         void handleIllegalFsdState(const QString &message);
@@ -0,0 +1,120 @@
+/* Copyright (C) 2021
+ * swift project community / contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/fsd/fsdsendqueue.h"
+
+#include <QStringBuilder>
+#include <QTextCodec>
+#include <QtGlobal>
+
+namespace BlackCore::Fsd
+{
+    double CFsdSendQueue::Statistics::bytesPerSecond() const
+    {
+        if (firstSentMs < 0 || lastSentMs <= firstSentMs) { return 0.0; }
+        return 1000.0 * sentBytes / (lastSentMs - firstSentMs);
+    }
+
+    QString CFsdSendQueue::Statistics::toQString() const
+    {
+        return u"send queue: sent " % QString::number(sentMessages) %
+                u" msgs/" % QString::number(sentBytes) %
+                u" bytes in " % QString::number(flushes) %
+                u" writes, " % QString::number(this->bytesPerSecond(), 'f', 1) %
+                u" bytes/s, latency avg " % QString::number(this->averageLatencyMs(), 'f', 1) %
+                u"ms max " % QString::number(latencyMaxMs) %
+                u"ms, coalesced " % QString::number(coalesced) % u'/' % QString::number(enqueued) %
+                u", max queued " % QString::number(maxQueueSize);
+    }
+
+    void CFsdSendQueue::enqueue(const QString &message, Priority priority, const QString &coalesceKey, qint64 nowMs)
+    {
+        if (message.isEmpty()) { return; }
+        Q_ASSERT_X(priority >= 0 && priority < PriorityCount, Q_FUNC_INFO, "Wrong priority");
+        m_statistics.enqueued++;
+
+        QQueue<Entry> &queue = m_queues[priority];
+        if (!coalesceKey.isEmpty())
+        {
+            // superseded message still waiting, drop it, the new one goes to the tail
+            // so it is not sent ahead of messages queued after the superseded one
+            for (int i = 0; i < queue.size(); i++)
+            {
+                if (queue.at(i).key != coalesceKey) { continue; }
+                queue.removeAt(i);
+                m_size--;
+                m_statistics.coalesced++;
+                break;
+            }
+        }
+
+        queue.enqueue(Entry { message, coalesceKey, nowMs });
+        m_size++;
+        if (m_size > m_statistics.maxQueueSize) { m_statistics.maxQueueSize = m_size; }
+    }
+
+    int CFsdSendQueue::takeBatch(QTextCodec *codec, QByteArray &buffer, int maxMessages, QStringList *sent, qint64 nowMs)
+    {
+        buffer.clear();
+        if (m_size < 1) { return 0; }
+
+        m_batch.resize(0); // keeps capacity
+        int taken = 0;
+        for (int p = 0; p < PriorityCount; p++)
+        {
+            QQueue<Entry> &queue = m_queues[p];
+            while (!queue.isEmpty() && (p == PriorityControl || taken < maxMessages))
+            {
+                const Entry entry = queue.dequeue();
+                m_size--;
+                taken++;
+                m_batch += entry.message;
+                if (sent) { sent->push_back(entry.message); }
+
+                const qint64 latencyMs = qMax<qint64>(0, nowMs - entry.enqueuedMs);
+                m_statistics.latencySumMs += latencyMs;
+                if (latencyMs > m_statistics.latencyMaxMs) { m_statistics.latencyMaxMs = latencyMs; }
+            }
+        }
+        if (taken < 1) { return 0; }
+
+        // one codec conversion for the whole batch
+        buffer = codec ? codec->fromUnicode(m_batch) : m_batch.toLatin1();
+
+        m_statistics.sentMessages += taken;
+        m_statistics.sentBytes += buffer.size();
+        m_statistics.flushes++;
+        if (m_statistics.firstSentMs < 0) { m_statistics.firstSentMs = nowMs; }
+        m_statistics.lastSentMs = nowMs;
+        return taken;
+    }
+
+    void CFsdSendQueue::clear()
+    {
+        for (QQueue<Entry> &queue : m_queues) { queue.clear(); }
+        m_size = 0;
+    }
+
+    const QString &CFsdSendQueue::priorityToString(Priority priority)
+    {
+        static const QString control("control");
+        static const QString position("position");
+        static const QString query("query");
+        static const QString text("text");
+
+        switch (priority)
+        {
+        case PriorityControl:  return control;
+        case PriorityPosition: return position;
+        case PriorityQuery:    return query;
+        case PriorityText:
+        default: break;
+        }
+        return text;
+    }
+} // ns
@@ -0,0 +1,124 @@
+/* Copyright (C) 2021
+ * swift project community / contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_FSD_FSDSENDQUEUE_H
+#define BLACKCORE_FSD_FSDSENDQUEUE_H
+
+#include "blackcore/blackcoreexport.h"
+
+#include <QByteArray>
+#include <QQueue>
+#include <QString>
+#include <QStringList>
+#include <array>
+
+class QTextCodec;
+
+namespace BlackCore::Fsd
+{
+    //! Outbound FSD message scheduler
+    //! \remark Messages are sent by priority class, FIFO within a class.
+    //!         A message with a coalescing key replaces a queued message with the same key,
+    //!         so superseded position updates are never sent. The new message is queued at the tail.
+    //! \remark not threadsafe, used in the FSD client thread only
+    class BLACKCORE_EXPORT CFsdSendQueue
+    {
+    public:
+        //! Priority classes, highest first
+        enum Priority
+        {
+            PriorityControl,  //!< login, identification
+            PriorityPosition, //!< pilot/ATC position updates
+            PriorityQuery,    //!< client queries and responses, flight plans, aircraft config
+            PriorityText      //!< text messages
+        };
+
+        //! Number of priority classes
+        static constexpr int PriorityCount = PriorityText + 1;
+
+        //! Queue metrics
+        struct Statistics
+        {
+            qint64 enqueued = 0;       //!< messages enqueued
+            qint64 coalesced = 0;      //!< messages replaced by a newer one
+            qint64 sentMessages = 0;   //!< messages sent
+            qint64 sentBytes = 0;      //!< encoded bytes sent
+            qint64 flushes = 0;        //!< socket writes
+            qint64 latencySumMs = 0;   //!< sum of queue latencies
+            qint64 latencyMaxMs = 0;   //!< max. queue latency
+            qint64 firstSentMs = -1;   //!< first flush, ms since epoch
+            qint64 lastSentMs = -1;    //!< latest flush, ms since epoch
+            int maxQueueSize = 0;      //!< max. number of queued messages
+
+            //! Average latency
+            double averageLatencyMs() const { return sentMessages > 0 ? static_cast<double>(latencySumMs) / sentMessages : 0.0; }
+
+            //! Average byte rate
+            double bytesPerSecond() const;
+
+            //! Statistics as string
+            QString toQString() const;
+        };
+
+        //! Add a message
+        //! \param message     encoded FSD message including CR/LF
+        //! \param priority    its class
+        //! \param coalesceKey if not empty, a queued message with the same key is removed
+        //! \param nowMs       current time, ms since epoch
+        void enqueue(const QString &message, Priority priority, const QString &coalesceKey, qint64 nowMs);
+
+        //! Take up to maxMessages messages (highest priority first) and encode them into buffer
+        //! \remark the batch is converted by the codec at once, to be written to the socket with a single call
+        //! \param codec       codec used for FSD
+        //! \param buffer      encoded messages, overwritten
+        //! \param maxMessages max. number of messages, all PriorityControl messages are always sent
+        //! \param sent        if not null, the messages taken
+        //! \param nowMs       current time, ms since epoch
+        //! \return number of messages taken
+        int takeBatch(QTextCodec *codec, QByteArray &buffer, int maxMessages, QStringList *sent, qint64 nowMs);
+
+        //! Number of queued messages
+        int size() const { return m_size; }
+
+        //! Number of queued messages in a class
+        int size(Priority priority) const { return m_queues[priority].size(); }
+
+        //! Empty?
+        bool isEmpty() const { return m_size < 1; }
+
+        //! Remove all queued messages, keeps the statistics
+        void clear();
+
+        //! Statistics
+        const Statistics &getStatistics() const { return m_statistics; }
+
+        //! Reset the statistics
+        void resetStatistics() { m_statistics = {}; }
+
+        //! Priority as string
+        static const QString &priorityToString(Priority priority);
+
+    private:
+        //! Queued message
+        struct Entry
+        {
+            QString message;    //!< encoded FSD message
+            QString key;        //!< coalescing key
+            qint64 enqueuedMs;  //!< enqueue time
+        };
+
+        std::array<QQueue<Entry>, PriorityCount> m_queues;
+        int m_size = 0;
+        QString m_batch; //!< reused for concatenating the batch
+        Statistics m_statistics;
+    };
+} // ns
+
+#endif // guard
@@ -12,11 +12,18 @@
 #include "blackcore/db/databaseutils.h"
 #include "blackmisc/aviation/aircrafticaocodelist.h"
 #include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/parallel.h"
 
+#include <QSet>
+#include <QStringBuilder>
 #include <QStringList>
 #include <Qt>
 #include <QtGlobal>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
+using namespace BlackMisc;
 using namespace BlackMisc::Simulation;
 using namespace BlackCore::Db;
 
@@ -27,42 +34,62 @@ namespace BlackCore
         // void
     }
 
-    CAircraftModelList CModelSetBuilder::buildModelSet(const CSimulatorInfo &simulator, const CAircraftModelList &models, const CAircraftModelList &currentSet, Builder options, const CDistributorList &distributors) const
+    CAircraftModelList CModelSetBuilder::buildModelSet(const CSimulatorInfo &simulator, const CAircraftModelList &models, const CAircraftModelList &currentSet, Builder options, const CDistributorList &distributors)
     {
+        m_lastStageTimings.clear();
         if (models.isEmpty()) { return CAircraftModelList(); }
-        CAircraftModelList modelSet;
+
+        QElapsedTimer timer;
+        timer.start();
 
         // Select by distributor:
         // I avoid an empty distributor set because it wipes out everything
-        if (options.testFlag(GivenDistributorsOnly) && !distributors.isEmpty())
-        {
-            modelSet = models.findByDistributors(distributors);
-        }
-        else
-        {
-            modelSet = models;
-        }
+        const bool byDistributors = options.testFlag(GivenDistributorsOnly) && !distributors.isEmpty();
+        const bool onlyDbData = options.testFlag(OnlyDbData);
+        const bool onlyDbIcaoCodes = !onlyDbData && options.testFlag(OnlyDbIcaoCodes);
 
-        // Only DB data?
-        if (options.testFlag(OnlyDbData))
-        {
-            modelSet.removeObjectsWithoutDbKey();
-        }
-        else if (options.testFlag(OnlyDbIcaoCodes))
+        QSet<QString> designators;
+        if (onlyDbIcaoCodes)
         {
             Q_ASSERT_X(sApp->hasWebDataServices(), Q_FUNC_INFO, "No web data services");
-            const QSet<QString> designators(sApp->getWebDataServices()->getAircraftIcaoCodes().allDesignators());
-            modelSet = modelSet.findWithAircraftDesignator(designators);
+            designators = sApp->getWebDataServices()->getAircraftIcaoCodes().allDesignators();
         }
-        else
+
+        // all filters in one pass, chunks filtered in parallel and merged in order
+        const QVector<CAircraftModelList> filteredChunks = CParallel::mapChunks<CAircraftModelList>(models.size(), 500, [&](int begin, int end)
         {
-            // without any information we can not use them
-            modelSet = modelSet.findWithKnownAircraftDesignator();
-        }
+            CAircraftModelList filtered;
+            for (int i = begin; i < end; i++)
+            {
+                const CAircraftModel &model = models[i];
+                if (byDistributors && !model.matchesAnyDbDistributor(distributors)) { continue; }
 
-        // Include only
-        modelSet = modelSet.matchesSimulator(simulator);
-        modelSet.setModelMode(CAircraftModel::Include); // in sets we only include, exclude means not present in set
+                // Only DB data?
+                if (onlyDbData)
+                {
+                    if (!model.hasValidDbKey()) { continue; }
+                }
+                else if (onlyDbIcaoCodes)
+                {
+                    if (!designators.contains(model.getAircraftIcaoCodeDesignator())) { continue; }
+                }
+                else if (!model.hasKnownAircraftDesignator())
+                {
+                    // without any information we can not use them
+                    continue;
+                }
+
+                // Include only
+                if (!model.matchesSimulator(simulator)) { continue; }
+                filtered.push_back(model);
+                filtered.back().setModelMode(CAircraftModel::Include); // in sets we only include, exclude means not present in set
+            }
+            return filtered;
+        });
+
+        CAircraftModelList modelSet;
+        for (const CAircraftModelList &chunk : filteredChunks) { modelSet.push_back(chunk); }
+        this->stageDone(QStringLiteral("filter"), modelSet.size(), timer, 25);
 
         if (options.testFlag(Incremental))
         {
@@ -73,23 +100,72 @@ namespace BlackCore
                 copy.replaceOrAddModelsWithString(modelSet, Qt::CaseInsensitive);
                 modelSet = copy;
             }
+            this->stageDone(QStringLiteral("incremental"), modelSet.size(), timer, 40);
         }
 
         // sort by preferences if applicable
-        modelSet.resetOrder();
         if (options.testFlag(SortByDistributors))
         {
-            modelSet.updateDistributorOrder(distributors);
-            modelSet.sortBy(&CAircraftModel::getDistributorOrder);
+            // order values and sorting of chunks in parallel, then the sorted chunks are merged
+            // (order, index) keys make the sort stable
+            const int count = modelSet.size();
+            const auto first = modelSet.begin(); // detach once, chunks write disjoint ranges
+            std::vector<std::pair<int, int>> keys(static_cast<size_t>(count));
+            const QVector<int> chunkEnds = CParallel::mapChunks<int>(count, 500, [&](int begin, int end)
+            {
+                for (int i = begin; i < end; i++)
+                {
+                    CAircraftModel &model = first[i];
+                    model.setOrder(i);
+                    if (!distributors.isEmpty()) { model.setDistributorOrder(distributors); }
+                    keys[static_cast<size_t>(i)] = { model.getDistributorOrder(), i };
+                }
+                std::sort(keys.begin() + begin, keys.begin() + end);
+                return end;
+            });
+
+            for (int c = 1; c < chunkEnds.size(); c++)
+            {
+                std::inplace_merge(keys.begin(), keys.begin() + chunkEnds[c - 1], keys.begin() + chunkEnds[c]);
+            }
+
+            CAircraftModelList sorted;
+            for (const auto &key : keys) { sorted.push_back(std::move(first[key.second])); }
+            modelSet = std::move(sorted);
+            this->stageDone(QStringLiteral("distributor order"), modelSet.size(), timer, 60);
+        }
+        else
+        {
+            modelSet.resetOrder();
         }
 
         // DB consolidation
         if (options.testFlag(ConsolidateWithDb))
         {
-            CDatabaseUtils::consolidateModelsWithDbData(modelSet, true);
+            CDatabaseUtils::consolidateModelsWithDbDataInParallel(modelSet, true);
+            this->stageDone(QStringLiteral("DB consolidation"), modelSet.size(), timer, 95);
         }
 
         // result
+        emit this->buildingProgress(QStringLiteral("Model set built, %1 models").arg(modelSet.size()), 100);
         return modelSet;
     }
+
+    QString CModelSetBuilder::getLastStageTimingsInfo() const
+    {
+        QStringList stages;
+        qint64 totalMs = 0;
+        for (const StageTiming &timing : m_lastStageTimings)
+        {
+            stages.push_back(timing.stage % u": " % QString::number(timing.models) % u" models " % QString::number(timing.ms) % u"ms");
+            totalMs += timing.ms;
+        }
+        return stages.join(", ") % u" (total " % QString::number(totalMs) % u"ms)";
+    }
+
+    void CModelSetBuilder::stageDone(const QString &stage, int models, QElapsedTimer &timer, int progressPercentage)
+    {
+        m_lastStageTimings.push_back({ stage, models, timer.restart() });
+        emit this->buildingProgress(QStringLiteral("Model set building, %1 done, %2 models").arg(stage).arg(models), progressPercentage);
+    }
 } // ns
@@ -16,9 +16,12 @@
 #include "blackmisc/simulation/distributorlist.h"
 #include "blackmisc/simulation/simulatorinfo.h"
 
+#include <QElapsedTimer>
 #include <QFlags>
 #include <QMetaType>
 #include <QObject>
+#include <QString>
+#include <QVector>
 
 namespace BlackCore
 {
@@ -43,15 +46,40 @@ namespace BlackCore
         };
         Q_DECLARE_FLAGS(Builder, BuilderFlag)
 
+        //! Timing of a build stage
+        struct StageTiming
+        {
+            QString stage;  //!< stage name
+            int models = 0; //!< number of models after the stage
+            qint64 ms = 0;  //!< elapsed time
+        };
+
         //! Constructor
         CModelSetBuilder(QObject *parent = nullptr);
 
         //! Build a model set
+        //! \remark filtering, distributor ordering and DB consolidation run in parallel over chunks of the models
         BlackMisc::Simulation::CAircraftModelList buildModelSet(
             const BlackMisc::Simulation::CSimulatorInfo &simulator,
             const BlackMisc::Simulation::CAircraftModelList &models,
             const BlackMisc::Simulation::CAircraftModelList &currentSet, Builder options,
-            const BlackMisc::Simulation::CDistributorList &distributors = {}) const;
+            const BlackMisc::Simulation::CDistributorList &distributors = {});
+
+        //! Stage timings of the last build
+        const QVector<StageTiming> &getLastStageTimings() const { return m_lastStageTimings; }
+
+        //! Stage timings of the last build as string
+        QString getLastStageTimingsInfo() const;
+
+    signals:
+        //! Building progress
+        void buildingProgress(const QString &message, int progressPercentage);
+
+    private:
+        //! Stage done, record timing and report progress
+        void stageDone(const QString &stage, int models, QElapsedTimer &timer, int progressPercentage);
+
+        QVector<StageTiming> m_lastStageTimings;
     };
 } // ns
 
@@ -11,7 +11,9 @@
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/directoryutils.h"
 #include "blackmisc/logmessage.h"
+#include "blackmisc/parallel.h"
 #include "blackmisc/statusmessage.h"
+#include "blackmisc/timeline.h"
 
 #include <QDir>
 #include <QDirIterator>
@@ -20,6 +22,7 @@
 #include <QLibrary>
 #include <QPluginLoader>
 #include <QStringBuilder>
+#include <QVector>
 #include <QtGlobal>
 
 using namespace BlackMisc;
@@ -38,10 +41,24 @@ namespace BlackCore
             return;
         }
 
+        CTimeline::Stage stage(CTimeline::startup(), QStringLiteral("Collect plugins %1").arg(this->metaObject()->className()), QStringLiteral("plugin"));
+        QStringList paths;
         QDirIterator it(pluginDir, QDirIterator::FollowSymlinks);
         while (it.hasNext())
         {
-            tryLoad(it.next());
+            const QString path = it.next();
+            if (QLibrary::isLibrary(path)) { paths.push_back(path); }
+        }
+
+        // reading the metadata means file I/O for each plugin, so read them in parallel
+        QVector<QJsonObject> metadata(paths.size());
+        CParallel::forEachChunk(paths.size(), 1, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++) { metadata[i] = QPluginLoader(paths[i]).metaData(); }
+        });
+        for (int i = 0; i < paths.size(); i++)
+        {
+            tryLoad(paths[i], metadata[i]);
         }
     }
 
@@ -91,13 +108,9 @@ namespace BlackCore
         return m_instanceIds.value(instance, QString());
     }
 
-    bool IPluginManager::tryLoad(const QString &path)
+    bool IPluginManager::tryLoad(const QString &path, const QJsonObject &json)
     {
-        if (!QLibrary::isLibrary(path)) { return false; }
-
         CLogMessage(this).debug() << "Try loading plugin:" << path;
-        QPluginLoader loader(path);
-        const QJsonObject json = loader.metaData();
         if (!isValid(json))
         {
             CLogMessage(this).warning(u"Plugin '%1' invalid, not loading it") << path;
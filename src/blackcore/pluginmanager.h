@@ -77,8 +77,8 @@ namespace BlackCore
         }
 
     private:
-        //! Tries to load the given plugin.
-        bool tryLoad(const QString &path);
+        //! Tries to load the given plugin, metadata as read by QPluginLoader::metaData
+        bool tryLoad(const QString &path, const QJsonObject &metadata);
 
         //! Loads the given plugin (if necessary) and returns its instance.
         //! Returns `nullptr` on failure.
@@ -66,5 +66,6 @@ namespace BlackCore
         qRegisterMetaType<ServerErrorCode>();
         qRegisterMetaType<ServerType>();
         qRegisterMetaType<Capabilities>();
+        qRegisterMetaType<BlackMisc::Aviation::CAircraftPartsDelta>();
     }
 } // namespace
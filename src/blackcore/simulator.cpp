@@ -15,6 +15,7 @@
 #include "blackmisc/crashhandler.h"
 #include "blackmisc/directoryutils.h"
 #include "blackmisc/threadutils.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/verify.h"
 
@@ -22,6 +23,8 @@
 #include <Qt>
 #include <QtGlobal>
 #include <QPointer>
+#include <QTimer>
+#include <QHash>
 #include <QDateTime>
 #include <QString>
 #include <QStringBuilder>
@@ -261,6 +264,7 @@ namespace BlackCore
         m_lastSentSituations.remove(callsign);
         m_loopbackSituations.clear();
         this->removeInterpolationSetupPerCallsign(callsign);
+        m_interpolationLogger.removeTrace(callsign);
     }
 
     bool ISimulator::addLoopbackSituation(const CAircraftSituation &situation)
@@ -389,6 +393,104 @@ namespace BlackCore
         return false;
     }
 
+    int ISimulator::requestElevationBatch(const CAircraftSituationList &situations)
+    {
+        return this->requestElevationBatch(situations, true);
+    }
+
+    int ISimulator::requestElevationBatch(const CAircraftSituationList &situations, bool checkPending)
+    {
+        if (situations.isEmpty() || this->isShuttingDown()) { return 0; }
+
+        // latest situation per callsign
+        QHash<CCallsign, int> indexPerCallsign;
+        CAircraftSituationList unique;
+        int coalesced = 0;
+        for (const CAircraftSituation &situation : situations)
+        {
+            const CCallsign cs = situation.getCallsign();
+            if (cs.isEmpty() || situation.isPositionNull()) { continue; }
+            const auto it = indexPerCallsign.constFind(cs);
+            if (it != indexPerCallsign.constEnd())
+            {
+                unique[it.value()] = situation;
+                coalesced++;
+                continue;
+            }
+            indexPerCallsign.insert(cs, unique.size());
+            unique.push_back(situation);
+        }
+
+        // already requested or already known
+        CAircraftSituationList requests;
+        for (const CAircraftSituation &situation : std::as_const(unique))
+        {
+            const CCallsign cs = situation.getCallsign();
+            if (checkPending && this->isElevationRequestPending(cs))
+            {
+                coalesced++;
+                continue;
+            }
+
+            const CElevationPlane cached = this->findClosestElevationWithinRange(situation, CElevationPlane::singlePointRadius());
+            if (!cached.isNull())
+            {
+                coalesced++;
+                ISimulator::callbackReceivedRequestedElevation(cached, cs, false);
+                continue;
+            }
+            requests.push_back(situation);
+        }
+
+        m_statsElevationRequestsCoalesced += coalesced;
+        if (requests.isEmpty()) { return 0; }
+
+        const QPair<int, int> sentAndRoundTrips = this->sendElevationRequests(requests);
+        m_statsElevationRoundTripsSaved += qMax(0, sentAndRoundTrips.first - sentAndRoundTrips.second);
+        return sentAndRoundTrips.first;
+    }
+
+    QPair<int, int> ISimulator::sendElevationRequests(const CAircraftSituationList &situations)
+    {
+        int sent = 0;
+        for (const CAircraftSituation &situation : situations)
+        {
+            if (!this->requestElevation(situation, situation.getCallsign())) { continue; }
+            this->addPendingElevationRequest(situation.getCallsign());
+            sent++;
+        }
+        return { sent, sent };
+    }
+
+    bool ISimulator::queueElevationRequest(const ICoordinateGeodetic &reference, const CCallsign &callsign)
+    {
+        if (this->isShuttingDown()) { return false; }
+        if (callsign.isEmpty() || reference.isNull()) { return false; }
+
+        m_queuedElevationRequests.push_back(CAircraftSituation(callsign, CCoordinateGeodetic(reference)));
+        if (m_queuedElevationRequestsScheduled) { return true; }
+        m_queuedElevationRequestsScheduled = true;
+
+        QPointer<ISimulator> myself(this);
+        QTimer::singleShot(0, this, [ = ]
+        {
+            if (!myself) { return; }
+            m_queuedElevationRequestsScheduled = false;
+            const CAircraftSituationList requests = m_queuedElevationRequests;
+            m_queuedElevationRequests.clear();
+
+            // the callers mark queued requests as pending, although not yet sent, see findClosestElevationWithinRangeOrRequest
+            this->requestElevationBatch(requests, false);
+        });
+        return true;
+    }
+
+    QString ISimulator::getStatisticsElevationBatchInfo() const
+    {
+        static const QString info("Elv. coalesced: %1 round trips saved: %2");
+        return info.arg(m_statsElevationRequestsCoalesced).arg(m_statsElevationRoundTripsSaved);
+    }
+
     void ISimulator::callbackReceivedRequestedElevation(const CElevationPlane &plane, const CCallsign &callsign, bool isWater)
     {
         if (this->isShuttingDown()) { return; }
@@ -402,6 +504,7 @@ namespace BlackCore
         // update in simulator and cache
         const bool likelyOnGroundElevation = updated > 0 && updatedForOnGroundPosition;
         ISimulationEnvironmentProvider::rememberGroundElevation(callsign, likelyOnGroundElevation, plane); // in simulator
+        ISimulationEnvironmentProvider::removePendingElevationRequest(callsign); // already known elevations are not remembered again
 
         // signal we have received the elevation
         // used by log display
@@ -419,6 +522,9 @@ namespace BlackCore
         m_statsPhysicallyAddedAircraft   = 0;
         m_statsPhysicallyRemovedAircraft = 0;
         m_statsUpdateAircraftLimited     = 0;
+        m_statsElevationRequestsCoalesced = 0;
+        m_statsElevationRoundTripsSaved   = 0;
+        m_updateScheduler.resetStatistics();
         m_statsLastUpdateAircraftRequestedMs  = 0;
         m_statsUpdateAircraftRequestedDeltaMs = 0;
         ISimulationEnvironmentProvider::resetSimulationEnvironmentStatistics();
@@ -482,6 +588,21 @@ namespace BlackCore
                 CLogMessage(this).info(u"Started writing interpolation log");
                 return true;
             }
+            if (part2 == "trace")
+            {
+                // binary trace of all aircraft, ".drv logint trace on|off|write"
+                const QString part3 = parser.part(3).toLower();
+                if (part3 == "write" || part3 == "save")
+                {
+                    m_interpolationLogger.writeTraceInBackground();
+                    CLogMessage(this).info(u"Started writing interpolation trace");
+                    return true;
+                }
+                const bool trace = part3 != "off" && part3 != "false";
+                m_interpolationLogger.setTracing(trace);
+                CLogMessage(this).info(trace ? QStringLiteral("Tracing interpolation of all aircraft") : QStringLiteral("Disabled interpolation tracing"));
+                return true;
+            }
             if (part2 == "show")
             {
                 const QDir dir(CInterpolationLogger::getLogDirectory());
@@ -590,6 +711,27 @@ namespace BlackCore
             return false;
         }
 
+        if (part1.startsWith("budget"))
+        {
+            // .drv budget ms|off
+            const QString part2 = parser.part(2).toLower();
+            if (part2 == "off" || part2 == "false")
+            {
+                m_updateScheduler.setEnabled(false);
+            }
+            else
+            {
+                bool ok = false;
+                const double budgetMs = part2.toDouble(&ok);
+                if (ok) { m_updateScheduler.setBudgetMs(budgetMs); }
+                m_updateScheduler.setEnabled(true);
+            }
+            m_updateScheduler.resetStatistics();
+            if (m_updateScheduler.isEnabled()) { CLogMessage(this).info(u"Remote aircraft update budget: %1ms") << m_updateScheduler.getBudgetMs(); }
+            else { CLogMessage(this).info(u"Remote aircraft update budget: off"); }
+            return true;
+        }
+
         if (part1.startsWith("limit"))
         {
             const int perSecond = parser.toInt(2, -1);
@@ -653,11 +795,14 @@ namespace BlackCore
         CSimpleCommandParser::registerCommand({".drv unload", "unload driver"});
         CSimpleCommandParser::registerCommand({".drv cg length clear|modelstr.", "override CG"});
         CSimpleCommandParser::registerCommand({".drv limit number/secs.", "limit updates to number per second (0..off)"});
+        CSimpleCommandParser::registerCommand({".drv budget ms|off", "time budget per update of remote aircraft, far and parked aircraft are updated less often"});
         CSimpleCommandParser::registerCommand({".drv logint callsign", "log interpolator for callsign"});
         CSimpleCommandParser::registerCommand({".drv logint off", "no log information for interpolator"});
         CSimpleCommandParser::registerCommand({".drv logint write", "write interpolator log to file"});
         CSimpleCommandParser::registerCommand({".drv logint clear", "clear current log"});
         CSimpleCommandParser::registerCommand({".drv logint max number", "max. number of entries logged"});
+        CSimpleCommandParser::registerCommand({".drv logint trace on|off", "binary trace of interpolation for all aircraft"});
+        CSimpleCommandParser::registerCommand({".drv logint trace write", "write interpolation trace to file"});
         CSimpleCommandParser::registerCommand({".drv pos callsign", "show position for callsign"});
         CSimpleCommandParser::registerCommand({".drv spline|linear callsign", "set spline/linear interpolator for one/all callsign(s)"});
         CSimpleCommandParser::registerCommand({".drv aircraft readd callsign", "add again (re-add) a given callsign"});
@@ -707,6 +852,21 @@ namespace BlackCore
         m_lastSentSituations.insert(sent.getCallsign(), sent);
     }
 
+    bool ISimulator::isRemoteAircraftUpdateDue(const CCallsign &callsign, const ICoordinateGeodetic &ownPosition, bool forceUpdate)
+    {
+        if (forceUpdate || !m_updateScheduler.isEnabled()) { return true; }
+        const auto it = m_lastSentSituations.constFind(callsign);
+        if (it == m_lastSentSituations.constEnd()) { return m_updateScheduler.isDue(callsign, CFrameBudgetScheduler::Near); }
+        return m_updateScheduler.isDue(callsign, it.value(), ownPosition);
+    }
+
+    CAircraftSituation ISimulator::extrapolateLastSent(const CCallsign &callsign, qint64 timestamp) const
+    {
+        const auto it = m_lastSentSituations.constFind(callsign);
+        if (it == m_lastSentSituations.constEnd()) { return CAircraftSituation::null(); }
+        return CFrameBudgetScheduler::extrapolate(it.value(), timestamp);
+    }
+
     void ISimulator::rememberLastSent(const CAircraftParts &sent, const CCallsign &callsign)
     {
         // normally we should never end up without callsign, but it has happened in real world scenarios
@@ -1027,10 +1187,11 @@ namespace BlackCore
         if (this->isShuttingDown()) { return CAirportList(); }
         if (!sApp || !sApp->hasWebDataServices()) { return CAirportList(); }
 
-        const CAirportList airports = sApp->getWebDataServices()->getAirports();
-        if (airports.isEmpty()) { return airports; }
+        // spatial index, neither copies nor scans all airports
+        const QSharedPointer<const CAirportIndex> airports = sApp->getWebDataServices()->getAirportsIndex();
+        if (!airports || airports->size() < 1) { return CAirportList(); }
         const CCoordinateGeodetic ownPosition = this->getOwnAircraftPosition();
-        CAirportList airportsInRange = airports.findClosest(maxAirportsInRange(), ownPosition);
+        CAirportList airportsInRange = airports->findClosest(maxAirportsInRange(), ownPosition);
         if (recalculateDistance) { airportsInRange.calculcateAndUpdateRelativeDistanceAndBearing(this->getOwnAircraftPosition()); }
         return airportsInRange;
     }
@@ -1229,6 +1390,8 @@ namespace BlackCore
         if (m_statsMaxUpdateTimeMs < dt) { m_statsMaxUpdateTimeMs = dt; }
         if (m_statsLastUpdateAircraftRequestedMs > 0) { m_statsUpdateAircraftRequestedDeltaMs = startTime - m_statsLastUpdateAircraftRequestedMs; }
         if (limited) { m_statsUpdateAircraftLimited++; }
+        else { m_updateScheduler.endFrame(startTime, static_cast<double>(dt)); }
+        BLACK_TRACE_COUNTER("Remote aircraft in range", this->getAircraftInRangeCount());
     }
 
     void ISimulator::onOwnModelChanged(const CAircraftModel &newModel)
@@ -25,6 +25,7 @@
 #include "blackmisc/simulation/simulationenvironmentprovider.h"
 #include "blackmisc/simulation/interpolationsetupprovider.h"
 #include "blackmisc/simulation/autopublishdata.h"
+#include "blackmisc/simulation/framebudgetscheduler.h"
 #include "blackmisc/aviation/airportlist.h"
 #include "blackmisc/aviation/callsignset.h"
 #include "blackmisc/network/clientprovider.h"
@@ -266,6 +267,11 @@ namespace BlackCore
         //! \copydoc BlackMisc::Simulation::ISimulationEnvironmentProvider::requestElevation
         bool requestElevation(const BlackMisc::Aviation::CAircraftSituation &situation) { return this->requestElevation(situation, situation.getCallsign()); }
 
+        //! Request elevations for many aircraft in one go
+        //! \remark deduplicated by callsign, against pending requests and against the elevation cache
+        //! \return number of elevations requested from the simulator
+        virtual int requestElevationBatch(const BlackMisc::Aviation::CAircraftSituationList &situations);
+
         //! A requested elevation has been received
         //! \remark public for testing purposes
         virtual void callbackReceivedRequestedElevation(const BlackMisc::Geo::CElevationPlane &plane, const BlackMisc::Aviation::CCallsign &callsign, bool isWater);
@@ -343,6 +349,21 @@ namespace BlackCore
         //! Time between two update requests
         qint64 getStatisticsAircraftUpdatedRequestedDeltaMs() const { return m_statsUpdateAircraftRequestedDeltaMs; }
 
+        //! Elevation requests not sent to the simulator, because pending, cached or requested twice in a batch
+        int getStatisticsElevationRequestsCoalesced() const { return m_statsElevationRequestsCoalesced; }
+
+        //! Elevation round trips saved by sending batches
+        int getStatisticsElevationRoundTripsSaved() const { return m_statsElevationRoundTripsSaved; }
+
+        //! Elevation batch statistics as string
+        QString getStatisticsElevationBatchInfo() const;
+
+        //! Update rates per tier of the remote aircraft update scheduler
+        QString getStatisticsUpdateSchedulerInfo() const { return m_updateScheduler.getStatisticsInfo(); }
+
+        //! Access to the remote aircraft update scheduler
+        const BlackMisc::Simulation::CFrameBudgetScheduler &updateScheduler() const { return m_updateScheduler; }
+
         //! The traced loopback situations
         BlackMisc::Aviation::CAircraftSituationList getLoopbackSituations(const BlackMisc::Aviation::CCallsign &callsign) const;
 
@@ -469,6 +490,19 @@ namespace BlackCore
         //! \sa ISimulator::clearAllRemoteAircraftData
         virtual int physicallyRemoveAllRemoteAircraft();
 
+        //! Send deduplicated elevation requests to the simulator
+        //! \remark default sends one request per situation, drivers able to probe many positions in one call override this
+        //! \return requests sent and round trips needed
+        virtual QPair<int, int> sendElevationRequests(const BlackMisc::Aviation::CAircraftSituationList &situations);
+
+        //! Queue an elevation request, all requests queued in one event loop cycle are sent as one batch
+        //! \sa ISimulator::requestElevationBatch
+        bool queueElevationRequest(const BlackMisc::Geo::ICoordinateGeodetic &reference, const BlackMisc::Aviation::CCallsign &callsign);
+
+        //! \copydoc ISimulator::requestElevationBatch
+        //! \param checkPending skip callsigns with pending requests, false for queued requests
+        int requestElevationBatch(const BlackMisc::Aviation::CAircraftSituationList &situations, bool checkPending);
+
         //! Set elevation and CG in the providers and for auto publishing
         //! \sa ISimulator::updateOwnSituationAndGroundElevation
         void rememberElevationAndSimulatorCG(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::Simulation::CAircraftModel &model, bool likelyOnGroundElevation, const BlackMisc::Geo::CElevationPlane &elevation, const BlackMisc::PhysicalQuantities::CLength &simulatorCG);
@@ -548,6 +582,14 @@ namespace BlackCore
         //! Last sent situations
         BlackMisc::Aviation::CAircraftSituationList getLastSentCanLikelySkipNearGroundInterpolation() const;
 
+        //! Is the remote aircraft due for an update in this update run, based on the last sent situation
+        //! \remark aircraft not due are not interpolated, they can be moved by ISimulator::extrapolateLastSent
+        //! \sa BlackMisc::Simulation::CFrameBudgetScheduler
+        bool isRemoteAircraftUpdateDue(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::Geo::ICoordinateGeodetic &ownPosition, bool forceUpdate);
+
+        //! Last sent situation extrapolated to timestamp, NULL if nothing was sent so far
+        BlackMisc::Aviation::CAircraftSituation extrapolateLastSent(const BlackMisc::Aviation::CCallsign &callsign, qint64 timestamp) const;
+
         //! Limit reached (max number of updates by token bucket if enabled)
         bool isUpdateAircraftLimited(qint64 timestamp = -1);
 
@@ -626,6 +668,9 @@ namespace BlackCore
         BlackMisc::CTokenBucket m_limitUpdateAircraftBucket { 5, 100, 5 }; //!< means 50 per second
         bool m_limitUpdateAircraft = false; //!< limit the update frequency by using BlackMisc::CTokenBucket
 
+        // far and parked aircraft are updated at reduced rates
+        BlackMisc::Simulation::CFrameBudgetScheduler m_updateScheduler; //!< decides which aircraft are updated per update run
+
         // general settings
         BlackMisc::Simulation::Settings::CMultiSimulatorSettings m_multiSettings { this }; //!< simulator settings for all simulators
 
@@ -650,6 +695,12 @@ namespace BlackCore
         // those are the added counters, overflow will not be an issue here (discussed in T171 review)
         int m_statsPhysicallyAddedAircraft   = 0; //!< statistics, how many aircraft added
         int m_statsPhysicallyRemovedAircraft = 0; //!< statistics, how many aircraft removed
+        int m_statsElevationRequestsCoalesced = 0; //!< statistics, elevation requests not sent
+        int m_statsElevationRoundTripsSaved   = 0; //!< statistics, elevation round trips saved by batches
+
+        // elevation requests queued for the next batch
+        BlackMisc::Aviation::CAircraftSituationList m_queuedElevationRequests; //!< queued requests
+        bool m_queuedElevationRequestsScheduled = false; //!< batch is scheduled
 
         // highlighting
         bool m_blinkCycle = false;                //!< used for highlighting
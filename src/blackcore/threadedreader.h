@@ -17,6 +17,7 @@
 #include "blackmisc/logcategories.h"
 #include "blackmisc/worker.h"
 
+#include <QByteArray>
 #include <QDateTime>
 #include <QObject>
 #include <QReadWriteLock>
@@ -119,6 +120,10 @@ namespace BlackCore
         //! \threadsafe
         bool didContentChange(const QString &content, int startPosition = -1);
 
+        //! Stores new content hash and returns if content changed, for raw data without conversion to QString
+        //! \threadsafe
+        bool didContentChange(const QByteArray &content);
+
         //! Set initial and periodic times
         void setInitialAndPeriodicTime(int initialTime, int periodicTime);
 
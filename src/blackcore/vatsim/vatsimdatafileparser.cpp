@@ -0,0 +1,465 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/vatsim/vatsimdatafileparser.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/atcstation.h"
+#include "blackmisc/aviation/informationmessage.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/network/server.h"
+#include "blackmisc/network/user.h"
+#include "blackmisc/pq/frequency.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/units.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+
+#include <cstring>
+#include <utility>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Audio;
+using namespace BlackMisc::Network;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::Simulation;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackCore::Vatsim
+{
+    namespace
+    {
+        constexpr quint64 FnvPrime = 1099511628211ULL;
+
+        //! FNV-1a
+        quint64 fnv1a(quint64 hash, const char *data, int size)
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                hash ^= static_cast<uchar>(data[i]);
+                hash *= FnvPrime;
+            }
+            return hash;
+        }
+
+        //! Pilot members, the flight plan members last
+        enum PilotMember
+        {
+            PilotCallsign,
+            PilotCid,
+            PilotName,
+            PilotLatitude,
+            PilotLongitude,
+            PilotAltitude,
+            PilotHeading,
+            PilotGroundspeed,
+            PilotTransponder,
+            PilotFlightPlan,
+            PilotAircraft, // flight_plan.aircraft
+            PilotRemarks,  // flight_plan.remarks
+            PilotMemberCount
+        };
+
+        //! Controller and ATIS members
+        enum ControllerMember
+        {
+            ControllerCallsign,
+            ControllerCid,
+            ControllerName,
+            ControllerFrequency,
+            ControllerVisualRange,
+            ControllerTextAtis,
+            ControllerMemberCount
+        };
+
+        //! Server members
+        enum ServerMember
+        {
+            ServerName,
+            ServerLocation,
+            ServerHostname,
+            ServerConnectionsAllowed,
+            ServerMemberCount
+        };
+
+        const QLatin1String pilotNames[] =
+        {
+            QLatin1String("callsign"), QLatin1String("cid"), QLatin1String("name"), QLatin1String("latitude"), QLatin1String("longitude"),
+            QLatin1String("altitude"), QLatin1String("heading"), QLatin1String("groundspeed"), QLatin1String("transponder"), QLatin1String("flight_plan")
+        };
+        const QLatin1String flightPlanNames[] = { QLatin1String("aircraft"), QLatin1String("remarks") };
+        const QLatin1String controllerNames[] =
+        {
+            QLatin1String("callsign"), QLatin1String("cid"), QLatin1String("name"), QLatin1String("frequency"), QLatin1String("visual_range"), QLatin1String("text_atis")
+        };
+        const QLatin1String serverNames[] = { QLatin1String("name"), QLatin1String("location"), QLatin1String("hostname_or_ip"), QLatin1String("clients_connection_allowed") };
+        const QLatin1String generalNames[] = { QLatin1String("update_timestamp") };
+    }
+
+    CVatsimDataFileParser::Result CVatsimDataFileParser::parse(const QByteArray &json, const std::function<bool()> &continueCheck)
+    {
+        m_json = json;
+        m_error.clear();
+        m_changedAircraft.clear();
+        m_changedAtcStations.clear();
+        m_removedAircraft.clear();
+        m_removedAtcStations.clear();
+        m_created = 0;
+        m_reused = 0;
+        m_stringsDecoded = 0;
+
+        ParseState state;
+        CJsonStreamReader reader(m_json);
+        bool ok = (reader.readNext() == CJsonStreamReader::StartObject);
+        while (ok && reader.readNext() == CJsonStreamReader::Name)
+        {
+            if (reader.isName(QLatin1String("general")))
+            {
+                reader.readNext();
+                ok = this->parseGeneral(reader, state);
+                if (ok && m_updateTimestamp.isValid() && state.updateTimestamp == m_updateTimestamp)
+                {
+                    // "general" is the first section, no need to read the rest
+                    m_json.clear();
+                    return SameTimestamp;
+                }
+            }
+            else if (reader.isName(QLatin1String("pilots")))
+            {
+                reader.readNext();
+                ok = this->parsePilots(reader, state, continueCheck);
+            }
+            else if (reader.isName(QLatin1String("controllers")) || reader.isName(QLatin1String("atis")))
+            {
+                reader.readNext();
+                ok = this->parseControllers(reader, state, continueCheck);
+            }
+            else if (reader.isName(QLatin1String("servers")))
+            {
+                reader.readNext();
+                ok = this->parseServers(reader, state);
+            }
+            else
+            {
+                ok = reader.skipValue(); // prefiles, facilities, ratings ...
+            }
+            if (ok && continueCheck && !continueCheck()) { ok = false; }
+        }
+        if (ok) { ok = reader.tokenType() == CJsonStreamReader::EndObject && reader.readNext() == CJsonStreamReader::EndDocument; }
+        if (!ok)
+        {
+            m_json.clear();
+            if (continueCheck && !continueCheck()) { return Aborted; }
+            m_error = reader.hasError() ? reader.errorString() : QStringLiteral("Not a VATSIM data file");
+            return Invalid;
+        }
+
+        // entries of the last parse which are gone, a callsign with a new CID is reported as changed
+        const CCallsignSet changedAircraftCallsigns = state.changedAircraft.getCallsigns();
+        for (auto it = m_pilots.cbegin(); it != m_pilots.cend(); ++it)
+        {
+            if (state.pilots.contains(it.key())) { continue; }
+            const CCallsign &callsign = it->aircraft.getCallsign();
+            if (!changedAircraftCallsigns.contains(callsign)) { m_removedAircraft.insert(callsign); }
+        }
+        const CCallsignSet changedStationCallsigns = state.changedAtcStations.getCallsigns();
+        for (auto it = m_stations.cbegin(); it != m_stations.cend(); ++it)
+        {
+            if (state.stations.contains(it.key())) { continue; }
+            const CCallsign &callsign = it->station.getCallsign();
+            if (!changedStationCallsigns.contains(callsign)) { m_removedAtcStations.insert(callsign); }
+        }
+
+        // sorting for comparison
+        state.fsdServers.sortBy(&CServer::getName, &CServer::getDescription);
+
+        m_updateTimestamp = state.updateTimestamp;
+        m_pilots = std::move(state.pilots);
+        m_stations = std::move(state.stations);
+        m_aircraft = std::move(state.aircraft);
+        m_atcStations = std::move(state.atcStations);
+        m_fsdServers = std::move(state.fsdServers);
+        m_flightPlanRemarks = std::move(state.remarks);
+        m_illegalEquipmentCodes = std::move(state.illegalEquipmentCodes);
+        m_changedAircraft = std::move(state.changedAircraft);
+        m_changedAtcStations = std::move(state.changedAtcStations);
+        m_json.clear();
+        return Parsed;
+    }
+
+    void CVatsimDataFileParser::clear()
+    {
+        *this = CVatsimDataFileParser();
+    }
+
+    bool CVatsimDataFileParser::readObject(CJsonStreamReader &reader, const QLatin1String *names, Slice *slices, int count, int baseOffset)
+    {
+        while (reader.readNext() == CJsonStreamReader::Name)
+        {
+            int member = 0;
+            while (member < count && !reader.isName(names[member])) { member++; }
+            if (member == count)
+            {
+                if (!reader.skipValue()) { return false; }
+                continue;
+            }
+
+            const CJsonStreamReader::TokenType type = reader.readNext();
+            const int begin = reader.tokenOffset();
+            Slice &slice = slices[member];
+            slice.type = type;
+            slice.offset = baseOffset + begin;
+            if (type == CJsonStreamReader::StartObject || type == CJsonStreamReader::StartArray)
+            {
+                // whole container as raw text
+                if (!reader.skipValue()) { return false; }
+                slice.size = reader.position() - begin;
+            }
+            else
+            {
+                slice.size = reader.tokenSize();
+            }
+            if (reader.hasError()) { return false; }
+        }
+        return reader.tokenType() == CJsonStreamReader::EndObject;
+    }
+
+    bool CVatsimDataFileParser::parseGeneral(CJsonStreamReader &reader, ParseState &state)
+    {
+        if (reader.tokenType() != CJsonStreamReader::StartObject) { return reader.skipValue(); }
+        Slice timestamp;
+        if (!readObject(reader, generalNames, &timestamp, 1)) { return false; }
+        state.updateTimestamp = QDateTime::fromString(this->toString(timestamp), Qt::ISODateWithMs);
+        return true;
+    }
+
+    bool CVatsimDataFileParser::parsePilots(CJsonStreamReader &reader, ParseState &state, const std::function<bool()> &continueCheck)
+    {
+        if (reader.tokenType() != CJsonStreamReader::StartArray) { return reader.skipValue(); }
+        while (reader.readNext() != CJsonStreamReader::EndArray)
+        {
+            if (reader.atEnd()) { return false; }
+            if (reader.tokenType() != CJsonStreamReader::StartObject)
+            {
+                if (!reader.skipValue()) { return false; }
+                continue;
+            }
+            if (continueCheck && !continueCheck()) { return false; }
+
+            Slice slices[PilotMemberCount];
+            if (!readObject(reader, pilotNames, slices, PilotFlightPlan + 1)) { return false; }
+            const Slice &flightPlan = slices[PilotFlightPlan];
+            if (flightPlan.type == CJsonStreamReader::StartObject)
+            {
+                CJsonStreamReader flightPlanReader(QByteArray::fromRawData(this->sliceData(flightPlan), flightPlan.size));
+                flightPlanReader.readNext();
+                if (!readObject(flightPlanReader, flightPlanNames, slices + PilotAircraft, 2, flightPlan.offset)) { return false; }
+            }
+
+            const Slice &cs = slices[PilotCallsign];
+            const Slice &cid = slices[PilotCid];
+            const quint64 key = keyHash(this->sliceData(cs), cs.size, this->sliceData(cid), cid.size);
+            const quint64 fingerprint = this->fingerprint(slices + PilotAircraft, 2, this->fingerprint(slices, PilotFlightPlan)); // not the whole flight plan
+
+            const PilotEntry *entry = nullptr;
+            const auto old = m_pilots.constFind(key);
+            if (old != m_pilots.cend() && old->fingerprint == fingerprint && keyEquals(old->key, this->sliceData(cs), cs.size, this->sliceData(cid), cid.size))
+            {
+                entry = &state.pilots.insert(key, old.value()).value();
+                m_reused++;
+            }
+            else
+            {
+                PilotEntry created;
+                created.key = QByteArray(this->sliceData(cs), cs.size) + '\0' + QByteArray(this->sliceData(cid), cid.size);
+                created.fingerprint = fingerprint;
+
+                const CCallsign callsign(this->toString(cs));
+                const CUser user(this->toText(cid), this->toString(slices[PilotName]), callsign);
+                const CCoordinateGeodetic position(this->toDouble(slices[PilotLatitude]), this->toDouble(slices[PilotLongitude]), this->toInt(slices[PilotAltitude]));
+                const CHeading heading(this->toInt(slices[PilotHeading]), CAngleUnit::deg());
+                const CSpeed groundspeed(this->toInt(slices[PilotGroundspeed]), CSpeedUnit::kts());
+                const CAircraftSituation situation(callsign, position, heading, {}, {}, groundspeed);
+                created.aircraft = CSimulatedAircraft(callsign, user, situation);
+                const QString icaoAndEquipment(this->toString(slices[PilotAircraft]).trimmed());
+                const QString icao(CFlightPlan::aircraftIcaoCodeFromEquipmentCode(icaoAndEquipment));
+                if (CAircraftIcaoCode::isValidDesignator(icao))
+                {
+                    created.aircraft.setAircraftIcaoCode(icao);
+                }
+                else if (!icaoAndEquipment.isEmpty())
+                {
+                    created.illegalEquipmentCode = icaoAndEquipment;
+                }
+                created.aircraft.setTransponderCode(this->toString(slices[PilotTransponder]).toInt());
+                created.remarks = CFlightPlanRemarks(this->toString(slices[PilotRemarks]).trimmed());
+
+                entry = &state.pilots.insert(key, std::move(created)).value();
+                state.changedAircraft.push_back(entry->aircraft);
+                m_created++;
+            }
+
+            if (!entry->illegalEquipmentCode.isEmpty()) { state.illegalEquipmentCodes.push_back(entry->illegalEquipmentCode); }
+            state.aircraft.push_back(entry->aircraft);
+            state.remarks.insert(entry->aircraft.getCallsign(), entry->remarks);
+        }
+        return true;
+    }
+
+    bool CVatsimDataFileParser::parseControllers(CJsonStreamReader &reader, ParseState &state, const std::function<bool()> &continueCheck)
+    {
+        if (reader.tokenType() != CJsonStreamReader::StartArray) { return reader.skipValue(); }
+        while (reader.readNext() != CJsonStreamReader::EndArray)
+        {
+            if (reader.atEnd()) { return false; }
+            if (reader.tokenType() != CJsonStreamReader::StartObject)
+            {
+                if (!reader.skipValue()) { return false; }
+                continue;
+            }
+            if (continueCheck && !continueCheck()) { return false; }
+
+            Slice slices[ControllerMemberCount];
+            if (!readObject(reader, controllerNames, slices, ControllerMemberCount)) { return false; }
+
+            const Slice &cs = slices[ControllerCallsign];
+            const Slice &cid = slices[ControllerCid];
+            const quint64 key = keyHash(this->sliceData(cs), cs.size, this->sliceData(cid), cid.size);
+            const quint64 fingerprint = this->fingerprint(slices, ControllerMemberCount);
+
+            const StationEntry *entry = nullptr;
+            const auto old = m_stations.constFind(key);
+            if (old != m_stations.cend() && old->fingerprint == fingerprint && keyEquals(old->key, this->sliceData(cs), cs.size, this->sliceData(cid), cid.size))
+            {
+                entry = &state.stations.insert(key, old.value()).value();
+                m_reused++;
+            }
+            else
+            {
+                StationEntry created;
+                created.key = QByteArray(this->sliceData(cs), cs.size) + '\0' + QByteArray(this->sliceData(cid), cid.size);
+                created.fingerprint = fingerprint;
+
+                const CCallsign callsign(this->toString(cs));
+                const CUser user(this->toText(cid), this->toString(slices[ControllerName]), callsign);
+                const CFrequency freq(this->toString(slices[ControllerFrequency]).toDouble(), CFrequencyUnit::kHz());
+                const CLength range(this->toInt(slices[ControllerVisualRange]), CLengthUnit::NM());
+                const CInformationMessage atis(CInformationMessage::ATIS, this->toAtisText(slices[ControllerTextAtis]));
+                created.station = CAtcStation(callsign, user, freq, {}, range, true, {}, {}, atis);
+
+                entry = &state.stations.insert(key, std::move(created)).value();
+                state.changedAtcStations.push_back(entry->station);
+                m_created++;
+            }
+            state.atcStations.push_back(entry->station);
+        }
+        return true;
+    }
+
+    bool CVatsimDataFileParser::parseServers(CJsonStreamReader &reader, ParseState &state)
+    {
+        if (reader.tokenType() != CJsonStreamReader::StartArray) { return reader.skipValue(); }
+        while (reader.readNext() != CJsonStreamReader::EndArray)
+        {
+            if (reader.atEnd()) { return false; }
+            if (reader.tokenType() != CJsonStreamReader::StartObject)
+            {
+                if (!reader.skipValue()) { return false; }
+                continue;
+            }
+
+            // only a few servers, always decoded
+            Slice slices[ServerMemberCount];
+            if (!readObject(reader, serverNames, slices, ServerMemberCount)) { return false; }
+            const CServer server(this->toString(slices[ServerName]), this->toString(slices[ServerLocation]),
+                                 this->toString(slices[ServerHostname]), 6809, CUser("id", "real name", "email", "password"),
+                                 CFsdSetup::vatsimStandard(), CVoiceSetup::vatsimStandard(), CEcosystem::VATSIM,
+                                 CServer::FSDServerVatsim, this->toInt(slices[ServerConnectionsAllowed]));
+            if (server.hasName()) { state.fsdServers.push_back(server); }
+        }
+        return true;
+    }
+
+    QString CVatsimDataFileParser::toString(const Slice &slice)
+    {
+        if (slice.type != CJsonStreamReader::String) { return {}; }
+        m_stringsDecoded++;
+        return CJsonStreamReader::decodeString(this->sliceData(slice), slice.size);
+    }
+
+    QString CVatsimDataFileParser::toText(const Slice &slice)
+    {
+        // CID is a number in the v3 file
+        if (slice.type == CJsonStreamReader::Number)
+        {
+            m_stringsDecoded++;
+            return QString::fromLatin1(this->sliceData(slice), slice.size);
+        }
+        return this->toString(slice);
+    }
+
+    double CVatsimDataFileParser::toDouble(const Slice &slice) const
+    {
+        return slice.type == CJsonStreamReader::Number ? CJsonStreamReader::parseNumber(this->sliceData(slice), slice.size) : 0.0;
+    }
+
+    int CVatsimDataFileParser::toInt(const Slice &slice) const
+    {
+        const double d = this->toDouble(slice);
+        const int i = static_cast<int>(d);
+        return (static_cast<double>(i) == d) ? i : 0;
+    }
+
+    QString CVatsimDataFileParser::toAtisText(const Slice &slice)
+    {
+        if (slice.type != CJsonStreamReader::StartArray) { return {}; }
+        QStringList lines;
+        CJsonStreamReader reader(QByteArray::fromRawData(this->sliceData(slice), slice.size));
+        reader.readNext();
+        while (reader.readNext() != CJsonStreamReader::EndArray && !reader.atEnd())
+        {
+            if (reader.tokenType() == CJsonStreamReader::String)
+            {
+                m_stringsDecoded++;
+                lines.push_back(reader.stringValue());
+            }
+            else
+            {
+                lines.push_back({});
+                reader.skipValue();
+            }
+        }
+        return lines.join('\n');
+    }
+
+    quint64 CVatsimDataFileParser::keyHash(const char *callsign, int callsignSize, const char *cid, int cidSize)
+    {
+        const char separator = '\0';
+        return fnv1a(fnv1a(fnv1a(FingerprintSeed, callsign, callsignSize), &separator, 1), cid, cidSize);
+    }
+
+    bool CVatsimDataFileParser::keyEquals(const QByteArray &key, const char *callsign, int callsignSize, const char *cid, int cidSize)
+    {
+        return key.size() == callsignSize + 1 + cidSize &&
+               std::memcmp(key.constData(), callsign, static_cast<size_t>(callsignSize)) == 0 &&
+               std::memcmp(key.constData() + callsignSize + 1, cid, static_cast<size_t>(cidSize)) == 0;
+    }
+
+    quint64 CVatsimDataFileParser::fingerprint(const Slice *slices, int count, quint64 seed) const
+    {
+        quint64 hash = seed;
+        for (int i = 0; i < count; ++i)
+        {
+            // type and size separate the members, "ab" + "c" differs from "a" + "bc"
+            const qint32 header[2] = { static_cast<qint32>(slices[i].type), slices[i].size };
+            hash = fnv1a(hash, reinterpret_cast<const char *>(header), sizeof(header));
+            hash = fnv1a(hash, this->sliceData(slices[i]), slices[i].size);
+        }
+        return hash;
+    }
+} // ns
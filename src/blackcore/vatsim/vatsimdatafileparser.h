@@ -0,0 +1,186 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_VATSIM_VATSIMDATAFILEPARSER_H
+#define BLACKCORE_VATSIM_VATSIMDATAFILEPARSER_H
+
+#include "blackcore/blackcoreexport.h"
+#include "blackmisc/aviation/atcstationlist.h"
+#include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/aviation/flightplan.h"
+#include "blackmisc/network/serverlist.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "blackmisc/jsonstreamreader.h"
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <functional>
+
+namespace BlackCore::Vatsim
+{
+    /*!
+     * Streaming and incremental parser for the VATSIM data file (JSON v3).
+     *
+     * The file is read with CJsonStreamReader, without a QJsonDocument. Only the used members are located,
+     * and a fingerprint of their raw bytes is compared with the last parse (keyed by callsign and CID).
+     * Value objects are only created for new or changed pilots and ATC stations, unchanged entries are reused.
+     * \remark not threadsafe, normally used by CVatsimDataFileReader in its worker thread
+     */
+    class BLACKCORE_EXPORT CVatsimDataFileParser
+    {
+    public:
+        //! Parse result
+        enum Result
+        {
+            Parsed,        //!< parsed, results replaced
+            SameTimestamp, //!< same update timestamp as last parse, results unchanged
+            Invalid,       //!< not a valid data file, results unchanged
+            Aborted        //!< aborted by continue check, results unchanged
+        };
+
+        //! Parse the data file
+        //! \param json UTF-8 JSON data file
+        //! \param continueCheck called regularly, parsing is aborted if it returns false
+        Result parse(const QByteArray &json, const std::function<bool()> &continueCheck = {});
+
+        //! Reset to "nothing parsed yet"
+        void clear();
+
+        //! Results of last successful parse
+        //! @{
+        const QDateTime &getUpdateTimestamp() const { return m_updateTimestamp; }
+        const BlackMisc::Simulation::CSimulatedAircraftList &getAircraft() const { return m_aircraft; }
+        const BlackMisc::Aviation::CAtcStationList &getAtcStations() const { return m_atcStations; }
+        const BlackMisc::Network::CServerList &getFsdServers() const { return m_fsdServers; }
+        const QMap<BlackMisc::Aviation::CCallsign, BlackMisc::Aviation::CFlightPlanRemarks> &getFlightPlanRemarks() const { return m_flightPlanRemarks; }
+        const QStringList &getIllegalEquipmentCodes() const { return m_illegalEquipmentCodes; }
+        //! @}
+
+        //! Changes of the last parse compared to the parse before
+        //! \remark a callsign with a new CID is changed, not removed
+        //! @{
+        const BlackMisc::Simulation::CSimulatedAircraftList &getChangedAircraft() const { return m_changedAircraft; }
+        const BlackMisc::Aviation::CCallsignSet &getRemovedAircraft() const { return m_removedAircraft; }
+        const BlackMisc::Aviation::CAtcStationList &getChangedAtcStations() const { return m_changedAtcStations; }
+        const BlackMisc::Aviation::CCallsignSet &getRemovedAtcStations() const { return m_removedAtcStations; }
+        //! @}
+
+        //! Statistics of the last parse
+        //! @{
+        int getCreatedObjects() const { return m_created; }    //!< pilots and stations decoded
+        int getReusedObjects() const { return m_reused; }      //!< pilots and stations unchanged
+        int getStringsDecoded() const { return m_stringsDecoded; }
+        //! @}
+
+        //! Error of last parse, if any
+        const QString &getErrorString() const { return m_error; }
+
+    private:
+        //! Raw value of a member
+        struct Slice
+        {
+            int offset = 0;
+            int size = 0;
+            BlackMisc::CJsonStreamReader::TokenType type = BlackMisc::CJsonStreamReader::NoToken;
+        };
+
+        //! Pilot from last parse
+        struct PilotEntry
+        {
+            QByteArray key;          //!< raw callsign and CID
+            quint64 fingerprint = 0; //!< used members
+            BlackMisc::Simulation::CSimulatedAircraft aircraft;
+            BlackMisc::Aviation::CFlightPlanRemarks remarks;
+            QString illegalEquipmentCode;
+        };
+
+        //! ATC station from last parse
+        struct StationEntry
+        {
+            QByteArray key;          //!< raw callsign and CID
+            quint64 fingerprint = 0; //!< used members
+            BlackMisc::Aviation::CAtcStation station;
+        };
+
+        //! Results built while parsing, committed when the whole file is parsed
+        struct ParseState
+        {
+            QHash<quint64, PilotEntry> pilots;
+            QHash<quint64, StationEntry> stations;
+            BlackMisc::Simulation::CSimulatedAircraftList aircraft;
+            BlackMisc::Aviation::CAtcStationList atcStations;
+            BlackMisc::Network::CServerList fsdServers;
+            QMap<BlackMisc::Aviation::CCallsign, BlackMisc::Aviation::CFlightPlanRemarks> remarks;
+            BlackMisc::Simulation::CSimulatedAircraftList changedAircraft;
+            BlackMisc::Aviation::CAtcStationList changedAtcStations;
+            QStringList illegalEquipmentCodes;
+            QDateTime updateTimestamp;
+        };
+
+        //! Read the object at the current StartObject token, store the slices of the named members
+        static bool readObject(BlackMisc::CJsonStreamReader &reader, const QLatin1String *names, Slice *slices, int count, int baseOffset = 0);
+
+        //! Sections
+        //! @{
+        bool parseGeneral(BlackMisc::CJsonStreamReader &reader, ParseState &state);
+        bool parsePilots(BlackMisc::CJsonStreamReader &reader, ParseState &state, const std::function<bool()> &continueCheck);
+        bool parseControllers(BlackMisc::CJsonStreamReader &reader, ParseState &state, const std::function<bool()> &continueCheck);
+        bool parseServers(BlackMisc::CJsonStreamReader &reader, ParseState &state);
+        //! @}
+
+        //! Decode values
+        //! \remark same semantics as QJsonValue::toString / toDouble / toInt
+        //! @{
+        QString toString(const Slice &slice);
+        QString toText(const Slice &slice);
+        double toDouble(const Slice &slice) const;
+        int toInt(const Slice &slice) const;
+        QString toAtisText(const Slice &slice);
+        //! @}
+
+        //! Slice bytes
+        const char *sliceData(const Slice &slice) const { return m_json.constData() + slice.offset; }
+
+        //! Key of an entry
+        //! @{
+        static quint64 keyHash(const char *callsign, int callsignSize, const char *cid, int cidSize);
+        static bool keyEquals(const QByteArray &key, const char *callsign, int callsignSize, const char *cid, int cidSize);
+        //! @}
+
+        //! Fingerprint (FNV-1a) of the used members
+        quint64 fingerprint(const Slice *slices, int count, quint64 seed = FingerprintSeed) const;
+
+        static constexpr quint64 FingerprintSeed = 14695981039346656037ULL; //!< FNV-1a offset basis
+
+        QByteArray m_json; //!< JSON being parsed
+        QDateTime m_updateTimestamp;
+        QHash<quint64, PilotEntry> m_pilots;     //!< by key hash
+        QHash<quint64, StationEntry> m_stations; //!< by key hash
+        BlackMisc::Simulation::CSimulatedAircraftList m_aircraft;
+        BlackMisc::Aviation::CAtcStationList m_atcStations;
+        BlackMisc::Network::CServerList m_fsdServers;
+        QMap<BlackMisc::Aviation::CCallsign, BlackMisc::Aviation::CFlightPlanRemarks> m_flightPlanRemarks;
+        QStringList m_illegalEquipmentCodes;
+        BlackMisc::Simulation::CSimulatedAircraftList m_changedAircraft;
+        BlackMisc::Aviation::CAtcStationList m_changedAtcStations;
+        BlackMisc::Aviation::CCallsignSet m_removedAircraft;
+        BlackMisc::Aviation::CCallsignSet m_removedAtcStations;
+        QString m_error;
+        int m_created = 0;
+        int m_reused = 0;
+        int m_stringsDecoded = 0;
+    };
+} // ns
+
+#endif // guard
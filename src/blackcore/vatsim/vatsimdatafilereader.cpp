@@ -215,13 +215,12 @@ namespace BlackCore::Vatsim
         }
 
         this->logNetworkReplyReceived(nwReplyPtr);
-        QStringList illegalEquipmentCodes;
         const QUrl url = nwReply->url();
         const QString urlString = url.toString();
 
         if (nwReply->error() == QNetworkReply::NoError)
         {
-            const QString dataFileData = nwReply->readAll();
+            const QByteArray dataFileData = nwReply->readAll();
             nwReply->close(); // close asap
 
             if (dataFileData.isEmpty()) { return; }
@@ -230,77 +229,37 @@ namespace BlackCore::Vatsim
                 CLogMessage(this).info(u"VATSIM file '%1' has same content, skipped") << urlString;
                 return;
             }
-            auto jsonDoc = QJsonDocument::fromJson(dataFileData.toUtf8());
-            if (jsonDoc.isEmpty()) { return; }
-
-            // build on local vars for thread safety
-            CServerList                         fsdServers;
-            CAtcStationList                     atcStations;
-            CSimulatedAircraftList              aircraft;
-            QMap<CCallsign, CFlightPlanRemarks> flightPlanRemarksMap;
-            auto updateTimestampFromFile = QDateTime::fromString(jsonDoc["general"]["update_timestamp"].toString(), Qt::ISODateWithMs);
-
-            const bool alreadyRead = (updateTimestampFromFile == this->getUpdateTimestamp());
-            if (alreadyRead)
+
+            // streaming parse, only new or changed pilots and stations are decoded
+            const CVatsimDataFileParser::Result result = m_parser.parse(dataFileData, [this] { return this->doWorkCheck(); });
+            switch (result)
             {
+            case CVatsimDataFileParser::Aborted:
+                CLogMessage(this).info(u"Terminated VATSIM file parsing process");
+                return;
+            case CVatsimDataFileParser::SameTimestamp:
                 CLogMessage(this).info(u"VATSIM file has same timestamp, skipped");
                 return;
+            case CVatsimDataFileParser::Invalid:
+                CLogMessage(this).warning(u"Invalid VATSIM file '%1': '%2'") << urlString << m_parser.getErrorString();
+                return;
+            default:
+                break;
             }
-
-            for (QJsonValueRef pilot : jsonDoc["pilots"].toArray())
-            {
-                if (!this->doWorkCheck())
-                {
-                    CLogMessage(this).info(u"Terminated VATSIM file parsing process");
-                    return;
-                }
-                aircraft.push_back(parsePilot(pilot.toObject(), illegalEquipmentCodes));
-                flightPlanRemarksMap.insert(aircraft.back().getCallsign(), parseFlightPlanRemarks(pilot.toObject()));
-            }
-            for (QJsonValueRef controller : jsonDoc["controllers"].toArray())
-            {
-                if (!this->doWorkCheck())
-                {
-                    CLogMessage(this).info(u"Terminated VATSIM file parsing process");
-                    return;
-                }
-                atcStations.push_back(parseController(controller.toObject()));
-            }
-            for (QJsonValueRef atis : jsonDoc["atis"].toArray())
-            {
-                if (!this->doWorkCheck())
-                {
-                    CLogMessage(this).info(u"Terminated VATSIM file parsing process");
-                    return;
-                }
-                atcStations.push_back(parseController(atis.toObject()));
-            }
-            for (QJsonValueRef server : jsonDoc["servers"].toArray())
-            {
-                if (!this->doWorkCheck())
-                {
-                    CLogMessage(this).info(u"Terminated VATSIM file parsing process");
-                    return;
-                }
-                fsdServers.push_back(parseServer(server.toObject()));
-                if (!fsdServers.back().hasName()) { fsdServers.pop_back(); }
-            }
-
-            // Setup for VATSIM servers and sorting for comparison
-            fsdServers.sortBy(&CServer::getName, &CServer::getDescription);
+            const QDateTime updateTimestampFromFile = m_parser.getUpdateTimestamp();
 
             // this part needs to be synchronized
             {
                 QWriteLocker wl(&m_lock);
                 this->setUpdateTimestamp(updateTimestampFromFile);
-                m_aircraft = aircraft;
-                m_atcStations = atcStations;
-                m_flightPlanRemarks = flightPlanRemarksMap;
+                m_aircraft = m_parser.getAircraft();
+                m_atcStations = m_parser.getAtcStations();
+                m_flightPlanRemarks = m_parser.getFlightPlanRemarks();
             }
 
             // update cache itself is thread safe
             CVatsimSetup vs(m_lastGoodSetup.get());
-            const bool changedSetup = vs.setServers(fsdServers, {});
+            const bool changedSetup = vs.setServers(m_parser.getFsdServers(), {});
             if (changedSetup)
             {
                 vs.setUtcTimestamp(updateTimestampFromFile);
@@ -308,14 +267,24 @@ namespace BlackCore::Vatsim
             }
 
             // warnings, if required
+            const QStringList &illegalEquipmentCodes = m_parser.getIllegalEquipmentCodes();
             if (!illegalEquipmentCodes.isEmpty())
             {
                 CVatsimDataFileReader::logInconsistentData(
                     CStatusMessage(this, CStatusMessage::SeverityInfo, u"Illegal / ignored equipment code(s) in VATSIM data file: %1") << illegalEquipmentCodes.join(", ")
                 );
             }
+            CLogMessage(this).debug(u"VATSIM file parsed, %1 pilots/stations decoded, %2 unchanged") << m_parser.getCreatedObjects() << m_parser.getReusedObjects();
 
             // data read finished
+            if (!m_parser.getChangedAircraft().isEmpty() || !m_parser.getRemovedAircraft().isEmpty())
+            {
+                emit this->aircraftChanged(m_parser.getChangedAircraft(), m_parser.getRemovedAircraft());
+            }
+            if (!m_parser.getChangedAtcStations().isEmpty() || !m_parser.getRemovedAtcStations().isEmpty())
+            {
+                emit this->atcStationsChanged(m_parser.getChangedAtcStations(), m_parser.getRemovedAtcStations());
+            }
             emit this->dataFileRead(dataFileData.size() / 1000);
             emit this->dataRead(CEntityFlags::VatsimDataFile, CEntityFlags::ReadFinished, dataFileData.size() / 1000, url);
         }
@@ -328,54 +297,6 @@ namespace BlackCore::Vatsim
         }
     }
 
-    CSimulatedAircraft CVatsimDataFileReader::parsePilot(const QJsonObject &pilot, QStringList &o_illegalEquipmentCodes) const
-    {
-        const CCallsign callsign(pilot["callsign"].toString());
-        const CUser user(pilot["cid"].toString(), pilot["name"].toString(), callsign);
-        const CCoordinateGeodetic position(pilot["latitude"].toDouble(), pilot["longitude"].toDouble(), pilot["altitude"].toInt());
-        const CHeading heading(pilot["heading"].toInt(), CAngleUnit::deg());
-        const CSpeed groundspeed(pilot["groundspeed"].toInt(), CSpeedUnit::kts());
-        const CAircraftSituation situation(callsign, position, heading, {}, {}, groundspeed);
-        CSimulatedAircraft aircraft(callsign, user, situation);
-        const QString icaoAndEquipment(pilot["flight_plan"]["aircraft"].toString().trimmed());
-        const QString icao(CFlightPlan::aircraftIcaoCodeFromEquipmentCode(icaoAndEquipment));
-        if (CAircraftIcaoCode::isValidDesignator(icao))
-        {
-            aircraft.setAircraftIcaoCode(icao);
-        }
-        else if (!icaoAndEquipment.isEmpty())
-        {
-            o_illegalEquipmentCodes.push_back(icaoAndEquipment);
-        }
-        aircraft.setTransponderCode(pilot["transponder"].toString().toInt());
-        return aircraft;
-    }
-
-    CFlightPlanRemarks CVatsimDataFileReader::parseFlightPlanRemarks(const QJsonObject &pilot) const
-    {
-        return CFlightPlanRemarks(pilot["flight_plan"]["remarks"].toString().trimmed());
-    }
-
-    CAtcStation CVatsimDataFileReader::parseController(const QJsonObject &controller) const
-    {
-        const CCallsign callsign(controller["callsign"].toString());
-        const CUser user(controller["cid"].toString(), controller["name"].toString(), callsign);
-        const CFrequency freq(controller["frequency"].toString().toDouble(), CFrequencyUnit::kHz());
-        const CLength range(controller["visual_range"].toInt(), CLengthUnit::NM());
-        const QJsonArray atisLines = controller["text_atis"].toArray();
-        const auto atisText = makeRange(atisLines).transform([](auto line) { return line.toString(); });
-        const CInformationMessage atis(CInformationMessage::ATIS, atisText.to<QStringList>().join('\n'));
-        return CAtcStation(callsign, user, freq, {}, range, true, {}, {}, atis);
-    }
-
-    CServer CVatsimDataFileReader::parseServer(const QJsonObject &server) const
-    {
-        return CServer(server["name"].toString(), server["location"].toString(),
-            server["hostname_or_ip"].toString(), 6809, CUser("id", "real name", "email", "password"),
-            CFsdSetup::vatsimStandard(), CVoiceSetup::vatsimStandard(), CEcosystem::VATSIM,
-            CServer::FSDServerVatsim, server["clients_connection_allowed"].toInt());
-    }
-
     void CVatsimDataFileReader::reloadSettings()
     {
         CReaderSettings s = m_settings.get();
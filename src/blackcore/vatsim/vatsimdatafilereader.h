@@ -13,6 +13,7 @@
 
 #include "blackcore/blackcoreexport.h"
 #include "blackcore/data/vatsimsetup.h"
+#include "blackcore/vatsim/vatsimdatafileparser.h"
 #include "blackmisc/aviation/aircrafticaocode.h"
 #include "blackmisc/aviation/airlineicaocode.h"
 #include "blackmisc/aviation/atcstationlist.h"
@@ -127,6 +128,14 @@ namespace BlackCore::Vatsim
         //! Data have been read
         void dataRead(BlackMisc::Network::CEntityFlags::Entity entity, BlackMisc::Network::CEntityFlags::ReadState state, int number, const QUrl &url);
 
+        //! Aircraft new or changed since the last data file, and aircraft no longer in the data file
+        //! \remark only emitted if there are changes
+        void aircraftChanged(const BlackMisc::Simulation::CSimulatedAircraftList &changedOrAdded, const BlackMisc::Aviation::CCallsignSet &removed);
+
+        //! ATC stations new or changed since the last data file, and ATC stations no longer in the data file
+        //! \remark only emitted if there are changes
+        void atcStationsChanged(const BlackMisc::Aviation::CAtcStationList &changedOrAdded, const BlackMisc::Aviation::CCallsignSet &removed);
+
     protected:
         //! \name BlackCore::CThreadedReader overrides
         //! @{
@@ -149,15 +158,11 @@ namespace BlackCore::Vatsim
         BlackMisc::CData<BlackCore::Data::TVatsimSetup> m_lastGoodSetup { this };
         BlackMisc::CSettingReadOnly<BlackCore::Vatsim::TVatsimDataFile> m_settings { this, &CVatsimDataFileReader::reloadSettings };
         QMap<BlackMisc::Aviation::CCallsign, BlackMisc::Aviation::CFlightPlanRemarks> m_flightPlanRemarks; //!< cache for flight plan remarks
+        CVatsimDataFileParser m_parser; //!< results of the last parse for incremental parsing, only used in worker thread
 
         //! Data have been read, parse VATSIM file
         void parseVatsimFile(QNetworkReply *nwReply);
 
-        BlackMisc::Simulation::CSimulatedAircraft parsePilot(const QJsonObject &, QStringList &o_illegalEquipmentCodes) const;
-        BlackMisc::Aviation::CFlightPlanRemarks parseFlightPlanRemarks(const QJsonObject &) const;
-        BlackMisc::Aviation::CAtcStation parseController(const QJsonObject &) const;
-        BlackMisc::Network::CServer parseServer(const QJsonObject &) const;
-
         //! Read / re-read data file
         void read();
 
@@ -22,6 +22,7 @@
 #include <QScopedPointer>
 #include <QScopedPointerDeleteLater>
 #include <QString>
+#include <QStringList>
 #include <QTextStream>
 #include <QTimer>
 #include <QUrl>
@@ -126,25 +127,21 @@ namespace BlackCore::Vatsim
                 return;
             }
 
-            CMetarList metars;
-            int invalidLines = 0;
+            // split first, then decode in parallel
+            QStringList lines;
             QTextStream lineReader(&metarData);
             while (!lineReader.atEnd())
             {
-                if (!this->doWorkCheck()) { return; }
                 const QString line = lineReader.readLine();
                 // some check for obvious errors
                 if (line.contains("<html")) { continue; }
-                const CMetar metar = m_metarDecoder.decode(line);
-                if (metar != CMetar())
-                {
-                    metars.push_back(metar);
-                }
-                else
-                {
-                    invalidLines++;
-                }
+                lines.push_back(line);
             }
+            if (!this->doWorkCheck()) { return; }
+
+            int invalidLines = 0;
+            const CMetarList metars = m_metarDecoder.decodeAll(lines, &invalidLines);
+            if (!this->doWorkCheck()) { return; }
 
             CLogMessage(this).info(u"METARs: %1 Metars (invalid %2) from '%3'") << metars.size() << invalidLines << metarUrl;
             {
@@ -10,6 +10,7 @@
 #include "blackcore/weathermanager.h"
 #include "blackcore/application.h"
 
+#include "blackmisc/geo/geoindex.h"
 #include "blackmisc/weather/gridpoint.h"
 #include "blackmisc/weather/weatherdataplugininfo.h"
 #include "blackmisc/weather/weatherdataplugininfolist.h"
@@ -23,6 +24,9 @@
 
 #include <QtGlobal>
 #include <QDateTime>
+#include <QVector>
+#include <array>
+#include <vector>
 
 using namespace BlackConfig;
 using namespace BlackMisc;
@@ -210,10 +214,33 @@ namespace BlackCore
         const WeatherRequest weatherRequest = m_pendingRequests.front();
         CWeatherGrid requestedWeatherGrid   = weatherRequest.weatherGrid;
 
+        // spatial index of the fetched grid, if there are several points to look up
+        CGeoIndex fetchedIndex;
+        if (requestedWeatherGrid.size() > 1)
+        {
+            std::vector<std::array<double, 3>> normalVectors;
+            QVector<int> indexes;
+            for (int i = 0; i < fetchedWeatherGrid.size(); i++)
+            {
+                normalVectors.push_back(fetchedWeatherGrid[i].getPosition().normalVectorDouble());
+                indexes.push_back(i);
+            }
+            fetchedIndex = CGeoIndex(normalVectors, indexes);
+        }
+
         // Interpolation. So far it just picks the closest point without interpolation.
         for (CGridPoint &gridPoint : requestedWeatherGrid)
         {
-            const auto nearestGridPoint = fetchedWeatherGrid.findClosest(1, gridPoint.getPosition()).frontOrDefault();
+            CGridPoint nearestGridPoint;
+            if (fetchedIndex.isEmpty())
+            {
+                nearestGridPoint = fetchedWeatherGrid.findClosest(1, gridPoint.getPosition()).frontOrDefault();
+            }
+            else
+            {
+                const QVector<int> closest = fetchedIndex.findClosest(1, gridPoint.getPosition());
+                if (!closest.isEmpty()) { nearestGridPoint = fetchedWeatherGrid[closest.front()]; }
+            }
             gridPoint.copyWeatherDataFrom(nearestGridPoint);
             gridPoint.setPosition(nearestGridPoint.getPosition());
         }
@@ -29,6 +29,7 @@
 #include "blackmisc/statusmessage.h"
 #include "blackmisc/worker.h"
 #include "blackmisc/threadutils.h"
+#include "blackmisc/timeline.h"
 #include "blackconfig/buildconfig.h"
 
 #include <QDir>
@@ -63,6 +64,7 @@ namespace BlackCore
         Q_ASSERT_X(QSslSocket::supportsSsl(), Q_FUNC_INFO, "Missing SSL support");
         Q_ASSERT_X(sApp->isSetupAvailable(), Q_FUNC_INFO, "Setup not synchronized");
         this->setObjectName("CWebDataServices");
+        CTimeline::Stage stage(CTimeline::startup(), QStringLiteral("Init web data services"), QStringLiteral("startup"));
 
         // SSL INFOs
         CLogMessage(this).info(u"SSL supported: %1 Version: %2 (build version) %3 (library version)") << boolToYesNo(QSslSocket::supportsSsl()) << QSslSocket::sslLibraryBuildVersionString() << QSslSocket::sslLibraryVersionString();
@@ -102,15 +104,12 @@ namespace BlackCore
         entities &= ~CEntityFlags::VatsimStatusFile;   // triggered in init readers
         entities &= ~m_entitiesPeriodicallyRead; // will be triggered by timers
 
-        // trigger reading
-        // but do not start all at the same time
-        const CEntityFlags::Entity icaoPart  = entities & CEntityFlags::AllIcaoCountriesCategory;
-        const CEntityFlags::Entity modelPart = entities & CEntityFlags::DistributorLiveryModel;
-        CEntityFlags::Entity remainingEntities = entities & ~icaoPart;
-        remainingEntities &= ~modelPart;
-        this->readDeferredInBackground(icaoPart, 500);
-        this->readDeferredInBackground(modelPart, 1000);
-        this->readDeferredInBackground(remainingEntities, 1500);
+        // startup graph
+        // 1. caches:       admitted now, so all files are deserialized in parallel in the background while the core facade starts and collects plugins
+        // 2. info objects: read triggered in initReaders
+        // 3. entities:     read once the info objects are available (readInBackground waits for them), using the caches from 1. if up to date
+        this->admitDbCaches(this->getDbEntitiesReadFromCache(entities));
+        this->readDeferredInBackground(entities, 0);
     }
 
     CWebDataServices::~CWebDataServices()
@@ -592,6 +591,12 @@ namespace BlackCore
         return CLiveryList();
     }
 
+    QSharedPointer<const CLiverySnapshot> CWebDataServices::getLiveriesSnapshot() const
+    {
+        if (m_modelDataReader) { return m_modelDataReader->getLiveriesSnapshot(); }
+        return QSharedPointer<const CLiverySnapshot>::create();
+    }
+
     int CWebDataServices::getLiveriesCount() const
     {
         if (m_modelDataReader) { return m_modelDataReader->getLiveriesCount(); }
@@ -634,6 +639,12 @@ namespace BlackCore
         return CAircraftModelList();
     }
 
+    QSharedPointer<const CAircraftModelSnapshot> CWebDataServices::getModelsSnapshot() const
+    {
+        if (m_modelDataReader) { return m_modelDataReader->getModelsSnapshot(); }
+        return QSharedPointer<const CAircraftModelSnapshot>::create();
+    }
+
     int CWebDataServices::getModelsCount() const
     {
         if (m_modelDataReader) { return m_modelDataReader->getModelsCount(); }
@@ -688,6 +699,12 @@ namespace BlackCore
         return CAircraftIcaoCodeList();
     }
 
+    QSharedPointer<const CAircraftIcaoCodeSnapshot> CWebDataServices::getAircraftIcaoCodesSnapshot() const
+    {
+        if (m_icaoDataReader) { return m_icaoDataReader->getAircraftIcaoCodesSnapshot(); }
+        return QSharedPointer<const CAircraftIcaoCodeSnapshot>::create();
+    }
+
     int CWebDataServices::getAircraftIcaoCodesCount() const
     {
         if (m_icaoDataReader) { return m_icaoDataReader->getAircraftIcaoCodesCount(); }
@@ -762,6 +779,12 @@ namespace BlackCore
         return CAirlineIcaoCodeList();
     }
 
+    QSharedPointer<const CAirlineIcaoCodeSnapshot> CWebDataServices::getAirlineIcaoCodesSnapshot() const
+    {
+        if (m_icaoDataReader) { return m_icaoDataReader->getAirlineIcaoCodesSnapshot(); }
+        return QSharedPointer<const CAirlineIcaoCodeSnapshot>::create();
+    }
+
     bool CWebDataServices::containsAirlineIcaoDesignator(const QString &designator) const
     {
         if (designator.isEmpty()) { return false; }
@@ -860,6 +883,18 @@ namespace BlackCore
         return CAirportList();
     }
 
+    QSharedPointer<const CAirportIndex> CWebDataServices::getAirportsIndex() const
+    {
+        if (m_airportDataReader) { return m_airportDataReader->getAirportsIndex(); }
+        return QSharedPointer<const CAirportIndex>::create();
+    }
+
+    QSharedPointer<const CAirportSnapshot> CWebDataServices::getAirportsSnapshot() const
+    {
+        if (m_airportDataReader) { return m_airportDataReader->getAirportsSnapshot(); }
+        return QSharedPointer<const CAirportSnapshot>::create();
+    }
+
     int CWebDataServices::getAirportsCount() const
     {
         if (m_airportDataReader) { return m_airportDataReader->getAirportsCount(); }
@@ -1303,6 +1338,20 @@ namespace BlackCore
         return entities;
     }
 
+    CEntityFlags::Entity CWebDataServices::getDbEntitiesReadFromCache(CEntityFlags::Entity entities) const
+    {
+        CEntityFlags::Entity cachedEntities = CEntityFlags::NoEntity;
+        CEntityFlags::Entity dbEntities = entities & CEntityFlags::AllDbEntitiesNoInfoObjects;
+        CEntityFlags::Entity currentEntity = CEntityFlags::iterateDbEntities(dbEntities);
+        while (currentEntity)
+        {
+            const CDbFlags::DataRetrievalMode mode = m_dbReaderConfig.findFirstOrDefaultForEntity(currentEntity).getRetrievalMode();
+            if (mode.testFlag(CDbFlags::Cached) && !mode.testFlag(CDbFlags::Ignore) && !mode.testFlag(CDbFlags::Canceled)) { cachedEntities |= currentEntity; }
+            currentEntity = CEntityFlags::iterateDbEntities(dbEntities);
+        }
+        return cachedEntities;
+    }
+
     CEntityFlags::Entity CWebDataServices::getDbEntitiesWithTimestampNewerThan(const QDateTime &threshold) const
     {
         CEntityFlags::Entity entities = CEntityFlags::NoEntity;
@@ -1568,7 +1617,7 @@ namespace BlackCore
 
         for (const auto &pair : fileContents)
         {
-            CWorker::fromTask(this, Q_FUNC_INFO, [pair, directory]
+            CWorker::fromTask(this, Q_FUNC_INFO, CTaskPool::LowPriority, [pair, directory]
             {
                 CFileUtils::writeStringToFile(CFileUtils::appendFilePaths(directory.absolutePath(), pair.first), pair.second);
             });
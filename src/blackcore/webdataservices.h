@@ -40,6 +40,7 @@
 #include <QList>
 #include <QSet>
 #include <QObject>
+#include <QSharedPointer>
 #include <QString>
 #include <QStringList>
 #include <atomic>
@@ -189,6 +190,10 @@ namespace BlackCore
         //! \threadsafe
         BlackMisc::Aviation::CLiveryList getLiveries() const;
 
+        //! Liveries with lookup by DB key and combined code, shared until the liveries change
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CLiverySnapshot> getLiveriesSnapshot() const;
+
         //! Liveries count
         //! \threadsafe
         int getLiveriesCount() const;
@@ -217,6 +222,10 @@ namespace BlackCore
         //! \threadsafe
         BlackMisc::Simulation::CAircraftModelList getModels() const;
 
+        //! Models with lookup by DB key and model string, shared until the models change
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Simulation::CAircraftModelSnapshot> getModelsSnapshot() const;
+
         //! Models count
         //! \threadsafe
         int getModelsCount() const;
@@ -253,6 +262,10 @@ namespace BlackCore
         //! \threadsafe
         BlackMisc::Aviation::CAircraftIcaoCodeList getAircraftIcaoCodes() const;
 
+        //! Aircraft ICAO codes with lookup by DB key and designator, shared until the codes change
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CAircraftIcaoCodeSnapshot> getAircraftIcaoCodesSnapshot() const;
+
         //! Aircraft ICAO codes count
         //! \threadsafe
         int getAircraftIcaoCodesCount() const;
@@ -301,6 +314,10 @@ namespace BlackCore
         //! \threadsafe
         BlackMisc::Aviation::CAirlineIcaoCodeList getAirlineIcaoCodes() const;
 
+        //! Airline ICAO codes with lookup by DB key and designator, shared until the codes change
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CAirlineIcaoCodeSnapshot> getAirlineIcaoCodesSnapshot() const;
+
         //! Contains the given designator?
         //! \threadsafe
         bool containsAirlineIcaoDesignator(const QString &designator) const;
@@ -369,6 +386,14 @@ namespace BlackCore
         //! \threadsafe
         int getAirportsCount() const;
 
+        //! Get airports with a spatial index, for closest/in range queries
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CAirportIndex> getAirportsIndex() const;
+
+        //! Airports with lookup by DB key and ICAO code, shared until the airports change
+        //! \threadsafe
+        QSharedPointer<const BlackMisc::Aviation::CAirportSnapshot> getAirportsSnapshot() const;
+
         //! Get airport for ICAO designator
         //! \threadsafe
         BlackMisc::Aviation::CAirport getAirportForIcaoDesignator(const QString &icao) const;
@@ -609,6 +634,9 @@ namespace BlackCore
         //! \remark requires the caches already read
         BlackMisc::Network::CEntityFlags::Entity getDbEntitiesWithCachedData() const;
 
+        //! DB entities read from cache (if up to date) according to the reader configuration
+        BlackMisc::Network::CEntityFlags::Entity getDbEntitiesReadFromCache(BlackMisc::Network::CEntityFlags::Entity entities) const;
+
         //! Entities from DB with cache timestamp newer than given threshold
         //! \remark unlike getDbEntitiesWithCachedData() this does not need the caches already being read
         BlackMisc::Network::CEntityFlags::Entity getDbEntitiesWithTimestampNewerThan(const QDateTime &threshold) const;
@@ -12,9 +12,11 @@
 #include "blackgui/editors/ownmodelsetform.h"
 #include "blackgui/guiapplication.h"
 #include "blackmisc/logcategories.h"
+#include "blackmisc/logmessage.h"
 #include "blackmisc/simulation/distributorlist.h"
 #include "ui_dbownmodelsetformdialog.h"
 
+#include <QProgressBar>
 #include <QPushButton>
 #include <QString>
 #include <QWidget>
@@ -154,13 +156,29 @@ namespace BlackGui::Components
             return currentSet;
         }
 
-        const CModelSetBuilder builder(this);
+        CModelSetBuilder builder(this);
+        ui->pb_Progress->setValue(0);
+        ui->pb_Progress->setVisible(true);
+        ui->pb_Ok->setEnabled(false);
+        ui->pb_Cancel->setEnabled(false);
+        connect(&builder, &CModelSetBuilder::buildingProgress, this, [ = ](const QString &message, int progressPercentage)
+        {
+            // the builder runs in this thread, refresh the GUI between the stages
+            ui->pb_Progress->setValue(progressPercentage);
+            ui->pb_Progress->setToolTip(message);
+            if (sGui) { sGui->processEventsToRefreshGui(); }
+        });
         CModelSetBuilder::Builder options = givenDistributorsOnly ? CModelSetBuilder::GivenDistributorsOnly : CModelSetBuilder::NoOptions;
         if (dbDataOnly)   { options |= CModelSetBuilder::OnlyDbData; }
         if (dbIcaoOnly)   { options |= CModelSetBuilder::OnlyDbIcaoCodes; }
         if (incremnental) { options |= CModelSetBuilder::Incremental; }
         if (sortByDistributor) { options |= CModelSetBuilder::SortByDistributors; }
         if (consolidateWithDb) { options |= CModelSetBuilder::ConsolidateWithDb; }
-        return builder.buildModelSet(simulator, models, currentSet, options, distributors);
+        const CAircraftModelList modelSet = builder.buildModelSet(simulator, models, currentSet, options, distributors);
+        ui->pb_Progress->setVisible(false);
+        ui->pb_Ok->setEnabled(true);
+        ui->pb_Cancel->setEnabled(true);
+        CLogMessage(this).info(u"Built model set for '%1': %2") << simulator.toQString(true) << builder.getLastStageTimingsInfo();
+        return modelSet;
     }
 } // ns
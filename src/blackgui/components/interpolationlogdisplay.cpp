@@ -17,6 +17,7 @@
 #include "blackmisc/stringutils.h"
 
 #include <QStringLiteral>
+#include <QStringBuilder>
 
 using namespace BlackCore;
 using namespace BlackCore::Context;
@@ -164,7 +165,8 @@ namespace BlackGui::Components
             ui->le_UpdateTimes->home(false);
             ui->le_UpdateCount->setText(QString::number(m_simulator->getStatisticsUpdateRuns()));
             ui->le_UpdateReqTime->setText(msTimeStr.arg(m_simulator->getStatisticsAircraftUpdatedRequestedDeltaMs()));
-            ui->le_Limited->setText(m_simulator->updateAircraftLimitationInfo());
+            ui->le_Limited->setText(m_simulator->updateAircraftLimitationInfo() % u' ' % m_simulator->getStatisticsUpdateSchedulerInfo());
+            ui->le_Limited->home(false);
 
             ui->le_SimulatorSpecific->setText(m_simulator->getStatisticsSimulatorSpecific());
             ui->le_SimulatorSpecific->home(false);
@@ -11,6 +11,7 @@
 #include "blackgui/guiutility.h"
 #include "blackgui/models/aircraftmodellistmodel.h"
 #include "blackgui/models/simulatedaircraftlistmodel.h"
+#include "blackgui/views/aircraftmodelsetimageview.h"
 #include "blackgui/views/aircraftmodelview.h"
 #include "blackgui/views/checkboxdelegate.h"
 #include "blackgui/views/simulatedaircraftview.h"
@@ -72,11 +73,7 @@ namespace BlackGui::Components
         ui->setupUi(this);
         ui->tw_SpecializedViews->setCurrentIndex(0);
 
-        ui->tvp_AircraftModels->setAircraftModelMode(CAircraftModelListModel::OwnAircraftModelClient);
-        ui->tvp_AircraftModels->setResizeMode(CAircraftModelView::ResizingOff);
-        ui->tvp_AircraftModels->addFilterDialog();
-        ui->tvp_AircraftModels->menuRemoveItems(CAircraftModelView::MenuBackend);
-        ui->tvp_AircraftModels->menuAddItems(CAircraftModelView::MenuDisableModelsTemp);
+        ui->tvp_AircraftModels->setTempDisableMenu(true);
 
         ui->tvp_RenderedAircraft->setAircraftMode(CSimulatedAircraftListModel::RenderedMode);
         ui->tvp_RenderedAircraft->setResizeMode(CAircraftModelView::ResizingOnce);
@@ -84,10 +81,10 @@ namespace BlackGui::Components
 
         connect(sGui->getIContextNetwork(), &IContextNetwork::connectionStatusChanged, this, &CMappingComponent::onNetworkConnectionStatusChanged);
 
-        connect(ui->tvp_AircraftModels, &CAircraftModelView::requestUpdate, this, &CMappingComponent::onModelsUpdateRequested);
-        connect(ui->tvp_AircraftModels, &CAircraftModelView::modelDataChanged, this, &CMappingComponent::onRowCountChanged);
-        connect(ui->tvp_AircraftModels, &CAircraftModelView::clicked, this, &CMappingComponent::onModelSelectedInView);
-        connect(ui->tvp_AircraftModels, &CAircraftModelView::requestTempDisableModelsForMatching, this, &CMappingComponent::onTempDisableModelsForMatchingRequested);
+        connect(ui->tvp_AircraftModels, &CAircraftModelSetImageView::requestUpdate, this, &CMappingComponent::onModelsUpdateRequested);
+        connect(ui->tvp_AircraftModels, &CAircraftModelSetImageView::rowCountChanged, this, &CMappingComponent::onRowCountChanged);
+        connect(ui->tvp_AircraftModels, &CAircraftModelSetImageView::clicked, this, &CMappingComponent::onModelSelectedInView);
+        connect(ui->tvp_AircraftModels, &CAircraftModelSetImageView::requestTempDisableModelsForMatching, this, &CMappingComponent::onTempDisableModelsForMatchingRequested);
 
         connect(ui->tvp_RenderedAircraft, &CSimulatedAircraftView::modelDataChanged, this, &CMappingComponent::onRowCountChanged);
         connect(ui->tvp_RenderedAircraft, &CSimulatedAircraftView::clicked, this, &CMappingComponent::onAircraftSelectedInView);
@@ -119,7 +116,6 @@ namespace BlackGui::Components
         // Updates
         connect(&m_updateTimer, &QTimer::timeout, this, &CMappingComponent::timerUpdate);
         m_updateTimer.setObjectName(this->objectName() + "::updateTimer");
-        ui->tvp_AircraftModels->setDisplayAutomatically(false);
         this->settingsChanged();
 
         // selector
@@ -184,7 +180,7 @@ namespace BlackGui::Components
     CAircraftModelList CMappingComponent::findModelsStartingWith(const QString &modelName, Qt::CaseSensitivity cs)
     {
         Q_ASSERT(ui->tvp_AircraftModels);
-        return ui->tvp_AircraftModels->container().findModelsStartingWith(modelName, cs);
+        return ui->tvp_AircraftModels->findModelsStartingWith(modelName, cs);
     }
 
     void CMappingComponent::onModelSetChanged(const CSimulatorInfo &dummy)
@@ -196,9 +192,10 @@ namespace BlackGui::Components
         const bool changed = ui->completer_ModelStrings->setSimulator(simulator);
         if (!changed) { return; }
 
-        if (ui->tvp_AircraftModels->displayAutomatically())
+        if (!ui->tvp_AircraftModels->isEmpty())
         {
-            this->onModelsUpdateRequested();
+            // displaying the image is cheap, so refresh an already loaded view
+            this->loadModelSetView();
         }
         else
         {
@@ -212,7 +209,7 @@ namespace BlackGui::Components
         Q_UNUSED(withFilter);
         const int am = ui->tw_SpecializedViews->indexOf(ui->tb_AircraftModels);
         const int cm = ui->tw_SpecializedViews->indexOf(ui->tb_CurrentMappings);
-        const QString amf = ui->tvp_AircraftModels->derivedModel()->hasFilter() ? "F" : "";
+        const QString amf = ui->tvp_AircraftModels->hasFilter() ? "F" : "";
         QString a = ui->tw_SpecializedViews->tabBar()->tabText(am);
         QString c = ui->tw_SpecializedViews->tabBar()->tabText(cm);
         a = CGuiUtility::replaceTabCountValue(a, this->countAircraftModels()) + amf;
@@ -243,7 +240,7 @@ namespace BlackGui::Components
 
     void CMappingComponent::onModelSelectedInView(const QModelIndex &index)
     {
-        const CAircraftModel model = ui->tvp_AircraftModels->at(index);
+        const CAircraftModel model = ui->tvp_AircraftModels->modelAt(index);
         ui->completer_ModelStrings->setModel(model);
 
         if (ui->cb_AircraftIconDisplayed->isChecked())
@@ -334,7 +331,7 @@ namespace BlackGui::Components
         }
 
         // model in current view (data already in UI)
-        bool hasModel = ui->tvp_AircraftModels->container().containsModelString(modelString);
+        bool hasModel = ui->tvp_AircraftModels->containsModelString(modelString);
         if (!hasModel && sGui && sGui->getIContextSimulator())
         {
             hasModel = sGui->getIContextSimulator()->isKnownModelInSet(modelString);
@@ -416,17 +413,27 @@ namespace BlackGui::Components
 
     void CMappingComponent::onModelsUpdateRequested()
     {
-        if (!sGui || sGui->isShuttingDown() || !sGui->getIContextSimulator()) { return; }
-        CAircraftModelList modelSet(sGui->getIContextSimulator()->getModelSet());
+        this->loadModelSetView();
+        ui->tw_SpecializedViews->setCurrentIndex(TabAircraftModels);
+    }
 
+    void CMappingComponent::loadModelSetView()
+    {
+        if (!sGui || sGui->isShuttingDown() || !sGui->getIContextSimulator()) { return; }
         const CAircraftModelList disabledModels = sGui->getIContextSimulator()->getDisabledModelsForMatching();
-        const bool hasDisabledModels = !disabledModels.isEmpty();
-
-        ui->tvp_AircraftModels->setHighlightColor(Qt::red);
-        ui->tvp_AircraftModels->setHighlight(hasDisabledModels);
         ui->tvp_AircraftModels->setHighlightModels(disabledModels);
-        ui->tvp_AircraftModels->updateContainerMaybeAsync(modelSet);
-        ui->tw_SpecializedViews->setCurrentIndex(TabAircraftModels);
+
+        // the image is shared with the core, the rows are read when displayed
+        const QSharedPointer<const CAircraftModelSetImage> image = sGui->getIContextSimulator()->getModelSetImage();
+        if (image)
+        {
+            ui->tvp_AircraftModels->setImage(image);
+        }
+        else
+        {
+            // core on another machine
+            ui->tvp_AircraftModels->setModels(sGui->getIContextSimulator()->getModelSet());
+        }
     }
 
     void CMappingComponent::onTempDisableModelsForMatchingRequested(const CAircraftModelList &models)
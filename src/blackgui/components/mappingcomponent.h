@@ -119,6 +119,9 @@ namespace BlackGui
             //! Request update for models from backend
             void onModelsUpdateRequested();
 
+            //! Display the model set, read from the model set image if available
+            void loadModelSetView();
+
             //! Request temp.disablng of models (for matching)
             void onTempDisableModelsForMatchingRequested(const BlackMisc::Simulation::CAircraftModelList &models);
 
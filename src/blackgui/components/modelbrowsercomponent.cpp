@@ -9,6 +9,7 @@
 #include "modelbrowsercomponent.h"
 #include "ui_modelbrowsercomponent.h"
 #include "blackgui/guiapplication.h"
+#include "blackgui/views/aircraftmodelsetimageview.h"
 #include "blackcore/context/contextownaircraft.h"
 #include "blackcore/context/contextsimulator.h"
 #include "blackmisc/aviation/heading.h"
@@ -33,8 +34,6 @@ namespace BlackGui::Components
     {
         ui->setupUi(this);
         ui->tw_Tab->setCurrentIndex(0);
-        ui->tvp_AircraftModels->acceptClickSelection(false);
-        ui->tvp_AircraftModels->acceptDoubleClickSelection(true);
 
         const CLength relDistance(40.0, CLengthUnit::m());
         ui->editor_RelativePosition->setDistance(relDistance);
@@ -47,7 +46,7 @@ namespace BlackGui::Components
         connect(ui->editor_Coordinate,      &CCoordinateForm::changedCoordinate,      this, &CModelBrowserComponent::onSetAbsolutePosition, Qt::QueuedConnection);
         connect(ui->editor_Pbh,             &CPbhsForm::changeValues,                 this, &CModelBrowserComponent::onSetPBH,              Qt::QueuedConnection);
         connect(ui->editor_AircraftParts,   &CAircraftPartsForm::changeAircraftParts, this, &CModelBrowserComponent::onSetParts,            Qt::QueuedConnection);
-        connect(ui->tvp_AircraftModels,     &CAircraftModelView::objectDoubleClicked, this, &CModelBrowserComponent::onModelDblClicked,     Qt::QueuedConnection);
+        connect(ui->tvp_AircraftModels,     &CAircraftModelSetImageView::modelDoubleClicked, this, &CModelBrowserComponent::onModelDblClicked, Qt::QueuedConnection);
 
         connect(ui->cb_OverrideCG, &QCheckBox::clicked, this, &CModelBrowserComponent::onCGChecked);
         connect(ui->cb_UseCG,      &QCheckBox::clicked, this, &CModelBrowserComponent::onCGChecked);
@@ -123,16 +122,16 @@ namespace BlackGui::Components
         if (!this->hasContexts()) { return; }
     }
 
-    void CModelBrowserComponent::onModelDblClicked(const CVariant &object)
+    void CModelBrowserComponent::onModelDblClicked(const CAircraftModel &model)
     {
-        Q_UNUSED(object);
+        Q_UNUSED(model);
         this->display();
     }
 
     void CModelBrowserComponent::display()
     {
         if (!this->hasContexts()) { return; }
-        CAircraftModel model = ui->tvp_AircraftModels->selectedObject();
+        CAircraftModel model = ui->tvp_AircraftModels->selectedModel(); // only the selected model is materialized
         if (!model.hasModelString()) { return; }
 
         this->remove(); // only 1 model at a time
@@ -186,10 +185,18 @@ namespace BlackGui::Components
     {
         if (!this->hasContexts()) { return; }
 
-        const CAircraftModelList modelSet = sGui->getIContextSimulator()->getModelSet();
-        ui->tvp_AircraftModels->updateContainerMaybeAsync(modelSet);
+        const QSharedPointer<const CAircraftModelSetImage> image = sGui->getIContextSimulator()->getModelSetImage();
+        if (image)
+        {
+            ui->tvp_AircraftModels->setImage(image);
+        }
+        else
+        {
+            // core on another machine
+            ui->tvp_AircraftModels->setModels(sGui->getIContextSimulator()->getModelSet());
+        }
         const QString sim = sGui->getIContextSimulator()->getSimulatorPluginInfo().getSimulatorInfo().toQString(true);
-        ui->lbl_ModelSetInfo->setText(QStringLiteral("'%1' model set with %2 models").arg(sim).arg(modelSet.sizeInt()));
+        ui->lbl_ModelSetInfo->setText(QStringLiteral("'%1' model set with %2 models").arg(sim).arg(ui->tvp_AircraftModels->rowCount()));
     }
 
     bool CModelBrowserComponent::hasContexts() const
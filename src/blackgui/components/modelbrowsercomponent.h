@@ -41,7 +41,7 @@ namespace BlackGui::Components
         void onSetAbsolutePosition();
         void onSetPBH();
         void onSetParts();
-        void onModelDblClicked(const BlackMisc::CVariant &object);
+        void onModelDblClicked(const BlackMisc::Simulation::CAircraftModel &model);
 
         BlackMisc::Aviation::CAircraftParts getParts() const;
 
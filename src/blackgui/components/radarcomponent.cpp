@@ -14,6 +14,10 @@
 #include "blackcore/context/contextownaircraft.h"
 #include "blackmisc/simulation/simulatedaircraft.h"
 
+#include <QElapsedTimer>
+#include <QGraphicsEllipseItem>
+#include <QGraphicsLineItem>
+#include <QGraphicsTextItem>
 #include <QtMath>
 #include <QStringBuilder>
 
@@ -83,6 +87,7 @@ namespace BlackGui::Components
         m_scene.addItem(&m_microGraticule);
         m_scene.addItem(&m_radials);
         m_scene.addItem(&m_radarTargets);
+        m_scene.addItem(&m_batchedTargets);
         m_radarTargetPen.setCosmetic(true);
         addCenter();
         addGraticules();
@@ -141,62 +146,121 @@ namespace BlackGui::Components
     void CRadarComponent::refreshTargets()
     {
         if (!sGui || sGui->isShuttingDown()) { return; }
+        if (!sGui->getIContextNetwork() || !sGui->getIContextNetwork()->isConnected() || !isVisibleWidget())
+        {
+            this->clearTargets();
+            return;
+        }
+
+        const CSimulatedAircraftList aircraft = sGui->getIContextNetwork()->getAircraftInRange();
+        QElapsedTimer time;
+        time.start();
+
+        const bool withCallsign    = ui->cb_Callsign->isChecked();
+        const bool withAltitude    = ui->cb_Altitude->isChecked();
+        const bool withGroundSpeed = ui->cb_GroundSpeed->isChecked();
+        const bool withHeading     = ui->cb_Heading->isChecked();
+        CRadarTargetsItem::Targets targets;
+        targets.reserve(aircraft.size());
+        for (const CSimulatedAircraft &sa : aircraft)
+        {
+            targets.insert(sa.getCallsign(), this->radarTarget(sa, withCallsign, withAltitude, withGroundSpeed, withHeading));
+        }
+
+        if (targets.size() >= BatchedTargetsThreshold)
+        {
+            qDeleteAll(m_radarTargets.childItems());
+            m_targetItems.clear();
+            m_batchedTargets.setTargets(targets);
+        }
+        else
+        {
+            m_batchedTargets.clear();
+            this->updateTargetItems(targets);
+        }
+        ui->gv_RadarView->setToolTip(QStringLiteral("%1 targets, updated in %2ms").arg(targets.size()).arg(time.elapsed()));
+    }
+
+    void CRadarComponent::updateTargetItems(const CRadarTargetsItem::Targets &targets)
+    {
+        for (auto it = m_targetItems.begin(); it != m_targetItems.end();)
+        {
+            if (targets.contains(it.key())) { ++it; continue; }
+            delete it->group;
+            it = m_targetItems.erase(it);
+        }
+
+        for (auto it = targets.cbegin(); it != targets.cend(); ++it)
+        {
+            TargetItems &items = m_targetItems[it.key()];
+            const bool created = !items.group;
+            if (created) { items = this->createTargetItems(); }
+
+            const CRadarTargetsItem::Target &target = it.value();
+            if (!created && items.target == target) { continue; }
+            items.group->setPos(target.position);
+            if (created || items.target.label != target.label) { items.tag->setPlainText(target.label); }
+            items.heading->setVisible(target.showHeading);
+            items.heading->setRotation(target.headingDeg);
+            items.target = target;
+        }
+    }
 
+    CRadarComponent::TargetItems CRadarComponent::createTargetItems()
+    {
+        TargetItems items;
+        items.group = new QGraphicsItemGroup(&m_radarTargets);
+
+        items.dot = new QGraphicsEllipseItem(-2.0, -2.0, 4.0, 4.0, items.group);
+        items.dot->setPen(m_radarTargetPen);
+        items.dot->setBrush(m_radarTargetPen.color());
+        items.dot->setFlags(QGraphicsItem::ItemIgnoresTransformations);
+
+        items.tag = new QGraphicsTextItem(items.group);
+        items.tag->setDefaultTextColor(Qt::green);
+        items.tag->setFlags(QGraphicsItem::ItemIgnoresTransformations);
+
+        // pointing north, rotated by the heading
+        items.heading = new QGraphicsLineItem(QLineF({ 0.0, 0.0 }, polarPoint(CRadarTargetsItem::HeadingLineNM, 0.0)), items.group);
+        items.heading->setPen(m_radarTargetPen);
+        return items;
+    }
+
+    void CRadarComponent::clearTargets()
+    {
         qDeleteAll(m_radarTargets.childItems());
+        m_targetItems.clear();
+        m_batchedTargets.clear();
+    }
 
-        if (sGui->getIContextNetwork() && sGui->getIContextNetwork()->isConnected())
+    CRadarTargetsItem::Target CRadarComponent::radarTarget(const CSimulatedAircraft &aircraft, bool withCallsign, bool withAltitude, bool withGroundSpeed, bool withHeading) const
+    {
+        const double distanceNM  = aircraft.getRelativeDistance().value(CLengthUnit::NM());
+        const double bearingRad  = aircraft.getRelativeBearing().value(CAngleUnit::rad());
+        const int groundSpeedKts = aircraft.getGroundSpeed().valueInteger(CSpeedUnit::kts());
+
+        CRadarTargetsItem::Target target;
+        target.position = polarPoint(distanceNM, bearingRad);
+        if (withCallsign)
         {
-            if (isVisibleWidget())
-            {
-                const CSimulatedAircraftList aircraft = sGui->getIContextNetwork()->getAircraftInRange();
-                for (const CSimulatedAircraft &sa : aircraft)
-                {
-                    const double distanceNM  = sa.getRelativeDistance().value(CLengthUnit::NM());
-                    const double bearingRad  = sa.getRelativeBearing().value(CAngleUnit::rad());
-                    const int groundSpeedKts = sa.getGroundSpeed().valueInteger(CSpeedUnit::kts());
-
-                    QPointF position(polarPoint(distanceNM, bearingRad));
-
-                    QGraphicsEllipseItem *dot = new QGraphicsEllipseItem(-2.0, -2.0, 4.0, 4.0, &m_radarTargets);
-                    dot->setPos(position);
-                    dot->setPen(m_radarTargetPen);
-                    dot->setBrush(m_radarTargetPen.color());
-                    dot->setFlags(QGraphicsItem::ItemIgnoresTransformations);
-
-                    QGraphicsTextItem *tag = new QGraphicsTextItem(&m_radarTargets);
-                    QString tagText;
-                    if (ui->cb_Callsign->isChecked())
-                    {
-                        tagText += sa.getCallsignAsString() % u"\n";
-                    }
-                    if (ui->cb_Altitude->isChecked())
-                    {
-                        int flightLeveL = sa.getAltitude().valueInteger(CLengthUnit::ft()) / 100;
-                        tagText += u"FL" % QStringLiteral("%1").arg(flightLeveL, 3, 10, QChar('0'));
-                    }
-                    if (ui->cb_GroundSpeed->isChecked())
-                    {
-                        if (!tagText.isEmpty()) tagText += QStringLiteral(" ");
-                        tagText += QString::number(groundSpeedKts) % u" kt";
-                    }
-
-                    tag->setPlainText(tagText);
-                    tag->setPos(position);
-                    tag->setDefaultTextColor(Qt::green);
-                    tag->setFlags(QGraphicsItem::ItemIgnoresTransformations);
-
-                    if (ui->cb_Heading->isChecked() && groundSpeedKts > 3.0)
-                    {
-                        const double headingRad = sa.getHeading().value(CAngleUnit::rad());
-                        QPen pen(Qt::green, 1);
-                        pen.setCosmetic(true);
-                        QGraphicsLineItem *li = new QGraphicsLineItem(QLineF({ 0.0, 0.0 }, polarPoint(5.0, headingRad)), &m_radarTargets);
-                        li->setPos(position);
-                        li->setPen(pen);
-                    }
-                }
-            }
+            target.label += aircraft.getCallsignAsString() % u"\n";
+        }
+        if (withAltitude)
+        {
+            const int flightLevel = aircraft.getAltitude().valueInteger(CLengthUnit::ft()) / 100;
+            target.label += u"FL" % QStringLiteral("%1").arg(flightLevel, 3, 10, QChar('0'));
+        }
+        if (withGroundSpeed)
+        {
+            if (!target.label.isEmpty()) { target.label += QStringLiteral(" "); }
+            target.label += QString::number(groundSpeedKts) % u" kt";
+        }
+        if (withHeading && groundSpeedKts > 3.0)
+        {
+            target.showHeading = true;
+            target.headingDeg  = aircraft.getHeading().value(CAngleUnit::deg());
         }
+        return target;
     }
 
     void CRadarComponent::rotateView()
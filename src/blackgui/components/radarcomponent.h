@@ -12,17 +12,25 @@
 #define BLACKGUI_COMPONENTS_RADARCOMPONENT_H
 
 #include "blackgui/enablefordockwidgetinfoarea.h"
+#include "blackgui/views/radartargetsitem.h"
 #include "blackgui/blackguiexport.h"
 #include "blackcore/actionbind.h"
+#include "blackmisc/aviation/callsign.h"
 #include "blackmisc/input/actionhotkeydefs.h"
 
 #include <QGraphicsScene>
 #include <QGraphicsItemGroup>
 #include <QFrame>
+#include <QHash>
 #include <QScopedPointer>
 #include <QTimer>
 
+class QGraphicsEllipseItem;
+class QGraphicsLineItem;
+class QGraphicsTextItem;
+
 namespace Ui { class CRadarComponent; }
+namespace BlackMisc::Simulation { class CSimulatedAircraft; }
 namespace BlackGui::Components
 {
     //! GUI displaying a radar like view with aircrafts nearby
@@ -48,7 +56,31 @@ namespace BlackGui::Components
         void addGraticules();
         void addRadials();
 
+        //! Items of a target, if painted as separate items
+        struct TargetItems
+        {
+            QGraphicsItemGroup   *group   = nullptr; //!< at the target position
+            QGraphicsEllipseItem *dot     = nullptr; //!< dot
+            QGraphicsTextItem    *tag     = nullptr; //!< label
+            QGraphicsLineItem    *heading = nullptr; //!< heading line, rotated
+            Views::CRadarTargetsItem::Target target; //!< displayed target
+        };
+
+        //! Update the targets, only changed items are updated
         void refreshTargets();
+
+        //! Update items per target
+        void updateTargetItems(const Views::CRadarTargetsItem::Targets &targets);
+
+        //! Items of a new target
+        TargetItems createTargetItems();
+
+        //! Remove all targets
+        void clearTargets();
+
+        //! Target of an aircraft
+        Views::CRadarTargetsItem::Target radarTarget(const BlackMisc::Simulation::CSimulatedAircraft &aircraft, bool withCallsign, bool withAltitude, bool withGroundSpeed, bool withHeading) const;
+
         void rotateView();
 
         void toggleGrid(bool checked);
@@ -69,6 +101,11 @@ namespace BlackGui::Components
         QGraphicsItemGroup m_macroGraticule;
         QGraphicsItemGroup m_microGraticule;
         QGraphicsItemGroup m_radials;
+        Views::CRadarTargetsItem m_batchedTargets;
+        QHash<BlackMisc::Aviation::CCallsign, TargetItems> m_targetItems; //!< items per target, children of m_radarTargets
+
+        //! From this number of targets, all targets are painted by m_batchedTargets
+        static constexpr int BatchedTargetsThreshold = 100;
 
         QPen m_radarTargetPen = { Qt::green, 1 };
         qreal  m_rangeNM      = 10.0;
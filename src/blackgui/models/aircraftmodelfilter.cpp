@@ -12,6 +12,8 @@
 #include "blackmisc/aviation/livery.h"
 #include "blackmisc/simulation/aircraftmodel.h"
 
+#include <QBitArray>
+
 using namespace BlackMisc::Simulation;
 
 namespace BlackGui::Models
@@ -154,6 +156,64 @@ namespace BlackGui::Models
         return outContainer;
     }
 
+    CAircraftModelList CAircraftModelFilter::filter(const CAircraftModelFilterIndex &index) const
+    {
+        if (!this->isEnabled()) { return index.getModels(); }
+        const QVector<int> rows = this->filterRows(index);
+        CAircraftModelList outContainer;
+        outContainer.reserve(rows.size());
+        for (int row : rows) { outContainer.push_back(index.getModels()[row]); }
+        return outContainer;
+    }
+
+    QVector<int> CAircraftModelFilter::filterRows(const CAircraftModelFilterIndex &index) const
+    {
+        if (!this->isEnabled()) { return CAircraftModelFilterIndex::toRows(index.allRows()); }
+        if (m_id >= 0)
+        {
+            // search only for id
+            const int row = index.rowByDbKey(m_id);
+            return row < 0 ? QVector<int>() : QVector<int>({ row });
+        }
+
+        QBitArray rows = index.allRows();
+        if (!m_simulatorInfo.isAllSimulators()) { rows &= index.simulatorRows(m_simulatorInfo); }
+        if (!m_modelKey.isEmpty()) { rows &= index.matchingRows(CAircraftModelFilterIndex::ModelString, m_modelKey); }
+
+        if (m_military == Qt::Checked)        { rows &=  index.flagRows(CAircraftModelFilterIndex::Military); }
+        else if (m_military == Qt::Unchecked) { rows &= ~index.flagRows(CAircraftModelFilterIndex::Military); }
+
+        if (m_colorLiveries == Qt::Checked)        { rows &=  index.flagRows(CAircraftModelFilterIndex::ColorLivery); }
+        else if (m_colorLiveries == Qt::Unchecked) { rows &= ~index.flagRows(CAircraftModelFilterIndex::ColorLivery); }
+
+        if (!m_description.isEmpty()) { rows &= index.matchingRows(CAircraftModelFilterIndex::Description, m_description); }
+        if (m_modelMode != CAircraftModel::All && m_modelMode != CAircraftModel::Undefined) { rows &= index.modelModeRows(m_modelMode); }
+        if (m_dbKeyFilter != BlackMisc::Db::All && m_dbKeyFilter != BlackMisc::Db::Undefined) { rows &= index.dbKeyStateRows(m_dbKeyFilter); }
+        if (!m_fileName.isEmpty())             { rows &= index.matchingRows(CAircraftModelFilterIndex::FileName, m_fileName); }
+        if (!m_aircraftIcao.isEmpty())         { rows &= index.matchingRows(CAircraftModelFilterIndex::AircraftIcao, m_aircraftIcao); }
+        if (!m_aircraftManufacturer.isEmpty()) { rows &= index.matchingRows(CAircraftModelFilterIndex::Manufacturer, m_aircraftManufacturer); }
+        if (!m_airlineIcao.isEmpty())          { rows &= index.matchingRows(CAircraftModelFilterIndex::AirlineIcao, m_airlineIcao); }
+        if (!m_airlineName.isEmpty())          { rows &= index.matchingRows(CAircraftModelFilterIndex::AirlineName, m_airlineName); }
+        if (!m_liveryCode.isEmpty())           { rows &= index.matchingRows(CAircraftModelFilterIndex::LiveryCode, m_liveryCode); }
+
+        if (m_distributor.hasValidDbKey())
+        {
+            rows &= index.matchingRows(CAircraftModelFilterIndex::Distributor, [this](const CAircraftModel &model)
+            {
+                return model.getDistributor().matchesKeyOrAlias(m_distributor);
+            });
+        }
+
+        if (!m_combinedType.isEmpty())
+        {
+            rows &= index.matchingRows(CAircraftModelFilterIndex::CombinedType, [this](const CAircraftModel &model)
+            {
+                return model.getAircraftIcaoCode().matchesCombinedType(m_combinedType);
+            });
+        }
+        return CAircraftModelFilterIndex::toRows(rows);
+    }
+
     bool CAircraftModelFilter::valid() const
     {
         const bool allEmpty =
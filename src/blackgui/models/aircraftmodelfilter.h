@@ -12,6 +12,7 @@
 #define BLACKGUI_MODELS_AIRCRAFTMODELFILTER_H
 
 #include "blackgui/blackguiexport.h"
+#include "blackgui/models/aircraftmodelfilterindex.h"
 #include "blackgui/models/modelfilter.h"
 #include "blackmisc/simulation/aircraftmodel.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
@@ -20,6 +21,7 @@
 #include "blackmisc/db/datastore.h"
 
 #include <QString>
+#include <QVector>
 
 namespace BlackGui::Models
 {
@@ -44,6 +46,13 @@ namespace BlackGui::Models
         //! \copydoc IModelFilter::filter
         virtual BlackMisc::Simulation::CAircraftModelList filter(const BlackMisc::Simulation::CAircraftModelList &inContainer) const override;
 
+        //! Filter the indexed models, same result as filter(index.getModels())
+        BlackMisc::Simulation::CAircraftModelList filter(const CAircraftModelFilterIndex &index) const;
+
+        //! Rows of the indexed models matching the filter
+        //! \remark intersection of the index bitsets, no model is compared
+        QVector<int> filterRows(const CAircraftModelFilterIndex &index) const;
+
     private:
         int m_id = -1;
         QString m_modelKey;
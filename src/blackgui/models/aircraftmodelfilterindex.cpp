@@ -0,0 +1,282 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackgui/models/aircraftmodelfilterindex.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/airlineicaocode.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/simulation/distributor.h"
+
+#include <QStringBuilder>
+#include <algorithm>
+#include <iterator>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Db;
+using namespace BlackMisc::Simulation;
+
+namespace BlackGui::Models
+{
+    CAircraftModelFilterIndex::CAircraftModelFilterIndex(const CAircraftModelList &models) : m_models(models)
+    {
+        const int size = m_models.size();
+        for (QBitArray &flag : m_flags) { flag = QBitArray(size); }
+        m_validDbKeys = QBitArray(size);
+
+        std::array<QStringList, NumberOfTextColumns> rowValues;
+        for (QStringList &values : rowValues) { values.reserve(size); }
+
+        int row = 0;
+        for (const CAircraftModel &model : std::as_const(m_models))
+        {
+            for (int c = 0; c < NumberOfTextColumns; c++)
+            {
+                rowValues[static_cast<size_t>(c)].push_back(indexValue(columnValue(model, static_cast<TextColumn>(c))));
+            }
+
+            if (model.isMilitary()) { m_flags[Military].setBit(row); }
+            if (model.getLivery().isColorLivery()) { m_flags[ColorLivery].setBit(row); }
+            if (model.hasValidDbKey()) { m_validDbKeys.setBit(row); }
+            if (model.isLoadedFromDb() && !m_rowByDbKey.contains(model.getDbKey())) { m_rowByDbKey.insert(model.getDbKey(), row); }
+
+            QBitArray &simulators = m_simulators[static_cast<int>(model.getSimulator().getSimulator())];
+            if (simulators.isEmpty()) { simulators = QBitArray(size); }
+            simulators.setBit(row);
+
+            QBitArray &modes = m_modelModes[static_cast<int>(model.getModelMode())];
+            if (modes.isEmpty()) { modes = QBitArray(size); }
+            modes.setBit(row);
+            row++;
+        }
+
+        for (int c = 0; c < NumberOfTextColumns; c++)
+        {
+            m_columns[static_cast<size_t>(c)] = buildColumn(rowValues[static_cast<size_t>(c)]);
+        }
+    }
+
+    QBitArray CAircraftModelFilterIndex::matchingRows(TextColumn column, const QString &filterExpression) const
+    {
+        const Column &c = m_columns[static_cast<size_t>(column)];
+        return this->toRowBits(c, matchingValueIds(c, filterExpression));
+    }
+
+    QBitArray CAircraftModelFilterIndex::matchingRows(TextColumn column, const std::function<bool (const CAircraftModel &)> &predicate) const
+    {
+        const Column &c = m_columns[static_cast<size_t>(column)];
+        QVector<int> valueIds;
+        for (int id = 0; id < c.rows.size(); id++)
+        {
+            // any model of the value will do
+            if (predicate(m_models[c.rows[id].front()])) { valueIds.push_back(id); }
+        }
+        return this->toRowBits(c, valueIds);
+    }
+
+    QBitArray CAircraftModelFilterIndex::modelModeRows(CAircraftModel::ModelModeFilter mode) const
+    {
+        if (mode == CAircraftModel::All) { return this->allRows(); }
+        return this->valueRows(m_modelModes, [mode](int modelMode) { return (mode & static_cast<CAircraftModel::ModelMode>(modelMode)) > 0; });
+    }
+
+    QBitArray CAircraftModelFilterIndex::dbKeyStateRows(DbKeyStateFilter filter) const
+    {
+        if (filter == All) { return this->allRows(); }
+        QBitArray rows(this->size());
+        if (filter.testFlag(Valid))   { rows |= m_validDbKeys; }
+        if (filter.testFlag(Invalid)) { rows |= ~m_validDbKeys; }
+        return rows;
+    }
+
+    QBitArray CAircraftModelFilterIndex::simulatorRows(const CSimulatorInfo &simulator) const
+    {
+        return this->valueRows(m_simulators, [&simulator](int modelSimulator) { return simulator.matchesAny(CSimulatorInfo(modelSimulator)); });
+    }
+
+    QVector<int> CAircraftModelFilterIndex::toRows(const QBitArray &rows)
+    {
+        QVector<int> indexes;
+        indexes.reserve(rows.count(true));
+        for (int row = 0; row < rows.size(); row++)
+        {
+            if (rows.testBit(row)) { indexes.push_back(row); }
+        }
+        return indexes;
+    }
+
+    QString CAircraftModelFilterIndex::columnValue(const CAircraftModel &model, TextColumn column)
+    {
+        switch (column)
+        {
+        case ModelString:  return model.getModelString();
+        case Description:  return model.getDescription();
+        case FileName:     return model.getFileName();
+        case AircraftIcao: return model.getAircraftIcaoCodeDesignator();
+        case Manufacturer: return model.getAircraftIcaoCode().getManufacturer();
+        case AirlineIcao:  return model.getAirlineIcaoCodeDesignator();
+        case AirlineName:  return model.getAirlineIcaoCode().getName();
+        case LiveryCode:   return model.getLivery().getCombinedCode();
+        case CombinedType: return model.getAircraftIcaoCode().getCombinedType();
+        case Distributor:
+        {
+            const CDistributor &distributor = model.getDistributor();
+            return distributor.getDbKey() % u' ' % distributor.getAlias1() % u' ' % distributor.getAlias2();
+        }
+        default: break;
+        }
+        Q_ASSERT_X(false, Q_FUNC_INFO, "Unknown column");
+        return {};
+    }
+
+    CAircraftModelFilterIndex::Column CAircraftModelFilterIndex::buildColumn(const QStringList &rowValues)
+    {
+        Column column;
+        QHash<QString, int> ids;
+        for (const QString &value : rowValues)
+        {
+            if (!ids.contains(value)) { ids.insert(value, -1); column.values.push_back(value); }
+        }
+
+        // ids in sorted order, so prefix ranges are id ranges
+        std::sort(column.values.begin(), column.values.end());
+        for (int id = 0; id < column.values.size(); id++) { ids[column.values[id]] = id; }
+        column.emptyId = ids.value(QString(), -1);
+
+        column.rows.resize(column.values.size());
+        for (int row = 0; row < rowValues.size(); row++) { column.rows[ids.value(rowValues[row])].push_back(row); }
+
+        QVector<QPair<QString, int>> reversed;
+        reversed.reserve(column.values.size());
+        for (int id = 0; id < column.values.size(); id++)
+        {
+            const QString &value = column.values[id];
+            QString r(value);
+            std::reverse(r.begin(), r.end());
+            reversed.push_back({ r, id });
+
+            // ids are increasing, so the lists are sorted and a duplicate trigram can only be the last id
+            for (int i = 0; i + 3 <= value.length(); i++)
+            {
+                QVector<int> &trigramIds = column.trigrams[value.mid(i, 3)];
+                if (trigramIds.isEmpty() || trigramIds.back() != id) { trigramIds.push_back(id); }
+            }
+        }
+        std::sort(reversed.begin(), reversed.end());
+        for (const auto &r : std::as_const(reversed))
+        {
+            column.reversedValues.push_back(r.first);
+            column.reversedIds.push_back(r.second);
+        }
+        return column;
+    }
+
+    QVector<int> CAircraftModelFilterIndex::matchingValueIds(const Column &column, const QString &filterExpression)
+    {
+        const QString f = indexValue(filterExpression);
+        const auto prefixRange = [](const QStringList &values, const QString &prefix)
+        {
+            const auto begin = std::lower_bound(values.cbegin(), values.cend(), prefix);
+            auto end = begin;
+            while (end != values.cend() && end->startsWith(prefix)) { ++end; }
+            return qMakePair(static_cast<int>(std::distance(values.cbegin(), begin)), static_cast<int>(std::distance(values.cbegin(), end)));
+        };
+
+        // no wildcard, just string matching
+        QVector<int> ids;
+        if (!f.contains('*'))
+        {
+            const auto it = std::lower_bound(column.values.cbegin(), column.values.cend(), f);
+            if (it != column.values.cend() && *it == f) { ids.push_back(static_cast<int>(std::distance(column.values.cbegin(), it))); }
+            return ids;
+        }
+
+        // same order of checks as IModelFilter::stringMatchesFilterExpression, empty values never match a wildcard
+        QString fragment(f);
+        fragment.remove('*');
+        if (f.startsWith('*') && f.endsWith('*'))
+        {
+            if (fragment.length() < 3)
+            {
+                for (int id = 0; id < column.values.size(); id++)
+                {
+                    if (id != column.emptyId && column.values[id].contains(fragment)) { ids.push_back(id); }
+                }
+                return ids;
+            }
+
+            // candidates have all trigrams of the fragment
+            QVector<int> candidates;
+            for (int i = 0; i + 3 <= fragment.length(); i++)
+            {
+                const auto trigram = column.trigrams.constFind(fragment.mid(i, 3));
+                if (trigram == column.trigrams.constEnd()) { return {}; }
+                if (i == 0) { candidates = trigram.value(); continue; }
+                QVector<int> intersection;
+                std::set_intersection(candidates.cbegin(), candidates.cend(), trigram.value().cbegin(), trigram.value().cend(), std::back_inserter(intersection));
+                candidates = std::move(intersection);
+                if (candidates.isEmpty()) { return {}; }
+            }
+            for (int id : std::as_const(candidates))
+            {
+                if (column.values[id].contains(fragment)) { ids.push_back(id); }
+            }
+            return ids;
+        }
+
+        if (f.endsWith('*'))
+        {
+            const auto range = prefixRange(column.values, fragment);
+            for (int id = range.first; id < range.second; id++)
+            {
+                if (id != column.emptyId) { ids.push_back(id); }
+            }
+            return ids;
+        }
+
+        if (f.startsWith('*'))
+        {
+            std::reverse(fragment.begin(), fragment.end());
+            const auto range = prefixRange(column.reversedValues, fragment);
+            for (int i = range.first; i < range.second; i++)
+            {
+                const int id = column.reversedIds[i];
+                if (id != column.emptyId) { ids.push_back(id); }
+            }
+            return ids;
+        }
+
+        // wildcard in middle
+        const QStringList parts = f.split('*');
+        const auto range = prefixRange(column.values, parts.front());
+        for (int id = range.first; id < range.second; id++)
+        {
+            if (id != column.emptyId && column.values[id].endsWith(parts.back())) { ids.push_back(id); }
+        }
+        return ids;
+    }
+
+    QBitArray CAircraftModelFilterIndex::toRowBits(const Column &column, const QVector<int> &valueIds) const
+    {
+        QBitArray rows(this->size());
+        for (int id : valueIds)
+        {
+            for (int row : column.rows[id]) { rows.setBit(row); }
+        }
+        return rows;
+    }
+
+    QBitArray CAircraftModelFilterIndex::valueRows(const QHash<int, QBitArray> &rowsByValue, const std::function<bool (int)> &predicate) const
+    {
+        QBitArray rows(this->size());
+        for (auto it = rowsByValue.cbegin(); it != rowsByValue.cend(); ++it)
+        {
+            if (predicate(it.key())) { rows |= it.value(); }
+        }
+        return rows;
+    }
+} // ns
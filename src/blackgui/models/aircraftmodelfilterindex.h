@@ -0,0 +1,150 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKGUI_MODELS_AIRCRAFTMODELFILTERINDEX_H
+#define BLACKGUI_MODELS_AIRCRAFTMODELFILTERINDEX_H
+
+#include "blackgui/blackguiexport.h"
+#include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/simulatorinfo.h"
+#include "blackmisc/db/datastore.h"
+
+#include <QBitArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <array>
+#include <functional>
+
+namespace BlackGui::Models
+{
+    /*!
+     * Search index of a model list for CAircraftModelFilter.
+     *
+     * Text columns are stored as distinct lower case values (interned per index) with the rows of each value,
+     * sorted for prefix search, reversed for suffix search and with a trigram index for "contains" search.
+     * Flags and enum values are stored as bitsets. A filter is then the intersection of bitsets of rows,
+     * and only distinct values are compared, not every model.
+     * \remark build once per list, a changed list needs a new index (see isIndexOf)
+     */
+    class BLACKGUI_EXPORT CAircraftModelFilterIndex
+    {
+    public:
+        //! Text columns
+        enum TextColumn
+        {
+            ModelString,
+            Description,
+            FileName,
+            AircraftIcao,
+            Manufacturer,
+            AirlineIcao,
+            AirlineName,
+            LiveryCode,
+            CombinedType,   //!< combined type of the aircraft ICAO code
+            Distributor,    //!< distributor key and aliases
+            NumberOfTextColumns
+        };
+
+        //! Flags
+        enum Flag
+        {
+            Military,
+            ColorLivery,
+            NumberOfFlags
+        };
+
+        //! Default constructor, empty
+        CAircraftModelFilterIndex() {}
+
+        //! Index of models
+        explicit CAircraftModelFilterIndex(const BlackMisc::Simulation::CAircraftModelList &models);
+
+        //! The indexed models
+        const BlackMisc::Simulation::CAircraftModelList &getModels() const { return m_models; }
+
+        //! Number of models
+        int size() const { return m_models.size(); }
+
+        //! Is this the index of models?
+        //! \remark O(1) if models share the data with the indexed list (unchanged copy)
+        bool isIndexOf(const BlackMisc::Simulation::CAircraftModelList &models) const { return m_models == models; }
+
+        //! All rows
+        QBitArray allRows() const { return QBitArray(this->size(), true); }
+
+        //! Rows with a value matching the filter expression, as IModelFilter::stringMatchesFilterExpression
+        QBitArray matchingRows(TextColumn column, const QString &filterExpression) const;
+
+        //! Rows for which the predicate is true, the predicate is called once per distinct value of column
+        //! \remark only for predicates which only depend on the column value
+        QBitArray matchingRows(TextColumn column, const std::function<bool(const BlackMisc::Simulation::CAircraftModel &)> &predicate) const;
+
+        //! Rows with flag
+        const QBitArray &flagRows(Flag flag) const { return m_flags[static_cast<size_t>(flag)]; }
+
+        //! Rows matching the model mode
+        QBitArray modelModeRows(BlackMisc::Simulation::CAircraftModel::ModelModeFilter mode) const;
+
+        //! Rows matching the DB key state
+        QBitArray dbKeyStateRows(BlackMisc::Db::DbKeyStateFilter filter) const;
+
+        //! Rows of models for any of the simulators
+        QBitArray simulatorRows(const BlackMisc::Simulation::CSimulatorInfo &simulator) const;
+
+        //! Row of the first model loaded from DB with key, -1 if none
+        int rowByDbKey(int dbKey) const { return m_rowByDbKey.value(dbKey, -1); }
+
+        //! Set rows to row indexes
+        static QVector<int> toRows(const QBitArray &rows);
+
+        //! Value as used in the index, trimmed and lower case
+        static QString indexValue(const QString &value) { return value.trimmed().toLower(); }
+
+    private:
+        //! Index of a text column
+        struct Column
+        {
+            QStringList values;               //!< distinct values, sorted
+            QVector<QVector<int>> rows;       //!< rows by value id
+            QStringList reversedValues;       //!< distinct values reversed, sorted
+            QVector<int> reversedIds;         //!< value ids of reversedValues
+            QHash<QString, QVector<int>> trigrams; //!< value ids by trigram
+            int emptyId = -1;                 //!< id of the empty value, -1 if none
+        };
+
+        //! Value of a text column
+        static QString columnValue(const BlackMisc::Simulation::CAircraftModel &model, TextColumn column);
+
+        //! Build a text column
+        static Column buildColumn(const QStringList &rowValues);
+
+        //! Value ids matching the filter expression
+        static QVector<int> matchingValueIds(const Column &column, const QString &filterExpression);
+
+        //! Rows of value ids
+        QBitArray toRowBits(const Column &column, const QVector<int> &valueIds) const;
+
+        //! Rows of values with bitsets by value
+        QBitArray valueRows(const QHash<int, QBitArray> &rowsByValue, const std::function<bool(int)> &predicate) const;
+
+        BlackMisc::Simulation::CAircraftModelList m_models;
+        std::array<Column, NumberOfTextColumns> m_columns;
+        std::array<QBitArray, NumberOfFlags> m_flags;
+        QHash<int, QBitArray> m_simulators;  //!< rows by simulator flags
+        QHash<int, QBitArray> m_modelModes;  //!< rows by model mode
+        QBitArray m_validDbKeys;             //!< rows with valid DB key
+        QHash<int, int> m_rowByDbKey;        //!< first row by DB key
+    };
+} // ns
+
+#endif // guard
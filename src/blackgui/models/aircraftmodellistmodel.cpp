@@ -7,6 +7,7 @@
  */
 
 #include "blackgui/models/aircraftmodellistmodel.h"
+#include "blackgui/models/aircraftmodelfilter.h"
 #include "blackgui/models/columnformatters.h"
 #include "blackgui/models/columns.h"
 #include "blackmisc/aviation/aircrafticaocode.h"
@@ -239,4 +240,20 @@ namespace BlackGui::Models
     {
         return !m_highlightStrings.isEmpty();
     }
+
+    void CAircraftModelListModel::updateFilteredContainer()
+    {
+        const CAircraftModelFilter *filter = this->hasFilter() ? dynamic_cast<const CAircraftModelFilter *>(m_filter.get()) : nullptr;
+        if (!filter || m_container.size() < FilterIndexThreshold)
+        {
+            // keep the index for the next filter, but not for an outdated list
+            if (m_container.size() < FilterIndexThreshold || !m_filterIndex.isIndexOf(m_container)) { m_filterIndex = CAircraftModelFilterIndex(); }
+            COrderableListModelDbObjects::updateFilteredContainer();
+            return;
+        }
+
+        // the index shares the data with m_container as long as it is not changed, so this check is cheap
+        if (!m_filterIndex.isIndexOf(m_container)) { m_filterIndex = CAircraftModelFilterIndex(m_container); }
+        m_containerFiltered = filter->filter(m_filterIndex);
+    }
 } // namespace
@@ -12,6 +12,7 @@
 #define BLACKGUI_MODELS_AIRCRAFTMODELLISTMODEL_H
 
 #include "blackgui/blackguiexport.h"
+#include "blackgui/models/aircraftmodelfilterindex.h"
 #include "blackgui/models/listmodeldbobjects.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
 
@@ -90,11 +91,20 @@ namespace BlackGui::Models
         //! \copydoc BlackGui::Models::CListModelBaseNonTemplate::isOrderable
         virtual bool isOrderable() const override { return true; }
 
+    protected:
+        //! \copydoc CListModelBase::updateFilteredContainer
+        //! \remark larger lists are filtered with a CAircraftModelFilterIndex, built on first use after the list changed
+        virtual void updateFilteredContainer() override;
+
     private:
+        //! Lists with fewer models are filtered without index
+        static constexpr int FilterIndexThreshold = 1000;
+
         AircraftModelMode m_mode = NotSet;              //!< current mode
         bool              m_highlightModels = false;    //!< highlight if in m_highlightStrings
         QStringList       m_highlightStrings;           //!< model strings to highlight
         QBrush            m_highlightColor{Qt::yellow}; //!< how to highlight
+        CAircraftModelFilterIndex m_filterIndex;        //!< index of m_container for filtering
     };
 } // ns
 #endif // guard
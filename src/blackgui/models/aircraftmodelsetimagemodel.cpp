@@ -0,0 +1,189 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackgui/models/aircraftmodelsetimagemodel.h"
+#include "blackmisc/simulation/distributor.h"
+#include "blackmisc/aviation/livery.h"
+
+#include <QBrush>
+#include <QStringView>
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackGui::Models
+{
+    CAircraftModelSetImageModel::CAircraftModelSetImageModel(QObject *parent) :
+        QAbstractTableModel(parent)
+    { }
+
+    int CAircraftModelSetImageModel::rowCount(const QModelIndex &parent) const
+    {
+        if (parent.isValid()) { return 0; }
+        return m_image ? m_image->size() : m_models.sizeInt();
+    }
+
+    int CAircraftModelSetImageModel::columnCount(const QModelIndex &parent) const
+    {
+        if (parent.isValid()) { return 0; }
+        return ColumnCount;
+    }
+
+    QVariant CAircraftModelSetImageModel::data(const QModelIndex &index, int role) const
+    {
+        if (!index.isValid()) { return QVariant(); }
+        const int row = index.row();
+        if (row < 0 || row >= this->rowCount()) { return QVariant(); }
+
+        if (role == Qt::DisplayRole)
+        {
+            // only the requested cell is read from the image
+            return m_image ?
+                   this->displayValue(m_image->at(row), index.column()) :
+                   this->displayValue(m_models[row], index.column());
+        }
+        if (role == Qt::ForegroundRole)
+        {
+            if (m_highlightModelStrings.isEmpty()) { return QVariant(); }
+            if (!m_highlightModelStrings.contains(this->modelStringAt(row).toUpper())) { return QVariant(); }
+            return QBrush(Qt::red);
+        }
+        return QVariant();
+    }
+
+    QVariant CAircraftModelSetImageModel::headerData(int section, Qt::Orientation orientation, int role) const
+    {
+        if (orientation != Qt::Horizontal || role != Qt::DisplayRole) { return QVariant(); }
+        switch (section)
+        {
+        case ColumnModelString: return QStringLiteral("model");
+        case ColumnAircraftIcao: return QStringLiteral("aircraft");
+        case ColumnAirline: return QStringLiteral("airline");
+        case ColumnLivery: return QStringLiteral("livery");
+        case ColumnDistributor: return QStringLiteral("distributor");
+        case ColumnSimulator: return QStringLiteral("simulator");
+        case ColumnMode: return QStringLiteral("mode");
+        case ColumnDbKey: return QStringLiteral("DB key");
+        case ColumnName: return QStringLiteral("name");
+        case ColumnDescription: return QStringLiteral("description");
+        default: break;
+        }
+        return QVariant();
+    }
+
+    void CAircraftModelSetImageModel::setImage(const QSharedPointer<const CAircraftModelSetImage> &image)
+    {
+        this->beginResetModel();
+        m_image = image;
+        m_models.clear();
+        this->endResetModel();
+    }
+
+    void CAircraftModelSetImageModel::setModels(const CAircraftModelList &models)
+    {
+        this->beginResetModel();
+        m_image.reset();
+        m_models = models;
+        this->endResetModel();
+    }
+
+    void CAircraftModelSetImageModel::clear()
+    {
+        this->beginResetModel();
+        m_image.reset();
+        m_models.clear();
+        this->endResetModel();
+    }
+
+    CAircraftModel CAircraftModelSetImageModel::modelAt(int row) const
+    {
+        if (row < 0 || row >= this->rowCount()) { return CAircraftModel(); }
+        return m_image ? m_image->at(row).toAircraftModel() : m_models[row];
+    }
+
+    QString CAircraftModelSetImageModel::modelStringAt(int row) const
+    {
+        if (row < 0 || row >= this->rowCount()) { return {}; }
+        return m_image ? m_image->at(row).getModelString().toString() : m_models[row].getModelString();
+    }
+
+    CAircraftModelList CAircraftModelSetImageModel::findModelsStartingWith(const QString &modelString, Qt::CaseSensitivity cs) const
+    {
+        if (!m_image) { return m_models.findModelsStartingWith(modelString, cs); }
+
+        // the image index is case insensitive
+        QVector<CAircraftModelImageView> views = m_image->findModelsStartingWith(modelString);
+        if (cs == Qt::CaseSensitive)
+        {
+            views.erase(std::remove_if(views.begin(), views.end(), [&](const CAircraftModelImageView &view)
+            {
+                return !view.getModelString().startsWith(modelString, Qt::CaseSensitive);
+            }), views.end());
+        }
+        return CAircraftModelSetImage::toAircraftModelList(views);
+    }
+
+    bool CAircraftModelSetImageModel::containsModelString(const QString &modelString) const
+    {
+        return m_image ? m_image->containsModelString(modelString) : m_models.containsModelString(modelString);
+    }
+
+    void CAircraftModelSetImageModel::setHighlightModelStrings(const QStringList &modelStrings)
+    {
+        QSet<QString> highlight;
+        for (const QString &modelString : modelStrings) { highlight.insert(modelString.toUpper()); }
+        if (highlight == m_highlightModelStrings) { return; }
+        m_highlightModelStrings = highlight;
+
+        const int rows = this->rowCount();
+        if (rows < 1) { return; }
+        emit this->dataChanged(this->index(0, 0), this->index(rows - 1, ColumnCount - 1), { Qt::ForegroundRole });
+    }
+
+    QVariant CAircraftModelSetImageModel::displayValue(const CAircraftModelImageView &model, int column) const
+    {
+        switch (column)
+        {
+        case ColumnModelString: return model.getModelString().toString();
+        case ColumnAircraftIcao: return model.getAircraftIcaoCodeDesignator().toString();
+        case ColumnAirline: return model.getAirlineIcaoCodeDesignator().toString();
+        case ColumnLivery: return model.getLiveryCombinedCode().toString();
+        case ColumnDistributor: return model.getDistributorKey().toString();
+        case ColumnSimulator: return model.getSimulator().toQString(true);
+        case ColumnMode: return CAircraftModel::modelModeToString(model.getModelMode());
+        case ColumnDbKey: return model.getDbKey() >= 0 ? QVariant(model.getDbKey()) : QVariant();
+        case ColumnName: return model.getName().toString();
+        case ColumnDescription: return model.getDescription().toString();
+        default: break;
+        }
+        return QVariant();
+    }
+
+    QVariant CAircraftModelSetImageModel::displayValue(const CAircraftModel &model, int column) const
+    {
+        switch (column)
+        {
+        case ColumnModelString: return model.getModelString();
+        case ColumnAircraftIcao: return model.getAircraftIcaoCodeDesignator();
+        case ColumnAirline: return model.getAirlineIcaoCodeDesignator();
+        case ColumnLivery: return model.getLivery().getCombinedCode();
+        case ColumnDistributor: return model.getDistributor().getDbKey();
+        case ColumnSimulator: return model.getSimulator().toQString(true);
+        case ColumnMode: return model.getModelModeAsString();
+        case ColumnDbKey: return model.hasValidDbKey() ? QVariant(model.getDbKey()) : QVariant();
+        case ColumnName: return model.getName();
+        case ColumnDescription: return model.getDescription();
+        default: break;
+        }
+        return QVariant();
+    }
+} // ns
@@ -0,0 +1,115 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKGUI_MODELS_AIRCRAFTMODELSETIMAGEMODEL_H
+#define BLACKGUI_MODELS_AIRCRAFTMODELSETIMAGEMODEL_H
+
+#include "blackgui/blackguiexport.h"
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+
+#include <QAbstractTableModel>
+#include <QModelIndex>
+#include <QObject>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QVariant>
+#include <Qt>
+
+namespace BlackGui::Models
+{
+    /*!
+     * Read-only model of a model set, reading the rows directly from the memory-mapped model set image.
+     *
+     * Only the displayed cells are read from the image, a CAircraftModel is materialized for a single row
+     * when it is needed. If there is no image (e.g. the core runs on another machine) a model list is used.
+     */
+    class BLACKGUI_EXPORT CAircraftModelSetImageModel : public QAbstractTableModel
+    {
+        Q_OBJECT
+
+    public:
+        //! Columns
+        enum Column
+        {
+            ColumnModelString,
+            ColumnAircraftIcao,
+            ColumnAirline,
+            ColumnLivery,
+            ColumnDistributor,
+            ColumnSimulator,
+            ColumnMode,
+            ColumnDbKey,
+            ColumnName,
+            ColumnDescription,
+            ColumnCount
+        };
+
+        //! Constructor
+        explicit CAircraftModelSetImageModel(QObject *parent = nullptr);
+
+        //! Destructor
+        virtual ~CAircraftModelSetImageModel() override {}
+
+        //! \copydoc QAbstractTableModel::rowCount
+        int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+        //! \copydoc QAbstractTableModel::columnCount
+        int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+        //! \copydoc QAbstractTableModel::data
+        QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+        //! \copydoc QAbstractTableModel::headerData
+        QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+        //! Display the models of the image
+        void setImage(const QSharedPointer<const BlackMisc::Simulation::CAircraftModelSetImage> &image);
+
+        //! Display the models of a list, used if there is no image
+        void setModels(const BlackMisc::Simulation::CAircraftModelList &models);
+
+        //! Clear model
+        void clear();
+
+        //! Displaying an image?
+        bool isUsingImage() const { return !m_image.isNull(); }
+
+        //! Materialized model of row, default model for an invalid row
+        BlackMisc::Simulation::CAircraftModel modelAt(int row) const;
+
+        //! Model string of row
+        QString modelStringAt(int row) const;
+
+        //! Models whose model string starts with
+        //! \remark only the found models are materialized
+        BlackMisc::Simulation::CAircraftModelList findModelsStartingWith(const QString &modelString, Qt::CaseSensitivity cs) const;
+
+        //! Contains model string (case insensitive)?
+        bool containsModelString(const QString &modelString) const;
+
+        //! Highlight the models with these model strings
+        void setHighlightModelStrings(const QStringList &modelStrings);
+
+    private:
+        //! Display value of a column
+        //! @{
+        QVariant displayValue(const BlackMisc::Simulation::CAircraftModelImageView &model, int column) const;
+        QVariant displayValue(const BlackMisc::Simulation::CAircraftModel &model, int column) const;
+        //! @}
+
+        QSharedPointer<const BlackMisc::Simulation::CAircraftModelSetImage> m_image; //!< mapped image, null if not used
+        BlackMisc::Simulation::CAircraftModelList m_models;                          //!< fallback if there is no image
+        QSet<QString> m_highlightModelStrings;                                       //!< upper case model strings
+    };
+} // ns
+
+#endif // guard
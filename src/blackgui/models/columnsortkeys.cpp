@@ -0,0 +1,185 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackgui/models/columnsortkeys.h"
+#include "blackmisc/pq/acceleration.h"
+#include "blackmisc/pq/angle.h"
+#include "blackmisc/pq/frequency.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/mass.h"
+#include "blackmisc/pq/pressure.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/temperature.h"
+#include "blackmisc/pq/time.h"
+
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+using namespace BlackMisc;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackGui::Models
+{
+    namespace
+    {
+        //! Physical quantity in its default unit, null values last like CPhysicalQuantity::lessThan
+        template <class PQ, class MU>
+        bool pqKey(const CVariant &value, double &key)
+        {
+            if (value.userType() != qMetaTypeId<PQ>()) { return false; }
+            const PQ pq = value.value<PQ>();
+            key = pq.isNull() ? std::numeric_limits<double>::infinity() : pq.value(MU::defaultUnit());
+            return true;
+        }
+
+        //! Real key of a value
+        bool realKey(const CVariant &value, double &key)
+        {
+            if (value.isArithmetic()) { key = value.toDouble(); return true; }
+            return pqKey<CLength, CLengthUnit>(value, key) || pqKey<CSpeed, CSpeedUnit>(value, key) ||
+                   pqKey<CAngle, CAngleUnit>(value, key) || pqKey<CFrequency, CFrequencyUnit>(value, key) ||
+                   pqKey<CTime, CTimeUnit>(value, key) || pqKey<CPressure, CPressureUnit>(value, key) ||
+                   pqKey<CTemperature, CTemperatureUnit>(value, key) || pqKey<CMass, CMassUnit>(value, key) ||
+                   pqKey<CAcceleration, CAccelerationUnit>(value, key);
+        }
+    }
+
+    CColumnSortKeys::CColumnSortKeys(QVector<CVariant> &&values, Qt::CaseSensitivity caseSensitivity) : m_size(values.size())
+    {
+        if (values.isEmpty()) { return; }
+        if (this->extractIntegers(values)) { m_type = IntegerKeys; return; }
+        if (this->extractReals(values)) { m_type = RealKeys; return; }
+        if (this->extractStringRanks(values, caseSensitivity)) { m_type = StringRankKeys; return; }
+        m_variants = std::move(values);
+        m_type = VariantKeys;
+    }
+
+    bool CColumnSortKeys::extractIntegers(const QVector<CVariant> &values)
+    {
+        const int type = values.front().userType();
+        const bool isDateTime = (type == QMetaType::QDateTime);
+        if (!isDateTime && !values.front().isIntegral()) { return false; }
+
+        m_integers.resize(values.size());
+        qint64 *keys = m_integers.data();
+        for (const CVariant &value : values)
+        {
+            if (value.userType() != type) { m_integers.clear(); return false; }
+            if (isDateTime)
+            {
+                const QDateTime dt = value.toDateTime();
+                *keys++ = dt.isValid() ? dt.toMSecsSinceEpoch() : std::numeric_limits<qint64>::min();
+            }
+            else
+            {
+                *keys++ = value.toLongLong();
+            }
+        }
+        return true;
+    }
+
+    bool CColumnSortKeys::extractReals(const QVector<CVariant> &values)
+    {
+        m_reals.resize(values.size());
+        double *keys = m_reals.data();
+        const int type = values.front().userType();
+        for (const CVariant &value : values)
+        {
+            if (value.userType() != type || !realKey(value, *keys++)) { m_reals.clear(); return false; }
+        }
+        return true;
+    }
+
+    bool CColumnSortKeys::extractStringRanks(const QVector<CVariant> &values, Qt::CaseSensitivity caseSensitivity)
+    {
+        // distinct strings, normally a lot less than rows
+        QHash<QString, int> distinct;
+        QVector<int> distinctIndexes;
+        distinctIndexes.reserve(values.size());
+        for (const CVariant &value : values)
+        {
+            if (value.userType() != QMetaType::QString) { return false; }
+            const QString s = value.toQString();
+            auto it = distinct.find(s);
+            if (it == distinct.end()) { it = distinct.insert(s, distinct.size()); }
+            distinctIndexes.push_back(it.value());
+        }
+
+        // rank of the distinct strings, equal strings (e.g. case insensitive) have the same rank
+        QVector<QString> strings(distinct.size());
+        for (auto it = distinct.cbegin(); it != distinct.cend(); ++it) { strings[it.value()] = it.key(); }
+        QVector<int> order(strings.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](int a, int b) { return strings[a].compare(strings[b], caseSensitivity) < 0; });
+        QVector<qint64> ranks(strings.size());
+        qint64 rank = 0;
+        for (int i = 0; i < order.size(); i++)
+        {
+            if (i > 0 && strings[order[i - 1]].compare(strings[order[i]], caseSensitivity) != 0) { rank++; }
+            ranks[order[i]] = rank;
+        }
+
+        m_integers.resize(values.size());
+        for (int row = 0; row < distinctIndexes.size(); row++) { m_integers[row] = ranks[distinctIndexes[row]]; }
+        return true;
+    }
+
+    int CColumnSortKeys::compareRows(int a, int b) const
+    {
+        switch (m_type)
+        {
+        case IntegerKeys:
+        case StringRankKeys: return (m_integers[a] < m_integers[b]) ? -1 : (m_integers[b] < m_integers[a]) ? 1 : 0;
+        case RealKeys: return (m_reals[a] < m_reals[b]) ? -1 : (m_reals[b] < m_reals[a]) ? 1 : 0;
+        case VariantKeys: return compare(m_variants[a], m_variants[b]);
+        default: break;
+        }
+        return 0;
+    }
+
+    QVector<int> CColumnSortKeys::sortedRows(Qt::SortOrder order, const TieBreaker &tieBreaker) const
+    {
+        QVector<int> rows(m_size);
+        std::iota(rows.begin(), rows.end(), 0);
+        const bool ascending = (order == Qt::AscendingOrder);
+        std::sort(rows.begin(), rows.end(), [&](int a, int b)
+        {
+            const int c = this->compareRows(a, b);
+            if (c != 0) { return ascending ? c < 0 : c > 0; }
+            if (tieBreaker)
+            {
+                if (tieBreaker(a, b)) { return true; }
+                if (tieBreaker(b, a)) { return false; }
+            }
+            return a < b;
+        });
+        return rows;
+    }
+
+    const QString &CColumnSortKeys::keyTypeToString(KeyType type)
+    {
+        static const QString no("no keys");
+        static const QString integer("integer");
+        static const QString real("real");
+        static const QString rank("string rank");
+        static const QString variant("variant");
+        switch (type)
+        {
+        case IntegerKeys: return integer;
+        case RealKeys: return real;
+        case StringRankKeys: return rank;
+        case VariantKeys: return variant;
+        default: break;
+        }
+        return no;
+    }
+} // ns
@@ -0,0 +1,79 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKGUI_MODELS_COLUMNSORTKEYS_H
+#define BLACKGUI_MODELS_COLUMNSORTKEYS_H
+
+#include "blackgui/blackguiexport.h"
+#include "blackmisc/variant.h"
+
+#include <QVector>
+#include <QtGlobal>
+#include <functional>
+
+namespace BlackGui::Models
+{
+    /*!
+     * One typed sort key per row, extracted in a single pass from the values of the sort column.
+     * Sorting row indexes by these keys avoids propertyByIndex/comparePropertyByIndex calls per comparison.
+     * \remark numbers and date/times become integer or real keys, physical quantities real keys in their default unit,
+     *         strings a rank (index in the ordered distinct strings), other values are compared as CVariant
+     */
+    class BLACKGUI_EXPORT CColumnSortKeys
+    {
+    public:
+        //! Kind of keys
+        enum KeyType
+        {
+            NoKeys,
+            IntegerKeys,
+            RealKeys,
+            StringRankKeys,
+            VariantKeys
+        };
+
+        //! Less than for rows with equal keys
+        using TieBreaker = std::function<bool(int rowA, int rowB)>;
+
+        //! Constructor
+        //! \param values one value per row
+        //! \param caseSensitivity used to order strings
+        CColumnSortKeys(QVector<BlackMisc::CVariant> &&values, Qt::CaseSensitivity caseSensitivity);
+
+        //! Kind of keys
+        KeyType getKeyType() const { return m_type; }
+
+        //! Number of rows
+        int size() const { return m_size; }
+
+        //! Rows in sort order, rows with equal keys by tie breaker, then in row order (stable)
+        QVector<int> sortedRows(Qt::SortOrder order, const TieBreaker &tieBreaker = {}) const;
+
+        //! Key type as string
+        static const QString &keyTypeToString(KeyType type);
+
+    private:
+        //! Compare keys of 2 rows
+        int compareRows(int a, int b) const;
+
+        //! Try the typed keys
+        bool extractIntegers(const QVector<BlackMisc::CVariant> &values);
+        bool extractReals(const QVector<BlackMisc::CVariant> &values);
+        bool extractStringRanks(const QVector<BlackMisc::CVariant> &values, Qt::CaseSensitivity caseSensitivity);
+
+        KeyType m_type = NoKeys;
+        int m_size = 0;
+        QVector<qint64> m_integers; //!< integer keys, string ranks
+        QVector<double> m_reals;    //!< real keys
+        QVector<BlackMisc::CVariant> m_variants; //!< fallback keys
+    };
+} // ns
+
+#endif // guard
@@ -12,6 +12,7 @@
 #include "blackgui/models/listmodelbase.h"
 #include "blackgui/models/allmodelcontainers.h"
 #include "blackgui/guiutility.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/variant.h"
 #include "blackmisc/worker.h"
 
@@ -161,6 +162,7 @@ namespace BlackGui::Models
     int CListModelBase<T, UseCompare>::update(const ContainerType &container, bool sort)
     {
         if (m_modelDestroyed) { return 0; }
+        BLACK_TRACE_ZONE("Update model", "gui");
 
         // Keep sorting out of begin/end reset model
         ContainerType sortedContainer;
@@ -221,7 +223,7 @@ namespace BlackGui::Models
         if (m_modelDestroyed) { return nullptr; }
         const auto sortColumn = this->getSortColumn();
         const auto sortOrder  = this->getSortOrder();
-        CWorker *worker = CWorker::fromTask(this, "ModelSort", [this, container, sortColumn, sortOrder]()
+        CWorker *worker = CWorker::fromTask(this, "ModelSort", CTaskPool::HighPriority, [this, container, sortColumn, sortOrder]()
         {
             return this->sortContainerByColumn(container, sortColumn, sortOrder);
         });
@@ -563,6 +565,11 @@ namespace BlackGui::Models
             return Private::compareForModelSort<ObjectType>(a, b, order, propertyIndex, tieBreakersCopy, marker);
         };
 
+        if (m_sortWithKeys && container.size() >= sortKeysThreshold)
+        {
+            ContainerType sorted;
+            if (Private::sortWithKeys(container, propertyIndex, order, p, !tieBreakersCopy.isEmpty(), marker, sorted)) { return sorted; }
+        }
         return container.sorted(p);
     }
 
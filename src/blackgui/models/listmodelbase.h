@@ -11,6 +11,7 @@
 #ifndef BLACKGUI_MODELS_LISTMODELBASE_H
 #define BLACKGUI_MODELS_LISTMODELBASE_H
 
+#include "blackgui/models/columnsortkeys.h"
 #include "blackgui/models/listmodelbasenontemplate.h"
 #include "blackgui/models/modelfilter.h"
 #include "blackgui/models/selectionmodel.h"
@@ -174,7 +175,7 @@ namespace BlackGui::Models
         //! @}
 
         //! Update filtered container
-        void updateFilteredContainer();
+        virtual void updateFilteredContainer();
 
         //! Model changed
         void emitModelDataChanged();
@@ -203,6 +204,41 @@ namespace BlackGui::Models
             return (order == Qt::AscendingOrder) ? (c < 0) : (c > 0);
         }
 
+        /*!
+         * Sort by typed keys extracted with one propertyByIndex call per row, \sa CColumnSortKeys
+         * \param container   to be sorted
+         * \param index       sort column property index
+         * \param order       sort order
+         * \param less        the per object comparison, used for tie breakers and to verify the result
+         * \param useTieBreakers call less for rows with equal keys
+         * \param sorted      result
+         * \return false if the keys do not reproduce the order of less, then the container needs to be sorted with less
+         */
+        template <class ContainerType, class Less, bool UseCompare>
+        bool sortWithKeys(const ContainerType &container, const BlackMisc::CPropertyIndex &index, Qt::SortOrder order,
+                          const Less &less, bool useTieBreakers, std::integral_constant<bool, UseCompare>, ContainerType &sorted)
+        {
+            QVector<BlackMisc::CVariant> values;
+            values.reserve(container.size());
+            for (const auto &object : container) { values.push_back(object.propertyByIndex(index)); }
+
+            // string order like comparePropertyByIndex (mostly case insensitive) or CVariant (case sensitive)
+            const CColumnSortKeys keys(std::move(values), UseCompare ? Qt::CaseInsensitive : Qt::CaseSensitive);
+            CColumnSortKeys::TieBreaker tieBreaker;
+            if (useTieBreakers) { tieBreaker = [&](int a, int b) { return less(container[a], container[b]); }; }
+            const QVector<int> rows = keys.sortedRows(order, tieBreaker);
+
+            sorted.clear();
+            for (int row : rows) { sorted.push_back(container[row]); }
+
+            // keys are an optimization only, the result must be sorted for less
+            for (int i = 1; i < sorted.size(); i++)
+            {
+                if (less(sorted[i], sorted[i - 1])) { return false; }
+            }
+            return true;
+        }
+
         //! Sort without compare function
         template <typename ObjectType>
         bool compareForModelSort(const ObjectType &a, const ObjectType &b, Qt::SortOrder order, const BlackMisc::CPropertyIndex &index, const BlackMisc::CPropertyIndexList &tieBreakers, std::false_type)
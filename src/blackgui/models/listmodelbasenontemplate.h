@@ -45,6 +45,9 @@ namespace BlackGui::Models
         //! Number of elements when to use asynchronous updates
         static constexpr int asyncThreshold = 50;
 
+        //! Number of elements when to sort by extracted keys, \sa CColumnSortKeys
+        static constexpr int sortKeysThreshold = 100;
+
         //! Destructor
         virtual ~CListModelBaseNonTemplate() override {}
 
@@ -97,6 +100,12 @@ namespace BlackGui::Models
         //! Get sort order
         virtual Qt::SortOrder getSortOrder() const { return m_sortOrder; }
 
+        //! Sort by keys extracted once per row (default), otherwise by comparing objects
+        void setSortWithKeys(bool withKeys) { m_sortWithKeys = withKeys; }
+
+        //! Sort by keys extracted once per row?
+        bool isSortWithKeys() const { return m_sortWithKeys; }
+
         //! Orderable, normally use a container BlackMisc::IOrderableList
         virtual bool isOrderable() const = 0;
 
@@ -171,6 +180,7 @@ namespace BlackGui::Models
         Qt::SortOrder   m_sortOrder;                       //!< sort order (asc/desc)
         Qt::DropActions m_dropActions = Qt::IgnoreAction;  //!< drop actions
         BlackMisc::CPropertyIndexList m_sortTieBreakers;   //!< how column values are sorted if equal, if no value is given this is random
+        bool            m_sortWithKeys = true;             //!< sort by extracted keys, \sa CColumnSortKeys
 
     private:
         BlackMisc::CDigestSignal m_dsModelsChanged { this, &CListModelBaseNonTemplate::changed, &CListModelBaseNonTemplate::onChangedDigest, 500, 10 };
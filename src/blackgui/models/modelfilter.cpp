@@ -52,9 +52,9 @@ namespace BlackGui::Models
         // wildcard in middle
         if (f.contains('*'))
         {
-            const QStringList parts = v.split('*');
+            const QStringList parts = f.split('*');
             if (parts.size() < 2) { return false; }
-            const bool s = v.startsWith(parts.front(), cs) && v.endsWith(parts.back());
+            const bool s = v.startsWith(parts.front(), cs) && v.endsWith(parts.back(), cs);
             return s;
         }
 
@@ -0,0 +1,171 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackgui/views/aircraftmodelsetimageview.h"
+#include "blackgui/models/aircraftmodelsetimagemodel.h"
+#include "blackmisc/icons.h"
+
+#include <QAction>
+#include <QHeaderView>
+#include <QInputDialog>
+#include <QLineEdit>
+#include <QMenu>
+#include <QSortFilterProxyModel>
+#include <QtGlobal>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Simulation;
+using namespace BlackGui::Models;
+
+namespace BlackGui::Views
+{
+    CAircraftModelSetImageView::CAircraftModelSetImageView(QWidget *parent) : QTableView(parent)
+    {
+        m_model = new CAircraftModelSetImageModel(this);
+        m_proxy = new QSortFilterProxyModel(this);
+        m_proxy->setSourceModel(m_model);
+        m_proxy->setFilterKeyColumn(CAircraftModelSetImageModel::ColumnModelString);
+        m_proxy->setFilterCaseSensitivity(Qt::CaseInsensitive);
+        m_proxy->setSortCaseSensitivity(Qt::CaseInsensitive);
+        this->setModel(m_proxy);
+
+        this->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder); // model set order until sorted by the user
+        this->horizontalHeader()->setResizeContentsPrecision(100); // resizing does not read the whole image
+        this->setSortingEnabled(true);
+        this->setSelectionBehavior(QAbstractItemView::SelectRows);
+        this->setSelectionMode(QAbstractItemView::SingleSelection);
+        this->setWordWrap(false);
+        this->verticalHeader()->setVisible(false);
+        this->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        this->horizontalHeader()->setStretchLastSection(true);
+
+        this->setContextMenuPolicy(Qt::CustomContextMenu);
+        connect(this, &CAircraftModelSetImageView::customContextMenuRequested, this, &CAircraftModelSetImageView::customMenu);
+        connect(this, &CAircraftModelSetImageView::doubleClicked, this, &CAircraftModelSetImageView::onDoubleClicked);
+    }
+
+    void CAircraftModelSetImageView::setImage(const QSharedPointer<const CAircraftModelSetImage> &image)
+    {
+        this->imageModel()->setImage(image);
+        this->emitRowCountChanged();
+    }
+
+    void CAircraftModelSetImageView::setModels(const CAircraftModelList &models)
+    {
+        this->imageModel()->setModels(models);
+        this->emitRowCountChanged();
+    }
+
+    void CAircraftModelSetImageView::clear()
+    {
+        this->imageModel()->clear();
+        this->emitRowCountChanged();
+    }
+
+    int CAircraftModelSetImageView::rowCount() const
+    {
+        return m_proxy->rowCount();
+    }
+
+    bool CAircraftModelSetImageView::isEmpty() const
+    {
+        return this->imageModel()->rowCount() < 1;
+    }
+
+    bool CAircraftModelSetImageView::hasFilter() const
+    {
+        return !m_filterModelString.isEmpty();
+    }
+
+    void CAircraftModelSetImageView::setFilterModelString(const QString &modelString)
+    {
+        m_filterModelString = modelString.trimmed();
+        m_proxy->setFilterFixedString(m_filterModelString);
+        this->emitRowCountChanged();
+    }
+
+    CAircraftModel CAircraftModelSetImageView::selectedModel() const
+    {
+        return this->modelAt(this->currentIndex());
+    }
+
+    CAircraftModel CAircraftModelSetImageView::modelAt(const QModelIndex &index) const
+    {
+        if (!index.isValid()) { return CAircraftModel(); }
+        const QModelIndex sourceIndex = m_proxy->mapToSource(index);
+        return this->imageModel()->modelAt(sourceIndex.row());
+    }
+
+    CAircraftModelList CAircraftModelSetImageView::findModelsStartingWith(const QString &modelString, Qt::CaseSensitivity cs) const
+    {
+        return this->imageModel()->findModelsStartingWith(modelString, cs);
+    }
+
+    bool CAircraftModelSetImageView::containsModelString(const QString &modelString) const
+    {
+        return this->imageModel()->containsModelString(modelString);
+    }
+
+    void CAircraftModelSetImageView::setHighlightModels(const CAircraftModelList &models)
+    {
+        this->imageModel()->setHighlightModelStrings(models.getModelStringList(false));
+    }
+
+    void CAircraftModelSetImageView::fullResizeToContents()
+    {
+        this->resizeColumnsToContents();
+    }
+
+    void CAircraftModelSetImageView::emitRowCountChanged()
+    {
+        emit this->rowCountChanged(this->rowCount(), this->hasFilter());
+    }
+
+    void CAircraftModelSetImageView::onDoubleClicked(const QModelIndex &index)
+    {
+        const CAircraftModel model = this->modelAt(index);
+        if (!model.hasModelString()) { return; }
+        emit this->modelDoubleClicked(model);
+    }
+
+    void CAircraftModelSetImageView::displayFilterDialog()
+    {
+        bool ok = false;
+        const QString filter = QInputDialog::getText(this, QStringLiteral("Filter"), QStringLiteral("Model string:"), QLineEdit::Normal, m_filterModelString, &ok);
+        if (!ok) { return; }
+        this->setFilterModelString(filter);
+    }
+
+    void CAircraftModelSetImageView::requestTempDisable()
+    {
+        const CAircraftModel model = this->selectedModel();
+        if (!model.hasModelString()) { return; }
+        emit this->requestTempDisableModelsForMatching(CAircraftModelList({ model }));
+    }
+
+    void CAircraftModelSetImageView::customMenu(const QPoint &point)
+    {
+        QMenu *menu = new QMenu(this);
+        menu->setAttribute(Qt::WA_DeleteOnClose);
+        menu->addAction(CIcons::refresh16(), "Reload from backend", this, &CAircraftModelSetImageView::requestUpdate);
+        if (!this->isEmpty())
+        {
+            menu->addAction(CIcons::filter16(), "Show filter", this, &CAircraftModelSetImageView::displayFilterDialog);
+            if (this->hasFilter())
+            {
+                menu->addAction(CIcons::filter16(), "Remove Filter", this, [ = ] { this->setFilterModelString({}); });
+            }
+            if (m_tempDisableMenu && this->currentIndex().isValid())
+            {
+                menu->addAction(CIcons::delete16(), "Temp.disable model", this, &CAircraftModelSetImageView::requestTempDisable);
+            }
+            menu->addAction(CIcons::resize16(), "Resize", this, &CAircraftModelSetImageView::fullResizeToContents);
+        }
+        menu->popup(this->viewport()->mapToGlobal(point));
+    }
+} // namespace
@@ -0,0 +1,130 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKGUI_VIEWS_AIRCRAFTMODELSETIMAGEVIEW_H
+#define BLACKGUI_VIEWS_AIRCRAFTMODELSETIMAGEVIEW_H
+
+#include "blackgui/blackguiexport.h"
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+
+#include <QTableView>
+#include <QObject>
+#include <QPoint>
+#include <QModelIndex>
+#include <QSharedPointer>
+#include <QString>
+#include <Qt>
+
+class QSortFilterProxyModel;
+
+namespace BlackGui
+{
+    namespace Models { class CAircraftModelSetImageModel; }
+
+    namespace Views
+    {
+        /*!
+         * Model set view, displaying the rows of the memory-mapped model set image
+         *
+         * Unlike CAircraftModelView the model set is not copied into a CAircraftModelList,
+         * models are materialized for the selected row only.
+         */
+        class BLACKGUI_EXPORT CAircraftModelSetImageView : public QTableView
+        {
+            Q_OBJECT
+
+        public:
+            //! Constructor
+            explicit CAircraftModelSetImageView(QWidget *parent = nullptr);
+
+            //! Display the models of the image
+            void setImage(const QSharedPointer<const BlackMisc::Simulation::CAircraftModelSetImage> &image);
+
+            //! Display the models of a list, used if there is no image
+            void setModels(const BlackMisc::Simulation::CAircraftModelList &models);
+
+            //! Clear
+            void clear();
+
+            //! Number of displayed rows, filter applied
+            int rowCount() const;
+
+            //! Empty data
+            bool isEmpty() const;
+
+            //! Filter applied?
+            bool hasFilter() const;
+
+            //! Filter by model string, empty string removes the filter
+            void setFilterModelString(const QString &modelString);
+
+            //! Materialized model of the current row
+            BlackMisc::Simulation::CAircraftModel selectedModel() const;
+
+            //! Materialized model of index
+            BlackMisc::Simulation::CAircraftModel modelAt(const QModelIndex &index) const;
+
+            //! Models whose model string starts with
+            BlackMisc::Simulation::CAircraftModelList findModelsStartingWith(const QString &modelString, Qt::CaseSensitivity cs) const;
+
+            //! Contains model string (case insensitive)?
+            bool containsModelString(const QString &modelString) const;
+
+            //! Highlight models
+            void setHighlightModels(const BlackMisc::Simulation::CAircraftModelList &models);
+
+            //! Offer "temp. disable" in the menu
+            void setTempDisableMenu(bool enabled) { m_tempDisableMenu = enabled; }
+
+            //! Resize all columns
+            void fullResizeToContents();
+
+        signals:
+            //! Reload requested
+            void requestUpdate();
+
+            //! Disable models for matching
+            void requestTempDisableModelsForMatching(const BlackMisc::Simulation::CAircraftModelList &models);
+
+            //! Model double clicked
+            void modelDoubleClicked(const BlackMisc::Simulation::CAircraftModel &model);
+
+            //! Number of displayed rows changed
+            void rowCountChanged(int count, bool withFilter);
+
+        private:
+            //! Used model
+            Models::CAircraftModelSetImageModel *imageModel() const { return m_model; }
+
+            //! Emit the row count
+            void emitRowCountChanged();
+
+            //! Double clicked
+            void onDoubleClicked(const QModelIndex &index);
+
+            //! Ask for a filter
+            void displayFilterDialog();
+
+            //! Disable the selected model for matching
+            void requestTempDisable();
+
+            //! Custom menu
+            void customMenu(const QPoint &point);
+
+            Models::CAircraftModelSetImageModel *m_model = nullptr; //!< image model
+            QSortFilterProxyModel *m_proxy = nullptr;               //!< sorting and filtering
+            QString m_filterModelString;                            //!< current filter
+            bool m_tempDisableMenu = false;
+        };
+    } // ns
+} // ns
+
+#endif // guard
@@ -0,0 +1,119 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackgui/views/radartargetsitem.h"
+
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPen>
+#include <QStringList>
+#include <QTransform>
+#include <QtMath>
+
+using namespace BlackMisc::Aviation;
+
+namespace BlackGui::Views
+{
+    CRadarTargetsItem::CRadarTargetsItem(QGraphicsItem *parent) : QGraphicsItem(parent)
+    { }
+
+    void CRadarTargetsItem::setTargets(const Targets &targets)
+    {
+        bool changed = false;
+        for (auto it = m_targets.begin(); it != m_targets.end();)
+        {
+            if (targets.contains(it.key())) { ++it; continue; }
+            it = m_targets.erase(it);
+            changed = true;
+        }
+
+        m_headingLines.clear();
+        for (auto it = targets.cbegin(); it != targets.cend(); ++it)
+        {
+            const Target &target = it.value();
+            if (target.showHeading) { m_headingLines.push_back(QLineF(target.position, headingLineEnd(target))); }
+
+            PaintedTarget &painted = m_targets[it.key()];
+            if (painted.target == target && !painted.labelLines.isEmpty()) { continue; }
+            changed = true;
+            if (painted.labelLines.isEmpty() || painted.target.label != target.label)
+            {
+                painted.labelLines.clear();
+                const QStringList lines = target.label.split('\n');
+                for (const QString &line : lines)
+                {
+                    QStaticText text(line);
+                    text.setTextFormat(Qt::PlainText);
+                    painted.labelLines.push_back(text);
+                }
+            }
+            painted.target = target;
+        }
+        if (changed) { this->update(); }
+    }
+
+    void CRadarTargetsItem::clear()
+    {
+        if (m_targets.isEmpty()) { return; }
+        m_targets.clear();
+        m_headingLines.clear();
+        this->update();
+    }
+
+    QRectF CRadarTargetsItem::boundingRect() const
+    {
+        // whole radar, as the radials
+        return QRectF(-1000.0, -1000.0, 2000.0, 2000.0);
+    }
+
+    void CRadarTargetsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+    {
+        Q_UNUSED(option)
+        Q_UNUSED(widget)
+        if (m_targets.isEmpty()) { return; }
+
+        QPen pen(m_color, 1);
+        pen.setCosmetic(true);
+        painter->setPen(pen);
+        painter->drawLines(m_headingLines);
+
+        // dots and labels keep their size and orientation, so they are painted in view coordinates
+        const QTransform toView = painter->worldTransform();
+        painter->save();
+        painter->resetTransform();
+
+        QPainterPath dots;
+        for (const PaintedTarget &painted : m_targets)
+        {
+            dots.addEllipse(toView.map(painted.target.position), 2.0, 2.0);
+        }
+        painter->setBrush(m_color);
+        painter->drawPath(dots);
+
+        // as QGraphicsTextItem, which has a document margin of 4
+        painter->setFont(m_font);
+        const qreal lineSpacing = QFontMetricsF(m_font).lineSpacing();
+        for (const PaintedTarget &painted : m_targets)
+        {
+            QPointF topLeft = toView.map(painted.target.position) + QPointF(4.0, 4.0);
+            for (const QStaticText &line : painted.labelLines)
+            {
+                painter->drawStaticText(topLeft, line);
+                topLeft.ry() += lineSpacing;
+            }
+        }
+        painter->restore();
+    }
+
+    QPointF CRadarTargetsItem::headingLineEnd(const Target &target)
+    {
+        const qreal headingRad = qDegreesToRadians(target.headingDeg);
+        return target.position + QPointF(qSin(headingRad), -qCos(headingRad)) * HeadingLineNM;
+    }
+} // ns
@@ -0,0 +1,101 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKGUI_VIEWS_RADARTARGETSITEM_H
+#define BLACKGUI_VIEWS_RADARTARGETSITEM_H
+
+#include "blackgui/blackguiexport.h"
+#include "blackmisc/aviation/callsign.h"
+
+#include <QColor>
+#include <QFont>
+#include <QGraphicsItem>
+#include <QHash>
+#include <QLineF>
+#include <QPointF>
+#include <QRectF>
+#include <QStaticText>
+#include <QString>
+#include <QVector>
+
+namespace BlackGui::Views
+{
+    /*!
+     * All radar targets painted by one item: heading lines in scene coordinates,
+     * dots and labels in view coordinates (as items ignoring transformations).
+     * Used instead of items per target if there are many targets.
+     */
+    class BLACKGUI_EXPORT CRadarTargetsItem : public QGraphicsItem
+    {
+    public:
+        //! Radar target
+        struct Target
+        {
+            QPointF position;            //!< NM relative to own aircraft, north is (0, -1)
+            qreal   headingDeg  = 0.0;   //!< heading, clockwise from north
+            bool    showHeading = false; //!< draw the heading line
+            QString label;               //!< label, lines separated by \n
+
+            //! Equal
+            bool operator ==(const Target &other) const
+            {
+                return position == other.position && qFuzzyCompare(headingDeg, other.headingDeg) && showHeading == other.showHeading && label == other.label;
+            }
+
+            //! Not equal
+            bool operator !=(const Target &other) const { return !(*this == other); }
+        };
+
+        //! Targets by callsign
+        using Targets = QHash<BlackMisc::Aviation::CCallsign, Target>;
+
+        //! Length of the heading line in NM
+        static constexpr qreal HeadingLineNM = 5.0;
+
+        //! Constructor
+        CRadarTargetsItem(QGraphicsItem *parent = nullptr);
+
+        //! Set the targets, labels are only laid out again if changed
+        void setTargets(const Targets &targets);
+
+        //! Remove all targets
+        void clear();
+
+        //! Number of targets
+        int size() const { return m_targets.size(); }
+
+        //! Color of dots, lines and labels
+        void setColor(const QColor &color) { m_color = color; this->update(); }
+
+        //! \copydoc QGraphicsItem::boundingRect
+        virtual QRectF boundingRect() const override;
+
+        //! \copydoc QGraphicsItem::paint
+        virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override;
+
+        //! End of the heading line of a target
+        static QPointF headingLineEnd(const Target &target);
+
+    private:
+        //! Target with laid out label
+        struct PaintedTarget
+        {
+            Target target;
+            QVector<QStaticText> labelLines;
+        };
+
+        QHash<BlackMisc::Aviation::CCallsign, PaintedTarget> m_targets;
+        QVector<QLineF> m_headingLines;
+        QColor m_color = Qt::green;
+        QFont  m_font;
+    };
+} // ns
+
+#endif // guard
@@ -108,7 +108,7 @@ namespace BlackGui::Views
         const auto sortColumn = model->getSortColumn();
         const auto sortOrder  = model->getSortOrder();
         this->showLoadIndicator(container.size());
-        CWorker *worker = CWorker::fromTask(this, "ViewSort", [model, container, sortColumn, sortOrder]()
+        CWorker *worker = CWorker::fromTask(this, "ViewSort", CTaskPool::HighPriority, [model, container, sortColumn, sortOrder]()
         {
             return model->sortContainerByColumn(container, sortColumn, sortOrder);
         });
@@ -841,7 +841,7 @@ namespace BlackGui::Views
         const QString json(this->toJsonString(QJsonDocument::Indented, selectedOnly)); // save as CVariant JSON
 
         // save file
-        CWorker::fromTask(qApp, Q_FUNC_INFO, [ = ] { CFileUtils::writeStringToFile(json, fileName); });
+        CWorker::fromTask(qApp, Q_FUNC_INFO, CTaskPool::LowPriority, [ = ] { CFileUtils::writeStringToFile(json, fileName); });
         this->rememberLastJsonDirectory(fileName);
         return CStatusMessage(this, CStatusMessage::SeverityInfo, u"Writing " % fileName % u" in progress", true);
     }
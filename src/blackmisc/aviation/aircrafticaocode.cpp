@@ -314,7 +314,7 @@ namespace BlackMisc::Aviation
 
     bool CAircraftIcaoCode::hasValidDesignator() const
     {
-        return isValidDesignator(m_designator);
+        return isValidDesignator(m_designator.toQString());
     }
 
     bool CAircraftIcaoCode::hasKnownDesignator() const
@@ -330,12 +330,12 @@ namespace BlackMisc::Aviation
 
     bool CAircraftIcaoCode::isIataSameAsDesignator() const
     {
-        return hasDesignator() && hasIataCode() && m_iataCode == m_designator;
+        return hasDesignator() && hasIataCode() && m_iataCode == m_designator.toQString();
     }
 
     bool CAircraftIcaoCode::isFamilySameAsDesignator() const
     {
-        return hasFamily() && hasDesignator() && m_designator == m_family;
+        return hasFamily() && hasDesignator() && m_designator.toQString() == m_family;
     }
 
     bool CAircraftIcaoCode::hasValidCombinedType() const
@@ -472,10 +472,10 @@ namespace BlackMisc::Aviation
         if (m_designator.length() == 4)
         {
             if (
-                m_designator == "BALL" ||
-                m_designator == "SHIP" ||
-                m_designator == "GYRO" ||
-                m_designator == "UHEL"
+                this->getDesignator() == "BALL" ||
+                this->getDesignator() == "SHIP" ||
+                this->getDesignator() == "GYRO" ||
+                this->getDesignator() == "UHEL"
             ) { return true; }
         }
 
@@ -655,7 +655,7 @@ namespace BlackMisc::Aviation
         const ColumnIndex i = index.frontCasted<ColumnIndex>();
         switch (i)
         {
-        case IndexAircraftDesignator: return QVariant::fromValue(m_designator);
+        case IndexAircraftDesignator: return QVariant::fromValue(m_designator.toQString());
         case IndexCategory: return m_category.propertyByIndex(index.copyFrontRemoved());
         case IndexIataCode: return QVariant::fromValue(m_iataCode);
         case IndexFamily:   return QVariant::fromValue(m_family);
@@ -702,12 +702,12 @@ namespace BlackMisc::Aviation
 
     int CAircraftIcaoCode::comparePropertyByIndex(CPropertyIndexRef index, const CAircraftIcaoCode &compareValue) const
     {
-        if (index.isMyself()) { return m_designator.compare(compareValue.getDesignator(), Qt::CaseInsensitive); }
+        if (index.isMyself()) { return this->getDesignator().compare(compareValue.getDesignator(), Qt::CaseInsensitive); }
         if (IDatastoreObjectWithIntegerKey::canHandleIndex(index)) { return IDatastoreObjectWithIntegerKey::comparePropertyByIndex(index, compareValue);}
         const ColumnIndex i = index.frontCasted<ColumnIndex>();
         switch (i)
         {
-        case IndexAircraftDesignator: return m_designator.compare(compareValue.getDesignator(), Qt::CaseInsensitive);
+        case IndexAircraftDesignator: return this->getDesignator().compare(compareValue.getDesignator(), Qt::CaseInsensitive);
         case IndexCategory: return m_category.comparePropertyByIndex(index.copyFrontRemoved(), compareValue.getCategory());
         case IndexIataCode: return m_iataCode.compare(compareValue.getIataCode(), Qt::CaseInsensitive);
         case IndexFamily:   return m_family.compare(compareValue.getFamily(), Qt::CaseInsensitive);
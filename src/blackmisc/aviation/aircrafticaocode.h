@@ -14,6 +14,7 @@
 #include "blackmisc/aviation/aircraftcategory.h"
 #include "blackmisc/db/datastore.h"
 #include "blackmisc/pq/length.h"
+#include "blackmisc/internedstring.h"
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
@@ -76,7 +77,7 @@ namespace BlackMisc::Aviation
                             const QString &model, const QString &modelIata, const QString &modelSwift, const QString &wtc, bool realworld, bool legacy, bool military, int rank);
 
         //! Get ICAO designator, e.g. "B737"
-        const QString &getDesignator() const { return m_designator; }
+        const QString &getDesignator() const { return m_designator.toQString(); }
 
         //! Designator and DB key
         QString getDesignatorDbKey() const;
@@ -85,7 +86,7 @@ namespace BlackMisc::Aviation
         QString getDesignatorManufacturer() const;
 
         //! Set ICAO designator, e.g. "B737"
-        void setDesignator(const QString &icaoDesignator) { m_designator = icaoDesignator.trimmed().toUpper(); }
+        void setDesignator(const QString &icaoDesignator) { m_designator = CInternedString(icaoDesignator.trimmed().toUpper()); }
 
         //! Aircraft designator?
         bool hasDesignator() const;
@@ -376,7 +377,7 @@ namespace BlackMisc::Aviation
         static constexpr int DesignatorMaxLength = 5; //!< designator length (max)
 
     private:
-        QString m_designator;            //!< "B737"
+        CInternedString m_designator;    //!< "B737", interned
         QString m_iataCode;              //!< "320"
         QString m_family;                //!< "A350" (not a real ICAO code, but a family)
         QString m_combinedType;          //!< "L2J"
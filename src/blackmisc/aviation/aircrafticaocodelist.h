@@ -15,6 +15,7 @@
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/collection.h"
 #include "blackmisc/db/datastoreobjectlist.h"
+#include "blackmisc/db/dbsnapshot.h"
 #include "blackmisc/sequence.h"
 
 #include <QJsonArray>
@@ -145,6 +146,9 @@ namespace BlackMisc::Aviation
         //! From our database JSON format
         static CAircraftIcaoCodeList fromDatabaseJson(const QJsonArray &array, const CAircraftCategoryList &categories, bool ignoreIncompleteAndDuplicates = true, CAircraftIcaoCodeList *inconsistent = nullptr);
     };
+
+    //! Aircraft ICAO codes with lookup by DB key and designator
+    using CAircraftIcaoCodeSnapshot = Db::CDbSnapshot<CAircraftIcaoCodeList>;
 } // namespace
 
 Q_DECLARE_METATYPE(BlackMisc::Aviation::CAircraftIcaoCodeList)
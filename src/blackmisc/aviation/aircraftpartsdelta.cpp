@@ -0,0 +1,422 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/aviation/aircraftpartsdelta.h"
+#include "blackmisc/aviation/aircraftparts.h"
+
+#include <QLocale>
+#include <QStringBuilder>
+#include <algorithm>
+#include <cmath>
+
+namespace BlackMisc::Aviation
+{
+    //! Single pass scanner for the JSON of an FSD aircraft config packet
+    //! \remark only understands the parts schema, unknown members are skipped
+    class CAircraftPartsPacketParser
+    {
+    public:
+        //! Constructor
+        CAircraftPartsPacketParser(QStringView text, CAircraftPartsDelta &delta) : m_text(text), m_delta(delta) {}
+
+        //! Parse the whole packet
+        void parse()
+        {
+            this->skipWhitespace();
+            if (!this->parseObject([this](QStringView key) { return this->parseTopLevelMember(key); })) { return; }
+            this->skipWhitespace();
+            if (m_pos < m_text.size()) { this->error(QStringLiteral("Trailing characters")); }
+        }
+
+    private:
+        bool parseTopLevelMember(QStringView key)
+        {
+            if (key == u"config")
+            {
+                if (this->peek() != u'{') { return this->skipValue(); } // like QJsonValue::toObject
+                m_delta.m_hasConfig = true;
+                return this->parseObject([this](QStringView configKey) { return this->parseConfigMember(configKey); });
+            }
+            if (key == u"request")
+            {
+                if (this->peek() != u'"') { return this->skipValue(); }
+                QStringView request;
+                if (!this->parseString(request)) { return false; }
+                m_delta.m_isFullDataRequest = (request == u"full");
+                return true;
+            }
+            return this->skipValue();
+        }
+
+        bool parseConfigMember(QStringView key)
+        {
+            // like QJsonObject, a duplicate key is counted once
+            if (!m_configKeys.contains(key))
+            {
+                m_configKeys.push_back(key);
+                m_delta.m_attributesCount++;
+            }
+            if (key == u"is_full_data") { m_delta.m_fields |= CAircraftPartsDelta::IsFullData; return this->parseBool(m_delta.m_isFullData); }
+            if (key == u"gear_down")    { m_delta.m_fields |= CAircraftPartsDelta::GearDown;   return this->parseBool(m_delta.m_gearDown); }
+            if (key == u"spoilers_out") { m_delta.m_fields |= CAircraftPartsDelta::SpoilersOut; return this->parseBool(m_delta.m_spoilersOut); }
+            if (key == u"on_ground")    { m_delta.m_fields |= CAircraftPartsDelta::OnGround;   return this->parseBool(m_delta.m_onGround); }
+            if (key == u"flaps_pct")    { m_delta.m_fields |= CAircraftPartsDelta::FlapsPercent; return this->parseInt(m_delta.m_flapsPercent); }
+            if (key == u"lights")
+            {
+                m_delta.m_fields |= CAircraftPartsDelta::Lights;
+                if (this->peek() != u'{') { return this->skipValue(); } // lights unchanged
+                return this->parseObject([this](QStringView lightKey) { return this->parseLightsMember(lightKey); });
+            }
+            if (key == u"engines")
+            {
+                m_delta.m_fields |= CAircraftPartsDelta::Engines;
+                if (this->peek() != u'{')
+                {
+                    // convertFromJson with an empty object removes all engines
+                    m_delta.m_clearEngines = true;
+                    m_delta.m_engines.clear();
+                    return this->skipValue();
+                }
+                return this->parseObject([this](QStringView engineKey) { return this->parseEngine(engineKey); });
+            }
+            return this->skipValue();
+        }
+
+        bool parseLightsMember(QStringView key)
+        {
+            CAircraftPartsDelta::Light light = CAircraftPartsDelta::NoLight;
+            if      (key == u"strobe_on")  { light = CAircraftPartsDelta::StrobeLight; }
+            else if (key == u"landing_on") { light = CAircraftPartsDelta::LandingLight; }
+            else if (key == u"taxi_on")    { light = CAircraftPartsDelta::TaxiLight; }
+            else if (key == u"beacon_on")  { light = CAircraftPartsDelta::BeaconLight; }
+            else if (key == u"nav_on")     { light = CAircraftPartsDelta::NavLight; }
+            else if (key == u"logo_on")    { light = CAircraftPartsDelta::LogoLight; }
+            else { return this->skipValue(); }
+
+            bool on = false;
+            if (!this->parseBool(on)) { return false; }
+            m_delta.m_lightsSet |= light;
+            m_delta.m_lightsOn.setFlag(light, on);
+            return true;
+        }
+
+        bool parseEngine(QStringView key)
+        {
+            // engine numbers are 1 based, QString::toInt would yield 0 for garbage
+            int number = 0;
+            for (QChar c : key)
+            {
+                if (!c.isDigit() || number > 1000) { number = 0; break; }
+                number = number * 10 + c.digitValue();
+            }
+
+            CAircraftPartsDelta::EngineDelta engine;
+            engine.number = number;
+            if (this->peek() != u'{')
+            {
+                // a non object value resets the engine to its defaults
+                engine.hasOn = true;
+                if (!this->skipValue()) { return false; }
+            }
+            else
+            {
+                const bool ok = this->parseObject([this, &engine](QStringView engineKey)
+                {
+                    if (engineKey != u"on") { return this->skipValue(); }
+                    engine.hasOn = true;
+                    return this->parseBool(engine.on);
+                });
+                if (!ok) { return false; }
+            }
+            if (number < 1) { return true; } // ignore invalid numbers
+
+            auto it = std::find_if(m_delta.m_engines.begin(), m_delta.m_engines.end(), [number](const CAircraftPartsDelta::EngineDelta &e) { return e.number == number; });
+            if (it == m_delta.m_engines.end()) { m_delta.m_engines.append(engine); }
+            else { *it = engine; }
+            return true;
+        }
+
+        //! Parse an object, calling the member function for each key, which has to consume the value
+        template <class MemberFunction>
+        bool parseObject(MemberFunction member)
+        {
+            if (!this->expect(u'{')) { return false; }
+            this->skipWhitespace();
+            if (this->peek() == u'}') { m_pos++; return true; }
+            while (true)
+            {
+                this->skipWhitespace();
+                QStringView key;
+                if (!this->parseString(key)) { return false; }
+                this->skipWhitespace();
+                if (!this->expect(u':')) { return false; }
+                this->skipWhitespace();
+                if (!member(key)) { return false; }
+                this->skipWhitespace();
+                const QChar c = this->peek();
+                m_pos++;
+                if (c == u',') { continue; }
+                if (c == u'}') { return true; }
+                return this->error(QStringLiteral("Expected , or }"));
+            }
+        }
+
+        //! String without the quotes, escape sequences are not resolved (not used by the schema)
+        bool parseString(QStringView &out)
+        {
+            if (!this->expect(u'"')) { return false; }
+            const qsizetype start = m_pos;
+            while (m_pos < m_text.size())
+            {
+                const QChar c = m_text.at(m_pos);
+                if (c == u'"')
+                {
+                    out = m_text.mid(start, m_pos - start);
+                    m_pos++;
+                    return true;
+                }
+                m_pos += (c == u'\\') ? 2 : 1;
+            }
+            return this->error(QStringLiteral("Unterminated string"));
+        }
+
+        //! Like QJsonValue::toBool, values other than true/false yield false
+        bool parseBool(bool &out)
+        {
+            if (this->matchLiteral(u"true"))  { out = true;  return true; }
+            if (this->matchLiteral(u"false")) { out = false; return true; }
+            out = false;
+            return this->skipValue();
+        }
+
+        //! Like QJsonValue::toInt, non integral values yield 0
+        bool parseInt(int &out)
+        {
+            const QChar c = this->peek();
+            if (c != u'-' && !c.isDigit()) { out = 0; return this->skipValue(); }
+
+            const qsizetype start = m_pos;
+            bool integral = true;
+            qint64 value = 0;
+            bool negative = false;
+            if (c == u'-') { negative = true; m_pos++; }
+            while (m_pos < m_text.size())
+            {
+                const QChar d = m_text.at(m_pos);
+                if (d.isDigit())
+                {
+                    if (value < 1000000000) { value = value * 10 + d.digitValue(); }
+                    else { integral = false; }
+                }
+                else if (d == u'.' || d == u'e' || d == u'E' || d == u'+' || d == u'-') { integral = false; }
+                else { break; }
+                m_pos++;
+            }
+            if (integral)
+            {
+                out = static_cast<int>(negative ? -value : value);
+                return true;
+            }
+
+            // rare, e.g. 50.0
+            bool ok = false;
+            const double d = QLocale::c().toDouble(m_text.mid(start, m_pos - start), &ok);
+            if (!ok) { return this->error(QStringLiteral("Invalid number")); }
+            const bool isInt = std::abs(d) < 2147483647.0 && static_cast<double>(static_cast<int>(d)) == d;
+            out = isInt ? static_cast<int>(d) : 0;
+            return true;
+        }
+
+        bool skipValue()
+        {
+            const QChar c = this->peek();
+            if (c == u'{') { return this->parseObject([this](QStringView) { this->skipWhitespace(); return this->skipValue(); }); }
+            if (c == u'[')
+            {
+                m_pos++;
+                this->skipWhitespace();
+                if (this->peek() == u']') { m_pos++; return true; }
+                while (true)
+                {
+                    this->skipWhitespace();
+                    if (!this->skipValue()) { return false; }
+                    this->skipWhitespace();
+                    const QChar n = this->peek();
+                    m_pos++;
+                    if (n == u',') { continue; }
+                    if (n == u']') { return true; }
+                    return this->error(QStringLiteral("Expected , or ]"));
+                }
+            }
+            if (c == u'"') { QStringView dummy; return this->parseString(dummy); }
+            if (this->matchLiteral(u"true") || this->matchLiteral(u"false") || this->matchLiteral(u"null")) { return true; }
+            if (c == u'-' || c.isDigit()) { int dummy; return this->parseInt(dummy); }
+            return this->error(QStringLiteral("Unexpected character"));
+        }
+
+        bool matchLiteral(QStringView literal)
+        {
+            if (!m_text.mid(m_pos).startsWith(literal)) { return false; }
+            m_pos += literal.size();
+            return true;
+        }
+
+        bool expect(QChar c)
+        {
+            if (this->peek() != c) { return this->error(QStringLiteral("Expected '%1' at %2").arg(c).arg(m_pos)); }
+            m_pos++;
+            return true;
+        }
+
+        QChar peek() const { return m_pos < m_text.size() ? m_text.at(m_pos) : QChar(); }
+
+        void skipWhitespace()
+        {
+            while (m_pos < m_text.size() && m_text.at(m_pos).isSpace()) { m_pos++; }
+        }
+
+        bool error(const QString &message)
+        {
+            m_delta.setError(message);
+            m_pos = m_text.size();
+            return false;
+        }
+
+        QStringView m_text;
+        qsizetype m_pos = 0;
+        CAircraftPartsDelta &m_delta;
+        QVarLengthArray<QStringView, 8> m_configKeys; //!< distinct keys of the "config" object
+    };
+
+    CAircraftPartsDelta CAircraftPartsDelta::fromPacket(QStringView packet)
+    {
+        CAircraftPartsDelta delta;
+        CAircraftPartsPacketParser parser(packet, delta);
+        parser.parse();
+        return delta;
+    }
+
+    CAircraftPartsDelta CAircraftPartsDelta::fromParts(const CAircraftParts &parts, bool fullData)
+    {
+        CAircraftPartsDelta delta;
+        delta.m_hasConfig = true;
+        delta.m_fields = IsFullData | Lights | GearDown | FlapsPercent | SpoilersOut | Engines | OnGround;
+        delta.m_attributesCount = CAircraftParts::attributesCountFullJson;
+        delta.m_isFullData = fullData;
+        delta.m_gearDown = parts.isGearDown();
+        delta.m_flapsPercent = parts.getFlapsPercent();
+        delta.m_spoilersOut = parts.isSpoilersOut();
+        delta.m_onGround = parts.isOnGround();
+
+        const CAircraftLights &lights = parts.getLights();
+        delta.m_lightsSet = StrobeLight | LandingLight | TaxiLight | BeaconLight | NavLight | LogoLight;
+        delta.m_lightsOn.setFlag(StrobeLight, lights.isStrobeOn());
+        delta.m_lightsOn.setFlag(LandingLight, lights.isLandingOn());
+        delta.m_lightsOn.setFlag(TaxiLight, lights.isTaxiOn());
+        delta.m_lightsOn.setFlag(BeaconLight, lights.isBeaconOn());
+        delta.m_lightsOn.setFlag(NavLight, lights.isNavOn());
+        delta.m_lightsOn.setFlag(LogoLight, lights.isLogoOn());
+
+        for (const CAircraftEngine &engine : parts.getEngines())
+        {
+            delta.m_engines.append(EngineDelta { engine.getNumber(), engine.isOn(), true });
+        }
+        // a full parts set replaces all engines, even if there are none
+        delta.m_clearEngines = fullData;
+        return delta;
+    }
+
+    void CAircraftPartsDelta::applyTo(CAircraftParts &parts) const
+    {
+        if (m_fields.testFlag(GearDown))     { parts.setGearDown(m_gearDown); }
+        if (m_fields.testFlag(FlapsPercent)) { parts.setFlapsPercent(m_flapsPercent); }
+        if (m_fields.testFlag(SpoilersOut))  { parts.setSpoilersOut(m_spoilersOut); }
+        if (m_fields.testFlag(OnGround))     { parts.setOnGround(m_onGround); }
+
+        if (m_lightsSet != NoLight)
+        {
+            CAircraftLights &lights = parts.lights();
+            if (m_lightsSet.testFlag(StrobeLight))  { lights.setStrobeOn(m_lightsOn.testFlag(StrobeLight)); }
+            if (m_lightsSet.testFlag(LandingLight)) { lights.setLandingOn(m_lightsOn.testFlag(LandingLight)); }
+            if (m_lightsSet.testFlag(TaxiLight))    { lights.setTaxiOn(m_lightsOn.testFlag(TaxiLight)); }
+            if (m_lightsSet.testFlag(BeaconLight))  { lights.setBeaconOn(m_lightsOn.testFlag(BeaconLight)); }
+            if (m_lightsSet.testFlag(NavLight))     { lights.setNavOn(m_lightsOn.testFlag(NavLight)); }
+            if (m_lightsSet.testFlag(LogoLight))    { lights.setLogoOn(m_lightsOn.testFlag(LogoLight)); }
+        }
+
+        if (m_fields.testFlag(Engines))
+        {
+            CAircraftEngineList &engines = parts.engines();
+            if (m_clearEngines) { engines.clear(); }
+            bool added = false;
+            for (const EngineDelta &delta : m_engines)
+            {
+                auto it = std::find_if(engines.begin(), engines.end(), [&delta](const CAircraftEngine &e) { return e.getNumber() == delta.number; });
+                if (it == engines.end())
+                {
+                    engines.push_back(CAircraftEngine(delta.number, delta.hasOn ? delta.on : true));
+                    added = true;
+                }
+                else if (delta.hasOn)
+                {
+                    it->setOn(delta.on);
+                }
+            }
+            if (added) { engines.sortBy(&CAircraftEngine::getNumber); }
+        }
+    }
+
+    QString CAircraftPartsDelta::toJsonString() const
+    {
+        static const QString t("true");
+        static const QString f("false");
+        const auto b = [](bool v) -> const QString & { return v ? t : f; };
+
+        QString json;
+        json.reserve(256);
+        const auto add = [&json](const QString &member)
+        {
+            json += json.isEmpty() ? QChar(u'{') : QChar(u',');
+            json += member;
+        };
+
+        if (m_fields.testFlag(IsFullData)) { add(u"\"is_full_data\":" % b(m_isFullData)); }
+        if (m_fields.testFlag(Lights))
+        {
+            QString lights;
+            const auto addLight = [&](Light light, const char *name)
+            {
+                if (!m_lightsSet.testFlag(light)) { return; }
+                lights += (lights.isEmpty() ? QString() : QStringLiteral(",")) % u'"' % QLatin1String(name) % u"\":" % b(m_lightsOn.testFlag(light));
+            };
+            addLight(StrobeLight, "strobe_on");
+            addLight(LandingLight, "landing_on");
+            addLight(TaxiLight, "taxi_on");
+            addLight(BeaconLight, "beacon_on");
+            addLight(NavLight, "nav_on");
+            addLight(LogoLight, "logo_on");
+            add(u"\"lights\":{" % lights % u'}');
+        }
+        if (m_fields.testFlag(GearDown))     { add(u"\"gear_down\":" % b(m_gearDown)); }
+        if (m_fields.testFlag(FlapsPercent)) { add(u"\"flaps_pct\":" % QString::number(m_flapsPercent)); }
+        if (m_fields.testFlag(SpoilersOut))  { add(u"\"spoilers_out\":" % b(m_spoilersOut)); }
+        if (m_fields.testFlag(Engines))
+        {
+            QString engines;
+            for (const EngineDelta &engine : m_engines)
+            {
+                engines += (engines.isEmpty() ? QString() : QStringLiteral(",")) % u'"' % QString::number(engine.number) % u"\":{" %
+                           (engine.hasOn ? QString(u"\"on\":" % b(engine.on)) : QString()) % u'}';
+            }
+            add(u"\"engines\":{" % engines % u'}');
+        }
+        if (m_fields.testFlag(OnGround)) { add(u"\"on_ground\":" % b(m_onGround)); }
+        json += json.isEmpty() ? QStringLiteral("{}") : QStringLiteral("}");
+        return json;
+    }
+} // namespace
@@ -0,0 +1,143 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_AVIATION_AIRCRAFTPARTSDELTA_H
+#define BLACKMISC_AVIATION_AIRCRAFTPARTSDELTA_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QFlags>
+#include <QMetaType>
+#include <QString>
+#include <QStringView>
+#include <QVarLengthArray>
+
+namespace BlackMisc::Aviation
+{
+    class CAircraftParts;
+
+    //! Changes of aircraft parts as sent with an FSD aircraft config packet
+    //! \remark Parsed directly from the packet text without building a QJsonDocument,
+    //!         the delta is applied in place to the latest parts of an aircraft.
+    //!         Semantics are the same as CAircraftParts::convertFromJson on the
+    //!         result of Json::applyIncrementalObject, values not mentioned are left unchanged.
+    class BLACKMISC_EXPORT CAircraftPartsDelta
+    {
+    public:
+        //! Parts attributes contained in the packet
+        enum Field
+        {
+            NoField      = 0,
+            IsFullData   = 1 << 0,
+            Lights       = 1 << 1,
+            GearDown     = 1 << 2,
+            FlapsPercent = 1 << 3,
+            SpoilersOut  = 1 << 4,
+            Engines      = 1 << 5,
+            OnGround     = 1 << 6
+        };
+        Q_DECLARE_FLAGS(Fields, Field)
+
+        //! Individual lights contained in the packet
+        enum Light
+        {
+            NoLight      = 0,
+            StrobeLight  = 1 << 0,
+            LandingLight = 1 << 1,
+            TaxiLight    = 1 << 2,
+            BeaconLight  = 1 << 3,
+            NavLight     = 1 << 4,
+            LogoLight    = 1 << 5
+        };
+        Q_DECLARE_FLAGS(Lights, Light)
+
+        //! Default constructor, empty delta
+        CAircraftPartsDelta() {}
+
+        //! Parse the JSON part of an FSD aircraft config packet, e.g. <tt>{"config":{"gear_down":true}}</tt>
+        //! \remark on syntax errors the delta is invalid, see isValid and getErrorMessage
+        static CAircraftPartsDelta fromPacket(QStringView packet);
+
+        //! Delta containing all values of the given parts
+        static CAircraftPartsDelta fromParts(const CAircraftParts &parts, bool fullData);
+
+        //! Syntactically valid?
+        bool isValid() const { return m_errorMessage.isEmpty(); }
+
+        //! Error message if not valid
+        const QString &getErrorMessage() const { return m_errorMessage; }
+
+        //! Packet is the request for our full parts (<tt>{"request":"full"}</tt>)
+        bool isFullDataRequest() const { return m_isFullDataRequest; }
+
+        //! Packet contains a "config" object
+        bool hasConfig() const { return m_hasConfig; }
+
+        //! Full parts data, or incremental ("is_full_data")
+        bool isFullData() const { return m_isFullData; }
+
+        //! Nothing to apply?
+        bool isEmpty() const { return m_fields == NoField; }
+
+        //! Attributes contained in the packet
+        Fields getFields() const { return m_fields; }
+
+        //! Attribute contained?
+        bool hasField(Field field) const { return m_fields.testFlag(field); }
+
+        //! Number of attributes in the "config" object, including unknown ones
+        //! \remark equivalent to the size of the QJsonObject
+        int getAttributesCount() const { return m_attributesCount; }
+
+        //! Number of engines mentioned in the packet
+        int getEnginesCount() const { return m_engines.size(); }
+
+        //! Apply the delta to the given parts
+        void applyTo(CAircraftParts &parts) const;
+
+        //! Compact JSON representation of the "config" object, e.g. for the parts history
+        QString toJsonString() const;
+
+    private:
+        //! Engine mentioned in the packet
+        struct EngineDelta
+        {
+            int number = 1;      //!< 1 based
+            bool on = true;      //!< on/off
+            bool hasOn = false;  //!< "on" contained
+        };
+
+        //! Set error once
+        void setError(const QString &message) { if (m_errorMessage.isEmpty()) { m_errorMessage = message; } }
+
+        friend class CAircraftPartsPacketParser;
+
+        QString m_errorMessage;
+        Fields m_fields = NoField;
+        Lights m_lightsSet = NoLight;
+        Lights m_lightsOn = NoLight;
+        QVarLengthArray<EngineDelta, 4> m_engines;
+        int m_flapsPercent = 0;
+        int m_attributesCount = 0;
+        bool m_gearDown = false;
+        bool m_spoilersOut = false;
+        bool m_onGround = false;
+        bool m_isFullData = false;
+        bool m_isFullDataRequest = false;
+        bool m_hasConfig = false;
+        bool m_clearEngines = false; //!< "engines" was no object, resets engines like convertFromJson
+    };
+} // namespace
+
+Q_DECLARE_METATYPE(BlackMisc::Aviation::CAircraftPartsDelta)
+Q_DECLARE_OPERATORS_FOR_FLAGS(BlackMisc::Aviation::CAircraftPartsDelta::Fields)
+Q_DECLARE_OPERATORS_FOR_FLAGS(BlackMisc::Aviation::CAircraftPartsDelta::Lights)
+
+#endif // guard
@@ -8,12 +8,12 @@
 
 #include "blackmisc/aviation/aircraftsituationchange.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/aircraftsituationstatistics.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/simulation/aircraftmodel.h"
 #include "blackmisc/pq/length.h"
 #include "blackmisc/pq/angle.h"
 #include "blackmisc/pq/units.h"
-#include "blackmisc/math/mathutils.h"
 #include "blackmisc/comparefunctions.h"
 #include "blackmisc/propertyindexref.h"
 #include "blackmisc/verify.h"
@@ -327,47 +327,43 @@ namespace BlackMisc::Aviation
     bool CAircraftSituationChange::calculateStdDeviations(const CAircraftSituationList &situations, const CLength &cg)
     {
         if (situations.isEmpty()) { return false; }
+        return this->setStdDeviations(CAircraftSituationStatistics(situations), cg);
+    }
+
+    bool CAircraftSituationChange::setStdDeviations(const CAircraftSituationStatistics &statistics, const CLength &cg)
+    {
+        if (statistics.getSituationsCount() < 1) { return false; }
 
-        const QPair<CSpeed, CSpeed> gsStdDevMean = situations.groundSpeedStandardDeviationAndMean();
+        const CSpeedPair gsStdDevMean = statistics.groundSpeedStandardDeviationAndMean();
         m_gsStdDev = gsStdDevMean.first;
         m_gsMean = gsStdDevMean.second;
 
-        const QPair<CAngle, CAngle> pitchStdDevMean = situations.pitchStandardDeviationAndMean();
+        const CAnglePair pitchStdDevMean = statistics.pitchStandardDeviationAndMean();
         m_pitchStdDev = pitchStdDevMean.first;
         m_pitchMean = pitchStdDevMean.second;
 
-        const QList<double> altValues = situations.altitudeValues(CAltitude::defaultUnit());
-        if (altValues.size() == situations.size())
+        if (statistics.isComplete(CAircraftSituationStatistics::Altitude))
         {
-            const QPair<double, double> altDevMean = CMathUtils::standardDeviationAndMean(altValues);
-            m_altStdDev = CAltitude(altDevMean.first, CAltitude::MeanSeaLevel, CAltitude::defaultUnit());
-            m_altMean = CAltitude(altDevMean.second, CAltitude::MeanSeaLevel, CAltitude::defaultUnit());
+            const CAltitudePair altStdDevMean = statistics.altitudeStandardDeviationAndMean();
+            m_altStdDev = altStdDevMean.first;
+            m_altMean = altStdDevMean.second;
         }
 
-        const QList<double> elvValues = situations.elevationValues(CAltitude::defaultUnit());
-        if (elvValues.size() == situations.size())
+        if (statistics.isComplete(CAircraftSituationStatistics::Elevation))
         {
-            const QPair<double, double> elvDevMean = CMathUtils::standardDeviationAndMean(elvValues);
-            m_elvStdDev = CAltitude(elvDevMean.first, CAltitude::MeanSeaLevel, CAltitude::defaultUnit());
-            m_elvMean = CAltitude(elvDevMean.second, CAltitude::MeanSeaLevel, CAltitude::defaultUnit());
+            const CAltitudePair elvStdDevMean = statistics.elevationStandardDeviationAndMean();
+            m_elvStdDev = elvStdDevMean.first;
+            m_elvMean = elvStdDevMean.second;
 
-            if (altValues.size() == situations.size())
+            if (statistics.isComplete(CAircraftSituationStatistics::GroundDistance))
             {
-                QList<double> gndDistance;
-                for (int i = 0; i < altValues.size(); i++)
-                {
-                    const double delta = altValues[i] - elvValues[i];
-                    gndDistance.push_back(delta);
-                }
-                const QPair<double, double> gndDistanceDevMean = CMathUtils::standardDeviationAndMean(gndDistance);
-                m_gndDistStdDev = CLength(gndDistanceDevMean.first, CAltitude::defaultUnit());
-                m_gndDistMean = CLength(gndDistanceDevMean.second, CAltitude::defaultUnit());
-
-                const auto gndDistMinMax = std::minmax_element(gndDistance.constBegin(), gndDistance.constEnd());
-                const double gndDistMin = *gndDistMinMax.first;
-                const double gndDistMax = *gndDistMinMax.second;
-                m_minGroundDistance = CLength(gndDistMin, CAltitude::defaultUnit());
-                m_maxGroundDistance = CLength(gndDistMax, CAltitude::defaultUnit());
+                const CLengthPair gndDistanceStdDevMean = statistics.groundDistanceStandardDeviationAndMean();
+                m_gndDistStdDev = gndDistanceStdDevMean.first;
+                m_gndDistMean = gndDistanceStdDevMean.second;
+
+                const CLengthPair gndDistMinMax = statistics.groundDistanceMinMax();
+                m_minGroundDistance = gndDistMinMax.first;
+                m_maxGroundDistance = gndDistMinMax.second;
                 this->guessSceneryDeviation(cg);
             }
         }
@@ -33,6 +33,7 @@ namespace BlackMisc
     {
         class CAircraftSituation;
         class CAircraftSituationList;
+        class CAircraftSituationStatistics;
 
         //! Value object about changes in situations
         class BLACKMISC_EXPORT CAircraftSituationChange :
@@ -180,6 +181,9 @@ namespace BlackMisc
             //! Calculate the standard deviiations
             bool calculateStdDeviations(const CAircraftSituationList &situations, const PhysicalQuantities::CLength &cg);
 
+            //! Set the standard deviations from statistics already calculated, e.g. maintained incrementally
+            bool setStdDeviations(const CAircraftSituationStatistics &statistics, const PhysicalQuantities::CLength &cg);
+
             //! NULL object
             static const CAircraftSituationChange &null();
 
@@ -7,6 +7,7 @@
  */
 
 #include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/aircraftsituationstatistics.h"
 #include "blackmisc/geo/elevationplane.h"
 #include "blackmisc/math/mathutils.h"
 #include "blackmisc/pq/speed.h"
@@ -422,6 +423,7 @@ namespace BlackMisc::Aviation
     QList<double> CAircraftSituationList::groundSpeedValues(const CSpeedUnit &unit) const
     {
         QList<double> values;
+        values.reserve(this->size());
         for (const CAircraftSituation &s : *this)
         {
             if (s.getGroundSpeed().isNull()) { continue; }
@@ -434,6 +436,7 @@ namespace BlackMisc::Aviation
     QList<double> CAircraftSituationList::elevationValues(const CLengthUnit &unit) const
     {
         QList<double> values;
+        values.reserve(this->size());
         for (const CAircraftSituation &s : *this)
         {
             if (s.getGroundElevation().isNull()) { continue; }
@@ -445,9 +448,10 @@ namespace BlackMisc::Aviation
     QList<double> CAircraftSituationList::altitudeValues(const CLengthUnit &unit) const
     {
         QList<double> values;
+        values.reserve(this->size());
         for (const CAircraftSituation &s : *this)
         {
-            const CAltitude alt(s.getAltitude());
+            const CAltitude &alt = s.getAltitude();
             if (alt.isNull()) { continue; }
             values.push_back(alt.value(unit));
         }
@@ -480,34 +484,22 @@ namespace BlackMisc::Aviation
 
     CSpeedPair CAircraftSituationList::groundSpeedStandardDeviationAndMean() const
     {
-        const QList<double> gsValues = this->groundSpeedValues(CSpeedUnit::kts());
-        if (gsValues.size() != this->size()) { return QPair<CSpeed, CSpeed>(CSpeed::null(), CSpeed::null()); }
-        const QPair<double, double> gsKts = CMathUtils::standardDeviationAndMean(gsValues);
-        return CSpeedPair(CSpeed(gsKts.first, CSpeedUnit::kts()), CSpeed(gsKts.second, CSpeedUnit::kts()));
+        return CAircraftSituationStatistics(*this).groundSpeedStandardDeviationAndMean();
     }
 
     CAnglePair CAircraftSituationList::pitchStandardDeviationAndMean() const
     {
-        const QList<double> pitchValues = this->pitchValues(CAngleUnit::deg());
-        if (pitchValues.size() != this->size()) { return QPair<CAngle, CAngle>(CAngle::null(), CAngle::null()); }
-        const QPair<double, double> pitchDeg = CMathUtils::standardDeviationAndMean(pitchValues);
-        return CAnglePair(CAngle(pitchDeg.first, CAngleUnit::deg()), CAngle(pitchDeg.second, CAngleUnit::deg()));
+        return CAircraftSituationStatistics(*this).pitchStandardDeviationAndMean();
     }
 
     CAltitudePair CAircraftSituationList::elevationStandardDeviationAndMean() const
     {
-        const QList<double> elvValues = this->elevationValues(CAltitude::defaultUnit());
-        if (elvValues.size() != this->size()) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
-        const QPair<double, double> elvFt = CMathUtils::standardDeviationAndMean(elvValues);
-        return CAltitudePair(CAltitude(elvFt.first, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()), CAltitude(elvFt.second, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()));
+        return CAircraftSituationStatistics(*this).elevationStandardDeviationAndMean();
     }
 
     CAltitudePair CAircraftSituationList::altitudeStandardDeviationAndMean() const
     {
-        const QList<double> altValues = this->altitudeValues(CAltitude::defaultUnit());
-        if (altValues.size() != this->size()) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
-        const QPair<double, double> altFt = CMathUtils::standardDeviationAndMean(altValues);
-        return CAltitudePair(CAltitude(altFt.first, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()), CAltitude(altFt.second, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()));
+        return CAircraftSituationStatistics(*this).altitudeStandardDeviationAndMean();
     }
 
     QPair<CLength, CLength> CAircraftSituationList::minMaxGroundDistance(const CLength &cg) const
@@ -522,20 +514,9 @@ namespace BlackMisc::Aviation
 
     CAltitudePair CAircraftSituationList::altitudeAglStandardDeviationAndMean() const
     {
-        const QList<double> altValues = this->altitudeValues(CLengthUnit::ft());
-        if (altValues.size() != this->size()) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
-
-        const QList<double> elvValues = this->elevationValues(CLengthUnit::ft());
-        if (elvValues.size() != this->size()) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
-
-        QList<double> altElvDeltas;
-        for (int i = 0; i < altValues.size(); i++)
-        {
-            const double delta = altValues[i] - elvValues[i];
-            altElvDeltas.push_back(delta);
-        }
-        const QPair<double, double> deltaFt = CMathUtils::standardDeviationAndMean(altElvDeltas);
-        return CAltitudePair(CAltitude(deltaFt.first, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()), CAltitude(deltaFt.second, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()));
+        const CLengthPair agl = CAircraftSituationStatistics(*this).groundDistanceStandardDeviationAndMean();
+        if (agl.first.isNull()) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
+        return CAltitudePair(CAltitude(agl.first, CAltitude::MeanSeaLevel), CAltitude(agl.second, CAltitude::MeanSeaLevel));
     }
 
     int CAircraftSituationList::transferElevationForward(const CLength &radius)
@@ -0,0 +1,143 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/aviation/aircraftsituationstatistics.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/pq/units.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace BlackMisc::Math;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Aviation
+{
+    CAircraftSituationStatistics::CAircraftSituationStatistics(const CAircraftSituationList &situations)
+    {
+        m_values.reserve(situations.size());
+        for (const CAircraftSituation &situation : situations)
+        {
+            const Values values = situationValues(situation);
+            m_values.push_back(values);
+            this->addValues(values);
+        }
+    }
+
+    void CAircraftSituationStatistics::pushFront(const CAircraftSituation &situation, int maxSituations)
+    {
+        const Values values = situationValues(situation);
+        m_values.prepend(values);
+        this->addValues(values);
+        while (maxSituations >= 0 && m_values.size() > maxSituations) { this->popBack(); }
+    }
+
+    void CAircraftSituationStatistics::popBack()
+    {
+        if (m_values.isEmpty()) { return; }
+        const Values removed = m_values.takeLast();
+        for (int f = 0; f < NumberOfFields; f++)
+        {
+            const double value = removed[static_cast<size_t>(f)];
+            if (std::isnan(value)) { continue; }
+            CRunningStatistics &statistics = m_statistics[static_cast<size_t>(f)];
+            if (!statistics.remove(value) || statistics.isEmpty()) { continue; }
+
+            // removed min or max, find them in the remaining values
+            double minValue =  std::numeric_limits<double>::infinity();
+            double maxValue = -std::numeric_limits<double>::infinity();
+            for (const Values &values : std::as_const(m_values))
+            {
+                const double v = values[static_cast<size_t>(f)];
+                if (std::isnan(v)) { continue; }
+                if (v < minValue) { minValue = v; }
+                if (v > maxValue) { maxValue = v; }
+            }
+            statistics.setMinMax(minValue, maxValue);
+        }
+    }
+
+    bool CAircraftSituationStatistics::isComplete(Field field) const
+    {
+        return !m_values.isEmpty() && this->getStatistics(field).count() == m_values.size();
+    }
+
+    CAnglePair CAircraftSituationStatistics::pitchStandardDeviationAndMean() const
+    {
+        if (!this->isComplete(Pitch)) { return CAnglePair(CAngle::null(), CAngle::null()); }
+        const QPair<double, double> pitchDeg = this->getStatistics(Pitch).standardDeviationAndMean();
+        return CAnglePair(CAngle(pitchDeg.first, CAngleUnit::deg()), CAngle(pitchDeg.second, CAngleUnit::deg()));
+    }
+
+    CSpeedPair CAircraftSituationStatistics::groundSpeedStandardDeviationAndMean() const
+    {
+        if (!this->isComplete(GroundSpeed)) { return CSpeedPair(CSpeed::null(), CSpeed::null()); }
+        const QPair<double, double> gsKts = this->getStatistics(GroundSpeed).standardDeviationAndMean();
+        return CSpeedPair(CSpeed(gsKts.first, CSpeedUnit::kts()), CSpeed(gsKts.second, CSpeedUnit::kts()));
+    }
+
+    CAltitudePair CAircraftSituationStatistics::altitudeStandardDeviationAndMean() const
+    {
+        if (!this->isComplete(Altitude)) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
+        const QPair<double, double> alt = this->getStatistics(Altitude).standardDeviationAndMean();
+        return CAltitudePair(CAltitude(alt.first, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()), CAltitude(alt.second, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()));
+    }
+
+    CAltitudePair CAircraftSituationStatistics::elevationStandardDeviationAndMean() const
+    {
+        if (!this->isComplete(Elevation)) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
+        const QPair<double, double> elv = this->getStatistics(Elevation).standardDeviationAndMean();
+        return CAltitudePair(CAltitude(elv.first, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()), CAltitude(elv.second, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()));
+    }
+
+    CLengthPair CAircraftSituationStatistics::groundDistanceStandardDeviationAndMean() const
+    {
+        if (!this->isComplete(GroundDistance)) { return CLengthPair(CLength::null(), CLength::null()); }
+        const QPair<double, double> gnd = this->getStatistics(GroundDistance).standardDeviationAndMean();
+        return CLengthPair(CLength(gnd.first, CAltitude::defaultUnit()), CLength(gnd.second, CAltitude::defaultUnit()));
+    }
+
+    CLengthPair CAircraftSituationStatistics::groundDistanceMinMax() const
+    {
+        if (!this->isComplete(GroundDistance)) { return CLengthPair(CLength::null(), CLength::null()); }
+        const CRunningStatistics &gnd = this->getStatistics(GroundDistance);
+        return CLengthPair(CLength(gnd.minValue(), CAltitude::defaultUnit()), CLength(gnd.maxValue(), CAltitude::defaultUnit()));
+    }
+
+    void CAircraftSituationStatistics::clear()
+    {
+        m_values.clear();
+        for (CRunningStatistics &statistics : m_statistics) { statistics.clear(); }
+    }
+
+    CAircraftSituationStatistics::Values CAircraftSituationStatistics::situationValues(const CAircraftSituation &situation)
+    {
+        constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+        const CAltitude &altitude  = situation.getAltitude();
+        const CAltitude &elevation = situation.getGroundElevation();
+        const CSpeed &gs = situation.getGroundSpeed();
+
+        Values values;
+        values[Pitch]       = situation.getPitch().isNull() ? 0.0 : situation.getPitch().value(CAngleUnit::deg()); // as CAircraftSituationList::pitchValues
+        values[GroundSpeed] = gs.isNull() ? NaN : gs.value(CSpeedUnit::kts());
+        values[Altitude]    = altitude.isNull()  ? NaN : altitude.value(CAltitude::defaultUnit());
+        values[Elevation]   = elevation.isNull() ? NaN : elevation.value(CAltitude::defaultUnit());
+        values[GroundDistance] = std::isnan(values[Altitude]) || std::isnan(values[Elevation]) ? NaN : values[Altitude] - values[Elevation];
+        return values;
+    }
+
+    void CAircraftSituationStatistics::addValues(const Values &values)
+    {
+        for (int f = 0; f < NumberOfFields; f++)
+        {
+            const double value = values[static_cast<size_t>(f)];
+            if (!std::isnan(value)) { m_statistics[static_cast<size_t>(f)].add(value); }
+        }
+    }
+} // ns
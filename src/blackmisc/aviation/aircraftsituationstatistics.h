@@ -0,0 +1,110 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_AVIATION_AIRCRAFTSITUATIONSTATISTICS_H
+#define BLACKMISC_AVIATION_AIRCRAFTSITUATIONSTATISTICS_H
+
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/math/runningstatistics.h"
+#include "blackmisc/pq/angle.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QVector>
+#include <array>
+
+namespace BlackMisc::Aviation
+{
+    class CAircraftSituation;
+    class CAircraftSituationList;
+
+    /*!
+     * Statistics (mean, standard deviation, min, max) of all fields of situations used by CAircraftSituationChange,
+     * calculated in a single pass without intermediate value lists.
+     *
+     * Situations can be pushed to the front, the oldest ones are then removed from the statistics,
+     * so the statistics follow the situations list of a callsign.
+     */
+    class BLACKMISC_EXPORT CAircraftSituationStatistics
+    {
+    public:
+        //! Fields
+        enum Field
+        {
+            Pitch,          //!< pitch in deg
+            GroundSpeed,    //!< ground speed in kts
+            Altitude,       //!< altitude in CAltitude::defaultUnit
+            Elevation,      //!< ground elevation in CAltitude::defaultUnit
+            GroundDistance  //!< altitude - elevation in CAltitude::defaultUnit
+        };
+
+        //! Number of fields
+        static constexpr int NumberOfFields = 5;
+
+        //! Default constructor
+        CAircraftSituationStatistics() {}
+
+        //! Statistics of situations
+        CAircraftSituationStatistics(const CAircraftSituationList &situations);
+
+        //! Add a situation as the latest one
+        //! \param situation      latest situation
+        //! \param maxSituations  if there are more situations, the oldest are removed, -1 for no limit
+        void pushFront(const CAircraftSituation &situation, int maxSituations = -1);
+
+        //! Remove the oldest situation
+        void popBack();
+
+        //! Number of situations
+        int getSituationsCount() const { return m_values.size(); }
+
+        //! Statistics of field, NULL values are not part of the statistics
+        const Math::CRunningStatistics &getStatistics(Field field) const { return m_statistics[static_cast<size_t>(field)]; }
+
+        //! All situations have a value for field?
+        bool isComplete(Field field) const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::pitchStandardDeviationAndMean
+        PhysicalQuantities::CAnglePair pitchStandardDeviationAndMean() const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::groundSpeedStandardDeviationAndMean
+        PhysicalQuantities::CSpeedPair groundSpeedStandardDeviationAndMean() const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::altitudeStandardDeviationAndMean
+        CAltitudePair altitudeStandardDeviationAndMean() const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::elevationStandardDeviationAndMean
+        CAltitudePair elevationStandardDeviationAndMean() const;
+
+        //! Standard deviation and mean of the ground distance (altitude - elevation, without CG)
+        PhysicalQuantities::CLengthPair groundDistanceStandardDeviationAndMean() const;
+
+        //! Min and max of the ground distance (altitude - elevation, without CG)
+        PhysicalQuantities::CLengthPair groundDistanceMinMax() const;
+
+        //! Remove all situations
+        void clear();
+
+    private:
+        using Values = std::array<double, NumberOfFields>; //!< values of a situation, NaN for NULL
+
+        //! Values of a situation
+        static Values situationValues(const CAircraftSituation &situation);
+
+        //! Add values to the statistics
+        void addValues(const Values &values);
+
+        QVector<Values> m_values; //!< latest first
+        std::array<Math::CRunningStatistics, NumberOfFields> m_statistics;
+    };
+} // ns
+
+#endif // guard
@@ -32,27 +32,20 @@ BLACK_DEFINE_VALUEOBJECT_MIXINS(BlackMisc::Aviation, CAirlineIcaoCode)
 namespace BlackMisc::Aviation
 {
     CAirlineIcaoCode::CAirlineIcaoCode(const QString &airlineDesignator)
-        : m_designator(airlineDesignator.trimmed().toUpper())
     {
-        if (m_designator.length() == 4)
-        {
-            this->setDesignator(m_designator);
-        }
+        this->setDesignator(airlineDesignator);
     }
 
     CAirlineIcaoCode::CAirlineIcaoCode(const QString &airlineDesignator, const QString &airlineName, const CCountry &country, const QString &telephony, bool virtualAirline, bool operating)
-        : m_designator(airlineDesignator.trimmed().toUpper()), m_name(airlineName), m_telephonyDesignator(telephony), m_country(country), m_isVa(virtualAirline), m_isOperating(operating)
+        : m_name(airlineName), m_telephonyDesignator(telephony), m_country(country), m_isVa(virtualAirline), m_isOperating(operating)
     {
-        if (m_designator.length() == 4)
-        {
-            this->setDesignator(m_designator);
-        }
+        this->setDesignator(airlineDesignator);
     }
 
     QString CAirlineIcaoCode::getVDesignator() const
     {
-        if (!this->isVirtualAirline()) { return m_designator; }
-        return u'V' % m_designator;
+        if (!this->isVirtualAirline()) { return this->getDesignator(); }
+        return u'V' % this->getDesignator();
     }
 
     QString CAirlineIcaoCode::getVDesignatorDbKey() const
@@ -64,12 +57,16 @@ namespace BlackMisc::Aviation
 
     void CAirlineIcaoCode::setDesignator(const QString &icaoDesignator)
     {
-        m_designator = icaoDesignator.trimmed().toUpper();
-        if (m_designator.length() == 4 && m_designator.startsWith("V"))
+        const QString designator = icaoDesignator.trimmed().toUpper();
+        if (designator.length() == 4 && designator.startsWith("V"))
         {
             // a virtual designator was provided
             this->setVirtualAirline(true);
-            m_designator = m_designator.right(3);
+            m_designator = CInternedString(designator.right(3));
+        }
+        else
+        {
+            m_designator = CInternedString(designator);
         }
     }
 
@@ -99,7 +96,7 @@ namespace BlackMisc::Aviation
 
     bool CAirlineIcaoCode::hasValidDesignator() const
     {
-        return isValidAirlineDesignator(m_designator);
+        return isValidAirlineDesignator(this->getDesignator());
     }
 
     bool CAirlineIcaoCode::hasIataCode() const
@@ -110,7 +107,7 @@ namespace BlackMisc::Aviation
     bool CAirlineIcaoCode::matchesDesignator(const QString &designator) const
     {
         if (designator.isEmpty() || m_designator.isEmpty()) { return false; }
-        return caseInsensitiveStringCompare(m_designator, designator.trimmed());
+        return caseInsensitiveStringCompare(this->getDesignator(), designator.trimmed());
     }
 
     bool CAirlineIcaoCode::matchesVDesignator(const QString &designator) const
@@ -217,7 +214,7 @@ namespace BlackMisc::Aviation
         const ColumnIndex i = index.frontCasted<ColumnIndex>();
         switch (i)
         {
-        case IndexAirlineDesignator: return QVariant::fromValue(m_designator);
+        case IndexAirlineDesignator: return QVariant::fromValue(this->getDesignator());
         case IndexIataCode: return QVariant::fromValue(m_iataCode);
         case IndexAirlineCountryIso: return QVariant::fromValue(this->getCountryIso());
         case IndexAirlineCountry: return m_country.propertyByIndex(index.copyFrontRemoved());
@@ -259,13 +256,13 @@ namespace BlackMisc::Aviation
 
     int CAirlineIcaoCode::comparePropertyByIndex(CPropertyIndexRef index, const CAirlineIcaoCode &compareValue) const
     {
-        if (index.isMyself()) { return m_designator.compare(compareValue.getDesignator(), Qt::CaseInsensitive); }
+        if (index.isMyself()) { return this->getDesignator().compare(compareValue.getDesignator(), Qt::CaseInsensitive); }
         if (IDatastoreObjectWithIntegerKey::canHandleIndex(index)) { return IDatastoreObjectWithIntegerKey::comparePropertyByIndex(index, compareValue);}
         const ColumnIndex i = index.frontCasted<ColumnIndex>();
         switch (i)
         {
         case IndexAirlineIconHTML:
-        case IndexAirlineDesignator: return m_designator.compare(compareValue.getDesignator());
+        case IndexAirlineDesignator: return this->getDesignator().compare(compareValue.getDesignator());
         case IndexIataCode: return m_iataCode.compare(compareValue.getIataCode());
         case IndexAirlineCountry: return m_country.comparePropertyByIndex(index.copyFrontRemoved(), compareValue.getCountry());
         case IndexDesignatorNameCountry: return m_country.getName().compare(compareValue.getCountry().getName(), Qt::CaseInsensitive);
@@ -348,7 +345,7 @@ namespace BlackMisc::Aviation
         if (callsign.isEmpty())    { return *this; }
         const QString callsignAirline = callsign.getAirlinePrefix();
         if (callsignAirline.isEmpty()) { return *this; }
-        if (callsignAirline == m_designator) { return *this; }
+        if (callsignAirline == this->getDesignator()) { return *this; }
 
         const CAirlineIcaoCode callsignIcao(callsignAirline);
         if (m_designator.isEmpty()) { return callsignIcao; }
@@ -357,7 +354,7 @@ namespace BlackMisc::Aviation
         if (callsignIcao.isVirtualAirline())
         {
 
-            if (callsignIcao.getDesignator().endsWith(m_designator))
+            if (callsignIcao.getDesignator().endsWith(this->getDesignator()))
             {
                 // callsign ICAO is virtual airline of myself, this is more accurate
                 return callsignIcao;
@@ -445,7 +442,7 @@ namespace BlackMisc::Aviation
 
     bool CAirlineIcaoCode::isNull() const
     {
-        return m_designator.isNull() && m_iataCode.isNull() && m_telephonyDesignator.isNull();
+        return m_designator.toQString().isNull() && m_iataCode.isNull() && m_telephonyDesignator.isNull();
     }
 
     const CAirlineIcaoCode &CAirlineIcaoCode::null()
@@ -14,6 +14,7 @@
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/country.h"
 #include "blackmisc/db/datastore.h"
+#include "blackmisc/internedstring.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
 #include "blackmisc/statusmessagelist.h"
@@ -66,7 +67,7 @@ namespace BlackMisc::Aviation
         CAirlineIcaoCode(const QString &airlineDesignator, const QString &airlineName, const CCountry &country, const QString &telephony, bool virtualAirline, bool operating);
 
         //! Get airline, e.g. "DLH"
-        const QString &getDesignator() const { return m_designator; }
+        const QString &getDesignator() const { return m_designator.toQString(); }
 
         //! Get airline, e.g. "DLH", but "VMVA" for virtual airlines
         QString getVDesignator() const;
@@ -277,7 +278,7 @@ namespace BlackMisc::Aviation
         static const QSet<int> &iconIds();
 
     private:
-        QString m_designator;           //!< "DLH"
+        CInternedString m_designator;   //!< "DLH", interned
         QString m_iataCode;             //!< "LH"
         QString m_name;                 //!< "Lufthansa"
         QString m_telephonyDesignator;  //!< "Speedbird"
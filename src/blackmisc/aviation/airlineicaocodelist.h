@@ -16,6 +16,7 @@
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/collection.h"
 #include "blackmisc/db/datastoreobjectlist.h"
+#include "blackmisc/db/dbsnapshot.h"
 #include "blackmisc/sequence.h"
 
 #include <QJsonArray>
@@ -136,6 +137,9 @@ namespace BlackMisc::Aviation
         //! From our DB JSON
         static CAirlineIcaoCodeList fromDatabaseJson(const QJsonArray &array, bool ignoreIncomplete = true, CAirlineIcaoCodeList *inconsistent = nullptr);
     };
+
+    //! Airline ICAO codes with lookup by DB key and V-designator
+    using CAirlineIcaoCodeSnapshot = Db::CDbSnapshot<CAirlineIcaoCodeList>;
 } // namespace
 
 Q_DECLARE_METATYPE(BlackMisc::Aviation::CAirlineIcaoCodeList)
@@ -16,6 +16,8 @@
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/collection.h"
 #include "blackmisc/db/datastoreobjectlist.h"
+#include "blackmisc/db/dbsnapshot.h"
+#include "blackmisc/geo/geoindex.h"
 #include "blackmisc/geo/geoobjectlist.h"
 #include "blackmisc/sequence.h"
 
@@ -76,6 +78,12 @@ namespace BlackMisc::Aviation
         //! From our DB JSON
         static CAirportList fromDatabaseJson(const QJsonArray &array, CAirportList *inconsistent = nullptr);
     };
+
+    //! Airports with a spatial index
+    using CAirportIndex = Geo::CGeoObjectIndex<CAirport, CAirportList>;
+
+    //! Airports with lookup by DB key and ICAO code
+    using CAirportSnapshot = Db::CDbSnapshot<CAirportList>;
 } // namespace
 
 Q_DECLARE_METATYPE(BlackMisc::Aviation::CAirportList)
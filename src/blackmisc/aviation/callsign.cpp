@@ -23,15 +23,27 @@ namespace BlackMisc::Aviation
 {
     CCallsign::CCallsign(const QString &callsign, CCallsign::TypeHint hint)
         : m_callsignAsSet(callsign.trimmed()), m_callsign(CCallsign::unifyCallsign(callsign, hint)), m_typeHint(hint)
-    {}
+    {
+        this->shareStringAsSet();
+    }
 
     CCallsign::CCallsign(const QString &callsign, const QString &telephonyDesignator, CCallsign::TypeHint hint)
         : m_callsignAsSet(callsign.trimmed()), m_callsign(CCallsign::unifyCallsign(callsign, hint)), m_telephonyDesignator(telephonyDesignator.trimmed()), m_typeHint(hint)
-    {}
+    {
+        this->shareStringAsSet();
+    }
 
     CCallsign::CCallsign(const char *callsign, CCallsign::TypeHint hint)
         : m_callsignAsSet(callsign), m_callsign(CCallsign::unifyCallsign(callsign, hint)), m_typeHint(hint)
-    {}
+    {
+        this->shareStringAsSet();
+    }
+
+    void CCallsign::shareStringAsSet()
+    {
+        // normally set as unified, then no extra buffer for the string as set is needed
+        if (m_callsignAsSet == m_callsign.toQString()) { m_callsignAsSet = m_callsign.toQString(); }
+    }
 
     void CCallsign::registerMetadata()
     {
@@ -42,7 +54,7 @@ namespace BlackMisc::Aviation
     QString CCallsign::convertToQString(bool i18n) const
     {
         Q_UNUSED(i18n)
-        return m_callsign;
+        return m_callsign.toQString();
     }
 
     void CCallsign::clear()
@@ -95,7 +107,7 @@ namespace BlackMisc::Aviation
 
     const CIcon &CCallsign::convertToIcon(const CCallsign &callsign)
     {
-        if (callsign.m_callsign.startsWith(QStringView(u"VATGOV"))) { return CIcon::iconByIndex(CIcons::NetworkRolePilot); }
+        if (callsign.asString().startsWith(QStringView(u"VATGOV"))) { return CIcon::iconByIndex(CIcons::NetworkRolePilot); }
         const bool pilot = callsign.getTypeHint() == CCallsign::Aircraft || !callsign.hasSuffix();
         return pilot ?
                 CIcon::iconByIndex(CIcons::NetworkRolePilot) :
@@ -147,31 +159,32 @@ namespace BlackMisc::Aviation
     bool CCallsign::isSupervisorCallsign() const
     {
         if (this->getTypeHint() == Aircraft) { return false; }
-        return m_callsign.endsWith("SUP");
+        return this->asString().endsWith("SUP");
     }
 
     bool CCallsign::isBroadcastCallsign() const
     {
-        return m_callsignAsSet == "*" || m_callsign == "*" || m_callsignAsSet == "BROADCAST";
+        return m_callsignAsSet == "*" || m_callsign.toQString() == "*" || m_callsignAsSet == "BROADCAST";
     }
 
     void CCallsign::markAsBroadcastCallsign()
     {
         m_callsignAsSet = "BROADCAST";
-        m_callsign = "BROADCAST";
+        m_callsign = CInternedString("BROADCAST");
     }
 
     void CCallsign::markAsWallopCallsign()
     {
         m_callsignAsSet = "SUP";
-        m_callsign = "SUP";
+        m_callsign = CInternedString("SUP");
     }
 
     bool CCallsign::isMaybeCopilotCallsign(const CCallsign &pilotCallsign) const
     {
-        return  m_callsign.startsWith(pilotCallsign.asString()) &&
-                m_callsign.size() == pilotCallsign.asString().size() + 1 &&
-                m_callsign.at(m_callsign.size() - 1) >= 'A' && m_callsign.at(m_callsign.size() - 1) <= 'Z';
+        const QString &callsign = this->asString();
+        return  callsign.startsWith(pilotCallsign.asString()) &&
+                callsign.size() == pilotCallsign.asString().size() + 1 &&
+                callsign.at(callsign.size() - 1) >= 'A' && callsign.at(callsign.size() - 1) <= 'Z';
     }
 
     QString CCallsign::getFsdCallsignString() const
@@ -183,7 +196,7 @@ namespace BlackMisc::Aviation
 
     bool CCallsign::isSameAsSet() const
     {
-        return m_callsign == m_callsignAsSet;
+        return m_callsign.toQString() == m_callsignAsSet;
     }
 
     QString CCallsign::getIcaoCode() const
@@ -192,7 +205,7 @@ namespace BlackMisc::Aviation
         {
             if (m_callsign.length() >= 4)
             {
-                return m_callsign.left(4).toUpper();
+                return this->asString().left(4).toUpper();
             }
         }
         return {};
@@ -251,7 +264,7 @@ namespace BlackMisc::Aviation
         if (this->isAtcCallsign())   { return {}; }
 
         thread_local const QRegularExpression regExp("(^[A-Z]{3,})(\\d+)");
-        const QRegularExpressionMatch match = regExp.match(m_callsign);
+        const QRegularExpressionMatch match = regExp.match(this->asString());
         if (!match.hasMatch()) { return {}; }
         // 0 is whole capture
         const QString airline = match.captured(1);
@@ -260,19 +273,19 @@ namespace BlackMisc::Aviation
         // hard facts
         if (airline.length() == 3) // we allow 3 letters
         {
-            flightIdentification = m_callsign.length() > 3 ?  m_callsign.mid(3) : QString();
+            flightIdentification = m_callsign.length() > 3 ?  this->asString().mid(3) : QString();
             return airline;
         }
         if (airline.length() == 4 && airline.startsWith('V')) // we allow virtual 4 letter codes, e.g. VDLD
         {
-            flightIdentification = m_callsign.length() > 4 ?  m_callsign.mid(4) : QString();
+            flightIdentification = m_callsign.length() > 4 ?  this->asString().mid(4) : QString();
             return airline;
         }
 
         // some people use callsigns like UPSE123
         if (flightNumber.length() >= 1 && airline.length() == 4)
         {
-            flightIdentification = m_callsign.mid(3);
+            flightIdentification = this->asString().mid(3);
             return airline.left(3);
         }
 
@@ -346,7 +359,7 @@ namespace BlackMisc::Aviation
         const ColumnIndex i = index.frontCasted<ColumnIndex>();
         switch (i)
         {
-        case IndexCallsignString:      m_callsign = unifyCallsign(variant.toString()); break;
+        case IndexCallsignString:      m_callsign = CInternedString(unifyCallsign(variant.toString())); break;
         case IndexCallsignStringAsSet: m_callsignAsSet = variant.toString(); break;
         case IndexTelephonyDesignator: m_telephonyDesignator = variant.toString(); break;
         default:
@@ -357,11 +370,11 @@ namespace BlackMisc::Aviation
 
     int CCallsign::comparePropertyByIndex(CPropertyIndexRef index, const CCallsign &compareValue) const
     {
-        if (index.isMyself()) { return m_callsign.compare(compareValue.m_callsign, Qt::CaseInsensitive); }
+        if (index.isMyself()) { return this->asString().compare(compareValue.asString(), Qt::CaseInsensitive); }
         const ColumnIndex i = index.frontCasted<ColumnIndex>();
         switch (i)
         {
-        case IndexCallsignString:      return m_callsign.compare(compareValue.m_callsign, Qt::CaseInsensitive);
+        case IndexCallsignString:      return this->asString().compare(compareValue.asString(), Qt::CaseInsensitive);
         case IndexCallsignStringAsSet: return m_callsignAsSet.compare(compareValue.m_callsignAsSet, Qt::CaseInsensitive);
         case IndexTelephonyDesignator: return m_telephonyDesignator.compare(compareValue.m_telephonyDesignator, Qt::CaseInsensitive);
         case IndexSuffix:              return this->getSuffix().compare(compareValue.getSuffix(), Qt::CaseInsensitive);
@@ -12,6 +12,7 @@
 #define BLACKMISC_AVIATION_CALLSIGN_H
 
 #include "blackmisc/blackmiscexport.h"
+#include "blackmisc/internedstring.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
 #include "blackmisc/valueobject.h"
@@ -98,7 +99,7 @@ namespace BlackMisc
             bool isMaybeCopilotCallsign(const CCallsign &pilotCallsign) const;
 
             //! Get callsign (normalized)
-            const QString &asString() const { return m_callsign; }
+            const QString &asString() const { return m_callsign.toQString(); }
 
             //! Get callsign.
             const QString &getStringAsSet() const { return m_callsignAsSet; }
@@ -226,8 +227,11 @@ namespace BlackMisc
             static void registerMetadata();
 
         private:
+            //! Use the interned buffer for the string as set if equal
+            void shareStringAsSet();
+
             QString  m_callsignAsSet;
-            QString  m_callsign;
+            CInternedString m_callsign; //!< interned, O(1) comparison and hashing
             QString  m_telephonyDesignator;
             TypeHint m_typeHint = NoHint;
 
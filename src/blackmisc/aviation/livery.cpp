@@ -118,7 +118,7 @@ namespace BlackMisc::Aviation
     {
         if (candidate.isEmpty() || !this->hasCombinedCode()) { return false; }
         const QString c(candidate.trimmed().toUpper());
-        return c == m_combinedCode;
+        return c == this->getCombinedCode();
     }
 
     bool CLivery::matchesColors(const CRgbColor &fuselage, const CRgbColor &tail) const
@@ -132,7 +132,7 @@ namespace BlackMisc::Aviation
         static const QString liveryI18n(QCoreApplication::translate("Aviation", "Livery"));
 
         return (i18n ? liveryI18n : livery) %
-                u" cc: '" % m_combinedCode %
+                u" cc: '" % this->getCombinedCode() %
                 u"' airline: '" % m_airline.toQString(i18n) %
                 u"' desc.: '" % m_description %
                 u"' F: '" % m_colorFuselage.hex() %
@@ -182,7 +182,7 @@ namespace BlackMisc::Aviation
 
     bool CLivery::hasCombinedCode() const
     {
-        Q_ASSERT_X(!m_combinedCode.startsWith("." + standardLiveryMarker()), Q_FUNC_INFO, "illegal combined code");
+        Q_ASSERT_X(!this->getCombinedCode().startsWith("." + standardLiveryMarker()), Q_FUNC_INFO, "illegal combined code");
         return !m_combinedCode.isEmpty();
     }
 
@@ -199,12 +199,12 @@ namespace BlackMisc::Aviation
     bool CLivery::isAirlineStandardLivery() const
     {
         if (isColorLivery()) { return false; }
-        return (m_airline.hasValidDesignator() && m_combinedCode.endsWith(standardLiveryMarker()));
+        return (m_airline.hasValidDesignator() && this->getCombinedCode().endsWith(standardLiveryMarker()));
     }
 
     bool CLivery::isColorLivery() const
     {
-        return m_combinedCode.startsWith(colorLiveryMarker());
+        return this->getCombinedCode().startsWith(colorLiveryMarker());
     }
 
     double CLivery::getColorDistance(const CLivery &otherLivery) const
@@ -372,7 +372,7 @@ namespace BlackMisc::Aviation
         case IndexColorFuselage:   return m_colorFuselage.propertyByIndex(index.copyFrontRemoved());;
         case IndexColorTail:       return m_colorTail.propertyByIndex(index.copyFrontRemoved());
         case IndexDescription:     return QVariant::fromValue(m_description);
-        case IndexCombinedCode:    return QVariant::fromValue(m_combinedCode);
+        case IndexCombinedCode:    return QVariant::fromValue(this->getCombinedCode());
         case IndexIsMilitary:      return QVariant::fromValue(m_military);
         default: return CValueObject::propertyByIndex(index);
         }
@@ -14,6 +14,7 @@
 #include "blackmisc/aviation/airlineicaocode.h"
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/db/datastore.h"
+#include "blackmisc/internedstring.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
 #include "blackmisc/rgbcolor.h"
@@ -71,7 +72,7 @@ namespace BlackMisc::Aviation
         const QString &getAirlineIcaoCodeDesignator() const { return m_airline.getDesignator(); }
 
         //! Combined code
-        const QString &getCombinedCode() const { return m_combinedCode; }
+        const QString &getCombinedCode() const { return m_combinedCode.toQString(); }
 
         //! Combined code plus info
         QString getCombinedCodePlusInfo() const;
@@ -107,7 +108,7 @@ namespace BlackMisc::Aviation
         bool setAirlineIcaoCodeDesignator(const QString &airlineIcaoDesignator);
 
         //! Combined code
-        void setCombinedCode(const QString &code) { m_combinedCode = code.trimmed().toUpper(); }
+        void setCombinedCode(const QString &code) { m_combinedCode = CInternedString(code.trimmed().toUpper()); }
 
         //! Set fuselage color
         void setColorFuselage(const CRgbColor &color) { m_colorFuselage = color; }
@@ -233,7 +234,7 @@ namespace BlackMisc::Aviation
 
     private:
         CAirlineIcaoCode m_airline; //!< corresponding airline, if any
-        QString   m_combinedCode;   //!< livery code and pseudo airline ICAO code
+        CInternedString m_combinedCode; //!< livery code and pseudo airline ICAO code, interned
         QString   m_description;    //!< describes the livery
         CRgbColor m_colorFuselage;  //!< color of fuselage
         CRgbColor m_colorTail;      //!< color of tail
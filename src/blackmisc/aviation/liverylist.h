@@ -14,6 +14,7 @@
 #include "blackmisc/aviation/airlineicaocodelist.h"
 #include "blackmisc/aviation/livery.h"
 #include "blackmisc/db/datastoreobjectlist.h"
+#include "blackmisc/db/dbsnapshot.h"
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/collection.h"
 #include "blackmisc/sequence.h"
@@ -89,6 +90,9 @@ namespace BlackMisc::Aviation
         //! \remark without passing related airlines there is not much sense using this function, as most airlines/liveries have a 1:1 ratio
         static CLiveryList fromDatabaseJsonCaching(const QJsonArray &array, const CAirlineIcaoCodeList &relatedAirlines = {});
     };
+
+    //! Liveries with lookup by DB key and combined code
+    using CLiverySnapshot = Db::CDbSnapshot<CLiveryList>;
 } // namespace
 
 Q_DECLARE_METATYPE(BlackMisc::Aviation::CLiveryList)
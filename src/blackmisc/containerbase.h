@@ -151,6 +151,50 @@ namespace BlackMisc
             this->convertFromJson(jsonObject);
         }
 
+        //! \copydoc BlackMisc::Mixin::JsonByMetaClass::writeJson
+        void writeJson(CJsonStreamWriter &writer) const
+        {
+            writer.beginObject();
+            writer.writeName(QLatin1String("containerbase"));
+            writer.beginArray();
+            for (auto it = derived().cbegin(); it != derived().cend(); ++it)
+            {
+                Json::writeToStream(writer, *it);
+            }
+            writer.endArray();
+            writer.endObject();
+        }
+
+        //! Assign from JSON read element by element, the reader is on the first token of the object
+        //! \throws CJsonException
+        void readJson(CJsonStreamReader &reader)
+        {
+            derived().clear();
+            if (reader.tokenType() == CJsonStreamReader::Name) { reader.readNext(); }
+            if (reader.tokenType() != CJsonStreamReader::StartObject)
+            {
+                reader.skipValue();
+                throw CJsonException("Missing 'containerbase'");
+            }
+            bool found = false;
+            while (reader.readNext() == CJsonStreamReader::Name)
+            {
+                if (!reader.isName(QLatin1String("containerbase"))) { reader.skipValue(); continue; }
+                found = true;
+                if (reader.readNext() != CJsonStreamReader::StartArray) { reader.skipValue(); continue; }
+                int index = 0;
+                while (reader.readNext() != CJsonStreamReader::EndArray && !reader.atEnd())
+                {
+                    CJsonScope scope("containerbase", index++);
+                    Q_UNUSED(scope);
+                    typename Derived::value_type val;
+                    Json::readFromStream(reader, val);
+                    derived().push_back(std::move(val));
+                }
+            }
+            if (!found) { throw CJsonException("Missing 'containerbase'"); }
+        }
+
         //! Static version of convertFromJson
         static Derived fromJson(const QJsonObject &json)
         {
@@ -0,0 +1,151 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_DB_DBSNAPSHOT_H
+#define BLACKMISC_DB_DBSNAPSHOT_H
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+namespace BlackMisc::Db
+{
+    /*!
+     * Immutable snapshot of DB objects with lookup by DB key and by name (e.g. model string or ICAO designator).
+     *
+     * Names are compared trimmed and case insensitive. As the list functions often have extra rules (rank,
+     * operating airlines), a name lookup returns all candidates, so the list function can be applied on
+     * those few objects instead of the whole list.
+     * \remark objects are returned in the order of the list
+     */
+    template <class CONTAINER>
+    class CDbSnapshot
+    {
+    public:
+        //! Object type
+        using ObjectType = typename CONTAINER::value_type;
+
+        //! Name of an object used for the name lookup
+        using NameFunction = QString (*)(const ObjectType &);
+
+        //! Default constructor, empty
+        CDbSnapshot() {}
+
+        //! Snapshot of objects
+        //! \param objects   the objects
+        //! \param name      name for the name lookup, nullptr for none
+        //! \param timestamp version of the objects, e.g. the cache timestamp
+        CDbSnapshot(const CONTAINER &objects, NameFunction name, qint64 timestamp = -1) : m_objects(objects), m_timestamp(timestamp)
+        {
+            m_byDbKey.reserve(m_objects.size());
+            int row = 0;
+            for (const ObjectType &object : m_objects)
+            {
+                if (object.hasValidDbKey() && !m_byDbKey.contains(object.getDbKey())) { m_byDbKey.insert(object.getDbKey(), row); }
+                if (name)
+                {
+                    const QString n = normalizedName(name(object));
+                    if (!n.isEmpty()) { m_byName[n].push_back(row); }
+                }
+                row++;
+            }
+        }
+
+        //! All objects
+        const CONTAINER &getObjects() const { return m_objects; }
+
+        //! Number of objects
+        int size() const { return m_objects.size(); }
+
+        //! Empty?
+        bool isEmpty() const { return m_objects.isEmpty(); }
+
+        //! Version of the objects
+        qint64 getTimestamp() const { return m_timestamp; }
+
+        //! Object for DB key, or default
+        //! \remark O(1)
+        ObjectType findByDbKey(int dbKey) const
+        {
+            const int row = m_byDbKey.value(dbKey, -1);
+            return row < 0 ? ObjectType() : m_objects[row];
+        }
+
+        //! Contains object with DB key?
+        bool containsDbKey(int dbKey) const { return m_byDbKey.contains(dbKey); }
+
+        //! Objects with the name (trimmed, case insensitive)
+        //! \remark O(1), plus copying the found objects
+        CONTAINER findByName(const QString &name) const
+        {
+            CONTAINER objects;
+            const auto it = m_byName.constFind(normalizedName(name));
+            if (it == m_byName.constEnd()) { return objects; }
+            for (int row : it.value()) { objects.push_back(m_objects[row]); }
+            return objects;
+        }
+
+        //! Contains object with the name (trimmed, case insensitive)?
+        bool containsName(const QString &name) const { return m_byName.contains(normalizedName(name)); }
+
+        //! Name as used in the lookup
+        static QString normalizedName(const QString &name) { return name.trimmed().toUpper(); }
+
+    private:
+        CONTAINER m_objects;
+        QHash<int, int> m_byDbKey;             //!< first row by DB key
+        QHash<QString, QVector<int>> m_byName; //!< rows by normalized name
+        qint64 m_timestamp = -1;
+    };
+
+    /*!
+     * Latest snapshot of data, e.g. of a cache. A new snapshot is built if the timestamp of the data changed,
+     * and is then shared by all threads until the data changes again.
+     * \remark thread safe, a snapshot is never changed after publication
+     */
+    template <class SNAPSHOT>
+    class CDbSnapshotHolder
+    {
+    public:
+        //! Default constructor
+        CDbSnapshotHolder() {}
+
+        //! Not copyable
+        CDbSnapshotHolder(const CDbSnapshotHolder &) = delete;
+
+        //! Not copyable
+        CDbSnapshotHolder &operator =(const CDbSnapshotHolder &) = delete;
+
+        //! Snapshot for timestamp of the data, build is called if there is no snapshot for timestamp yet
+        template <class F>
+        QSharedPointer<const SNAPSHOT> get(qint64 timestamp, F build) const
+        {
+            QMutexLocker lock(&m_mutex);
+            if (!m_snapshot || timestamp != m_timestamp)
+            {
+                // built once per version of the data
+                m_snapshot = QSharedPointer<const SNAPSHOT>(new SNAPSHOT(build()));
+                m_timestamp = timestamp;
+            }
+            return m_snapshot;
+        }
+
+    private:
+        mutable QMutex m_mutex;
+        mutable QSharedPointer<const SNAPSHOT> m_snapshot;
+        mutable qint64 m_timestamp = -1;
+    };
+} // ns
+
+#endif // guard
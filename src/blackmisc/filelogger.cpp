@@ -15,9 +15,12 @@
 #include <QDir>
 #include <QFileInfo>
 #include <QIODevice>
+#include <QMutexLocker>
 #include <QString>
 #include <QStringBuilder>
+#include <QThread>
 #include <QtGlobal>
+#include <utility>
 
 using namespace BlackConfig;
 
@@ -53,7 +56,12 @@ namespace BlackMisc
         m_logFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text);
         m_stream.setDevice(&m_logFile);
         m_stream.setCodec("UTF-8");
+        m_dropPattern.uniqueWrite() = CLogPattern().withSeverities({ CStatusMessage::SeverityDebug, CStatusMessage::SeverityInfo });
         writeHeaderToFile();
+
+        m_writerThread = QThread::create([this] { this->writerLoop(); });
+        m_writerThread->setObjectName(QStringLiteral("CFileLogger writer"));
+        m_writerThread->start(QThread::LowPriority);
     }
 
     CFileLogger::~CFileLogger()
@@ -61,16 +69,49 @@ namespace BlackMisc
         this->close();
     }
 
+    void CFileLogger::changeLogPattern(const CLogPattern &pattern)
+    {
+        m_logPattern.sharedWrite() = pattern;
+    }
+
+    void CFileLogger::changeDropPattern(const CLogPattern &pattern)
+    {
+        m_dropPattern.sharedWrite() = pattern;
+    }
+
     void CFileLogger::close()
     {
-        if (m_logFile.isOpen())
+        if (m_writerThread)
         {
             disconnect(this); // disconnect from log handler
+            m_stopWriter = true;
+            {
+                QMutexLocker lock(&m_wakeMutex);
+                m_wakeCondition.wakeOne();
+            }
+            m_writerThread->wait();
+            delete m_writerThread;
+            m_writerThread = nullptr;
+
+            // queued while stopping
+            QVector<CStatusMessage> batch;
+            CStatusMessage statusMessage;
+            while (m_queue.tryPop(statusMessage)) { batch.push_back(std::move(statusMessage)); }
+            if (m_logFile.isOpen()) { this->writeBatch(batch); }
+        }
+        if (m_logFile.isOpen())
+        {
             writeContentToFile(QStringLiteral("Logging stops."));
             m_logFile.close();
         }
     }
 
+    QHash<QString, qint64> CFileLogger::getDroppedMessagesByCategory() const
+    {
+        QMutexLocker lock(&m_droppedMutex);
+        return m_droppedByCategory;
+    }
+
     QString CFileLogger::getLogFileName()
     {
         return logFileName();
@@ -78,21 +119,97 @@ namespace BlackMisc
 
     void CFileLogger::writeStatusMessageToFile(const BlackMisc::CStatusMessage &statusMessage)
     {
+        // filter before anything is formatted, the caller never waits for the disk
         if (statusMessage.isEmpty()) { return; }
-        if (!m_logFile.isOpen()) { return; }
-        if (! m_logPattern.match(statusMessage)) { return; }
+        if (m_stopWriter) { return; }
+        if (!m_logPattern.read()->match(statusMessage)) { return; }
+        if (m_queue.sizeApprox() >= QueueCapacity * 3 / 4 && m_dropPattern.read()->match(statusMessage))
+        {
+            this->dropMessage(statusMessage);
+            return;
+        }
+        if (!m_queue.tryPush(statusMessage))
+        {
+            this->dropMessage(statusMessage);
+            return;
+        }
+
+        // wake the writer if it is waiting, pairs with the fence in writerLoop
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_writerIdle && m_writerIdle.exchange(false))
+        {
+            QMutexLocker lock(&m_wakeMutex);
+            m_wakeCondition.wakeOne();
+        }
+    }
+
+    void CFileLogger::dropMessage(const CStatusMessage &statusMessage)
+    {
+        m_dropped++;
         const QString categories = statusMessage.getCategoriesAsString();
-        if (categories != m_previousCategories)
+        QMutexLocker lock(&m_droppedMutex);
+        m_droppedByCategory[categories]++;
+        m_droppedNotReported[categories]++;
+    }
+
+    void CFileLogger::writerLoop()
+    {
+        constexpr int MaxBatchSize = 512;
+        QVector<CStatusMessage> batch;
+        batch.reserve(MaxBatchSize);
+        CStatusMessage statusMessage;
+        for (;;)
         {
-            writeContentToFile(u"\n[" % categories % u']');
-            m_previousCategories = categories;
+            while (batch.size() < MaxBatchSize && m_queue.tryPop(statusMessage)) { batch.push_back(std::move(statusMessage)); }
+            if (!batch.isEmpty())
+            {
+                this->writeBatch(batch);
+                batch.clear();
+                continue;
+            }
+            if (m_stopWriter) { break; }
+
+            QMutexLocker lock(&m_wakeMutex);
+            m_writerIdle = true;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_queue.isEmpty() && !m_stopWriter) { m_wakeCondition.wait(&m_wakeMutex, 100); }
+            m_writerIdle = false;
         }
-        const QString finalContent(QDateTime::currentDateTime().toString(QStringLiteral("hh:mm:ss "))
-                                   % statusMessage.getSeverityAsString()
-                                   % u": "
-                                   % statusMessage.getMessage());
+    }
 
-        writeContentToFile(finalContent);
+    void CFileLogger::writeBatch(const QVector<CStatusMessage> &batch)
+    {
+        for (const CStatusMessage &statusMessage : batch)
+        {
+            const QString categories = statusMessage.getCategoriesAsString();
+            if (categories != m_previousCategories)
+            {
+                m_stream << u"\n[" % categories % u"]\n";
+                m_previousCategories = categories;
+            }
+            m_stream << QDateTime::fromMSecsSinceEpoch(statusMessage.getMSecsSinceEpoch()).toString(QStringLiteral("hh:mm:ss "))
+                        % statusMessage.getSeverityAsString()
+                        % u": "
+                        % statusMessage.getMessage()
+                        % u'\n';
+        }
+        m_written += batch.size();
+
+        QHash<QString, qint64> dropped;
+        {
+            QMutexLocker lock(&m_droppedMutex);
+            dropped.swap(m_droppedNotReported);
+        }
+        if (!dropped.isEmpty())
+        {
+            m_stream << QStringLiteral("\n[swift.filelogger]\n");
+            for (auto it = dropped.cbegin(); it != dropped.cend(); ++it)
+            {
+                m_stream << u"Dropped " % QString::number(it.value()) % u" message(s) of [" % it.key() % u"], log writer overloaded\n";
+            }
+            m_previousCategories.clear();
+        }
+        m_stream.flush(); // once per batch
     }
 
     QString CFileLogger::getLogFilePath()
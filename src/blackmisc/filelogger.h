@@ -12,17 +12,33 @@
 #define BLACKMISC_FILELOGGER_H
 
 #include "blackmisc/blackmiscexport.h"
+#include "blackmisc/lockfree.h"
+#include "blackmisc/lockfreeringbuffer.h"
 #include "blackmisc/logpattern.h"
 #include "blackmisc/statusmessage.h"
 
 #include <QFile>
+#include <QHash>
+#include <QMutex>
 #include <QObject>
 #include <QString>
 #include <QTextStream>
+#include <QVector>
+#include <QWaitCondition>
+#include <atomic>
+
+class QThread;
 
 namespace BlackMisc
 {
-    //! Class to write log messages to file
+    /*!
+     * Class to write log messages to file.
+     *
+     * Messages are filtered by the log pattern and queued in a lock-free ring buffer, a writer thread
+     * formats and writes them in batches. So logging threads never wait for the disk.
+     * If the writer cannot keep up, messages matching the drop pattern are dropped once the buffer is 3/4 full,
+     * all messages when it is full. Dropped messages are counted by category and reported in the log file.
+     */
     class BLACKMISC_EXPORT CFileLogger : public QObject
     {
         Q_OBJECT
@@ -36,11 +52,31 @@ namespace BlackMisc
         virtual ~CFileLogger();
 
         //! Change the log pattern. Default is to log all messages.
-        void changeLogPattern(const CLogPattern &pattern) { m_logPattern = pattern; }
+        //! \threadsafe
+        void changeLogPattern(const CLogPattern &pattern);
+
+        //! Change the pattern of messages dropped first under overload. Default are debug and info messages.
+        //! \threadsafe
+        void changeDropPattern(const CLogPattern &pattern);
 
-        //! Close file
+        //! Close file, queued messages are written before
         void close();
 
+        //! Messages written to file
+        //! \threadsafe
+        qint64 getWrittenMessages() const { return m_written; }
+
+        //! Messages dropped because the writer could not keep up
+        //! \threadsafe
+        qint64 getDroppedMessages() const { return m_dropped; }
+
+        //! Dropped messages per category (categories as string)
+        //! \threadsafe
+        QHash<QString, qint64> getDroppedMessagesByCategory() const;
+
+        //! Capacity of the ring buffer
+        static constexpr int QueueCapacity = 8192;
+
         //! Get the log file name
         static QString getLogFileName();
 
@@ -48,7 +84,8 @@ namespace BlackMisc
         static QString getLogFilePath();
 
     public slots:
-        //! Write single status message to file
+        //! Write single status message to file, the message is queued and written by the writer thread
+        //! \threadsafe
         void writeStatusMessageToFile(const BlackMisc::CStatusMessage &statusMessage);
 
     private:
@@ -56,11 +93,32 @@ namespace BlackMisc
         void writeHeaderToFile();
         void writeContentToFile(const QString &content);
 
-        CLogPattern m_logPattern;
+        //! Writer thread, drains the queue in batches until stopped
+        void writerLoop();
+
+        //! Format and write a batch, flush once
+        void writeBatch(const QVector<CStatusMessage> &batch);
+
+        //! Count a dropped message
+        void dropMessage(const CStatusMessage &statusMessage);
+
+        LockFree<CLogPattern> m_logPattern;
+        LockFree<CLogPattern> m_dropPattern;
+        CLockFreeRingBuffer<CStatusMessage> m_queue { QueueCapacity };
         QFile m_logFile;
         QString m_fileName;
         QTextStream m_stream;
-        QString m_previousCategories;
+        QString m_previousCategories;      //!< only used by writer thread
+        QThread *m_writerThread = nullptr;
+        QMutex m_wakeMutex;
+        QWaitCondition m_wakeCondition;
+        std::atomic_bool m_writerIdle { false };
+        std::atomic_bool m_stopWriter { false };
+        std::atomic<qint64> m_written { 0 };
+        std::atomic<qint64> m_dropped { 0 };
+        mutable QMutex m_droppedMutex;
+        QHash<QString, qint64> m_droppedByCategory;  //!< total
+        QHash<QString, qint64> m_droppedNotReported; //!< since last report in file
     };
 }
 
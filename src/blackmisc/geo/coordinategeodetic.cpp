@@ -89,6 +89,37 @@ namespace BlackMisc::Geo
         return static_cast<double>((coordinate1.normalVector() - coordinate2.normalVector()).lengthSquared());
     }
 
+    void calculateGreatCircleDistancesAndBearings(int count, const float *x, const float *y, const float *z, const QVector3D &reference, float *distancesM, float *bearingsRad)
+    {
+        constexpr float earthRadiusMeters = 6371000.8f;
+        const float rx = reference.x();
+        const float ry = reference.y();
+        const float rz = reference.z();
+
+        // cross products spelled out, c2 = v x north pole = (vy, -vx, 0)
+        for (int i = 0; i < count; i++)
+        {
+            const float vx = x[i];
+            const float vy = y[i];
+            const float vz = z[i];
+
+            const float c1x = vy * rz - vz * ry;
+            const float c1y = vz * rx - vx * rz;
+            const float c1z = vx * ry - vy * rx;
+            const float dot = vx * rx + vy * ry + vz * rz;
+            distancesM[i] = earthRadiusMeters * std::atan2(std::sqrt(c1x * c1x + c1y * c1y + c1z * c1z), dot);
+
+            const float c2x = vy;
+            const float c2y = -vx;
+            const float cx = -c1z * c2y;
+            const float cy = c1z * c2x;
+            const float cz = c1x * c2y - c1y * c2x;
+            const float sinTheta = std::copysign(std::sqrt(cx * cx + cy * cy + cz * cz), cx * vx + cy * vy + cz * vz);
+            const float cosTheta = c1x * c2x + c1y * c2y;
+            bearingsRad[i] = std::atan2(sinTheta, cosTheta);
+        }
+    }
+
     bool ICoordinateGeodetic::equalNormalVectorDouble(const std::array<double, 3> &otherVector) const
     {
         static const double epsilon = std::numeric_limits<double>::epsilon();
@@ -164,6 +164,22 @@ namespace BlackMisc
         //! Euclidean distance squared between normal vectors, use for more efficient sorting by distance
         BLACKMISC_EXPORT double calculateEuclideanDistanceSquared(const ICoordinateGeodetic &coordinate1, const ICoordinateGeodetic &coordinate2);
 
+        /*!
+         * Great circle distances and initial bearings of many normal vectors to one reference vector.
+         *
+         * Same calculation as calculateGreatCircleDistance and calculateBearing(vector, reference), but in one pass
+         * over contiguous arrays, without branches or virtual calls, so the compiler can vectorize the loop.
+         * \param count       number of vectors
+         * \param x           x of the normal vectors
+         * \param y           y of the normal vectors
+         * \param z           z of the normal vectors
+         * \param reference   reference normal vector
+         * \param distancesM  great circle distances in m
+         * \param bearingsRad initial bearings in rad
+         * \remark a NaN component yields NaN results, use it for NULL coordinates
+         */
+        BLACKMISC_EXPORT void calculateGreatCircleDistancesAndBearings(int count, const float *x, const float *y, const float *z, const QVector3D &reference, float *distancesM, float *bearingsRad);
+
         //! Interface (actually more an abstract class) of coordinates and relative position to something (normally own aircraft)
         class BLACKMISC_EXPORT ICoordinateWithRelativePosition : public ICoordinateGeodetic
         {
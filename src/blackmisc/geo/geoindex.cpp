@@ -0,0 +1,156 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/geo/geoindex.h"
+#include "blackmisc/pq/units.h"
+
+#include <QtGlobal>
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
+
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Geo
+{
+    CGeoIndex::CGeoIndex(const std::vector<std::array<double, 3>> &normalVectors, const QVector<int> &indexes)
+    {
+        Q_ASSERT_X(static_cast<int>(normalVectors.size()) == indexes.size(), Q_FUNC_INFO, "Size mismatch");
+        m_nodes.resize(normalVectors.size());
+        for (size_t i = 0; i < normalVectors.size(); i++)
+        {
+            m_nodes[i].point = normalVectors[i];
+            m_nodes[i].index = indexes[static_cast<int>(i)];
+        }
+        this->build(0, this->size());
+    }
+
+    QVector<int> CGeoIndex::findClosest(int number, const ICoordinateGeodetic &coordinate) const
+    {
+        if (number < 1 || m_nodes.empty() || coordinate.isNull()) { return {}; }
+        Candidates candidates;
+        candidates.reserve(static_cast<size_t>(number) + 1);
+        this->closest(0, this->size(), coordinate.normalVectorDouble(), static_cast<size_t>(number), candidates);
+        return toIndexes(candidates);
+    }
+
+    QVector<int> CGeoIndex::findWithinRange(const ICoordinateGeodetic &coordinate, const CLength &range) const
+    {
+        if (range.isNull() || m_nodes.empty() || coordinate.isNull()) { return {}; }
+        Candidates candidates;
+        this->withinRange(0, this->size(), coordinate.normalVectorDouble(), chordDistanceSquared(range), candidates);
+        return toIndexes(candidates);
+    }
+
+    double CGeoIndex::distanceSquared(const std::array<double, 3> &v1, const std::array<double, 3> &v2)
+    {
+        const double dx = v1[0] - v2[0];
+        const double dy = v1[1] - v2[1];
+        const double dz = v1[2] - v2[2];
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    double CGeoIndex::chordDistanceSquared(const CLength &range)
+    {
+        // same radius as calculateGreatCircleDistance, the margin (about 6m) covers its float precision
+        constexpr double earthRadiusMeters = 6371000.8;
+        constexpr double marginRad = 1e-6;
+        const double angleRad = range.value(CLengthUnit::m()) / earthRadiusMeters + marginRad;
+        if (angleRad >= M_PI) { return 4.0; } // whole sphere
+        const double chord = 2.0 * std::sin(angleRad / 2.0);
+        return chord * chord;
+    }
+
+    void CGeoIndex::build(int begin, int end)
+    {
+        if (end - begin < 2) { return; }
+
+        // split at the axis with the largest spread
+        Point minP = m_nodes[static_cast<size_t>(begin)].point;
+        Point maxP = minP;
+        for (int i = begin + 1; i < end; i++)
+        {
+            const Point &p = m_nodes[static_cast<size_t>(i)].point;
+            for (size_t a = 0; a < 3; a++)
+            {
+                minP[a] = std::min(minP[a], p[a]);
+                maxP[a] = std::max(maxP[a], p[a]);
+            }
+        }
+        int axis = 0;
+        for (int a = 1; a < 3; a++)
+        {
+            if (maxP[static_cast<size_t>(a)] - minP[static_cast<size_t>(a)] > maxP[static_cast<size_t>(axis)] - minP[static_cast<size_t>(axis)]) { axis = a; }
+        }
+
+        const int mid = (begin + end) / 2;
+        std::nth_element(m_nodes.begin() + begin, m_nodes.begin() + mid, m_nodes.begin() + end, [axis](const Node & a, const Node & b)
+        {
+            return a.point[static_cast<size_t>(axis)] < b.point[static_cast<size_t>(axis)];
+        });
+        m_nodes[static_cast<size_t>(mid)].axis = axis;
+        this->build(begin, mid);
+        this->build(mid + 1, end);
+    }
+
+    void CGeoIndex::closest(int begin, int end, const Point &point, size_t number, Candidates &candidates) const
+    {
+        if (begin >= end) { return; }
+        const int mid = (begin + end) / 2;
+        const Node &node = m_nodes[static_cast<size_t>(mid)];
+
+        // max heap of the best candidates
+        const double d2 = distanceSquared(point, node.point);
+        if (candidates.size() < number)
+        {
+            candidates.emplace_back(d2, node.index);
+            std::push_heap(candidates.begin(), candidates.end());
+        }
+        else if (d2 < candidates.front().first)
+        {
+            std::pop_heap(candidates.begin(), candidates.end());
+            candidates.back() = { d2, node.index };
+            std::push_heap(candidates.begin(), candidates.end());
+        }
+        if (end - begin < 2) { return; }
+
+        const double diff = point[static_cast<size_t>(node.axis)] - node.point[static_cast<size_t>(node.axis)];
+        const bool leftFirst = diff < 0;
+        this->closest(leftFirst ? begin : mid + 1, leftFirst ? mid : end, point, number, candidates);
+
+        // other side only if it can contain closer positions
+        if (candidates.size() < number || diff * diff < candidates.front().first)
+        {
+            this->closest(leftFirst ? mid + 1 : begin, leftFirst ? end : mid, point, number, candidates);
+        }
+    }
+
+    void CGeoIndex::withinRange(int begin, int end, const Point &point, double maxDistanceSquared, Candidates &candidates) const
+    {
+        if (begin >= end) { return; }
+        const int mid = (begin + end) / 2;
+        const Node &node = m_nodes[static_cast<size_t>(mid)];
+
+        const double d2 = distanceSquared(point, node.point);
+        if (d2 <= maxDistanceSquared) { candidates.emplace_back(d2, node.index); }
+        if (end - begin < 2) { return; }
+
+        const double diff = point[static_cast<size_t>(node.axis)] - node.point[static_cast<size_t>(node.axis)];
+        if (diff < 0 || diff * diff <= maxDistanceSquared) { this->withinRange(begin, mid, point, maxDistanceSquared, candidates); }
+        if (diff >= 0 || diff * diff <= maxDistanceSquared) { this->withinRange(mid + 1, end, point, maxDistanceSquared, candidates); }
+    }
+
+    QVector<int> CGeoIndex::toIndexes(Candidates &candidates)
+    {
+        std::sort(candidates.begin(), candidates.end());
+        QVector<int> indexes;
+        indexes.reserve(static_cast<int>(candidates.size()));
+        for (const auto &candidate : candidates) { indexes.push_back(candidate.second); }
+        return indexes;
+    }
+} // ns
@@ -0,0 +1,167 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_GEO_GEOINDEX_H
+#define BLACKMISC_GEO_GEOINDEX_H
+
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QVector>
+#include <array>
+#include <vector>
+
+namespace BlackMisc::Geo
+{
+    /*!
+     * Spatial index (k-d tree) over the normal vectors of positions.
+     *
+     * The chord distance of normal vectors grows with the great circle distance, so the k nearest
+     * positions by normal vector are the k nearest by great circle distance. Queries return the
+     * indexes the positions were added with, closest first.
+     */
+    class BLACKMISC_EXPORT CGeoIndex
+    {
+    public:
+        //! Default constructor, empty index
+        CGeoIndex() {}
+
+        //! Index of the normal vectors, index i refers to normalVectors[i]
+        CGeoIndex(const std::vector<std::array<double, 3>> &normalVectors, const QVector<int> &indexes);
+
+        //! Number of indexed positions
+        int size() const { return static_cast<int>(m_nodes.size()); }
+
+        //! Empty?
+        bool isEmpty() const { return m_nodes.empty(); }
+
+        //! Indexes of the 0..n positions closest to the given position, closest first
+        QVector<int> findClosest(int number, const ICoordinateGeodetic &coordinate) const;
+
+        //! Indexes of the positions within the chord distance of the given range, closest first
+        //! \remark the chord distance is slightly enlarged, callers check the exact distance
+        QVector<int> findWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const;
+
+        //! Squared chord distance between two normal vectors, as calculateEuclideanDistanceSquared
+        static double distanceSquared(const std::array<double, 3> &v1, const std::array<double, 3> &v2);
+
+        //! Squared chord distance on the unit sphere corresponding to a great circle distance
+        static double chordDistanceSquared(const PhysicalQuantities::CLength &range);
+
+    private:
+        using Point = std::array<double, 3>;
+        using Candidates = std::vector<std::pair<double, int>>; //!< squared distance, index as added
+
+        //! Node of the tree
+        struct Node
+        {
+            Point point;    //!< normal vector
+            int index = -1; //!< index as added
+            int axis = 0;   //!< split axis
+        };
+
+        //! Build the subtree of [begin, end)
+        void build(int begin, int end);
+
+        //! k nearest in subtree [begin, end), candidates as max heap
+        void closest(int begin, int end, const Point &point, size_t number, Candidates &candidates) const;
+
+        //! All within squared distance in subtree [begin, end)
+        void withinRange(int begin, int end, const Point &point, double maxDistanceSquared, Candidates &candidates) const;
+
+        //! Candidates sorted by distance
+        static QVector<int> toIndexes(Candidates &candidates);
+
+        std::vector<Node> m_nodes; //!< node of subtree [begin, end) is at (begin + end) / 2
+    };
+
+    /*!
+     * Immutable list of geo objects with a spatial index, for repeated queries on a large list
+     * such as all airports. Build it once and keep it as long as the list does not change.
+     * \remark objects with a NULL position are not found
+     */
+    template<class OBJ, class CONTAINER>
+    class CGeoObjectIndex
+    {
+    public:
+        //! Default constructor, empty
+        CGeoObjectIndex() {}
+
+        //! Index of objects
+        explicit CGeoObjectIndex(const CONTAINER &objects) : m_objects(objects)
+        {
+            std::vector<std::array<double, 3>> normalVectors;
+            QVector<int> indexes;
+            normalVectors.reserve(static_cast<size_t>(m_objects.size()));
+            indexes.reserve(m_objects.size());
+            int i = 0;
+            for (const OBJ &obj : m_objects)
+            {
+                const std::array<double, 3> v = obj.normalVectorDouble();
+                if (v[0] != 0.0 || v[1] != 0.0 || v[2] != 0.0)
+                {
+                    normalVectors.push_back(v);
+                    indexes.push_back(i);
+                }
+                i++;
+            }
+            m_index = CGeoIndex(normalVectors, indexes);
+        }
+
+        //! All objects
+        const CONTAINER &objects() const { return m_objects; }
+
+        //! Number of objects
+        int size() const { return m_objects.size(); }
+
+        //! \copydoc BlackMisc::Geo::IGeoObjectList::findClosest
+        //! \remark sub-linear
+        CONTAINER findClosest(int number, const ICoordinateGeodetic &coordinate) const
+        {
+            return this->toObjects(m_index.findClosest(number, coordinate));
+        }
+
+        //! Objects within range, closest first
+        //! \remark sub-linear
+        CONTAINER findWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const
+        {
+            CONTAINER objects;
+            for (int i : m_index.findWithinRange(coordinate, range))
+            {
+                const OBJ &obj = m_objects[i];
+                if (calculateGreatCircleDistance(obj, coordinate) <= range) { objects.push_back(obj); }
+            }
+            return objects;
+        }
+
+        //! \copydoc BlackMisc::Geo::IGeoObjectList::findClosestWithinRange
+        OBJ findClosestWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const
+        {
+            const CONTAINER closest = this->findClosest(1, coordinate);
+            if (closest.isEmpty() || calculateGreatCircleDistance(closest.front(), coordinate) > range) { return OBJ(); }
+            return closest.front();
+        }
+
+    private:
+        //! Objects by indexes
+        CONTAINER toObjects(const QVector<int> &indexes) const
+        {
+            CONTAINER objects;
+            for (int i : indexes) { objects.push_back(m_objects[i]); }
+            return objects;
+        }
+
+        CONTAINER m_objects;
+        CGeoIndex m_index;
+    };
+} // ns
+
+#endif // guard
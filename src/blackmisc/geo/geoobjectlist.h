@@ -18,7 +18,11 @@
 #include "blackmisc/geo/coordinategeodetic.h"
 
 #include <QList>
+#include <QVector3D>
+#include <cmath>
+#include <limits>
 #include <tuple>
+#include <vector>
 
 namespace BlackMisc::Geo
 {
@@ -294,20 +298,58 @@ namespace BlackMisc::Geo
         //! Calculate distances, remove if outside range
         void removeIfOutsideRange(const ICoordinateGeodetic &position, const PhysicalQuantities::CLength &maxDistance, bool updateValues)
         {
-            this->container().removeIf([&](OBJ & geoObj)
+            if (updateValues)
             {
-                return updateValues ?
-                    geoObj.calculcateAndUpdateRelativeDistanceAndBearing(position) > maxDistance :
-                geoObj.calculateGreatCircleDistance(position) > maxDistance;
-            });
+                this->calculcateAndUpdateRelativeDistanceAndBearing(position);
+                this->container().removeIf([&](const OBJ & geoObj) { return geoObj.getRelativeDistance() > maxDistance; });
+                return;
+            }
+            this->container().removeIf([&](const OBJ & geoObj) { return geoObj.calculateGreatCircleDistance(position) > maxDistance; });
         }
 
         //! Calculate distances
+        //! \remark all objects in one batch, see Geo::calculateGreatCircleDistancesAndBearings
         void calculcateAndUpdateRelativeDistanceAndBearing(const ICoordinateGeodetic &position)
         {
+            const int n = this->container().size();
+            if (n < 1) { return; }
+
+            // structure of arrays: x, y, z, distance, bearing
+            constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+            std::vector<float> values(5 * static_cast<size_t>(n));
+            float *x = values.data();
+            float *y = x + n;
+            float *z = y + n;
+            float *distances = z + n;
+            float *bearings = distances + n;
+
+            int i = 0;
+            for (const OBJ &geoObj : std::as_const(this->container()))
+            {
+                const QVector3D v = geoObj.isNull() ? QVector3D(nan, nan, nan) : geoObj.normalVector();
+                x[i] = v.x();
+                y[i] = v.y();
+                z[i] = v.z();
+                i++;
+            }
+
+            const QVector3D reference = position.isNull() ? QVector3D(nan, nan, nan) : position.normalVector();
+            calculateGreatCircleDistancesAndBearings(n, x, y, z, reference, distances, bearings);
+
+            i = 0;
             for (OBJ &geoObj : this->container())
             {
-                geoObj.calculcateAndUpdateRelativeDistanceAndBearing(position);
+                const float d = distances[i];
+                const float b = bearings[i];
+                i++;
+                if (std::isnan(d))
+                {
+                    geoObj.setRelativeDistance(PhysicalQuantities::CLength::null());
+                    geoObj.setRelativeBearing(PhysicalQuantities::CAngle::null());
+                    continue;
+                }
+                geoObj.setRelativeDistance(PhysicalQuantities::CLength(static_cast<double>(d), PhysicalQuantities::CLengthUnit::m()));
+                geoObj.setRelativeBearing(PhysicalQuantities::CAngle(static_cast<double>(b), PhysicalQuantities::CAngleUnit::rad()));
             }
         }
 
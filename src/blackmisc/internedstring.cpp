@@ -0,0 +1,139 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/internedstring.h"
+
+#include <QReadLocker>
+#include <QReadWriteLock>
+#include <QWriteLocker>
+#include <array>
+
+namespace BlackMisc
+{
+    namespace Private
+    {
+        //! Part of the intern table with its own lock, so lookups of different strings rarely contend
+        struct CInternShard
+        {
+            static constexpr int MinPruneSize = 64; //!< do not prune small shards
+
+            QReadWriteLock lock;
+            QHash<QString, QExplicitlySharedDataPointer<CInternedStringData>> entries;
+            int pruneSize = MinPruneSize; //!< prune when this size is reached
+
+            //! Remove entries only referenced by the table, call with write lock
+            int prune()
+            {
+                int removed = 0;
+                for (auto it = entries.begin(); it != entries.end();)
+                {
+                    if (it.value()->ref.loadRelaxed() == 1) { it = entries.erase(it); removed++; }
+                    else { ++it; }
+                }
+                pruneSize = qMax(MinPruneSize, 2 * entries.size());
+                return removed;
+            }
+        };
+
+        //! Process wide table of interned strings
+        struct CInternTable
+        {
+            static constexpr int Shards = 16; //!< number of shards
+
+            std::array<CInternShard, Shards> shards;
+
+            //! Shard of a string, cheap so the string is only hashed once by the shard lookup
+            CInternShard &shard(const QString &string)
+            {
+                const uint key = static_cast<uint>(string.length()) * 31U + string.at(string.length() - 1).unicode();
+                return shards[key % Shards];
+            }
+        };
+
+        CInternTable &internTable()
+        {
+            static CInternTable table;
+            return table;
+        }
+    }
+
+    CInternedString::CInternedString(const QString &string)
+    {
+        if (string.isEmpty()) { return; }
+        Private::CInternShard &shard = Private::internTable().shard(string);
+        {
+            QReadLocker l(&shard.lock);
+            const auto it = shard.entries.constFind(string);
+            if (it != shard.entries.constEnd())
+            {
+                m_data = it.value();
+                return;
+            }
+        }
+
+        QWriteLocker l(&shard.lock);
+        const auto it = shard.entries.constFind(string); // added meanwhile?
+        if (it != shard.entries.constEnd())
+        {
+            m_data = it.value();
+            return;
+        }
+
+        // generation based pruning, amortized O(1) per insert
+        if (shard.entries.size() >= shard.pruneSize) { shard.prune(); }
+
+        m_data = new Private::CInternedStringData;
+        m_data->string = string;
+        m_data->string.squeeze();
+        m_data->hash = qHash(string.toCaseFolded());
+        shard.entries.insert(m_data->string, m_data);
+    }
+
+    const QString &CInternedString::emptyString()
+    {
+        static const QString empty;
+        return empty;
+    }
+
+    int CInternedString::getInternedCount()
+    {
+        int count = 0;
+        for (Private::CInternShard &shard : Private::internTable().shards)
+        {
+            QReadLocker l(&shard.lock);
+            count += shard.entries.size();
+        }
+        return count;
+    }
+
+    qint64 CInternedString::getInternedBytes()
+    {
+        constexpr qint64 entryBytes = static_cast<qint64>(sizeof(Private::CInternedStringData) + sizeof(QString) + sizeof(void *));
+        qint64 bytes = 0;
+        for (Private::CInternShard &shard : Private::internTable().shards)
+        {
+            QReadLocker l(&shard.lock);
+            for (auto it = shard.entries.cbegin(); it != shard.entries.cend(); ++it)
+            {
+                bytes += entryBytes + (it.key().capacity() + 1) * static_cast<qint64>(sizeof(QChar));
+            }
+        }
+        return bytes;
+    }
+
+    int CInternedString::pruneInterned()
+    {
+        int removed = 0;
+        for (Private::CInternShard &shard : Private::internTable().shards)
+        {
+            QWriteLocker l(&shard.lock);
+            removed += shard.prune();
+        }
+        return removed;
+    }
+} // ns
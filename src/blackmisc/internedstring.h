@@ -0,0 +1,127 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_INTERNEDSTRING_H
+#define BLACKMISC_INTERNEDSTRING_H
+
+#include "blackmisc/blackmiscexport.h"
+#include "blackmisc/json.h"
+#include "blackmisc/metaclass.h"
+
+#include <QDBusArgument>
+#include <QDataStream>
+#include <QExplicitlySharedDataPointer>
+#include <QHash>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QJsonValueRef>
+#include <QSharedData>
+#include <QString>
+#include <utility>
+
+namespace BlackMisc
+{
+    namespace Private
+    {
+        //! Entry of the intern table, shared by all equal interned strings
+        struct CInternedStringData : public QSharedData
+        {
+            QString string; //!< the string
+            uint hash = 0;  //!< case insensitive hash of the string
+        };
+    }
+
+    /*!
+     * String from a process wide intern table, used for callsigns and designators.
+     * Equal strings share one table entry, so equality and hashing are O(1).
+     * \remark Ordering is by string, so sorting is not affected.
+     * \remark The hash is case insensitive, so it can be used with CaseInsensitiveComparison members.
+     * \remark Entries are reference counted, unused entries are pruned when the table grows.
+     * \remark Marshalled and serialized as plain QString, interned again when read.
+     */
+    class BLACKMISC_EXPORT CInternedString
+    {
+    public:
+        //! Default constructor, empty string
+        CInternedString() {}
+
+        //! Constructor, interns the string
+        explicit CInternedString(const QString &string);
+
+        //! The string
+        const QString &toQString() const { return m_data ? m_data->string : emptyString(); }
+
+        //! Empty?
+        bool isEmpty() const { return !m_data; }
+
+        //! Length
+        int length() const { return m_data ? m_data->string.length() : 0; }
+
+        //! Compare, O(1) for equal strings
+        int compare(const CInternedString &other, Qt::CaseSensitivity cs = Qt::CaseSensitive) const
+        {
+            if (m_data == other.m_data) { return 0; }
+            return this->toQString().compare(other.toQString(), cs);
+        }
+
+        //! Equal
+        friend bool operator ==(const CInternedString &a, const CInternedString &b) { return a.m_data == b.m_data; }
+
+        //! Not equal
+        friend bool operator !=(const CInternedString &a, const CInternedString &b) { return a.m_data != b.m_data; }
+
+        //! Less than, by string
+        friend bool operator <(const CInternedString &a, const CInternedString &b) { return a.compare(b) < 0; }
+
+        //! Compare, by string
+        friend int compare(const CInternedString &a, const CInternedString &b) { return a.compare(b); }
+
+        //! Hash, precomputed and case insensitive
+        friend uint qHash(const CInternedString &value, uint seed = 0) { return ::qHash(value.m_data ? value.m_data->hash : 0U, seed); } // clazy:exclude=qhash-namespace
+
+        //! DBus marshalling as string
+        //! @{
+        friend QDBusArgument &operator <<(QDBusArgument &arg, const CInternedString &value) { arg << value.toQString(); return arg; }
+        friend const QDBusArgument &operator >>(const QDBusArgument &arg, CInternedString &value) { QString s; arg >> s; value = CInternedString(s); return arg; }
+        //! @}
+
+        //! QDataStream marshalling as string
+        //! @{
+        friend QDataStream &operator <<(QDataStream &stream, const CInternedString &value) { stream << value.toQString(); return stream; }
+        friend QDataStream &operator >>(QDataStream &stream, CInternedString &value) { QString s; stream >> s; value = CInternedString(s); return stream; }
+        //! @}
+
+        //! JSON as string
+        //! @{
+        friend QJsonObject &operator <<(QJsonObject &json, const std::pair<QString, const CInternedString &> &value) { json.insert(value.first, value.second.toQString()); return json; }
+        friend QJsonObject &operator <<(QJsonObject &json, const std::pair<CExplicitLatin1String, const CInternedString &> &value) { json[value.first] = value.second.toQString(); return json; }
+        friend const QJsonValue &operator >>(const QJsonValue &json, CInternedString &value) { value = CInternedString(json.toString()); return json; }
+        friend QJsonValueRef operator >>(QJsonValueRef json, CInternedString &value) { value = CInternedString(json.toString()); return json; }
+        //! @}
+
+        //! Number of strings in the intern table
+        static int getInternedCount();
+
+        //! Approximate memory used by the intern table in bytes
+        static qint64 getInternedBytes();
+
+        //! Remove the strings no longer used, also done automatically when the table grows
+        //! \return number of removed strings
+        static int pruneInterned();
+
+    private:
+        //! Shared empty string
+        static const QString &emptyString();
+
+        QExplicitlySharedDataPointer<Private::CInternedStringData> m_data; //!< null for the empty string
+    };
+} // ns
+
+#endif // guard
@@ -0,0 +1,108 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_JSONSTREAM_H
+#define BLACKMISC_JSONSTREAM_H
+
+#include "blackmisc/json.h"
+#include "blackmisc/jsonstreamreader.h"
+#include "blackmisc/jsonstreamwriter.h"
+
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include <type_traits>
+#include <utility>
+
+namespace BlackMisc
+{
+    template <class Derived> class CContainerBase;
+    namespace Mixin { template <class Derived> class JsonByMetaClass; }
+
+    namespace Json
+    {
+        //! \cond PRIVATE
+        namespace Private
+        {
+            template <class C> C *toJsonOwner(QJsonObject (C::*)() const);
+            template <class C> C *convertFromJsonOwner(void (C::*)(const QJsonObject &));
+
+            // class declaring T::toJson, void if there is none or it is ambiguous
+            template <class T, class = void> struct TToJsonOwner { using type = void; };
+            template <class T> struct TToJsonOwner<T, std::void_t<decltype(toJsonOwner(&T::toJson))>> { using type = std::remove_pointer_t<decltype(toJsonOwner(&T::toJson))>; };
+
+            // class declaring T::convertFromJson, void if there is none or it is ambiguous
+            template <class T, class = void> struct TConvertFromJsonOwner { using type = void; };
+            template <class T> struct TConvertFromJsonOwner<T, std::void_t<decltype(convertFromJsonOwner(&T::convertFromJson))>> { using type = std::remove_pointer_t<decltype(convertFromJsonOwner(&T::convertFromJson))>; };
+
+            template <class T, class = void> struct THasToJson : std::false_type {};
+            template <class T> struct THasToJson<T, std::void_t<decltype(std::declval<const T &>().toJson())>> : std::true_type {};
+
+            template <class T, class = void> struct THasConvertFromJson : std::false_type {};
+            template <class T> struct THasConvertFromJson<T, std::void_t<decltype(std::declval<T &>().convertFromJson(std::declval<const QJsonObject &>()))>> : std::true_type {};
+
+            template <class T> struct TIsContainerBase : std::false_type {};
+            template <class T> struct TIsContainerBase<CContainerBase<T>> : std::true_type {};
+
+            // JSON of T is implemented by the metaclass or the container mixin, and not overridden by T
+            template <class Owner, class T>
+            inline constexpr bool IsStreamable = std::is_same_v<Owner, Mixin::JsonByMetaClass<T>> || TIsContainerBase<Owner>::value;
+        }
+        //! \endcond
+
+        /*!
+         * Write a value like the QJsonObject operators would do.
+         *
+         * Value objects using the metaclass and containers are written member by member and element by element,
+         * without building their QJsonObject. Other types are written via their JSON DOM.
+         */
+        template <class T>
+        void writeToStream(CJsonStreamWriter &writer, const T &value)
+        {
+            using Owner = typename Private::TToJsonOwner<T>::type;
+            if constexpr (Private::IsStreamable<Owner, T>) { static_cast<const Owner &>(value).writeJson(writer); }
+            else if constexpr (Private::THasToJson<T>::value) { writer.writeValue(value.toJson()); }
+            else if constexpr (std::is_same_v<T, QString>) { writer.writeString(value); }
+            else if constexpr (std::is_same_v<T, bool>) { writer.writeBool(value); }
+            else if constexpr (std::is_same_v<T, double>) { writer.writeNumber(value); }
+            else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, qint16> || std::is_same_v<T, qlonglong>) { writer.writeInteger(value); }
+            else if constexpr (std::is_enum_v<T>) { writer.writeInteger(static_cast<int>(value)); }
+            else
+            {
+                // any other type supported by the QJsonObject operators, e.g. QDateTime or QPixmap
+                QJsonObject json;
+                json << std::make_pair(CExplicitLatin1String("v"), std::cref(value));
+                writer.writeValue(json.value(QLatin1String("v")));
+            }
+        }
+
+        /*!
+         * Read a value like the QJsonValue operators would do, the reader is on the first token of the value
+         * and stays on the last token of the value.
+         *
+         * Value objects using the metaclass and containers are read member by member and element by element,
+         * without building their QJsonObject. Other types are read via their JSON DOM.
+         */
+        template <class T>
+        void readFromStream(CJsonStreamReader &reader, T &value)
+        {
+            using Owner = typename Private::TConvertFromJsonOwner<T>::type;
+            if constexpr (Private::IsStreamable<Owner, T>) { static_cast<Owner &>(value).readJson(reader); }
+            else if constexpr (Private::THasConvertFromJson<T>::value) { value.convertFromJson(reader.readValue().toObject()); }
+            else
+            {
+                const QJsonValue json = reader.readValue();
+                json >> value;
+            }
+        }
+    } // ns
+} // ns
+
+#endif // guard
@@ -0,0 +1,345 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/jsonstreamreader.h"
+
+#include <QChar>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <cstring>
+
+namespace BlackMisc
+{
+    CJsonStreamReader::CJsonStreamReader(const QByteArray &json) :
+        m_json(json), m_data(m_json.constData()), m_size(m_json.size())
+    { }
+
+    CJsonStreamReader::TokenType CJsonStreamReader::readNext()
+    {
+        if (this->atEnd()) { return m_type; }
+        this->skipWhitespace();
+        if (m_pos < m_size && m_data[m_pos] == ',')
+        {
+            if (!m_needComma) { return this->error(QStringLiteral("Unexpected ','")); }
+            m_pos++;
+            m_needComma = false;
+            this->skipWhitespace();
+            if (m_pos < m_size && (m_data[m_pos] == '}' || m_data[m_pos] == ']')) { return this->error(QStringLiteral("Unexpected end of container after ','")); }
+        }
+
+        if (m_pos >= m_size)
+        {
+            if (m_stack.isEmpty() && m_topLevelDone) { m_type = EndDocument; return m_type; }
+            return this->error(QStringLiteral("Unexpected end of document"));
+        }
+        if (m_stack.isEmpty() && m_topLevelDone) { return this->error(QStringLiteral("Unexpected data after the document")); }
+
+        const char c = m_data[m_pos];
+        m_tokenBegin = m_pos;
+        m_hasEscapes = false;
+        if (c == '}' || c == ']')
+        {
+            const char open = (c == '}') ? '{' : '[';
+            if (m_stack.isEmpty() || m_stack.back() != open || m_afterName) { return this->error(QStringLiteral("Unexpected '%1'").arg(QLatin1Char(c))); }
+            m_stack.removeLast();
+            m_pos++;
+            m_tokenEnd = m_pos;
+            m_type = (c == '}') ? EndObject : EndArray;
+            this->valueDone();
+            return m_type;
+        }
+        if (m_needComma) { return this->error(QStringLiteral("Missing ','")); }
+
+        // member name
+        if (!m_stack.isEmpty() && m_stack.back() == '{' && !m_afterName)
+        {
+            if (c != '"' || !this->scanString()) { return this->error(QStringLiteral("Expected member name")); }
+            this->skipWhitespace();
+            if (m_pos >= m_size || m_data[m_pos] != ':') { return this->error(QStringLiteral("Expected ':'")); }
+            m_pos++;
+            m_afterName = true;
+            m_type = Name;
+            return m_type;
+        }
+
+        // value
+        m_afterName = false;
+        switch (c)
+        {
+        case '{':
+        case '[':
+            m_stack.append(c);
+            m_pos++;
+            m_tokenEnd = m_pos;
+            m_type = (c == '{') ? StartObject : StartArray;
+            return m_type;
+        case '"':
+            if (!this->scanString()) { return this->error(QStringLiteral("Unterminated string")); }
+            m_type = String;
+            break;
+        case 't':
+        case 'f':
+            if (!this->scanLiteral(c == 't' ? QLatin1String("true") : QLatin1String("false"))) { return this->error(QStringLiteral("Invalid literal")); }
+            m_type = Bool;
+            break;
+        case 'n':
+            if (!this->scanLiteral(QLatin1String("null"))) { return this->error(QStringLiteral("Invalid literal")); }
+            m_type = Null;
+            break;
+        default:
+            if (!this->scanNumber()) { return this->error(QStringLiteral("Unexpected '%1'").arg(QLatin1Char(c))); }
+            m_type = Number;
+            break;
+        }
+        this->valueDone();
+        return m_type;
+    }
+
+    bool CJsonStreamReader::isName(QLatin1String name) const
+    {
+        return m_type == Name && !m_hasEscapes && this->tokenSize() == name.size() && std::memcmp(this->tokenData(), name.data(), static_cast<size_t>(name.size())) == 0;
+    }
+
+    QString CJsonStreamReader::stringValue() const
+    {
+        switch (m_type)
+        {
+        case Name:
+        case String: return m_hasEscapes ? decodeString(this->tokenData(), this->tokenSize()) : QString::fromUtf8(this->tokenData(), this->tokenSize());
+        case Number:
+        case Bool: return QString::fromLatin1(this->tokenData(), this->tokenSize());
+        default: break;
+        }
+        return {};
+    }
+
+    double CJsonStreamReader::numberValue() const
+    {
+        return m_type == Number ? parseNumber(this->tokenData(), this->tokenSize()) : 0.0;
+    }
+
+    bool CJsonStreamReader::boolValue() const
+    {
+        return m_type == Bool && m_data[m_tokenBegin] == 't';
+    }
+
+    bool CJsonStreamReader::skipValue()
+    {
+        if (m_type == Name) { this->readNext(); }
+        if (m_type == StartObject || m_type == StartArray)
+        {
+            const int containerDepth = this->depth();
+            do
+            {
+                if (this->readNext() == Invalid) { return false; }
+            }
+            while (this->depth() >= containerDepth);
+        }
+        return !this->hasError();
+    }
+
+    QJsonValue CJsonStreamReader::readValue()
+    {
+        if (m_type == Name) { this->readNext(); }
+        switch (m_type)
+        {
+        case StartObject:
+            {
+                QJsonObject object;
+                while (this->readNext() == Name)
+                {
+                    const QString name = this->stringValue();
+                    this->readNext();
+                    object.insert(name, this->readValue());
+                }
+                if (m_type != EndObject) { return QJsonValue::Undefined; }
+                return object;
+            }
+        case StartArray:
+            {
+                QJsonArray array;
+                while (this->readNext() != EndArray)
+                {
+                    if (this->atEnd()) { return QJsonValue::Undefined; }
+                    array.append(this->readValue());
+                }
+                return array;
+            }
+        case String: return this->stringValue();
+        case Number: return this->numberValue();
+        case Bool: return this->boolValue();
+        case Null: return QJsonValue::Null;
+        default: break;
+        }
+        return QJsonValue::Undefined;
+    }
+
+    QByteArray CJsonStreamReader::rawValue()
+    {
+        if (m_type == Name) { this->readNext(); }
+        const int begin = (m_type == String) ? m_tokenBegin - 1 : m_tokenBegin; // with quotes
+        if (!this->skipValue()) { return {}; }
+        const int end = (m_type == String) ? m_tokenEnd + 1 : m_tokenEnd;
+        return m_json.mid(begin, end - begin);
+    }
+
+    bool CJsonStreamReader::skipToDepth(int depth)
+    {
+        while (this->depth() > depth && !this->atEnd()) { this->readNext(); }
+        return !this->hasError();
+    }
+
+    QString CJsonStreamReader::decodeString(const char *data, int size)
+    {
+        if (!std::memchr(data, '\\', static_cast<size_t>(size))) { return QString::fromUtf8(data, size); }
+
+        QString result;
+        result.reserve(size);
+        int runBegin = 0;
+        for (int i = 0; i < size; ++i)
+        {
+            if (data[i] != '\\') { continue; }
+            if (i > runBegin) { result += QString::fromUtf8(data + runBegin, i - runBegin); }
+            if (++i >= size) { break; }
+            switch (data[i])
+            {
+            case 'b': result += QChar('\b'); break;
+            case 'f': result += QChar('\f'); break;
+            case 'n': result += QChar('\n'); break;
+            case 'r': result += QChar('\r'); break;
+            case 't': result += QChar('\t'); break;
+            case 'u':
+                {
+                    // UTF-16 code unit, surrogate pairs are 2 escapes
+                    ushort code = 0;
+                    int digits = 0;
+                    for (; digits < 4 && i + 1 < size; ++digits)
+                    {
+                        const char h = data[++i];
+                        const int v = (h >= '0' && h <= '9') ? h - '0' : (h >= 'a' && h <= 'f') ? h - 'a' + 10 : (h >= 'A' && h <= 'F') ? h - 'A' + 10 : -1;
+                        if (v < 0) { break; }
+                        code = static_cast<ushort>(code * 16 + v);
+                    }
+                    if (digits == 4) { result += QChar(code); }
+                }
+                break;
+            default: result += QLatin1Char(data[i]); break; // \" \\ \/
+            }
+            runBegin = i + 1;
+        }
+        if (runBegin < size) { result += QString::fromUtf8(data + runBegin, size - runBegin); }
+        return result;
+    }
+
+    double CJsonStreamReader::parseNumber(const char *data, int size)
+    {
+        // fast path: up to 15 digits without exponent, mantissa and power of 10 are exact doubles,
+        // so the division is correctly rounded like a full conversion
+        static const double powersOf10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+        const char *p = data;
+        const char *end = data + size;
+        const bool negative = (p < end && *p == '-');
+        if (negative) { ++p; }
+        quint64 mantissa = 0;
+        int digits = 0;
+        int fractionDigits = 0;
+        bool fraction = false;
+        for (; p < end && digits < 16; ++p)
+        {
+            const char c = *p;
+            if (c >= '0' && c <= '9')
+            {
+                mantissa = mantissa * 10 + static_cast<quint64>(c - '0');
+                digits++;
+                if (fraction) { fractionDigits++; }
+            }
+            else if (c == '.' && !fraction) { fraction = true; }
+            else { break; }
+        }
+        if (p == end && digits > 0 && digits <= 15)
+        {
+            const double value = static_cast<double>(mantissa) / powersOf10[fractionDigits];
+            return negative ? -value : value;
+        }
+
+        // exponent or many digits
+        bool ok = false;
+        const double value = QByteArray(data, size).toDouble(&ok);
+        return ok ? value : 0.0;
+    }
+
+    CJsonStreamReader::TokenType CJsonStreamReader::error(const QString &message)
+    {
+        m_error = QStringLiteral("%1 at offset %2").arg(message).arg(m_pos);
+        m_type = Invalid;
+        return m_type;
+    }
+
+    bool CJsonStreamReader::scanString()
+    {
+        m_pos++; // opening quote
+        m_tokenBegin = m_pos;
+        while (m_pos < m_size)
+        {
+            const char c = m_data[m_pos];
+            if (c == '"')
+            {
+                m_tokenEnd = m_pos++;
+                return true;
+            }
+            if (c == '\\')
+            {
+                m_hasEscapes = true;
+                m_pos++;
+            }
+            m_pos++;
+        }
+        return false;
+    }
+
+    bool CJsonStreamReader::scanNumber()
+    {
+        const int begin = m_pos;
+        const char first = m_data[m_pos];
+        if (first != '-' && (first < '0' || first > '9')) { return false; }
+        while (m_pos < m_size)
+        {
+            const char c = m_data[m_pos];
+            if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') { m_pos++; }
+            else { break; }
+        }
+        m_tokenBegin = begin;
+        m_tokenEnd = m_pos;
+        return true;
+    }
+
+    bool CJsonStreamReader::scanLiteral(QLatin1String literal)
+    {
+        if (m_size - m_pos < literal.size() || std::memcmp(m_data + m_pos, literal.data(), static_cast<size_t>(literal.size())) != 0) { return false; }
+        m_tokenBegin = m_pos;
+        m_pos += literal.size();
+        m_tokenEnd = m_pos;
+        return true;
+    }
+
+    void CJsonStreamReader::skipWhitespace()
+    {
+        while (m_pos < m_size)
+        {
+            const char c = m_data[m_pos];
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r') { break; }
+            m_pos++;
+        }
+    }
+
+    void CJsonStreamReader::valueDone()
+    {
+        if (m_stack.isEmpty()) { m_topLevelDone = true; }
+        else { m_needComma = true; }
+    }
+} // ns
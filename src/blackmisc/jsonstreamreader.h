@@ -0,0 +1,158 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_JSONSTREAMREADER_H
+#define BLACKMISC_JSONSTREAMREADER_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QByteArray>
+#include <QJsonValue>
+#include <QLatin1String>
+#include <QString>
+#include <QVarLengthArray>
+#include <QtGlobal>
+
+namespace BlackMisc
+{
+    /*!
+     * Pull parser for UTF-8 JSON, reads token by token without building a QJsonDocument.
+     *
+     * Like QXmlStreamReader: readNext() moves to the next token, the token values are read on demand,
+     * so values which are not needed are never converted (nor allocated).
+     * \remark the raw token bytes (tokenData, tokenSize) can be stored as offsets and decoded later
+     */
+    class BLACKMISC_EXPORT CJsonStreamReader
+    {
+    public:
+        //! Token
+        enum TokenType
+        {
+            NoToken,     //!< before first readNext()
+            StartObject, //!< {
+            EndObject,   //!< }
+            StartArray,  //!< [
+            EndArray,    //!< ]
+            Name,        //!< member name, the ':' is consumed
+            String,      //!< string value
+            Number,      //!< number value
+            Bool,        //!< true or false
+            Null,        //!< null
+            EndDocument, //!< complete document read
+            Invalid      //!< syntax error, see errorString()
+        };
+
+        //! Constructor
+        //! \param json UTF-8 JSON, shared (not copied)
+        explicit CJsonStreamReader(const QByteArray &json);
+
+        //! Next token
+        TokenType readNext();
+
+        //! Current token
+        TokenType tokenType() const { return m_type; }
+
+        //! End of document or error
+        bool atEnd() const { return m_type == EndDocument || m_type == Invalid; }
+
+        //! Syntax error?
+        bool hasError() const { return m_type == Invalid; }
+
+        //! Error message
+        const QString &errorString() const { return m_error; }
+
+        //! Nesting level, 1 inside the top level object or array
+        int depth() const { return m_stack.size(); }
+
+        //! Current token is a member name equal to name?
+        //! \remark compares the raw bytes, so the name must not be escaped in the JSON
+        bool isName(QLatin1String name) const;
+
+        //! Decoded string of a Name or String token, raw text of a Number or Bool token, otherwise empty
+        QString stringValue() const;
+
+        //! Value of a Number token, otherwise 0
+        double numberValue() const;
+
+        //! Value of a Bool token
+        bool boolValue() const;
+
+        //! Skip the value starting with the current token, nested objects and arrays are skipped completely
+        //! \remark after a Name the value following the name is skipped
+        //! \return false on syntax errors
+        bool skipValue();
+
+        //! Read the value starting with the current token as QJsonValue, nested objects and arrays completely
+        //! \remark used for values which are only available as QJsonValue, after a Name the value following the name is read
+        //! \return undefined on syntax errors
+        QJsonValue readValue();
+
+        //! Skip the value starting with the current token and return its raw JSON, e.g. to copy it unchanged
+        //! \remark after a Name the value following the name is returned
+        //! \return empty on syntax errors
+        QByteArray rawValue();
+
+        //! Read until the nesting level is at most depth, e.g. to skip the rest of a value after an error
+        //! \return false on syntax errors
+        bool skipToDepth(int depth);
+
+        //! Raw bytes of the current token, strings without the quotes and still escaped
+        //! @{
+        const char *tokenData() const { return m_data + m_tokenBegin; }
+        int tokenSize() const { return m_tokenEnd - m_tokenBegin; }
+        int tokenOffset() const { return m_tokenBegin; }
+        //! @}
+
+        //! Current read position, behind the current token
+        int position() const { return m_pos; }
+
+        //! The JSON data
+        const QByteArray &data() const { return m_json; }
+
+        //! Decode raw (still escaped) string bytes
+        static QString decodeString(const char *data, int size);
+
+        //! Parse raw number bytes, 0 if not a number
+        static double parseNumber(const char *data, int size);
+
+    private:
+        //! Set error and return Invalid
+        TokenType error(const QString &message);
+
+        //! Token scanners, position on the first character
+        //! @{
+        bool scanString();
+        bool scanNumber();
+        bool scanLiteral(QLatin1String literal);
+        //! @}
+
+        //! Skip whitespace
+        void skipWhitespace();
+
+        //! Completed a value in the current container
+        void valueDone();
+
+        QByteArray m_json;
+        const char *m_data = nullptr;
+        int m_size = 0;
+        int m_pos = 0;
+        int m_tokenBegin = 0;
+        int m_tokenEnd = 0;
+        TokenType m_type = NoToken;
+        QVarLengthArray<char, 32> m_stack; //!< open containers, '{' or '['
+        bool m_needComma = false;  //!< a value was completed in the current container
+        bool m_afterName = false;  //!< a member name was read, the value follows
+        bool m_topLevelDone = false;
+        bool m_hasEscapes = false; //!< current string token contains escapes
+        QString m_error;
+    };
+} // ns
+
+#endif // guard
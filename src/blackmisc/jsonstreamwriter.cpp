@@ -0,0 +1,255 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/jsonstreamwriter.h"
+
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QLocale>
+#include <QStringView>
+#include <cmath>
+
+namespace BlackMisc
+{
+    namespace
+    {
+        //! Buffer is written to the device when it exceeds this size
+        constexpr int FlushSize = 1 << 16;
+    }
+
+    CJsonStreamWriter::CJsonStreamWriter(QIODevice *device, QJsonDocument::JsonFormat format) :
+        m_device(device), m_compact(format == QJsonDocument::Compact)
+    {
+        Q_ASSERT_X(device, Q_FUNC_INFO, "Missing device");
+        m_buffer.reserve(FlushSize + 1024);
+    }
+
+    CJsonStreamWriter::~CJsonStreamWriter()
+    {
+        this->flush();
+    }
+
+    void CJsonStreamWriter::beginObject()
+    {
+        this->beginValue();
+        m_buffer += m_compact ? "{" : "{\n";
+        m_hasElements.append(false);
+    }
+
+    void CJsonStreamWriter::endObject()
+    {
+        Q_ASSERT_X(!m_hasElements.isEmpty(), Q_FUNC_INFO, "No open object");
+        const bool hasElements = m_hasElements.back();
+        m_hasElements.removeLast();
+        if (hasElements && !m_compact) { m_buffer += '\n'; }
+        this->indent(m_hasElements.size());
+        m_buffer += '}';
+        if (m_hasElements.isEmpty() && !m_compact) { m_buffer += '\n'; }
+        this->maybeFlush();
+    }
+
+    void CJsonStreamWriter::beginArray()
+    {
+        this->beginValue();
+        m_buffer += m_compact ? "[" : "[\n";
+        m_hasElements.append(false);
+    }
+
+    void CJsonStreamWriter::endArray()
+    {
+        Q_ASSERT_X(!m_hasElements.isEmpty(), Q_FUNC_INFO, "No open array");
+        const bool hasElements = m_hasElements.back();
+        m_hasElements.removeLast();
+        if (hasElements && !m_compact) { m_buffer += '\n'; }
+        this->indent(m_hasElements.size());
+        m_buffer += ']';
+        if (m_hasElements.isEmpty() && !m_compact) { m_buffer += '\n'; }
+        this->maybeFlush();
+    }
+
+    void CJsonStreamWriter::writeName(QLatin1String name)
+    {
+        this->beginValue();
+        m_buffer += '"';
+        m_buffer.append(name.data(), name.size()); // metaclass names need no escaping
+        m_buffer += m_compact ? "\":" : "\": ";
+        m_afterName = true;
+    }
+
+    void CJsonStreamWriter::writeName(const QString &name)
+    {
+        this->beginValue();
+        this->appendString(name);
+        m_buffer += m_compact ? ":" : ": ";
+        m_afterName = true;
+    }
+
+    void CJsonStreamWriter::writeString(const QString &value)
+    {
+        this->beginValue();
+        this->appendString(value);
+        this->maybeFlush();
+    }
+
+    void CJsonStreamWriter::writeNumber(double value)
+    {
+        this->beginValue();
+        // like QJsonDocument, see RFC4627 section 2.4 for not finite values
+        if (std::isfinite(value)) { m_buffer += QByteArray::number(value, 'g', QLocale::FloatingPointShortest); }
+        else { m_buffer += "null"; }
+        this->maybeFlush();
+    }
+
+    void CJsonStreamWriter::writeInteger(qint64 value)
+    {
+        this->beginValue();
+        char digits[24];
+        int count = 0;
+        quint64 v = value < 0 ? 0 - static_cast<quint64>(value) : static_cast<quint64>(value);
+        do
+        {
+            digits[count++] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        }
+        while (v);
+        if (value < 0) { m_buffer += '-'; }
+        while (count) { m_buffer += digits[--count]; }
+        this->maybeFlush();
+    }
+
+    void CJsonStreamWriter::writeBool(bool value)
+    {
+        this->beginValue();
+        m_buffer += value ? "true" : "false";
+        this->maybeFlush();
+    }
+
+    void CJsonStreamWriter::writeNull()
+    {
+        this->beginValue();
+        m_buffer += "null";
+        this->maybeFlush();
+    }
+
+    void CJsonStreamWriter::writeValue(const QJsonValue &value)
+    {
+        switch (value.type())
+        {
+        case QJsonValue::Bool: this->writeBool(value.toBool()); break;
+        case QJsonValue::String: this->writeString(value.toString()); break;
+        case QJsonValue::Double:
+            {
+                // integers are stored as double in QJsonValue
+                const double d = value.toDouble();
+                if (std::abs(d) <= 9007199254740992.0 && std::floor(d) == d) { this->writeInteger(static_cast<qint64>(d)); }
+                else { this->writeNumber(d); }
+            }
+            break;
+        case QJsonValue::Array:
+            {
+                const QJsonArray array = value.toArray();
+                this->beginArray();
+                for (const QJsonValue &element : array) { this->writeValue(element); }
+                this->endArray();
+            }
+            break;
+        case QJsonValue::Object:
+            {
+                const QJsonObject object = value.toObject();
+                this->beginObject();
+                for (auto it = object.constBegin(); it != object.constEnd(); ++it)
+                {
+                    this->writeName(it.key());
+                    this->writeValue(it.value());
+                }
+                this->endObject();
+            }
+            break;
+        default: this->writeNull(); break;
+        }
+    }
+
+    void CJsonStreamWriter::writeRawValue(const QByteArray &json)
+    {
+        this->beginValue();
+        m_buffer += json;
+        this->maybeFlush();
+    }
+
+    bool CJsonStreamWriter::flush()
+    {
+        if (m_buffer.isEmpty()) { return !m_error; }
+        if (!m_error && m_device->write(m_buffer) != m_buffer.size()) { m_error = true; }
+        m_written += m_buffer.size();
+        m_buffer.resize(0); // keeps the reserved capacity
+        return !m_error;
+    }
+
+    void CJsonStreamWriter::beginValue()
+    {
+        if (m_afterName) { m_afterName = false; return; }
+        if (m_hasElements.isEmpty()) { return; } // top level
+        if (m_hasElements.back()) { m_buffer += m_compact ? "," : ",\n"; }
+        m_hasElements.back() = true;
+        this->indent(m_hasElements.size());
+    }
+
+    void CJsonStreamWriter::maybeFlush()
+    {
+        if (m_buffer.size() >= FlushSize) { this->flush(); }
+    }
+
+    void CJsonStreamWriter::indent(int depth)
+    {
+        if (!m_compact && depth > 0) { m_buffer.append(4 * depth, ' '); }
+    }
+
+    void CJsonStreamWriter::appendString(const QString &value)
+    {
+        // escaped like QJsonDocument
+        static const char hexDigits[] = "0123456789abcdef";
+        m_buffer += '"';
+        const QChar *data = value.constData();
+        const int size = value.size();
+        int i = 0;
+        while (i < size)
+        {
+            const ushort u = data[i].unicode();
+            if (u >= 0x80)
+            {
+                int end = i + 1;
+                while (end < size && data[end].unicode() >= 0x80) { ++end; }
+                m_buffer += QStringView(data + i, end - i).toUtf8();
+                i = end;
+                continue;
+            }
+            switch (u)
+            {
+            case '"':  m_buffer += "\\\""; break;
+            case '\\': m_buffer += "\\\\"; break;
+            case '\b': m_buffer += "\\b"; break;
+            case '\f': m_buffer += "\\f"; break;
+            case '\n': m_buffer += "\\n"; break;
+            case '\r': m_buffer += "\\r"; break;
+            case '\t': m_buffer += "\\t"; break;
+            default:
+                if (u < 0x20)
+                {
+                    m_buffer += "\\u00";
+                    m_buffer += hexDigits[u >> 4];
+                    m_buffer += hexDigits[u & 0xf];
+                }
+                else { m_buffer += static_cast<char>(u); }
+                break;
+            }
+            ++i;
+        }
+        m_buffer += '"';
+    }
+} // ns
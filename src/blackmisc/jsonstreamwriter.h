@@ -0,0 +1,114 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_JSONSTREAMWRITER_H
+#define BLACKMISC_JSONSTREAMWRITER_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QByteArray>
+#include <QJsonDocument>
+#include <QJsonValue>
+#include <QLatin1String>
+#include <QString>
+#include <QVarLengthArray>
+#include <QtGlobal>
+
+class QIODevice;
+
+namespace BlackMisc
+{
+    /*!
+     * Writes UTF-8 JSON token by token to a QIODevice, without building a QJsonDocument.
+     *
+     * Counterpart of CJsonStreamReader. The output is laid out like QJsonDocument::toJson,
+     * but object members are written in the order they are written, not sorted by name.
+     * The output is buffered and written to the device in large blocks.
+     */
+    class BLACKMISC_EXPORT CJsonStreamWriter
+    {
+    public:
+        //! Constructor
+        //! \param device opened for writing, not owned
+        //! \param format indented like QJsonDocument::toJson() or compact
+        explicit CJsonStreamWriter(QIODevice *device, QJsonDocument::JsonFormat format = QJsonDocument::Indented);
+
+        //! Destructor, flushes the buffer
+        ~CJsonStreamWriter();
+
+        //! Not copyable
+        CJsonStreamWriter(const CJsonStreamWriter &) = delete;
+
+        //! Not copyable
+        CJsonStreamWriter &operator =(const CJsonStreamWriter &) = delete;
+
+        //! Containers
+        //! @{
+        void beginObject();
+        void endObject();
+        void beginArray();
+        void endArray();
+        //! @}
+
+        //! Member name, followed by the value
+        //! @{
+        void writeName(QLatin1String name);
+        void writeName(const QString &name);
+        //! @}
+
+        //! Values
+        //! @{
+        void writeString(const QString &value);
+        void writeNumber(double value);
+        void writeInteger(qint64 value);
+        void writeBool(bool value);
+        void writeNull();
+        //! @}
+
+        //! Write a JSON DOM value, for values which are only available as QJsonValue
+        void writeValue(const QJsonValue &value);
+
+        //! Write an already encoded JSON value as it is, e.g. a value copied from CJsonStreamReader::rawValue
+        void writeRawValue(const QByteArray &json);
+
+        //! Write the buffer to the device
+        //! \return false if writing failed
+        bool flush();
+
+        //! Writing to the device failed?
+        bool hasError() const { return m_error; }
+
+        //! Bytes written, including the buffer
+        qint64 bytesWritten() const { return m_written + m_buffer.size(); }
+
+    private:
+        //! Separator and indentation before a value or member name
+        void beginValue();
+
+        //! Flush if the buffer is full
+        void maybeFlush();
+
+        //! Append indentation of the current depth
+        void indent(int depth);
+
+        //! Append escaped string with quotes
+        void appendString(const QString &value);
+
+        QIODevice *m_device = nullptr;
+        QByteArray m_buffer;
+        qint64 m_written = 0;
+        bool m_compact = false;
+        bool m_afterName = false;
+        bool m_error = false;
+        QVarLengthArray<bool, 32> m_hasElements; //!< per open container, elements written
+    };
+} // ns
+
+#endif // guard
@@ -0,0 +1,134 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_LOCKFREERINGBUFFER_H
+#define BLACKMISC_LOCKFREERINGBUFFER_H
+
+#include <QtGlobal>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+// http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+
+namespace BlackMisc
+{
+    /*!
+     * Bounded lock-free FIFO ring buffer, any number of producer and consumer threads.
+     *
+     * Each cell has a sequence number which tells whether it can be written (sequence == position)
+     * or read (sequence == position + 1), so push and pop only need one compare and swap on the position.
+     * \remark tryPush does not block and fails if the buffer is full, which lets the caller decide what to drop
+     */
+    template <typename T>
+    class CLockFreeRingBuffer
+    {
+    public:
+        //! Constructor
+        //! \param capacity rounded up to a power of 2
+        explicit CLockFreeRingBuffer(int capacity) : m_capacity(roundUpToPowerOf2(capacity)), m_mask(m_capacity - 1), m_cells(new Cell[m_capacity])
+        {
+            for (size_t i = 0; i < m_capacity; ++i) { m_cells[i].sequence.store(i, std::memory_order_relaxed); }
+        }
+
+        //! Not copyable
+        //! @{
+        CLockFreeRingBuffer(const CLockFreeRingBuffer &) = delete;
+        CLockFreeRingBuffer &operator =(const CLockFreeRingBuffer &) = delete;
+        //! @}
+
+        //! Append a value, false if the buffer is full
+        //! \threadsafe
+        template <typename U>
+        bool tryPush(U &&value)
+        {
+            size_t pos = m_pushPos.load(std::memory_order_relaxed);
+            Cell *cell = nullptr;
+            for (;;)
+            {
+                cell = &m_cells[pos & m_mask];
+                const size_t seq = cell->sequence.load(std::memory_order_acquire);
+                const qptrdiff diff = static_cast<qptrdiff>(seq) - static_cast<qptrdiff>(pos);
+                if (diff == 0)
+                {
+                    if (m_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+                }
+                else if (diff < 0) { return false; } // full
+                else { pos = m_pushPos.load(std::memory_order_relaxed); }
+            }
+            cell->value = std::forward<U>(value);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        //! Remove the oldest value, false if the buffer is empty
+        //! \threadsafe
+        bool tryPop(T &value)
+        {
+            size_t pos = m_popPos.load(std::memory_order_relaxed);
+            Cell *cell = nullptr;
+            for (;;)
+            {
+                cell = &m_cells[pos & m_mask];
+                const size_t seq = cell->sequence.load(std::memory_order_acquire);
+                const qptrdiff diff = static_cast<qptrdiff>(seq) - static_cast<qptrdiff>(pos + 1);
+                if (diff == 0)
+                {
+                    if (m_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+                }
+                else if (diff < 0) { return false; } // empty
+                else { pos = m_popPos.load(std::memory_order_relaxed); }
+            }
+            value = std::move(cell->value);
+            cell->value = T();
+            cell->sequence.store(pos + m_capacity, std::memory_order_release);
+            return true;
+        }
+
+        //! Number of values, only a snapshot while other threads push or pop
+        //! \threadsafe
+        int sizeApprox() const
+        {
+            const size_t push = m_pushPos.load(std::memory_order_acquire);
+            const size_t pop = m_popPos.load(std::memory_order_acquire);
+            return push > pop ? static_cast<int>(push - pop) : 0;
+        }
+
+        //! Empty, only a snapshot while other threads push or pop
+        //! \threadsafe
+        bool isEmpty() const { return this->sizeApprox() == 0; }
+
+        //! Capacity
+        int capacity() const { return static_cast<int>(m_capacity); }
+
+    private:
+        //! Buffer cell
+        struct Cell
+        {
+            std::atomic<size_t> sequence { 0 };
+            T value {};
+        };
+
+        static size_t roundUpToPowerOf2(int capacity)
+        {
+            size_t size = 2;
+            while (size < static_cast<size_t>(qMax(capacity, 2))) { size *= 2; }
+            return size;
+        }
+
+        const size_t m_capacity;
+        const size_t m_mask;
+        std::unique_ptr<Cell[]> m_cells;
+        alignas(64) std::atomic<size_t> m_pushPos { 0 }; //!< own cache line, producers
+        alignas(64) std::atomic<size_t> m_popPos { 0 };  //!< own cache line, consumers
+    };
+} // ns
+
+#endif // guard
@@ -222,6 +222,13 @@ namespace BlackMisc
             return cat;
         }
 
+        //! Performance, e.g. tracing of hot paths
+        static const QString &performance()
+        {
+            static const QString cat { "swift.performance" };
+            return cat;
+        }
+
         //! Startup of application
         static const QString &startup()
         {
@@ -314,6 +321,7 @@ namespace BlackMisc
                 modelSetCache(),
                 modelGui(),
                 network(),
+                performance(),
                 plugin(),
                 swiftDbWebservice(),
                 swiftCore(),
@@ -0,0 +1,61 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/math/runningstatistics.h"
+
+#include <QtGlobal>
+#include <cmath>
+
+namespace BlackMisc::Math
+{
+    void CRunningStatistics::add(double value)
+    {
+        if (m_count < 1)
+        {
+            m_min = value;
+            m_max = value;
+        }
+        else
+        {
+            if (value < m_min) { m_min = value; }
+            if (value > m_max) { m_max = value; }
+        }
+
+        m_count++;
+        const double delta = value - m_mean;
+        m_mean += delta / m_count;
+        m_m2 += delta * (value - m_mean);
+    }
+
+    bool CRunningStatistics::remove(double value)
+    {
+        Q_ASSERT_X(m_count > 0, Q_FUNC_INFO, "No values");
+        if (m_count < 2)
+        {
+            this->clear();
+            return false;
+        }
+
+        const double delta = value - m_mean;
+        m_mean -= delta / (m_count - 1);
+        m_m2 -= delta * (value - m_mean);
+        if (m_m2 < 0.0) { m_m2 = 0.0; } // rounding
+        m_count--;
+        return value <= m_min || value >= m_max;
+    }
+
+    double CRunningStatistics::variance() const
+    {
+        return m_count < 1 ? 0.0 : m_m2 / m_count;
+    }
+
+    double CRunningStatistics::standardDeviation() const
+    {
+        return std::sqrt(this->variance());
+    }
+} // ns
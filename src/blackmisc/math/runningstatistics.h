@@ -0,0 +1,76 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_MATH_RUNNINGSTATISTICS_H
+#define BLACKMISC_MATH_RUNNINGSTATISTICS_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QPair>
+
+namespace BlackMisc::Math
+{
+    /*!
+     * Mean, standard deviation, min and max calculated in a single pass (Welford's algorithm),
+     * without storing the values.
+     *
+     * Values can be removed again, this is used for a sliding window of values.
+     * \remark standard deviation is the population standard deviation as in CMathUtils::standardDeviationAndMean
+     */
+    class BLACKMISC_EXPORT CRunningStatistics
+    {
+    public:
+        //! Add a value
+        void add(double value);
+
+        //! Remove a value which has been added before
+        //! \return true if the value was the min or max value, then min/max need to be set by CRunningStatistics::setMinMax
+        bool remove(double value);
+
+        //! Set min and max, after a min/max value has been removed
+        void setMinMax(double minValue, double maxValue) { m_min = minValue; m_max = maxValue; }
+
+        //! Number of values
+        int count() const { return m_count; }
+
+        //! Any values?
+        bool isEmpty() const { return m_count < 1; }
+
+        //! Mean value, 0 if empty
+        double mean() const { return m_mean; }
+
+        //! Variance (population)
+        double variance() const;
+
+        //! Standard deviation (population)
+        double standardDeviation() const;
+
+        //! Standard deviation and mean as by CMathUtils::standardDeviationAndMean
+        QPair<double, double> standardDeviationAndMean() const { return { this->standardDeviation(), m_mean }; }
+
+        //! Min value, 0 if empty
+        double minValue() const { return m_min; }
+
+        //! Max value, 0 if empty
+        double maxValue() const { return m_max; }
+
+        //! Remove all values
+        void clear() { *this = CRunningStatistics(); }
+
+    private:
+        int    m_count = 0;
+        double m_mean  = 0.0;
+        double m_m2    = 0.0; //!< sum of the squared differences from the mean
+        double m_min   = 0.0;
+        double m_max   = 0.0;
+    };
+} // ns
+
+#endif // guard
@@ -14,6 +14,9 @@
 #include "blackmisc/dictionary.h"
 #include "blackmisc/sequence.h"
 
+#include <array>
+#include <type_traits>
+
 namespace BlackMisc
 {
     /*!
@@ -52,6 +55,18 @@ namespace BlackMisc
     template <typename... Ts>
     struct CMemoHelper
     {
+        //! Indexes of the memoized members of one object, in the order of Ts, -1 if not memoized
+        using CIndexes = std::array<int, sizeof...(Ts)>;
+
+        //! Position of T in Ts, -1 if T is not memoized
+        template <typename T>
+        static constexpr int indexOf()
+        {
+            constexpr bool same[] = { std::is_same_v<T, Ts>... };
+            for (int i = 0; i < static_cast<int>(sizeof...(Ts)); ++i) { if (same[i]) { return i; } }
+            return -1;
+        }
+
         //! Memoizer for Ts. Other types are passed through.
         class CMemoizer : private CMemoTable<Ts>...
         {
@@ -96,6 +111,18 @@ namespace BlackMisc
                 }
                 else { return std::ref(member); }
             }
+
+            //! Assign member from the value at the given index in the flat list T table, -1 leaves member unchanged
+            //! \return false if index is out of range
+            template <typename T>
+            bool unmemoize(T &member, int index) const
+            {
+                const CSequence<T> &list = *this;
+                if (index < 0) { return true; }
+                if (index >= list.size()) { return false; }
+                member = list[index];
+                return true;
+            }
         };
     };
 }
@@ -12,6 +12,7 @@
 #define BLACKMISC_MIXIN_MIXINJSON_H
 
 #include "blackmisc/json.h"
+#include "blackmisc/jsonstream.h"
 #include "blackmisc/inheritancetraits.h"
 
 #include <QByteArray>
@@ -104,6 +105,23 @@ namespace BlackMisc
             //! Assign from JSON object string
             void convertFromJson(const QString &jsonString, bool acceptCacheFormat = false);
 
+            //! Write as JSON object member by member, without building the QJsonObject
+            //! \remark members are written in metaclass order, followed by the members of the base class
+            void writeJson(CJsonStreamWriter &writer) const;
+
+            //! Assign from JSON read member by member, the reader is on the first token of the object
+            void readJson(CJsonStreamReader &reader);
+
+            //! \private Write the members, also used by derived classes
+            void writeJsonMembers(CJsonStreamWriter &writer) const;
+
+            //! \private Read the member named by the current token, also used by derived classes
+            //! \return false if there is no such member
+            bool readJsonMember(CJsonStreamReader &reader);
+
+            //! \private Assign the members which were not read member by member, e.g. of a base class with its own JSON
+            void readJsonRemainder(const QJsonObject &json);
+
             //! Get object from QJsonObject
             template<class DerivedObj = Derived>
             static DerivedObj fromJson(const QJsonObject &json);
@@ -126,6 +144,16 @@ namespace BlackMisc
             static void baseConvertFromJson(void *, const QJsonObject &);
             static QJsonObject baseToJson(const CEmpty *);
             static void baseConvertFromJson(CEmpty *, const QJsonObject &);
+
+            template <typename T> static void baseWriteJsonMembers(const T *base, CJsonStreamWriter &writer);
+            template <typename T> static bool baseReadJsonMember(T *base, CJsonStreamReader &reader);
+            template <typename T> static void baseReadJsonRemainder(T *base, const QJsonObject &json);
+            static void baseWriteJsonMembers(const void *, CJsonStreamWriter &);
+            static bool baseReadJsonMember(void *, CJsonStreamReader &);
+            static void baseReadJsonRemainder(void *, const QJsonObject &);
+            static void baseWriteJsonMembers(const CEmpty *, CJsonStreamWriter &);
+            static bool baseReadJsonMember(CEmpty *, CJsonStreamReader &);
+            static void baseReadJsonRemainder(CEmpty *, const QJsonObject &);
         };
 
         template <class Derived>
@@ -183,6 +211,74 @@ namespace BlackMisc
             convertFromJson(jsonObject);
         }
 
+        template <class Derived>
+        void JsonByMetaClass<Derived>::writeJson(CJsonStreamWriter &writer) const
+        {
+            writer.beginObject();
+            this->writeJsonMembers(writer);
+            writer.endObject();
+        }
+
+        template <class Derived>
+        void JsonByMetaClass<Derived>::readJson(CJsonStreamReader &reader)
+        {
+            if (reader.tokenType() == CJsonStreamReader::Name) { reader.readNext(); }
+            if (reader.tokenType() != CJsonStreamReader::StartObject)
+            {
+                // like convertFromJson with an empty object
+                reader.skipValue();
+                this->readJsonRemainder({});
+                return;
+            }
+            QJsonObject remainder;
+            while (reader.readNext() == CJsonStreamReader::Name)
+            {
+                if (this->readJsonMember(reader)) { continue; }
+                const QString name = reader.stringValue();
+                remainder.insert(name, reader.readValue());
+            }
+            this->readJsonRemainder(remainder);
+        }
+
+        template <class Derived>
+        void JsonByMetaClass<Derived>::writeJsonMembers(CJsonStreamWriter &writer) const
+        {
+            introspect<Derived>().forEachMember([ &, this ](auto member)
+            {
+                if constexpr (!decltype(member)::has(MetaFlags<DisabledForJson>()))
+                {
+                    writer.writeName(member.latin1Name());
+                    Json::writeToStream(writer, member.in(*this->derived()));
+                }
+            });
+            baseWriteJsonMembers(static_cast<const TBaseOfT<Derived> *>(derived()), writer);
+        }
+
+        template <class Derived>
+        bool JsonByMetaClass<Derived>::readJsonMember(CJsonStreamReader &reader)
+        {
+            bool found = false;
+            introspect<Derived>().forEachMember([ &, this ](auto member)
+            {
+                if constexpr (!decltype(member)::has(MetaFlags<DisabledForJson>()))
+                {
+                    if (found || !reader.isName(member.latin1Name())) { return; }
+                    found = true;
+                    CJsonScope scope(member.latin1Name());
+                    Q_UNUSED(scope);
+                    reader.readNext();
+                    Json::readFromStream(reader, member.in(*this->derived()));
+                }
+            });
+            return found || baseReadJsonMember(static_cast<TBaseOfT<Derived> *>(derived()), reader);
+        }
+
+        template <class Derived>
+        void JsonByMetaClass<Derived>::readJsonRemainder(const QJsonObject &json)
+        {
+            baseReadJsonRemainder(static_cast<TBaseOfT<Derived> *>(derived()), json);
+        }
+
         template <class Derived>
         template <class DerivedObj>
         DerivedObj JsonByMetaClass<Derived>::fromJson(const QJsonObject &json)
@@ -249,6 +345,66 @@ namespace BlackMisc
         template <class Derived>
         void JsonByMetaClass<Derived>::baseConvertFromJson(CEmpty *, const QJsonObject &) {}
 
+        template <class Derived>
+        template <typename T>
+        void JsonByMetaClass<Derived>::baseWriteJsonMembers(const T *base, CJsonStreamWriter &writer)
+        {
+            using Owner = typename Json::Private::TToJsonOwner<T>::type;
+            if constexpr (std::is_same_v<Owner, JsonByMetaClass<T>>) { static_cast<const Owner *>(base)->writeJsonMembers(writer); }
+            else
+            {
+                // base class with its own JSON
+                const QJsonObject json = base->toJson();
+                for (auto it = json.constBegin(); it != json.constEnd(); ++it)
+                {
+                    writer.writeName(it.key());
+                    writer.writeValue(it.value());
+                }
+            }
+        }
+
+        template <class Derived>
+        template <typename T>
+        bool JsonByMetaClass<Derived>::baseReadJsonMember(T *base, CJsonStreamReader &reader)
+        {
+            using Owner = typename Json::Private::TConvertFromJsonOwner<T>::type;
+            if constexpr (std::is_same_v<Owner, JsonByMetaClass<T>>) { return static_cast<Owner *>(base)->readJsonMember(reader); }
+            else
+            {
+                // base class with its own JSON, see baseReadJsonRemainder
+                Q_UNUSED(base)
+                Q_UNUSED(reader)
+                return false;
+            }
+        }
+
+        template <class Derived>
+        template <typename T>
+        void JsonByMetaClass<Derived>::baseReadJsonRemainder(T *base, const QJsonObject &json)
+        {
+            using Owner = typename Json::Private::TConvertFromJsonOwner<T>::type;
+            if constexpr (std::is_same_v<Owner, JsonByMetaClass<T>>) { static_cast<Owner *>(base)->readJsonRemainder(json); }
+            else { base->convertFromJson(json); }
+        }
+
+        template <class Derived>
+        void JsonByMetaClass<Derived>::baseWriteJsonMembers(const void *, CJsonStreamWriter &) {}
+
+        template <class Derived>
+        bool JsonByMetaClass<Derived>::baseReadJsonMember(void *, CJsonStreamReader &) { return false; }
+
+        template <class Derived>
+        void JsonByMetaClass<Derived>::baseReadJsonRemainder(void *, const QJsonObject &) {}
+
+        template <class Derived>
+        void JsonByMetaClass<Derived>::baseWriteJsonMembers(const CEmpty *, CJsonStreamWriter &) {}
+
+        template <class Derived>
+        bool JsonByMetaClass<Derived>::baseReadJsonMember(CEmpty *, CJsonStreamReader &) { return false; }
+
+        template <class Derived>
+        void JsonByMetaClass<Derived>::baseReadJsonRemainder(CEmpty *, const QJsonObject &) {}
+
         /*!
          * When a derived class and a base class both inherit from Mixin::JsonByTuple,
          * the derived class uses this macro to disambiguate the inherited members.
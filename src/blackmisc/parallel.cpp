@@ -0,0 +1,86 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/parallel.h"
+
+#include "blackmisc/taskpool.h"
+
+#include <QSemaphore>
+#include <QString>
+#include <QThread>
+#include <QtGlobal>
+#include <atomic>
+#include <memory>
+
+namespace BlackMisc
+{
+    namespace Private
+    {
+        //! State of one CParallel::forEachChunk call, shared with the pool tasks
+        struct CChunkState
+        {
+            //! Constructor
+            CChunkState(const CParallel::ChunkFunction &function, int chunks) : function(function), claimed(new std::atomic_bool[chunks]()) {}
+
+            //! Claim a chunk, only one thread runs it
+            bool claim(int chunk) { return !claimed[chunk].exchange(true); }
+
+            const CParallel::ChunkFunction &function; //!< only used for claimed chunks, the caller is waiting then
+            std::unique_ptr<std::atomic_bool[]> claimed;
+            QSemaphore done;
+        };
+    }
+
+    int CParallel::maxThreads()
+    {
+        return qBound(1, QThread::idealThreadCount(), CTaskPool::instance().maxThreadCount());
+    }
+
+    int CParallel::chunkCount(int count, int minChunkSize)
+    {
+        if (count < 1) { return 0; }
+        const int byCount = count / qMax(1, minChunkSize);
+        return qBound(1, byCount, maxThreads());
+    }
+
+    void CParallel::forEachChunk(int count, int minChunkSize, const ChunkFunction &function)
+    {
+        const int chunks = chunkCount(count, minChunkSize);
+        if (chunks < 1) { return; }
+        if (chunks == 1)
+        {
+            function(0, count, 0);
+            return;
+        }
+
+        // chunk sizes differ by max. 1
+        const int chunkSize = count / chunks;
+        const int remainder = count % chunks;
+        const auto chunkBegin = [ = ](int chunk) { return chunk * chunkSize + qMin(chunk, remainder); };
+
+        // chunks run on the shared task pool, so concurrent and nested calls do not oversubscribe the CPU
+        const auto state = std::make_shared<Private::CChunkState>(function, chunks);
+        const auto runChunk = [ = ](int chunk)
+        {
+            if (!state->claim(chunk)) { return; }
+            state->function(chunkBegin(chunk), chunkBegin(chunk + 1), chunk);
+            state->done.release();
+        };
+        CTaskPool &pool = CTaskPool::instance();
+        static const QString name("CParallel::forEachChunk");
+        for (int chunk = 1; chunk < chunks; chunk++)
+        {
+            pool.submit(CTaskPool::newTaskId(), nullptr, name, CTaskPool::HighPriority, [ = ] { runChunk(chunk); }, {});
+        }
+
+        // first chunk in this thread, then the chunks not yet started by the pool
+        // so the caller never waits for queued chunks, even if all pool threads are busy
+        for (int chunk = 0; chunk < chunks; chunk++) { runChunk(chunk); }
+        state->done.acquire(chunks);
+    }
+} // ns
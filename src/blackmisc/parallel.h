@@ -0,0 +1,62 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_PARALLEL_H
+#define BLACKMISC_PARALLEL_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QVector>
+#include <functional>
+
+namespace BlackMisc
+{
+    /*!
+     * Data parallel processing of index ranges in contiguous chunks.
+     * \remark Chunks run on the shared CTaskPool. The calling thread processes a chunk itself and runs
+     *         chunks not yet started by the pool, so nested calls do not deadlock.
+     * \remark Chunks are in index order, so chunk results can be merged in order to get stable results.
+     */
+    class BLACKMISC_EXPORT CParallel
+    {
+    public:
+        //! Processes the indexes [begin, end), chunk is the 0 based chunk number
+        using ChunkFunction = std::function<void(int begin, int end, int chunk)>;
+
+        //! Number of chunks used for count elements, at least minChunkSize elements per chunk
+        static int chunkCount(int count, int minChunkSize);
+
+        //! Process count elements in chunks, blocks until all chunks are done
+        //! \remark runs inline if only one chunk is needed
+        static void forEachChunk(int count, int minChunkSize, const ChunkFunction &function);
+
+        //! Map each chunk to a result, results are in chunk order
+        template <class R, class F>
+        static QVector<R> mapChunks(int count, int minChunkSize, F function)
+        {
+            QVector<R> results(chunkCount(count, minChunkSize));
+            R *data = results.data(); // detached once, no detach checks in the workers
+            forEachChunk(count, minChunkSize, [&](int begin, int end, int chunk)
+            {
+                data[chunk] = function(begin, end);
+            });
+            return results;
+        }
+
+        //! Number of threads used
+        static int maxThreads();
+
+    private:
+        //! Not instantiable
+        CParallel() = delete;
+    };
+} // ns
+
+#endif // guard
@@ -14,11 +14,14 @@ using namespace BlackMisc::Math;
 
 namespace BlackMisc::PhysicalQuantities
 {
-    double CMeasurementUnit::convertFrom(double value, const CMeasurementUnit &unit) const
+    double CMeasurementUnit::convertFromOtherUnit(double value, const CMeasurementUnit &unit) const
     {
         if (this->isNull() || unit.isNull()) return 0;
         if (m_data->m_toDefault == unit.m_data->m_toDefault && m_data->m_fromDefault == unit.m_data->m_fromDefault) return value;
-        return m_data->m_fromDefault(unit.m_data->m_toDefault(value));
+
+        // no indirect calls for the default units
+        const double defaultValue = unit.m_data->m_isIdentity ? value : unit.m_data->m_toDefault(value);
+        return m_data->m_isIdentity ? defaultValue : m_data->m_fromDefault(defaultValue);
     }
 
     QString CMeasurementUnit::makeRoundedQStringWithUnit(double value, int digits, bool withGroupSeparator, bool i18n) const
@@ -31,6 +31,7 @@
 #include <cmath>
 #include <cstddef>
 #include <string>
+#include <type_traits>
 
 namespace BlackMisc::PhysicalQuantities
 {
@@ -208,7 +209,8 @@ namespace BlackMisc::PhysicalQuantities
             //! Construct a unit with custom conversion
             template <class Converter>
             constexpr Data(QLatin1String name, QLatin1String symbol, Converter, int displayDigits = 2, double epsilon = 1e-9)
-                : m_name(name), m_symbol(symbol), m_epsilon(epsilon), m_displayDigits(displayDigits), m_toDefault(Converter::toDefault), m_fromDefault(Converter::fromDefault)
+                : m_name(name), m_symbol(symbol), m_epsilon(epsilon), m_displayDigits(displayDigits), m_toDefault(Converter::toDefault), m_fromDefault(Converter::fromDefault),
+                  m_isIdentity(std::is_same_v<Converter, IdentityConverter>)
             {}
 
             //! Construct a null unit
@@ -222,6 +224,7 @@ namespace BlackMisc::PhysicalQuantities
             int m_displayDigits = 0;  //!< standard rounding for string conversions
             ConverterFunction m_toDefault = nullptr;   //!< convert from this unit to default unit
             ConverterFunction m_fromDefault = nullptr; //!< convert to this unit from default unit
+            bool m_isIdentity = false; //!< identity conversion, same scale as the default unit
         };
 
         //! Constant-initialize QLatin1String without using strlen.
@@ -247,6 +250,9 @@ namespace BlackMisc::PhysicalQuantities
         CMeasurementUnit &operator =(const CMeasurementUnit &) = default;
 
     private:
+        //! Convert from a unit with different data
+        double convertFromOtherUnit(double value, const CMeasurementUnit &unit) const;
+
         const Data *m_data = (static_cast<void>(throw std::logic_error("Uninitialized pimpl")), nullptr);
 
     public:
@@ -287,7 +293,7 @@ namespace BlackMisc::PhysicalQuantities
         //! Equal operator ==
         friend bool operator == (const CMeasurementUnit &a, const CMeasurementUnit &b)
         {
-            if (&a == &b) return true;
+            if (&a == &b || a.m_data == b.m_data) return true;
             return a.m_data->m_name == b.m_data->m_name;
         }
 
@@ -352,7 +358,18 @@ namespace BlackMisc::PhysicalQuantities
         }
 
         //! Convert from other unit to this unit.
-        double convertFrom(double value, const CMeasurementUnit &unit) const;
+        //! \remark same units and default units are not converted, this is used in hot paths
+        double convertFrom(double value, const CMeasurementUnit &unit) const
+        {
+            if (m_data == unit.m_data) { return this->isNull() ? 0.0 : value; }
+            return this->convertFromOtherUnit(value, unit);
+        }
+
+        //! Same scale as the default unit, conversions to and from the default unit are not needed
+        bool hasIdentityConversion() const
+        {
+            return m_data->m_isIdentity;
+        }
 
         //! Is given value <= epsilon?
         bool isEpsilon(double value) const
@@ -252,13 +252,13 @@ namespace BlackMisc::PhysicalQuantities
     template <class MU, class PQ>
     bool CPhysicalQuantity<MU, PQ>::lessThan(const CPhysicalQuantity<MU, PQ> &other) const
     {
-        if (*this == other) return false;
+        // any value is less than NULL, so NULL values are sorted last
+        if (this->isNull() || other.isNull()) { return !this->isNull() && other.isNull(); }
 
-        if (isNull() < other.isNull()) { return true; }
-        if (isNull() > other.isNull()) { return false; }
-        if (isNull() && other.isNull()) { return false; }
-
-        return (m_value < other.value(m_unit));
+        // only one conversion, none for the same unit
+        const double otherValue = other.value(m_unit);
+        if (std::abs(m_value - otherValue) <= m_unit.getEpsilon()) { return false; }
+        return m_value < otherValue;
     }
 
     template <class MU, class PQ>
@@ -388,13 +388,6 @@ namespace BlackMisc::PhysicalQuantities
         return QString::number(v, 'f', digits);
     }
 
-    template <class MU, class PQ>
-    double CPhysicalQuantity<MU, PQ>::value(MU unit) const
-    {
-        Q_ASSERT_X(!unit.isNull(), Q_FUNC_INFO, "Cannot convert to null");
-        return unit.convertFrom(m_value, m_unit);
-    }
-
     template <class MU, class PQ>
     QString CPhysicalQuantity<MU, PQ>::convertToQString(bool i18n) const
     {
@@ -150,7 +150,12 @@ namespace BlackMisc::PhysicalQuantities
         void setNull();
 
         //! Value in given unit
-        double value(MU unit) const;
+        //! \remark inline, as no conversion is needed if the unit is the current unit
+        double value(MU unit) const
+        {
+            Q_ASSERT_X(!unit.isNull(), Q_FUNC_INFO, "Cannot convert to null");
+            return unit.convertFrom(m_value, m_unit);
+        }
 
         //! Value in current unit
         double value() const;
@@ -13,6 +13,9 @@
 
 #if defined(Q_OS_MACOS)
 #include <libproc.h>
+#include <mach/mach.h>
+#elif defined(Q_OS_LINUX)
+#include <unistd.h>
 #elif defined(Q_OS_WIN)
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -37,6 +40,16 @@ namespace BlackMisc
         QString path = QFileInfo(QStringLiteral("/proc/%1/exe").arg(pid)).symLinkTarget();
         return QFileInfo(path).fileName();
     }
+
+    qint64 CProcessInfo::currentProcessResidentMemoryBytes()
+    {
+        // /proc/self/statm: size resident shared text lib data dt (in pages)
+        QFile statm(QStringLiteral("/proc/self/statm"));
+        if (!statm.open(QIODevice::ReadOnly)) { return 0; }
+        const QList<QByteArray> parts = statm.readAll().split(' ');
+        if (parts.size() < 2) { return 0; }
+        return parts.at(1).toLongLong() * static_cast<qint64>(sysconf(_SC_PAGESIZE));
+    }
 #elif defined(Q_OS_MACOS)
     QString CProcessInfo::processNameFromId(qint64 pid)
     {
@@ -44,6 +57,14 @@ namespace BlackMisc
         proc_name(pid, name, std::extent_v<decltype(name)>);
         return name;
     }
+
+    qint64 CProcessInfo::currentProcessResidentMemoryBytes()
+    {
+        mach_task_basic_info info {};
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) { return 0; }
+        return static_cast<qint64>(info.resident_size);
+    }
 #elif defined(Q_OS_WIN)
     QString CProcessInfo::processNameFromId(qint64 pid)
     {
@@ -55,12 +76,25 @@ namespace BlackMisc
         if (len <= 0) { return {}; }
         return QFileInfo(QString::fromWCharArray(path)).completeBaseName();
     }
+
+    qint64 CProcessInfo::currentProcessResidentMemoryBytes()
+    {
+        // K32 variant from kernel32, psapi is only linked for MinGW
+        PROCESS_MEMORY_COUNTERS counters {};
+        if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) { return 0; }
+        return static_cast<qint64>(counters.WorkingSetSize);
+    }
 #else
     QString CProcessInfo::processNameFromId(qint64)
     {
         qFatal("Not implemented");
         return {};
     }
+
+    qint64 CProcessInfo::currentProcessResidentMemoryBytes()
+    {
+        return 0; // not implemented
+    }
 #endif
 
 }
@@ -37,6 +37,10 @@ namespace BlackMisc
         //! Return an object identifying the current process.
         static CProcessInfo currentProcess() { return CProcessInfo(QCoreApplication::applicationPid()); }
 
+        //! Resident memory (working set) of the current process in bytes
+        //! \remark 0 if not implemented on this platform
+        static qint64 currentProcessResidentMemoryBytes();
+
         //! True if this object identifies a process that exists.
         bool exists() const { return ! m_name.isEmpty() && *this == CProcessInfo(m_pid); }
 
@@ -240,6 +240,9 @@ namespace BlackMisc
         //! Changes the size of the sequence, if it is bigger than the given size.
         void truncate(size_type maxSize) { if (size() > maxSize) { erase(begin() + maxSize, end()); } }
 
+        //! Releases memory not needed to store the elements.
+        void squeeze() { m_impl.squeeze(); }
+
         //! Inserts an element into the sequence.
         //! \return An iterator to the position where value was inserted.
         iterator insert(iterator before, const T &value) { return m_impl.insert(before, value); }
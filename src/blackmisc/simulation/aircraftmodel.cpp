@@ -148,6 +148,65 @@ namespace BlackMisc::Simulation
         });
     }
 
+    void CAircraftModel::writeMemoizedJson(CJsonStreamWriter &writer, MemoHelper::CMemoizer &helper) const
+    {
+        writer.beginObject();
+        introspect<CAircraftModel>().forEachMember([ &, this ](auto member)
+        {
+            if constexpr (!decltype(member)::has(MetaFlags<DisabledForJson>()))
+            {
+                writer.writeName(member.latin1Name());
+                Json::writeToStream(writer, helper.maybeMemoize(member.in(*this)));
+            }
+        });
+        writer.endObject();
+    }
+
+    void CAircraftModel::readMemoizedJson(CJsonStreamReader &reader, MemoHelper::CIndexes &indexes)
+    {
+        indexes.fill(-1);
+        if (reader.tokenType() != CJsonStreamReader::StartObject) { reader.skipValue(); return; }
+        while (reader.readNext() == CJsonStreamReader::Name)
+        {
+            bool found = false;
+            introspect<CAircraftModel>().forEachMember([ &, this ](auto member)
+            {
+                if constexpr (!decltype(member)::has(MetaFlags<DisabledForJson>()))
+                {
+                    if (found || !reader.isName(member.latin1Name())) { return; }
+                    found = true;
+                    reader.readNext();
+                    using T = std::decay_t<decltype(member.in(*this))>;
+                    constexpr int memo = MemoHelper::indexOf<T>();
+                    if constexpr (memo >= 0)
+                    {
+                        // an object if written without memoization
+                        if (reader.tokenType() == CJsonStreamReader::StartObject) { Json::readFromStream(reader, member.in(*this)); }
+                        else { indexes[memo] = reader.readValue().toInt(); }
+                    }
+                    else { Json::readFromStream(reader, member.in(*this)); }
+                }
+            });
+            if (!found) { reader.skipValue(); }
+        }
+    }
+
+    void CAircraftModel::resolveMemoized(const MemoHelper::CIndexes &indexes, const MemoHelper::CUnmemoizer &helper)
+    {
+        introspect<CAircraftModel>().forEachMember([ &, this ](auto member)
+        {
+            using T = std::decay_t<decltype(member.in(*this))>;
+            constexpr int memo = MemoHelper::indexOf<T>();
+            if constexpr (memo >= 0 && !decltype(member)::has(MetaFlags<DisabledForJson>()))
+            {
+                if (!helper.unmemoize(member.in(*this), indexes[memo]))
+                {
+                    throw CJsonException(QStringLiteral("Invalid index %1 of '%2'").arg(indexes[memo]).arg(member.latin1Name()));
+                }
+            }
+        });
+    }
+
     QString CAircraftModel::asHtmlSummary(const QString &separator) const
     {
         return QStringLiteral("Model: %1 changed: %2%3Simulator: %4 Mode: %5 Distributor: %6%7Aircraft ICAO: %8%9Livery: %10")
@@ -428,6 +428,17 @@ namespace BlackMisc
             //! From JSON with memoized members (used by CAircraftModelList)
             void convertFromMemoizedJson(const QJsonObject &json, const MemoHelper::CUnmemoizer &);
 
+            //! Write JSON with memoized members (used by CAircraftModelList)
+            void writeMemoizedJson(CJsonStreamWriter &writer, MemoHelper::CMemoizer &) const;
+
+            //! Read JSON with memoized members, the reader is on the first token of the object (used by CAircraftModelList)
+            //! \remark the tables can follow the models, so the indexes are only returned, see resolveMemoized
+            void readMemoizedJson(CJsonStreamReader &reader, MemoHelper::CIndexes &indexes);
+
+            //! Assign the memoized members read by readMemoizedJson
+            //! \throws CJsonException index out of range
+            void resolveMemoized(const MemoHelper::CIndexes &indexes, const MemoHelper::CUnmemoizer &);
+
             //! To database JSON
             QJsonObject toDatabaseJson() const;
 
@@ -13,6 +13,7 @@
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/iterator.h"
 #include "blackmisc/range.h"
+#include "blackmisc/parallel.h"
 #include "blackmisc/fileutils.h"
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/directoryutils.h"
@@ -25,9 +26,11 @@
 #include <QJsonValue>
 #include <QList>
 #include <QMultiMap>
+#include <QHash>
 #include <QFileInfo>
 #include <QDir>
 #include <tuple>
+#include <vector>
 
 using namespace BlackConfig;
 using namespace BlackMisc::Network;
@@ -1573,6 +1576,43 @@ namespace BlackMisc::Simulation
                                         )
                                     );
 
+        // file existence checks are I/O bound, run them in parallel for blocks of unique files
+        // a block is checked when the loop reaches it, so stopping early still saves the remaining checks
+        QHash<QString, int> uniqueFileIndexes;
+        QVector<int> uniqueFileModels; // first model for the file
+        for (int i = 0; i < sorted.size(); i++)
+        {
+            const CAircraftModel &model = std::as_const(sorted)[i];
+            if (!model.hasFileName()) { continue; }
+            const QString fn(caseSensitive ? model.getFileName() : model.getFileNameLowerCase());
+            if (uniqueFileIndexes.contains(fn)) { continue; }
+            uniqueFileIndexes.insert(fn, uniqueFileModels.size());
+            uniqueFileModels.push_back(i);
+        }
+
+        constexpr int FileBlockSize = 1024;
+        std::vector<char> existingFiles(static_cast<size_t>(uniqueFileModels.size()), 0);
+        int checkedFiles = 0;
+        const auto isExistingFile = [&](const QString & fn)
+        {
+            const int index = uniqueFileIndexes.value(fn, -1);
+            if (index < 0) { return false; }
+            if (index >= checkedFiles)
+            {
+                const int blockEnd = qMin(uniqueFileModels.size(), qMax(index + 1, checkedFiles + FileBlockSize));
+                const CAircraftModelList &models = sorted;
+                CParallel::forEachChunk(blockEnd - checkedFiles, 32, [&, blockBegin = checkedFiles](int begin, int end, int)
+                {
+                    for (int f = blockBegin + begin; f < blockBegin + end; f++)
+                    {
+                        existingFiles[static_cast<size_t>(f)] = models[uniqueFileModels[f]].hasExistingCorrespondingFile() ? 1 : 0;
+                    }
+                });
+                checkedFiles = blockEnd;
+            }
+            return existingFiles[static_cast<size_t>(index)] != 0;
+        };
+
         for (const CAircraftModel &model : std::as_const(sorted))
         {
             if (wasStopped) { break; } // allow breaking from external
@@ -1599,7 +1639,7 @@ namespace BlackMisc::Simulation
                     break;
                 }
 
-                if (workingFiles.contains(fn) || model.hasExistingCorrespondingFile())
+                if (workingFiles.contains(fn) || isExistingFile(fn))
                 {
                     if (!simRootDirectory.isEmpty() && !fn.contains(simRootDir))
                     {
@@ -1743,6 +1783,103 @@ namespace BlackMisc::Simulation
         }
     }
 
+    void CAircraftModelList::writeMemoizedJson(CJsonStreamWriter &writer) const
+    {
+        // the tables are complete after all models are written
+        CAircraftModel::MemoHelper::CMemoizer helper;
+        writer.beginObject();
+        writer.writeName(QLatin1String("containerbase"));
+        writer.beginArray();
+        for (auto it = cbegin(); it != cend(); ++it)
+        {
+            it->writeMemoizedJson(writer, helper);
+        }
+        writer.endArray();
+        writer.writeName(QLatin1String("aircraftIcaos"));
+        Json::writeToStream(writer, helper.getTable<CAircraftIcaoCode>());
+        writer.writeName(QLatin1String("liveries"));
+        Json::writeToStream(writer, helper.getTable<CLivery>());
+        writer.writeName(QLatin1String("distributors"));
+        Json::writeToStream(writer, helper.getTable<CDistributor>());
+        writer.endObject();
+    }
+
+    void CAircraftModelList::readMemoizedJson(CJsonStreamReader &reader, bool fallbackToConvertToJson)
+    {
+        clear();
+        if (reader.tokenType() != CJsonStreamReader::StartObject)
+        {
+            reader.skipValue();
+            throw CJsonException("Missing 'containerbase'");
+        }
+
+        // tables and models can be in any order, so the memoized members are resolved at the end
+        CAircraftModel::MemoHelper::CUnmemoizer helper;
+        QVector<CAircraftModel::MemoHelper::CIndexes> indexes;
+        bool hasModels = false;
+        bool hasAc = false;
+        bool hasLiv = false;
+        bool hasDist = false;
+        while (reader.readNext() == CJsonStreamReader::Name)
+        {
+            if (reader.isName(QLatin1String("containerbase")))
+            {
+                hasModels = true;
+                if (reader.readNext() != CJsonStreamReader::StartArray) { reader.skipValue(); continue; }
+                while (reader.readNext() != CJsonStreamReader::EndArray && !reader.atEnd())
+                {
+                    CAircraftModel value;
+                    CAircraftModel::MemoHelper::CIndexes valueIndexes;
+                    value.readMemoizedJson(reader, valueIndexes);
+                    this->push_back(value);
+                    indexes.push_back(valueIndexes);
+                }
+            }
+            else if (reader.isName(QLatin1String("aircraftIcaos")))
+            {
+                hasAc = true;
+                CJsonScope scope("aircraftIcaos");
+                Q_UNUSED(scope)
+                reader.readNext();
+                Json::readFromStream(reader, helper.getTable<CAircraftIcaoCode>());
+            }
+            else if (reader.isName(QLatin1String("liveries")))
+            {
+                hasLiv = true;
+                CJsonScope scope("liveries");
+                Q_UNUSED(scope)
+                reader.readNext();
+                Json::readFromStream(reader, helper.getTable<CLivery>());
+            }
+            else if (reader.isName(QLatin1String("distributors")))
+            {
+                hasDist = true;
+                CJsonScope scope("distributors");
+                Q_UNUSED(scope)
+                reader.readNext();
+                Json::readFromStream(reader, helper.getTable<CDistributor>());
+            }
+            else { reader.skipValue(); }
+        }
+
+        if (!hasModels) { throw CJsonException("Missing 'containerbase'"); }
+        if (fallbackToConvertToJson && !hasAc && !hasLiv && !hasDist)
+        {
+            // not memoized, the models are already complete
+            return;
+        }
+        if (!hasAc)   { throw CJsonException("Missing 'aircraftIcaos'"); }
+        if (!hasLiv)  { throw CJsonException("Missing 'liveries'"); }
+        if (!hasDist) { throw CJsonException("Missing 'distributors'"); }
+
+        for (int i = 0; i < indexes.size(); ++i)
+        {
+            CJsonScope scope("containerbase", i);
+            Q_UNUSED(scope)
+            (*this)[i].resolveMemoized(indexes[i], helper);
+        }
+    }
+
     QJsonArray CAircraftModelList::toDatabaseJson() const
     {
         QJsonArray array;
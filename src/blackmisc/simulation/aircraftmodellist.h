@@ -20,6 +20,7 @@
 #include "blackmisc/aviation/liverylist.h"
 #include "blackmisc/aviation/callsignobjectlist.h"
 #include "blackmisc/db/datastoreobjectlist.h"
+#include "blackmisc/db/dbsnapshot.h"
 #include "blackmisc/statusmessage.h"
 #include "blackmisc/collection.h"
 #include "blackmisc/orderablelist.h"
@@ -527,6 +528,13 @@ namespace BlackMisc
             //! From compact JSON format
             void convertFromMemoizedJson(const QJsonObject &json, bool fallbackToConvertToJson = false);
 
+            //! Write compact JSON format, model by model without building the QJsonObject
+            void writeMemoizedJson(CJsonStreamWriter &writer) const;
+
+            //! Read compact JSON format model by model, the reader is on the first token of the object
+            //! \throws CJsonException
+            void readMemoizedJson(CJsonStreamReader &reader, bool fallbackToConvertToJson = false);
+
             //! To database JSON
             QJsonArray toDatabaseJson() const;
 
@@ -575,6 +583,9 @@ namespace BlackMisc
         //! Model per callsign
         using CAircraftModelPerCallsign = QHash<Aviation::CCallsign, CAircraftModel>;
 
+        //! Models with lookup by DB key and model string
+        using CAircraftModelSnapshot = Db::CDbSnapshot<CAircraftModelList>;
+
     } // ns
 } // ns
 
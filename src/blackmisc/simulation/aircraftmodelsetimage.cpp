@@ -0,0 +1,456 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/units.h"
+#include "blackmisc/logcategories.h"
+#include "blackmisc/logmessage.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Simulation
+{
+    //! \cond PRIVATE
+    struct CAircraftModelSetImage::StringRef
+    {
+        quint32 offset = 0; //!< in UTF-16 code units from the begin of the string table
+        quint32 size = 0;   //!< in UTF-16 code units
+    };
+
+    struct CAircraftModelSetImage::Header
+    {
+        char magic[8];
+        quint32 version;
+        quint32 byteOrder;
+        quint32 recordSize;
+        quint32 models;
+        quint32 simulator;
+        quint32 reserved;
+        qint64 timestamp;
+        qint64 modelSetTimestamp; //!< timestamp of the model set cache
+        quint64 recordsOffset;
+        quint64 indexOffset;
+        quint64 stringsOffset;
+        quint64 strings; //!< in UTF-16 code units
+    };
+
+    struct CAircraftModelSetImage::ModelRecord
+    {
+        StringRef modelString;
+        StringRef modelStringAlias;
+        StringRef name;
+        StringRef description;
+        StringRef fileName;
+        StringRef iconFile;
+        StringRef supportedParts;
+        StringRef callsign;
+        StringRef cgUnit;
+        StringRef aircraftIcao;           //!< JSON
+        StringRef livery;                 //!< JSON
+        StringRef distributor;            //!< JSON
+        StringRef aircraftIcaoDesignator; //!< from the aircraft ICAO code, for the view
+        StringRef airlineIcaoDesignator;  //!< from the livery, for the view
+        StringRef liveryCode;             //!< from the livery, for the view
+        StringRef distributorKey;         //!< from the distributor, for the view
+        qint64 timestamp;
+        qint64 fileTimestamp;
+        double cg;                        //!< NaN for null
+        qint32 dbKey;
+        qint32 order;
+        qint32 simulator;
+        qint32 modelType;
+        qint32 modelMode;
+        qint32 reserved;
+    };
+    //! \endcond
+
+    namespace
+    {
+        constexpr char Magic[8] = { 'S', 'W', 'I', 'F', 'T', 'M', 'S', 'I' };
+        constexpr quint32 Version = 2;
+        constexpr quint32 ByteOrder = 0x01020304;
+
+        //! Offset aligned for the records
+        quint64 aligned(quint64 offset) { return (offset + 7) & ~quint64(7); }
+
+        //! Object stored as JSON string
+        template <class T>
+        T fromJsonString(QStringView json)
+        {
+            T object;
+            if (!json.isEmpty()) { object.convertFromJson(QJsonDocument::fromJson(json.toUtf8()).object()); }
+            return object;
+        }
+
+        //! Object as JSON string
+        template <class T>
+        QString toJsonString(const T &object)
+        {
+            return QString::fromUtf8(QJsonDocument(object.toJson()).toJson(QJsonDocument::Compact));
+        }
+    }
+
+    QStringView CAircraftModelImageView::getModelString() const { return m_image ? m_image->stringAt(m_image->record(m_index).modelString) : QStringView(); }
+    QStringView CAircraftModelImageView::getModelStringAlias() const { return m_image ? m_image->stringAt(m_image->record(m_index).modelStringAlias) : QStringView(); }
+    QStringView CAircraftModelImageView::getName() const { return m_image ? m_image->stringAt(m_image->record(m_index).name) : QStringView(); }
+    QStringView CAircraftModelImageView::getDescription() const { return m_image ? m_image->stringAt(m_image->record(m_index).description) : QStringView(); }
+    QStringView CAircraftModelImageView::getAircraftIcaoCodeDesignator() const { return m_image ? m_image->stringAt(m_image->record(m_index).aircraftIcaoDesignator) : QStringView(); }
+    QStringView CAircraftModelImageView::getAirlineIcaoCodeDesignator() const { return m_image ? m_image->stringAt(m_image->record(m_index).airlineIcaoDesignator) : QStringView(); }
+    QStringView CAircraftModelImageView::getLiveryCombinedCode() const { return m_image ? m_image->stringAt(m_image->record(m_index).liveryCode) : QStringView(); }
+    QStringView CAircraftModelImageView::getDistributorKey() const { return m_image ? m_image->stringAt(m_image->record(m_index).distributorKey) : QStringView(); }
+    int CAircraftModelImageView::getDbKey() const { return m_image ? m_image->record(m_index).dbKey : -1; }
+    CSimulatorInfo CAircraftModelImageView::getSimulator() const { return m_image ? CSimulatorInfo(m_image->record(m_index).simulator) : CSimulatorInfo(); }
+    CAircraftModel::ModelType CAircraftModelImageView::getModelType() const { return m_image ? static_cast<CAircraftModel::ModelType>(m_image->record(m_index).modelType) : CAircraftModel::TypeUnknown; }
+    CAircraftModel::ModelMode CAircraftModelImageView::getModelMode() const { return m_image ? static_cast<CAircraftModel::ModelMode>(m_image->record(m_index).modelMode) : CAircraftModel::Include; }
+
+    CAircraftModel CAircraftModelImageView::toAircraftModel() const
+    {
+        if (!m_image) { return {}; }
+        const CAircraftModelSetImage::ModelRecord &r = m_image->record(m_index);
+        const auto string = [this](const CAircraftModelSetImage::StringRef &ref) { return m_image->stringAt(ref).toString(); };
+
+        CAircraftModel model;
+        model.setModelString(string(r.modelString));
+        model.setModelStringAlias(string(r.modelStringAlias));
+        model.setName(string(r.name));
+        model.setDescription(string(r.description));
+        model.setFileName(string(r.fileName));
+        model.setIconFile(string(r.iconFile));
+        model.setSupportedParts(string(r.supportedParts));
+        if (r.callsign.size > 0) { model.setCallsign(CCallsign(string(r.callsign))); }
+        if (!std::isnan(r.cg)) { model.setCG(CLength(r.cg, CMeasurementUnit::unitFromSymbol<CLengthUnit>(string(r.cgUnit)))); }
+        model.setAircraftIcaoCode(fromJsonString<CAircraftIcaoCode>(m_image->stringAt(r.aircraftIcao)));
+        model.setLivery(fromJsonString<CLivery>(m_image->stringAt(r.livery)));
+        model.setDistributor(fromJsonString<CDistributor>(m_image->stringAt(r.distributor)));
+        model.setMSecsSinceEpoch(r.timestamp);
+        model.setFileTimestamp(r.fileTimestamp);
+        model.setDbKey(r.dbKey);
+        model.setOrder(r.order);
+        model.setSimulator(CSimulatorInfo(r.simulator));
+        model.setModelType(static_cast<CAircraftModel::ModelType>(r.modelType));
+        model.setModelMode(static_cast<CAircraftModel::ModelMode>(r.modelMode));
+        return model;
+    }
+
+    CAircraftModelSetImage::CAircraftModelSetImage(const QString &fileName) : m_fileName(fileName), m_file(fileName)
+    {
+        const QFileInfo info(fileName);
+        m_lastModified = info.lastModified();
+        if (!m_file.open(QIODevice::ReadOnly))
+        {
+            m_status = CStatusMessage(this).warning(u"Cannot open model set image '%1'") << fileName;
+            return;
+        }
+
+        const qint64 bytes = m_file.size();
+        if (bytes < static_cast<qint64>(sizeof(Header)))
+        {
+            m_status = CStatusMessage(this).warning(u"Model set image '%1' is too small") << fileName;
+            return;
+        }
+
+        const uchar *data = m_file.map(0, bytes);
+        if (!data)
+        {
+            m_status = CStatusMessage(this).warning(u"Cannot map model set image '%1': %2") << fileName << m_file.errorString();
+            return;
+        }
+
+        // validate, so that all accesses within the records and the index are within the mapped bytes
+        const Header *h = reinterpret_cast<const Header *>(data);
+        const quint64 size = static_cast<quint64>(bytes);
+        const bool valid =
+            std::memcmp(h->magic, Magic, sizeof(Magic)) == 0 && h->version == Version && h->byteOrder == ByteOrder &&
+            h->recordSize == sizeof(ModelRecord) && h->models <= static_cast<quint32>(std::numeric_limits<int>::max()) &&
+            h->recordsOffset % 8 == 0 && h->recordsOffset + quint64(h->models) * sizeof(ModelRecord) <= size &&
+            h->indexOffset % 4 == 0 && h->indexOffset + quint64(h->models) * sizeof(quint32) <= size &&
+            h->stringsOffset % 2 == 0 && h->stringsOffset + h->strings * sizeof(char16_t) <= size;
+        if (!valid)
+        {
+            m_file.unmap(const_cast<uchar *>(data));
+            m_status = CStatusMessage(this).warning(u"Invalid model set image '%1'") << fileName;
+            return;
+        }
+
+        m_data = data;
+        m_mappedBytes = bytes;
+        m_size = static_cast<int>(h->models);
+        m_status = CStatusMessage(this).info(u"Mapped model set image '%1' with %2 models, %3 bytes") << fileName << m_size << m_mappedBytes;
+    }
+
+    CAircraftModelSetImage::~CAircraftModelSetImage()
+    {
+        if (m_data) { m_file.unmap(const_cast<uchar *>(m_data)); }
+    }
+
+    CSimulatorInfo CAircraftModelSetImage::getSimulator() const
+    {
+        return m_data ? CSimulatorInfo(static_cast<int>(this->header().simulator)) : CSimulatorInfo();
+    }
+
+    qint64 CAircraftModelSetImage::getMSecsSinceEpoch() const
+    {
+        return m_data ? this->header().timestamp : -1;
+    }
+
+    qint64 CAircraftModelSetImage::getModelSetTimestamp() const
+    {
+        return m_data ? this->header().modelSetTimestamp : -1;
+    }
+
+    CAircraftModelImageView CAircraftModelSetImage::at(int index) const
+    {
+        Q_ASSERT_X(index >= 0 && index < m_size, Q_FUNC_INFO, "Index out of range");
+        return CAircraftModelImageView(this, index);
+    }
+
+    CAircraftModelImageView CAircraftModelSetImage::findByModelString(const QString &modelString) const
+    {
+        const QString ms = modelString.trimmed();
+        if (ms.isEmpty() || !m_data) { return {}; }
+        const int position = this->lowerBound(ms);
+        if (position >= m_size || this->sortedModelString(position).compare(ms, Qt::CaseInsensitive) != 0) { return {}; }
+        return CAircraftModelImageView(this, static_cast<int>(reinterpret_cast<const quint32 *>(m_data + this->header().indexOffset)[position]));
+    }
+
+    QVector<CAircraftModelImageView> CAircraftModelSetImage::findModelsStartingWith(const QString &modelString) const
+    {
+        QVector<CAircraftModelImageView> views;
+        const QString ms = modelString.trimmed();
+        if (ms.isEmpty() || !m_data) { return views; }
+        const quint32 *index = reinterpret_cast<const quint32 *>(m_data + this->header().indexOffset);
+        for (int position = this->lowerBound(ms); position < m_size && this->sortedModelString(position).startsWith(ms, Qt::CaseInsensitive); ++position)
+        {
+            views.push_back(CAircraftModelImageView(this, static_cast<int>(index[position])));
+        }
+
+        // like CAircraftModelList::findModelsStartingWith
+        std::sort(views.begin(), views.end(), [](const CAircraftModelImageView &a, const CAircraftModelImageView &b) { return a.getIndex() < b.getIndex(); });
+        return views;
+    }
+
+    QStringList CAircraftModelSetImage::getModelStringList() const
+    {
+        QStringList modelStrings;
+        modelStrings.reserve(m_size);
+        for (int i = 0; i < m_size; ++i) { modelStrings.push_back(this->stringAt(this->record(i).modelString).toString()); }
+        return modelStrings;
+    }
+
+    CAircraftModelList CAircraftModelSetImage::toAircraftModelList() const
+    {
+        CAircraftModelList models;
+        models.reserve(m_size);
+        for (int i = 0; i < m_size; ++i) { models.push_back(CAircraftModelImageView(this, i).toAircraftModel()); }
+        return models;
+    }
+
+    CAircraftModelList CAircraftModelSetImage::toAircraftModelList(const QVector<CAircraftModelImageView> &views)
+    {
+        CAircraftModelList models;
+        models.reserve(views.size());
+        for (const CAircraftModelImageView &view : views) { models.push_back(view.toAircraftModel()); }
+        return models;
+    }
+
+    CStatusMessage CAircraftModelSetImage::writeImage(const CAircraftModelList &models, const CSimulatorInfo &simulator, qint64 modelSetTimestamp, const QString &fileName)
+    {
+        const CAircraftModelSetImage *self = nullptr;
+
+        // deduplicated strings, most values like designators, liveries or distributors are shared by many models
+        QString strings;
+        QHash<QString, StringRef> stringRefs;
+        const auto addString = [&](const QString &string)
+        {
+            StringRef ref;
+            if (string.isEmpty()) { return ref; }
+            const auto it = stringRefs.constFind(string);
+            if (it != stringRefs.constEnd()) { return it.value(); }
+            ref.offset = static_cast<quint32>(strings.size());
+            ref.size = static_cast<quint32>(string.size());
+            strings += string;
+            stringRefs.insert(string, ref);
+            return ref;
+        };
+
+        QVector<ModelRecord> records;
+        records.reserve(models.size());
+        for (const CAircraftModel &model : models)
+        {
+            ModelRecord r {};
+            r.modelString = addString(model.getModelString());
+            r.modelStringAlias = addString(model.getModelStringAlias());
+            r.name = addString(model.getName());
+            r.description = addString(model.getDescription());
+            r.fileName = addString(model.getFileName());
+            r.iconFile = addString(model.getIconFile());
+            r.supportedParts = addString(model.getSupportedParts());
+            r.callsign = addString(model.getCallsign().asString());
+            r.aircraftIcao = addString(toJsonString(model.getAircraftIcaoCode()));
+            r.livery = addString(toJsonString(model.getLivery()));
+            r.distributor = addString(toJsonString(model.getDistributor()));
+            r.aircraftIcaoDesignator = addString(model.getAircraftIcaoCodeDesignator());
+            r.airlineIcaoDesignator = addString(model.getAirlineIcaoCodeDesignator());
+            r.liveryCode = addString(model.getLivery().getCombinedCode());
+            r.distributorKey = addString(model.getDistributor().getDbKey());
+            if (model.getCG().isNull()) { r.cg = std::numeric_limits<double>::quiet_NaN(); }
+            else
+            {
+                r.cg = model.getCG().value();
+                r.cgUnit = addString(model.getCG().getUnit().getSymbol());
+            }
+            r.timestamp = model.getMSecsSinceEpoch();
+            r.fileTimestamp = model.hasValidFileTimestamp() ? model.getFileTimestamp().toMSecsSinceEpoch() : -1;
+            r.dbKey = model.getDbKey();
+            r.order = model.getOrder();
+            r.simulator = model.getSimulator().getSimulator();
+            r.modelType = model.getModelType();
+            r.modelMode = model.getModelMode();
+            records.push_back(r);
+        }
+
+        // index sorted by model string, for lookups and completion
+        QVector<quint32> index(records.size());
+        std::iota(index.begin(), index.end(), 0u);
+        std::stable_sort(index.begin(), index.end(), [&](quint32 a, quint32 b)
+        {
+            return QString::compare(models[static_cast<int>(a)].getModelString(), models[static_cast<int>(b)].getModelString(), Qt::CaseInsensitive) < 0;
+        });
+
+        Header header {};
+        std::memcpy(header.magic, Magic, sizeof(Magic));
+        header.version = Version;
+        header.byteOrder = ByteOrder;
+        header.recordSize = sizeof(ModelRecord);
+        header.models = static_cast<quint32>(records.size());
+        header.simulator = static_cast<quint32>(simulator.getSimulator());
+        header.timestamp = QDateTime::currentMSecsSinceEpoch();
+        header.modelSetTimestamp = modelSetTimestamp;
+        header.recordsOffset = aligned(sizeof(Header));
+        header.indexOffset = header.recordsOffset + quint64(records.size()) * sizeof(ModelRecord);
+        header.stringsOffset = aligned(header.indexOffset + quint64(index.size()) * sizeof(quint32));
+        header.strings = static_cast<quint64>(strings.size());
+
+        QDir().mkpath(QFileInfo(fileName).absolutePath());
+        QSaveFile file(fileName); // readers mapping the old image keep it until they map the new one
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            return CStatusMessage(self).warning(u"Cannot write model set image '%1': %2") << fileName << file.errorString();
+        }
+        const QByteArray padding(8, '\0');
+        file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+        file.write(padding.constData(), static_cast<qint64>(header.recordsOffset - sizeof(Header)));
+        file.write(reinterpret_cast<const char *>(records.constData()), static_cast<qint64>(records.size() * sizeof(ModelRecord)));
+        file.write(reinterpret_cast<const char *>(index.constData()), static_cast<qint64>(index.size() * sizeof(quint32)));
+        file.write(padding.constData(), static_cast<qint64>(header.stringsOffset - header.indexOffset - quint64(index.size()) * sizeof(quint32)));
+        file.write(reinterpret_cast<const char *>(strings.constData()), static_cast<qint64>(strings.size() * sizeof(char16_t)));
+        if (!file.commit())
+        {
+            // on Windows an image mapped by another process can not be replaced
+            return CStatusMessage(self).warning(u"Cannot write model set image '%1': %2") << fileName << file.errorString();
+        }
+        return CStatusMessage(self).info(u"Written model set image '%1' with %2 models, %3 bytes") << fileName << records.size() << file.size();
+    }
+
+    QSharedPointer<const CAircraftModelSetImage> CAircraftModelSetImage::mapShared(const QString &fileName)
+    {
+        static QMutex mutex;
+        static QHash<QString, QSharedPointer<const CAircraftModelSetImage>> images;
+
+        const QFileInfo info(fileName);
+        QMutexLocker lock(&mutex);
+        if (!info.exists())
+        {
+            images.remove(fileName);
+            return {};
+        }
+
+        QSharedPointer<const CAircraftModelSetImage> &image = images[fileName];
+        if (!image || image->getFileLastModified() != info.lastModified() || image->getMappedBytes() != info.size())
+        {
+            // views of the old image stay valid as long as its users hold it
+            QSharedPointer<const CAircraftModelSetImage> mapped(new CAircraftModelSetImage(fileName));
+            if (!mapped->isValid())
+            {
+                CLogMessage::preformatted(mapped->getStatus());
+                images.remove(fileName);
+                return {};
+            }
+            image = mapped;
+        }
+        return image;
+    }
+
+    const QStringList &CAircraftModelSetImage::getLogCategories()
+    {
+        static const QStringList cats { CLogCategories::modelCache() };
+        return cats;
+    }
+
+    const CAircraftModelSetImage::Header &CAircraftModelSetImage::header() const
+    {
+        Q_ASSERT_X(m_data, Q_FUNC_INFO, "Not mapped");
+        return *reinterpret_cast<const Header *>(m_data);
+    }
+
+    QStringView CAircraftModelSetImage::stringAt(const StringRef &ref) const
+    {
+        const Header &h = this->header();
+        if (ref.size == 0 || quint64(ref.offset) + ref.size > h.strings) { return {}; }
+        return QStringView(reinterpret_cast<const char16_t *>(m_data + h.stringsOffset) + ref.offset, static_cast<qsizetype>(ref.size));
+    }
+
+    const CAircraftModelSetImage::ModelRecord &CAircraftModelSetImage::record(int index) const
+    {
+        Q_ASSERT_X(index >= 0 && index < m_size, Q_FUNC_INFO, "Index out of range");
+        return reinterpret_cast<const ModelRecord *>(m_data + this->header().recordsOffset)[index];
+    }
+
+    QStringView CAircraftModelSetImage::sortedModelString(int position) const
+    {
+        const quint32 index = reinterpret_cast<const quint32 *>(m_data + this->header().indexOffset)[position];
+        return index < static_cast<quint32>(m_size) ? this->stringAt(this->record(static_cast<int>(index)).modelString) : QStringView();
+    }
+
+    int CAircraftModelSetImage::lowerBound(QStringView modelString) const
+    {
+        if (!m_data) { return 0; }
+        int first = 0;
+        int count = m_size;
+        while (count > 0)
+        {
+            const int step = count / 2;
+            const int position = first + step;
+            if (this->sortedModelString(position).compare(modelString, Qt::CaseInsensitive) < 0)
+            {
+                first = position + 1;
+                count -= step + 1;
+            }
+            else { count = step; }
+        }
+        return first;
+    }
+} // ns
@@ -0,0 +1,207 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_AIRCRAFTMODELSETIMAGE_H
+#define BLACKMISC_SIMULATION_AIRCRAFTMODELSETIMAGE_H
+
+#include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/simulatorinfo.h"
+#include "blackmisc/statusmessage.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+#include <QVector>
+#include <QtGlobal>
+
+namespace BlackMisc::Simulation
+{
+    class CAircraftModelSetImage;
+
+    /*!
+     * Lightweight read-only view of one model in a CAircraftModelSetImage.
+     *
+     * The strings point into the mapped image, nothing is copied until toAircraftModel() is called.
+     * \remark only valid as long as the image exists
+     */
+    class BLACKMISC_EXPORT CAircraftModelImageView
+    {
+    public:
+        //! Default constructor, invalid view
+        CAircraftModelImageView() {}
+
+        //! Valid view?
+        bool isValid() const { return m_image != nullptr; }
+
+        //! Index of the model in the image, the order of the model set
+        int getIndex() const { return m_index; }
+
+        //! Model values, empty for an invalid view
+        //! @{
+        QStringView getModelString() const;
+        QStringView getModelStringAlias() const;
+        QStringView getName() const;
+        QStringView getDescription() const;
+        QStringView getAircraftIcaoCodeDesignator() const;
+        QStringView getAirlineIcaoCodeDesignator() const;
+        QStringView getLiveryCombinedCode() const;
+        QStringView getDistributorKey() const;
+        int getDbKey() const;
+        CSimulatorInfo getSimulator() const;
+        CAircraftModel::ModelType getModelType() const;
+        CAircraftModel::ModelMode getModelMode() const;
+        //! @}
+
+        //! Materialize the complete model
+        CAircraftModel toAircraftModel() const;
+
+    private:
+        friend class CAircraftModelSetImage;
+
+        //! Constructor
+        CAircraftModelImageView(const CAircraftModelSetImage *image, int index) : m_image(image), m_index(index) {}
+
+        const CAircraftModelSetImage *m_image = nullptr;
+        int m_index = -1;
+    };
+
+    /*!
+     * Read-only, memory-mapped image of a model set, written once when the model set is saved.
+     *
+     * The image consists of fixed size records and a table of deduplicated UTF-16 strings, plus an index
+     * of the model strings. Several processes (core and GUI) can map the same image and share its pages.
+     * The aircraft ICAO code, livery and distributor are stored as JSON and only decoded when a model is materialized.
+     * \remark the image is immutable, a new image is written if the model set changes
+     */
+    class BLACKMISC_EXPORT CAircraftModelSetImage
+    {
+    public:
+        //! Map the image
+        //! \remark check isValid() and getStatus()
+        explicit CAircraftModelSetImage(const QString &fileName);
+
+        //! Destructor, unmaps the image
+        ~CAircraftModelSetImage();
+
+        //! Not copyable
+        CAircraftModelSetImage(const CAircraftModelSetImage &) = delete;
+
+        //! Not copyable
+        CAircraftModelSetImage &operator =(const CAircraftModelSetImage &) = delete;
+
+        //! Image mapped and valid?
+        bool isValid() const { return m_data != nullptr; }
+
+        //! Result of mapping the image
+        const CStatusMessage &getStatus() const { return m_status; }
+
+        //! File name
+        const QString &getFileName() const { return m_fileName; }
+
+        //! Last modification of the file when it was mapped
+        const QDateTime &getFileLastModified() const { return m_lastModified; }
+
+        //! Number of models
+        int size() const { return m_size; }
+
+        //! No models?
+        bool isEmpty() const { return m_size < 1; }
+
+        //! Simulator of the model set
+        CSimulatorInfo getSimulator() const;
+
+        //! Time when the image was written
+        qint64 getMSecsSinceEpoch() const;
+
+        //! Timestamp of the model set the image was written from
+        //! \remark compared with the model set cache timestamp to detect a stale image
+        qint64 getModelSetTimestamp() const;
+
+        //! Mapped bytes, shared by all processes mapping the image
+        qint64 getMappedBytes() const { return m_mappedBytes; }
+
+        //! Model at index
+        CAircraftModelImageView at(int index) const;
+
+        //! Model with model string (case insensitive), or invalid view
+        //! \remark O(log n)
+        CAircraftModelImageView findByModelString(const QString &modelString) const;
+
+        //! Contains model string (case insensitive)?
+        bool containsModelString(const QString &modelString) const { return this->findByModelString(modelString).isValid(); }
+
+        //! Models whose model string starts with (case insensitive), in model set order
+        //! \remark O(log n), plus sorting the found models
+        QVector<CAircraftModelImageView> findModelsStartingWith(const QString &modelString) const;
+
+        //! All model strings in model set order
+        QStringList getModelStringList() const;
+
+        //! Materialize all models
+        CAircraftModelList toAircraftModelList() const;
+
+        //! Materialize the models of the views
+        static CAircraftModelList toAircraftModelList(const QVector<CAircraftModelImageView> &views);
+
+        //! Write the image of a model set, replacing an existing image
+        //! \param models the model set
+        //! \param simulator simulator of the model set
+        //! \param modelSetTimestamp timestamp of the model set cache
+        //! \param fileName image file
+        static CStatusMessage writeImage(const CAircraftModelList &models, const CSimulatorInfo &simulator, qint64 modelSetTimestamp, const QString &fileName);
+
+        //! Image shared within this process, mapped again if the file has been changed
+        //! \return null if there is no valid image
+        //! \threadsafe
+        static QSharedPointer<const CAircraftModelSetImage> mapShared(const QString &fileName);
+
+        //! Log categories
+        static const QStringList &getLogCategories();
+
+    private:
+        friend class CAircraftModelImageView;
+
+        //! \cond PRIVATE
+        struct Header;
+        struct StringRef;
+        struct ModelRecord;
+        //! \endcond
+
+        //! Header of the mapped image
+        const Header &header() const;
+
+        //! String from the string table, pointing into the mapped image
+        QStringView stringAt(const StringRef &ref) const;
+
+        //! Record of model
+        const ModelRecord &record(int index) const;
+
+        //! Model string of the n-th model in the model string index
+        QStringView sortedModelString(int position) const;
+
+        //! First position in the model string index not less than modelString
+        int lowerBound(QStringView modelString) const;
+
+        QString m_fileName;
+        QFile m_file;
+        QDateTime m_lastModified;
+        CStatusMessage m_status;
+        const uchar *m_data = nullptr;
+        qint64 m_mappedBytes = 0;
+        int m_size = 0;
+    };
+} // ns
+
+#endif // guard
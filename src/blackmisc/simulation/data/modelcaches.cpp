@@ -8,14 +8,26 @@
 
 #include "blackmisc/simulation/data/modelcaches.h"
 #include "blackmisc/cachesettingsutils.h"
+#include "blackmisc/fileutils.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/verify.h"
+#include <QFileInfo>
 #include <QtGlobal>
 
 using namespace BlackMisc;
 
 namespace BlackMisc::Simulation::Data
 {
+    namespace
+    {
+        //! Model set image next to the cache file
+        QString imageFilename(const QString &cacheFilename)
+        {
+            const QFileInfo fi(cacheFilename);
+            return CFileUtils::appendFilePaths(fi.absolutePath(), fi.completeBaseName() + QStringLiteral(".modelsetimage"));
+        }
+    }
+
     void IMultiSimulatorModelCaches::setModelsForSimulator(const CAircraftModelList &models, const CSimulatorInfo &simulator)
     {
         this->setCachedModels(models, simulator);
@@ -452,18 +464,27 @@ namespace BlackMisc::Simulation::Data
             orderedModels.sortAscendingByOrder();
         }
 
+        // same timestamp for cache and image, so readers can detect a stale image
+        const qint64 timestamp = QDateTime::currentMSecsSinceEpoch();
         CStatusMessage msg;
         switch (simulator.getSimulator())
         {
-        case CSimulatorInfo::FS9:    msg = m_modelCacheFs9.set(orderedModels); break;
-        case CSimulatorInfo::FSX:    msg = m_modelCacheFsx.set(orderedModels); break;
-        case CSimulatorInfo::P3D:    msg = m_modelCacheP3D.set(orderedModels); break;
-        case CSimulatorInfo::XPLANE: msg = m_modelCacheXP.set(orderedModels);  break;
-        case CSimulatorInfo::FG:     msg = m_modelCacheFG.set(orderedModels);  break;
+        case CSimulatorInfo::FS9:    msg = m_modelCacheFs9.set(orderedModels, timestamp); break;
+        case CSimulatorInfo::FSX:    msg = m_modelCacheFsx.set(orderedModels, timestamp); break;
+        case CSimulatorInfo::P3D:    msg = m_modelCacheP3D.set(orderedModels, timestamp); break;
+        case CSimulatorInfo::XPLANE: msg = m_modelCacheXP.set(orderedModels, timestamp);  break;
+        case CSimulatorInfo::FG:     msg = m_modelCacheFG.set(orderedModels, timestamp);  break;
         default:
             Q_ASSERT_X(false, Q_FUNC_INFO, "wrong simulator");
             return CStatusMessage();
         }
+
+        // image mapped by core and GUI
+        if (!msg.isFailure())
+        {
+            const CStatusMessage imageMsg = CAircraftModelSetImage::writeImage(orderedModels, simulator, timestamp, this->getImageFilename(simulator));
+            if (imageMsg.isWarningOrAbove()) { CLogMessage::preformatted(imageMsg); }
+        }
         this->emitCacheChanged(simulator); // set
         return msg;
     }
@@ -529,6 +550,11 @@ namespace BlackMisc::Simulation::Data
         return {};
     }
 
+    QString CModelSetCaches::getImageFilename(const CSimulatorInfo &simulator) const
+    {
+        return imageFilename(this->getFilename(simulator));
+    }
+
     bool CModelSetCaches::isSaved(const CSimulatorInfo &simulator) const
     {
         Q_ASSERT_X(simulator.isSingleSimulator(), Q_FUNC_INFO, "No single simulator");
@@ -584,4 +610,29 @@ namespace BlackMisc::Simulation::Data
         }
         return true;
     }
+
+    QString CCentralMultiSimulatorModelSetCachesProvider::getImageFilename(const CSimulatorInfo &simulator) const
+    {
+        return imageFilename(this->getFilename(simulator));
+    }
+
+    QSharedPointer<const CAircraftModelSetImage> CCentralMultiSimulatorModelSetCachesProvider::getModelSetImage(const CSimulatorInfo &simulator) const
+    {
+        if (!simulator.isSingleSimulator()) { return {}; }
+        return CAircraftModelSetImage::mapShared(this->getImageFilename(simulator));
+    }
+
+    CStatusMessage CCentralMultiSimulatorModelSetCachesProvider::writeModelSetImage(const CSimulatorInfo &simulator)
+    {
+        Q_ASSERT_X(simulator.isSingleSimulator(), Q_FUNC_INFO, "No single simulator");
+        const CAircraftModelList models = this->getSynchronizedCachedModels(simulator);
+        return CAircraftModelSetImage::writeImage(models, simulator, this->getCacheTimestamp(simulator).toMSecsSinceEpoch(), this->getImageFilename(simulator));
+    }
+
+    bool CCentralMultiSimulatorModelSetCachesProvider::isModelSetImageCurrent(const CAircraftModelSetImage &image, const CSimulatorInfo &simulator) const
+    {
+        if (!simulator.isSingleSimulator() || !image.isValid() || image.getSimulator() != simulator) { return false; }
+        const QDateTime ts = this->getCacheTimestamp(simulator);
+        return ts.isValid() && image.getModelSetTimestamp() == ts.toMSecsSinceEpoch();
+    }
 } // ns
@@ -13,6 +13,7 @@
 
 #include "blackmisc/simulation/aircraftmodelinterfaces.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
 #include "blackmisc/simulation/simulatorinfo.h"
 #include "blackmisc/applicationinfo.h"
 #include "blackmisc/statusmessage.h"
@@ -22,6 +23,7 @@
 
 #include <QDateTime>
 #include <QObject>
+#include <QSharedPointer>
 #include <atomic>
 
 namespace BlackMisc::Simulation::Data
@@ -372,6 +374,9 @@ namespace BlackMisc::Simulation::Data
         virtual QString getDescription() const override { return "Model sets"; }
         //! @}
 
+        //! File name of the memory-mapped model set image, next to the cache file
+        QString getImageFilename(const CSimulatorInfo &simulator) const;
+
     private:
         CData<Data::TModelSetCacheFsx> m_modelCacheFsx { this, &CModelSetCaches::changedFsx };  //!< FSX cache
         CData<Data::TModelSetCacheFs9> m_modelCacheFs9 { this, &CModelSetCaches::changedFs9};   //!< FS9 cache
@@ -496,6 +501,20 @@ namespace BlackMisc::Simulation::Data
             return c;
         }
 
+        //! \copydoc CModelSetCaches::getImageFilename
+        QString getImageFilename(const CSimulatorInfo &simulator) const;
+
+        //! Memory-mapped model set image, shared with other processes on this machine
+        //! \return null if there is no image
+        //! \threadsafe
+        QSharedPointer<const CAircraftModelSetImage> getModelSetImage(const CSimulatorInfo &simulator) const;
+
+        //! Write the model set image from the cached models, e.g. for model sets saved before images were written
+        CStatusMessage writeModelSetImage(const CSimulatorInfo &simulator);
+
+        //! Image written from the current model set cache, based on the cache timestamp?
+        bool isModelSetImageCurrent(const CAircraftModelSetImage &image, const CSimulatorInfo &simulator) const;
+
     protected:
         //! Ctor
         CCentralMultiSimulatorModelSetCachesProvider(const QString &name, QObject *parent = nullptr) : CCentralMultiSimulatorModelCachesProviderBase(name, parent) {}
@@ -129,7 +129,7 @@ namespace BlackMisc::Simulation::Flightgear
             if (m_parserWorker && !m_parserWorker->isFinished()) { return; }
             emit this->diskLoadingStarted(simulator, mode);
 
-            m_parserWorker = CWorker::fromTask(this, "CAircraftModelLoaderFlightgear::performParsing",
+            m_parserWorker = CWorker::fromTask(this, "CAircraftModelLoaderFlightgear::performParsing", CTaskPool::LowPriority,
                                                 [this, modelDirs, excludedDirectoryPatterns, modelConsolidation]()
             {
                 auto models = this->performParsing(modelDirs, excludedDirectoryPatterns);
@@ -0,0 +1,164 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/simulation/framebudgetscheduler.h"
+#include "blackmisc/pq/units.h"
+
+#include <QHash>
+#include <QStringBuilder>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Simulation
+{
+    CFrameBudgetScheduler::CFrameBudgetScheduler(double budgetMs)
+    {
+        this->setBudgetMs(budgetMs);
+    }
+
+    void CFrameBudgetScheduler::setBudgetMs(double budgetMs)
+    {
+        m_budgetMs = qMax(0.1, budgetMs);
+    }
+
+    CFrameBudgetScheduler::Tier CFrameBudgetScheduler::tier(double distanceNM, double groundSpeedKts, bool parked)
+    {
+        if (parked) { return Parked; }
+        if (distanceNM < NearDistanceNM || groundSpeedKts >= FastGroundSpeedKts) { return Near; }
+        return distanceNM < MediumDistanceNM ? Medium : Far;
+    }
+
+    CFrameBudgetScheduler::Tier CFrameBudgetScheduler::tier(const CAircraftSituation &situation, const ICoordinateGeodetic &ownPosition)
+    {
+        const double distanceNM = ownPosition.isNull() || situation.isPositionNull() ?
+                                  0.0 :
+                                  calculateGreatCircleDistance(situation, ownPosition).value(CLengthUnit::NM());
+        const double gsKts = situation.getGroundSpeed().isNull() ? 0.0 : situation.getGroundSpeed().value(CSpeedUnit::kts());
+        const bool parked = situation.isOnGround() && !situation.isMoving();
+        return tier(distanceNM, gsKts, parked);
+    }
+
+    int CFrameBudgetScheduler::interval(Tier tier) const
+    {
+        // no reduced rates as long as the budget is kept
+        if (m_level < 1) { return 1; }
+
+        int frames = 1;
+        switch (tier)
+        {
+        case Near:   return 1;
+        case Medium: frames = 2; break;
+        case Far:    frames = 4; break;
+        case Parked: frames = 8; break;
+        }
+        return frames << (m_level - 1);
+    }
+
+    bool CFrameBudgetScheduler::isDue(const CCallsign &callsign, Tier tier)
+    {
+        TierStatistics &statistics = m_statistics[static_cast<size_t>(tier)];
+        statistics.considered++;
+
+        bool due = true;
+        if (m_enabled && m_level > 0 && tier != Near)
+        {
+            // staggered, so aircraft of a tier are spread over the frames
+            const qint64 phase = static_cast<qint64>(qHash(callsign.asString()));
+            due = ((m_frames + phase) % this->interval(tier)) == 0;
+        }
+        if (due) { statistics.updated++; }
+        return due;
+    }
+
+    bool CFrameBudgetScheduler::isDue(const CCallsign &callsign, const CAircraftSituation &lastSituation, const ICoordinateGeodetic &ownPosition)
+    {
+        if (lastSituation.isNull()) { return this->isDue(callsign, Near); }
+        return this->isDue(callsign, tier(lastSituation, ownPosition));
+    }
+
+    void CFrameBudgetScheduler::endFrame(qint64 timestampMs, double updateTimeMs)
+    {
+        constexpr double Alpha = 0.1;
+        m_avgUpdateTimeMs = m_frames < 1 ? updateTimeMs : (1.0 - Alpha) * m_avgUpdateTimeMs + Alpha * updateTimeMs;
+        if (m_firstFrameMs < 0) { m_firstFrameMs = timestampMs; }
+        m_lastFrameMs = timestampMs;
+        m_frames++;
+
+        if (!m_enabled || ++m_framesSinceAdaption < AdaptionFrames) { return; }
+        m_framesSinceAdaption = 0;
+        if (m_avgUpdateTimeMs > m_budgetMs && m_level < MaxLevel) { m_level++; }
+        else if (m_avgUpdateTimeMs < 0.5 * m_budgetMs && m_level > 0) { m_level--; }
+    }
+
+    double CFrameBudgetScheduler::getUpdateRateHz(Tier tier) const
+    {
+        const TierStatistics &statistics = this->getStatistics(tier);
+        if (statistics.considered < 1 || m_frames < 2 || m_lastFrameMs <= m_firstFrameMs) { return -1.0; }
+        const double framesPerSecond = (m_frames - 1) * 1000.0 / (m_lastFrameMs - m_firstFrameMs);
+        return framesPerSecond * statistics.updated / statistics.considered;
+    }
+
+    void CFrameBudgetScheduler::resetStatistics()
+    {
+        m_statistics = {};
+        m_frames = 0;
+        m_firstFrameMs = -1;
+        m_lastFrameMs  = -1;
+        m_avgUpdateTimeMs = 0.0;
+        m_framesSinceAdaption = 0;
+        m_level = 0;
+    }
+
+    QString CFrameBudgetScheduler::getStatisticsInfo() const
+    {
+        if (!m_enabled) { return QStringLiteral("scheduler disabled"); }
+        static const QString tierInfo("%1: %2Hz ");
+        QString info;
+        for (int t = 0; t < NumberOfTiers; t++)
+        {
+            const Tier tier = static_cast<Tier>(t);
+            const double hz = this->getUpdateRateHz(tier);
+            info += tierInfo.arg(tierToString(tier), hz < 0 ? QStringLiteral("-") : QString::number(hz, 'f', 1));
+        }
+        return info %
+               QStringLiteral("level: %1 avg: %2ms/%3ms").arg(m_level).arg(m_avgUpdateTimeMs, 0, 'f', 2).arg(m_budgetMs, 0, 'f', 1);
+    }
+
+    const QString &CFrameBudgetScheduler::tierToString(Tier tier)
+    {
+        // no "near"/"far" identifiers, those are macros on Windows
+        static const QString nearTier("near");
+        static const QString mediumTier("medium");
+        static const QString farTier("far");
+        static const QString parkedTier("parked");
+
+        switch (tier)
+        {
+        case Near:   return nearTier;
+        case Medium: return mediumTier;
+        case Far:    return farTier;
+        case Parked: return parkedTier;
+        }
+        return nearTier;
+    }
+
+    CAircraftSituation CFrameBudgetScheduler::extrapolate(const CAircraftSituation &situation, qint64 timestampMs)
+    {
+        CAircraftSituation extrapolated(situation);
+        const qint64 deltaMs = timestampMs - situation.getAdjustedMSecsSinceEpoch();
+        extrapolated.setAdjustedMSecsSinceEpoch(timestampMs);
+        if (deltaMs <= 0 || situation.isPositionNull() || !situation.isMoving() || situation.getHeading().isNull()) { return extrapolated; }
+
+        const double distanceM = situation.getGroundSpeed().value(CSpeedUnit::m_s()) * deltaMs / 1000.0;
+        const CCoordinateGeodetic position = situation.getPosition().calculatePosition(CLength(distanceM, CLengthUnit::m()), situation.getHeading());
+        if (!position.isNull()) { extrapolated.setPosition(position); }
+        return extrapolated;
+    }
+} // ns
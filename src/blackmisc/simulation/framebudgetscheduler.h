@@ -0,0 +1,154 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_FRAMEBUDGETSCHEDULER_H
+#define BLACKMISC_SIMULATION_FRAMEBUDGETSCHEDULER_H
+
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QString>
+#include <QtGlobal>
+#include <array>
+
+namespace BlackMisc::Simulation
+{
+    /*!
+     * Decides which remote aircraft are updated in an update tick ("frame") of a simulator driver.
+     *
+     * Within the budget all aircraft are updated every frame. Once the measured update time exceeds
+     * the budget, near and fast aircraft are still updated every frame, far and parked aircraft at reduced rates.
+     * In the frames in between the simulator keeps moving them, or the driver extrapolates them
+     * with CFrameBudgetScheduler::extrapolate. Updates within a tier are staggered by callsign,
+     * so the far aircraft are not all updated in the same frame.
+     *
+     * The reduced rates are halved per level while the update time exceeds the budget,
+     * and restored once the update time is well below the budget again.
+     */
+    class BLACKMISC_EXPORT CFrameBudgetScheduler
+    {
+    public:
+        //! Update tiers
+        enum Tier
+        {
+            Near,   //!< near or fast, always every frame
+            Medium, //!< medium distance
+            Far,    //!< far away
+            Parked  //!< on ground, not moving
+        };
+
+        //! Number of tiers
+        static constexpr int NumberOfTiers = 4;
+
+        //! Max. adaption level, level 0 updates all aircraft every frame, level 1 uses the reduced rates,
+        //! which are halved per further level
+        static constexpr int MaxLevel = 4;
+
+        //! Frames between two adaptions of the level
+        static constexpr int AdaptionFrames = 30;
+
+        //! Within this distance aircraft are updated every frame
+        static constexpr double NearDistanceNM = 5.0;
+
+        //! Within this distance aircraft are in the medium tier
+        static constexpr double MediumDistanceNM = 25.0;
+
+        //! Aircraft this fast are updated every frame, regardless of the distance
+        static constexpr double FastGroundSpeedKts = 150.0;
+
+        //! Updates per tier
+        struct TierStatistics
+        {
+            qint64 considered = 0; //!< aircraft checked
+            qint64 updated    = 0; //!< aircraft due and updated
+        };
+
+        //! Constructor
+        CFrameBudgetScheduler(double budgetMs = 5.0);
+
+        //! Enabled, if disabled all aircraft are due every frame
+        bool isEnabled() const { return m_enabled; }
+
+        //! Enable/disable
+        void setEnabled(bool enabled) { m_enabled = enabled; }
+
+        //! Budget per frame
+        double getBudgetMs() const { return m_budgetMs; }
+
+        //! Set the budget per frame
+        void setBudgetMs(double budgetMs);
+
+        //! Tier by distance to own aircraft and ground speed
+        static Tier tier(double distanceNM, double groundSpeedKts, bool parked);
+
+        //! Tier of a situation, relative to own position
+        //! \remark a NULL own position is treated as being near
+        static Tier tier(const Aviation::CAircraftSituation &situation, const Geo::ICoordinateGeodetic &ownPosition);
+
+        //! Update interval of tier in frames, considering the current level
+        //! \remark 1 for all tiers at level 0
+        int interval(Tier tier) const;
+
+        //! Is the aircraft due for an update in the current frame?
+        bool isDue(const Aviation::CCallsign &callsign, Tier tier);
+
+        //! Is the aircraft due for an update in the current frame?
+        //! \param callsign        aircraft
+        //! \param lastSituation   situation last sent, a NULL situation is always due
+        //! \param ownPosition     own aircraft position
+        bool isDue(const Aviation::CCallsign &callsign, const Aviation::CAircraftSituation &lastSituation, const Geo::ICoordinateGeodetic &ownPosition);
+
+        //! Frame finished, adapts the level to the measured update time
+        void endFrame(qint64 timestampMs, double updateTimeMs);
+
+        //! Current adaption level
+        int getLevel() const { return m_level; }
+
+        //! Frames so far
+        qint64 getFrames() const { return m_frames; }
+
+        //! Smoothed update time
+        double getAverageUpdateTimeMs() const { return m_avgUpdateTimeMs; }
+
+        //! Statistics of tier
+        const TierStatistics &getStatistics(Tier tier) const { return m_statistics[static_cast<size_t>(tier)]; }
+
+        //! Updates per second of an aircraft in tier, -1 if not yet known
+        double getUpdateRateHz(Tier tier) const;
+
+        //! Reset statistics and level
+        void resetStatistics();
+
+        //! Statistics as string, one entry per tier
+        QString getStatisticsInfo() const;
+
+        //! Tier as string
+        static const QString &tierToString(Tier tier);
+
+        //! Dead reckoning of a situation to timestamp, by ground speed and heading
+        //! \remark cheap replacement of an interpolation for aircraft skipped in a frame
+        static Aviation::CAircraftSituation extrapolate(const Aviation::CAircraftSituation &situation, qint64 timestampMs);
+
+    private:
+        bool   m_enabled  = true;
+        double m_budgetMs = 5.0;
+        double m_avgUpdateTimeMs = 0.0; //!< exponential moving average
+        int    m_level = 0;
+        int    m_framesSinceAdaption = 0;
+        qint64 m_frames = 0;
+        qint64 m_firstFrameMs = -1;
+        qint64 m_lastFrameMs  = -1;
+        std::array<TierStatistics, NumberOfTiers> m_statistics;
+    };
+} // ns
+
+#endif // guard
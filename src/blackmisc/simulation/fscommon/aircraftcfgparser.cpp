@@ -71,7 +71,7 @@ namespace BlackMisc::Simulation::FsCommon
         {
             if (m_parserWorker && !m_parserWorker->isFinished()) { return; }
             emit this->diskLoadingStarted(simulator, mode);
-            m_parserWorker = CWorker::fromTask(this, "CAircraftCfgParser::startLoadingFromDisk",
+            m_parserWorker = CWorker::fromTask(this, "CAircraftCfgParser::startLoadingFromDisk", CTaskPool::LowPriority,
                                                 [this, modelDirs, excludedDirectoryPatterns, simulator, modelConsolidation]()
             {
                 CStatusMessageList msgs;
@@ -179,7 +179,7 @@ namespace BlackMisc::Simulation::FsCommon
             if (m_asyncLoadInProgress || m_shutdown) { return nullptr; }
             m_asyncLoadInProgress = true;
         }
-        BlackMisc::CWorker *worker = BlackMisc::CWorker::fromTask(this, "CVPilotRulesReader", [this, convertToModels]()
+        BlackMisc::CWorker *worker = BlackMisc::CWorker::fromTask(this, "CVPilotRulesReader", BlackMisc::CTaskPool::LowPriority, [this, convertToModels]()
         {
             this->read(convertToModels);
         });
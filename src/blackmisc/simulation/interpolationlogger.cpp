@@ -21,7 +21,9 @@
 #include "blackmisc/stringutils.h"
 #include "blackconfig/buildconfig.h"
 #include <QDateTime>
+#include <QFileInfo>
 #include <QStringBuilder>
+#include <algorithm>
 
 using namespace BlackConfig;
 using namespace BlackMisc;
@@ -59,7 +61,7 @@ namespace BlackMisc::Simulation
         }
 
         QPointer<CInterpolationLogger> myself(this);
-        CWorker *worker = CWorker::fromTask(this, "WriteInterpolationLog", [situations, parts, myself, clearLog]()
+        CWorker *worker = CWorker::fromTask(this, "WriteInterpolationLog", CTaskPool::LowPriority, [situations, parts, myself, clearLog]()
         {
             const CStatusMessageList msg = CInterpolationLogger::writeLogFiles(situations, parts);
             CLogMessage::preformatted(msg);
@@ -94,21 +96,90 @@ namespace BlackMisc::Simulation
         return CSwiftDirectories::logDirectory();
     }
 
+    CWorker *CInterpolationLogger::writeTraceInBackground()
+    {
+        const QHash<CCallsign, CInterpolationTraceRecorder::Records> records = m_traceRecorder.getAllRecords();
+        CWorker *worker = CWorker::fromTask(this, "WriteInterpolationTrace", CTaskPool::LowPriority, [records]()
+        {
+            if (records.isEmpty())
+            {
+                CLogMessage(static_cast<CInterpolationLogger *>(nullptr)).warning(u"No data for trace");
+                return;
+            }
+            QString file = filePatternTrace();
+            file.remove('*');
+            const QString ts = QDateTime::currentDateTimeUtc().toString("yyyyMMddhhmmss");
+            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1 %2").arg(ts, file));
+            const bool s = CInterpolationTraceRecorder::writeToFile(records, fn);
+            CLogMessage::preformatted(CInterpolationLogger::logStatusFileWriting(s, fn));
+        });
+        return worker;
+    }
+
+    CStatusMessageList CInterpolationLogger::convertTraceFile(const QString &traceFile, const CCallsignSet &callsigns, const QString &outputDirectory)
+    {
+        QHash<CCallsign, CInterpolationTraceRecorder::Records> records;
+        QString error;
+        if (!CInterpolationTraceRecorder::readFromFile(traceFile, records, &error))
+        {
+            return CStatusMessage(static_cast<CInterpolationLogger *>(nullptr)).error(u"Cannot convert trace: %1") << error;
+        }
+
+        // per callsign in time order, as the HTML/KML reports expect
+        QList<SituationLog> situationLogs;
+        QList<PartsLog> partsLogs;
+        QString csvSituations;
+        QString csvParts;
+        QList<CCallsign> traced = records.keys();
+        std::sort(traced.begin(), traced.end(), [](const CCallsign &a, const CCallsign &b) { return a.asString() < b.asString(); });
+        for (const CCallsign &cs : std::as_const(traced))
+        {
+            if (!callsigns.isEmpty() && !callsigns.contains(cs)) { continue; }
+            const CInterpolationTraceRecorder::Records &r = records[cs];
+            for (const SituationTraceRecord &record : r.situations) { situationLogs.push_back(record.toLog(cs)); }
+            for (const PartsTraceRecord &record : r.parts) { partsLogs.push_back(record.toLog(cs)); }
+            csvSituations += CInterpolationTraceRecorder::toCsv(cs, r.situations, csvSituations.isEmpty());
+            csvParts += CInterpolationTraceRecorder::toCsv(cs, r.parts, csvParts.isEmpty());
+        }
+
+        const QString directory = outputDirectory.isEmpty() ? CSwiftDirectories::logDirectory() : outputDirectory;
+        const QString prefix = QFileInfo(traceFile).completeBaseName();
+        CStatusMessageList msgs = CInterpolationLogger::writeLogFiles(situationLogs, partsLogs, directory, prefix);
+
+        if (!csvSituations.isEmpty())
+        {
+            const QString fn = CFileUtils::appendFilePaths(directory, prefix % u"_situations.csv");
+            msgs.push_back(CInterpolationLogger::logStatusFileWriting(CFileUtils::writeStringToFile(csvSituations, fn), fn));
+        }
+        if (!csvParts.isEmpty())
+        {
+            const QString fn = CFileUtils::appendFilePaths(directory, prefix % u"_parts.csv");
+            msgs.push_back(CInterpolationLogger::logStatusFileWriting(CFileUtils::writeStringToFile(csvParts, fn), fn));
+        }
+        return msgs;
+    }
+
     CStatusMessageList CInterpolationLogger::writeLogFiles(const QList<SituationLog> &interpolation, const QList<PartsLog> &parts)
+    {
+        const QString ts = QDateTime::currentDateTimeUtc().toString("yyyyMMddhhmmss");
+        return CInterpolationLogger::writeLogFiles(interpolation, parts, CSwiftDirectories::logDirectory(), ts);
+    }
+
+    CStatusMessageList CInterpolationLogger::writeLogFiles(const QList<SituationLog> &interpolation, const QList<PartsLog> &parts, const QString &directory, const QString &prefix)
     {
         if (parts.isEmpty() && interpolation.isEmpty()) { return CStatusMessage(static_cast<CInterpolationLogger *>(nullptr)).warning(u"No data for log"); }
         static const QString html = QStringLiteral("Entries: %1\n\n%2");
         const QString htmlTemplate = CFileUtils::readFileToString(CSwiftDirectories::htmlTemplateFilePath());
 
         CStatusMessageList msgs;
-        const QString ts = QDateTime::currentDateTimeUtc().toString("yyyyMMddhhmmss");
+        const QString &ts = prefix;
 
         const QString htmlInterpolation = CInterpolationLogger::getHtmlInterpolationLog(interpolation);
         if (!htmlInterpolation.isEmpty())
         {
             QString file = filePatternInterpolationLog();
             file.remove('*');
-            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1 %2").arg(ts, file));
+            const QString fn = CFileUtils::appendFilePaths(directory, QStringLiteral("%1 %2").arg(ts, file));
             const bool s = CFileUtils::writeStringToFile(htmlTemplate.arg(html.arg(interpolation.size()).arg(htmlInterpolation)), fn);
             msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
         }
@@ -118,7 +189,7 @@ namespace BlackMisc::Simulation
         {
             QString file = filePatternPartsLog();
             file.remove('*');
-            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1 %2").arg(ts, file));
+            const QString fn = CFileUtils::appendFilePaths(directory, QStringLiteral("%1 %2").arg(ts, file));
             const bool s = CFileUtils::writeStringToFile(htmlTemplate.arg(html.arg(parts.size()).arg(htmlParts)), fn);
             msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
         }
@@ -126,7 +197,7 @@ namespace BlackMisc::Simulation
         QString kml = CKmlUtils::wrapAsKmlDocument(CInterpolationLogger::getKmlChangedSituations(interpolation));
         if (!kml.isEmpty())
         {
-            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1_changedSituations.kml").arg(ts));
+            const QString fn = CFileUtils::appendFilePaths(directory, QStringLiteral("%1_changedSituations.kml").arg(ts));
             const bool s = CFileUtils::writeStringToFile(kml, fn);
             msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
         }
@@ -134,7 +205,7 @@ namespace BlackMisc::Simulation
         kml = CKmlUtils::wrapAsKmlDocument(CInterpolationLogger::getKmlInterpolatedSituations(interpolation));
         if (!kml.isEmpty())
         {
-            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1_interpolatedSituations.kml").arg(ts));
+            const QString fn = CFileUtils::appendFilePaths(directory, QStringLiteral("%1_interpolatedSituations.kml").arg(ts));
             const bool s = CFileUtils::writeStringToFile(kml, fn);
             msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
         }
@@ -142,7 +213,7 @@ namespace BlackMisc::Simulation
         kml = CKmlUtils::wrapAsKmlDocument(CInterpolationLogger::getKmlElevations(interpolation));
         if (!kml.isEmpty())
         {
-            const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1_elevations.kml").arg(ts));
+            const QString fn = CFileUtils::appendFilePaths(directory, QStringLiteral("%1_elevations.kml").arg(ts));
             const bool s = CFileUtils::writeStringToFile(kml, fn);
             msgs.push_back(CInterpolationLogger::logStatusFileWriting(s, fn));
         }
@@ -173,6 +244,16 @@ namespace BlackMisc::Simulation
         m_partsLogs.push_back(log);
     }
 
+    void CInterpolationLogger::traceInterpolation(const SituationLog &log)
+    {
+        m_traceRecorder.recordSituation(log.callsign, SituationTraceRecord::fromLog(log));
+    }
+
+    void CInterpolationLogger::traceParts(const PartsLog &log)
+    {
+        m_traceRecorder.recordParts(log.callsign, PartsTraceRecord::fromLog(log));
+    }
+
     void CInterpolationLogger::setMaxSituations(int max)
     {
         QReadLocker l(&m_lockSituations);
@@ -283,6 +364,12 @@ namespace BlackMisc::Simulation
         return p;
     }
 
+    const QString &CInterpolationLogger::filePatternTrace()
+    {
+        static const QString p("*interpolation.trace");
+        return p;
+    }
+
     const QStringList &CInterpolationLogger::filePatterns()
     {
         static const QStringList l({ filePatternInterpolationLog(), filePatternPartsLog() });
@@ -12,6 +12,7 @@
 #define BLACKMISC_SIMULATION_INTERPOLATIONLOGGER_H
 
 #include "blackmisc/simulation/interpolationrenderingsetup.h"
+#include "blackmisc/simulation/interpolationtrace.h"
 #include "blackmisc/simulation/remoteaircraftprovider.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/aircraftpartslist.h"
@@ -21,6 +22,7 @@
 #include <QObject>
 #include <QStringList>
 #include <QtGlobal>
+#include <atomic>
 
 namespace BlackMisc
 {
@@ -132,6 +134,38 @@ namespace BlackMisc
             //! Max.situations logged
             void setMaxSituations(int max);
 
+            //! Continuous binary tracing of all aircraft, independent of logging
+            //! \threadsafe
+            void setTracing(bool tracing) { m_tracing = tracing; }
+
+            //! Tracing?
+            //! \threadsafe
+            bool isTracing() const { return m_tracing; }
+
+            //! Trace current interpolation cycle as compact record
+            //! \threadsafe
+            void traceInterpolation(const SituationLog &log);
+
+            //! Trace current parts cycle as compact record
+            //! \threadsafe
+            void traceParts(const PartsLog &log);
+
+            //! Remove the trace of callsign, e.g. when the aircraft is removed
+            //! \threadsafe
+            void removeTrace(const Aviation::CCallsign &callsign) { m_traceRecorder.remove(callsign); }
+
+            //! The trace
+            const CInterpolationTraceRecorder &getTraceRecorder() const { return m_traceRecorder; }
+
+            //! Dump the trace to a binary file in background
+            CWorker *writeTraceInBackground();
+
+            //! Convert a binary trace file into the HTML and KML log files plus CSV files
+            //! \param traceFile trace file written by writeTraceInBackground
+            //! \param callsigns only these callsigns, all if empty
+            //! \param outputDirectory defaults to the log directory
+            static CStatusMessageList convertTraceFile(const QString &traceFile, const Aviation::CCallsignSet &callsigns = {}, const QString &outputDirectory = {});
+
             //! All situation logs
             //! \threadsafe
             QList<SituationLog> getSituationsLog() const;
@@ -186,6 +220,9 @@ namespace BlackMisc
             //! File pattern for parts log
             static const QString &filePatternPartsLog();
 
+            //! File pattern for binary trace
+            static const QString &filePatternTrace();
+
             //! All log.file patterns
             static const QStringList &filePatterns();
 
@@ -217,6 +254,10 @@ namespace BlackMisc
             //! Write log to file
             static CStatusMessageList writeLogFiles(const QList<SituationLog> &interpolation, const QList<PartsLog> &getPartsLog);
 
+            //! Write log to file
+            //! \param prefix file names start with prefix
+            static CStatusMessageList writeLogFiles(const QList<SituationLog> &interpolation, const QList<PartsLog> &getPartsLog, const QString &directory, const QString &prefix);
+
             //! Status of file operation
             static CStatusMessage logStatusFileWriting(bool success, const QString &fileName);
 
@@ -225,6 +266,8 @@ namespace BlackMisc
             int m_maxSituations = 2500;              //!< max.number of situations
             QList<PartsLog> m_partsLogs;             //!< logs of parts
             QList<SituationLog> m_situationLogs;     //!< logs of interpolation
+            std::atomic_bool m_tracing { false };    //!< binary tracing
+            CInterpolationTraceRecorder m_traceRecorder; //!< binary trace of all aircraft
         };
     } // namespace
 } // namespace
@@ -0,0 +1,405 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/simulation/interpolationtrace.h"
+#include "blackmisc/simulation/interpolationlogger.h"
+#include "blackmisc/aviation/aircraftengine.h"
+#include "blackmisc/aviation/aircraftlights.h"
+#include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/pq/units.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QMutexLocker>
+#include <QReadLocker>
+#include <QSaveFile>
+#include <QStringBuilder>
+#include <QWriteLocker>
+#include <cmath>
+#include <limits>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Simulation
+{
+    namespace
+    {
+        constexpr quint32 TraceMagic = 0x53545243; // "STRC"
+        constexpr quint16 TraceVersion = 1;
+
+        //! Length in ft, NaN if null
+        float toFtOrNaN(const CLength &length)
+        {
+            return length.isNull() ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>(length.value(CLengthUnit::ft()));
+        }
+
+        //! Situation from recorded values
+        CAircraftSituation toSituation(const CCallsign &callsign, qint64 ts, qint32 offsetMs, double latDeg, double lngDeg, double altFt, quint8 onGround)
+        {
+            CAircraftSituation situation(callsign, CCoordinateGeodetic(latDeg, lngDeg, altFt));
+            situation.setMSecsSinceEpoch(ts);
+            situation.setTimeOffsetMs(offsetMs);
+            situation.setOnGround(static_cast<CAircraftSituation::IsOnGround>(onGround));
+            return situation;
+        }
+
+        //! Number with fixed precision for CSV
+        QString csvNumber(double value, int precision)
+        {
+            return std::isnan(value) ? QString() : QString::number(value, 'f', precision);
+        }
+    }
+
+    SituationTraceRecord SituationTraceRecord::fromLog(const SituationLog &log)
+    {
+        const CAircraftSituation &oldSituation = log.oldestInterpolationSituation();
+        const CAircraftSituation &newSituation = log.newestInterpolationSituation();
+        const CAircraftSituation &current = log.situationCurrent;
+
+        SituationTraceRecord r;
+        r.tsCurrent = log.tsCurrent;
+        r.tsInterpolated = log.tsInterpolated;
+        r.tsOld = oldSituation.getMSecsSinceEpoch();
+        r.tsNew = newSituation.getMSecsSinceEpoch();
+        r.timeOffsetOldMs = static_cast<qint32>(oldSituation.getTimeOffsetMs());
+        r.timeOffsetNewMs = static_cast<qint32>(newSituation.getTimeOffsetMs());
+        r.latitudeDeg = current.latitude().value(CAngleUnit::deg());
+        r.longitudeDeg = current.longitude().value(CAngleUnit::deg());
+        r.altitudeFt = current.getAltitude().value(CLengthUnit::ft());
+        r.oldLatitudeDeg = oldSituation.latitude().value(CAngleUnit::deg());
+        r.oldLongitudeDeg = oldSituation.longitude().value(CAngleUnit::deg());
+        r.oldAltitudeFt = oldSituation.getAltitude().value(CLengthUnit::ft());
+        r.newLatitudeDeg = newSituation.latitude().value(CAngleUnit::deg());
+        r.newLongitudeDeg = newSituation.longitude().value(CAngleUnit::deg());
+        r.newAltitudeFt = newSituation.getAltitude().value(CLengthUnit::ft());
+        r.groundElevationFt = current.hasGroundElevation() ? static_cast<float>(current.getGroundElevation().value(CLengthUnit::ft())) : std::numeric_limits<float>::quiet_NaN();
+        r.groundFactor = static_cast<float>(log.groundFactor);
+        r.simTimeFraction = static_cast<float>(log.simTimeFraction);
+        r.deltaSampleTimesMs = static_cast<float>(log.deltaSampleTimesMs);
+        r.cgFt = toFtOrNaN(log.cgAboveGround);
+        r.noNetworkSituations = log.noNetworkSituations;
+        r.noInvalidSituations = log.noInvalidSituations;
+        r.interpolator = static_cast<quint8>(log.interpolator.toLatin1());
+        r.flags = static_cast<quint8>((log.useParts ? UseParts : 0) | (log.vtolAircraft ? VtolAircraft : 0) | (log.interpolantRecalc ? InterpolantRecalc : 0));
+        r.onGroundOld = static_cast<quint8>(oldSituation.getOnGround());
+        r.onGroundNew = static_cast<quint8>(newSituation.getOnGround());
+        r.onGroundCur = static_cast<quint8>(current.getOnGround());
+        return r;
+    }
+
+    SituationLog SituationTraceRecord::toLog(const CCallsign &callsign) const
+    {
+        SituationLog log;
+        log.callsign = callsign;
+        log.interpolator = QChar::fromLatin1(static_cast<char>(interpolator));
+        log.tsCurrent = tsCurrent;
+        log.tsInterpolated = tsInterpolated;
+        log.groundFactor = static_cast<double>(groundFactor);
+        log.simTimeFraction = static_cast<double>(simTimeFraction);
+        log.deltaSampleTimesMs = static_cast<double>(deltaSampleTimesMs);
+        log.useParts = this->hasFlag(UseParts);
+        log.vtolAircraft = this->hasFlag(VtolAircraft);
+        log.interpolantRecalc = this->hasFlag(InterpolantRecalc);
+        log.noNetworkSituations = noNetworkSituations;
+        log.noInvalidSituations = noInvalidSituations;
+        log.cgAboveGround = std::isnan(cgFt) ? CLength::null() : CLength(static_cast<double>(cgFt), CLengthUnit::ft());
+        log.interpolationSituations.push_back(toSituation(callsign, tsOld, timeOffsetOldMs, oldLatitudeDeg, oldLongitudeDeg, oldAltitudeFt, onGroundOld));
+        log.interpolationSituations.push_back(toSituation(callsign, tsNew, timeOffsetNewMs, newLatitudeDeg, newLongitudeDeg, newAltitudeFt, onGroundNew));
+        log.situationCurrent = toSituation(callsign, tsInterpolated, 0, latitudeDeg, longitudeDeg, altitudeFt, onGroundCur);
+        log.situationCurrent.setOnGroundFactor(static_cast<double>(groundFactor));
+        if (!std::isnan(groundElevationFt))
+        {
+            log.situationCurrent.setGroundElevation(CAltitude(static_cast<double>(groundElevationFt), CAltitude::MeanSeaLevel, CLengthUnit::ft()), CAircraftSituation::Interpolated);
+        }
+        if (!log.cgAboveGround.isNull()) { log.situationCurrent.setCG(log.cgAboveGround); }
+        return log;
+    }
+
+    PartsTraceRecord PartsTraceRecord::fromLog(const PartsLog &log)
+    {
+        const CAircraftParts &parts = log.parts;
+        const CAircraftLights lights = parts.getLights();
+        PartsTraceRecord r;
+        r.tsCurrent = log.tsCurrent;
+        r.noNetworkParts = log.noNetworkParts;
+        r.flapsPercent = parts.getFlapsPercent();
+        r.flags = static_cast<quint16>((log.empty ? Empty : 0) | (parts.isGearDown() ? GearDown : 0) | (parts.isSpoilersOut() ? SpoilersOut : 0) |
+                                       (parts.isOnGround() ? OnGround : 0) | (parts.isNull() ? NullParts : 0));
+        r.lights = static_cast<quint8>((lights.isStrobeOn() ? Strobe : 0) | (lights.isLandingOn() ? Landing : 0) | (lights.isTaxiOn() ? Taxi : 0) | (lights.isBeaconOn() ? Beacon : 0) |
+                                       (lights.isNavOn() ? Nav : 0) | (lights.isLogoOn() ? Logo : 0) | (lights.isRecognitionOn() ? Recognition : 0) | (lights.isCabinOn() ? Cabin : 0));
+        const CAircraftEngineList engines = parts.getEngines();
+        r.enginesCount = static_cast<quint8>(qMin(engines.size(), 255));
+        int bit = 0;
+        for (const CAircraftEngine &engine : engines)
+        {
+            if (bit >= 8) { break; }
+            if (engine.isOn()) { r.engines |= static_cast<quint8>(1 << bit); }
+            bit++;
+        }
+        return r;
+    }
+
+    PartsLog PartsTraceRecord::toLog(const CCallsign &callsign) const
+    {
+        PartsLog log;
+        log.callsign = callsign;
+        log.tsCurrent = tsCurrent;
+        log.noNetworkParts = noNetworkParts;
+        log.empty = this->hasFlag(Empty);
+        if (this->hasFlag(NullParts))
+        {
+            log.parts = CAircraftParts::null();
+            return log;
+        }
+
+        const CAircraftLights aircraftLights(lights & Strobe, lights & Landing, lights & Taxi, lights & Beacon, lights & Nav, lights & Logo, lights & Recognition, lights & Cabin);
+        CAircraftEngineList engineList;
+        for (int e = 0; e < enginesCount; e++)
+        {
+            engineList.push_back(CAircraftEngine(e + 1, e < 8 && (engines & (1 << e))));
+        }
+        log.parts = CAircraftParts(aircraftLights, this->hasFlag(GearDown), flapsPercent, this->hasFlag(SpoilersOut), engineList, this->hasFlag(OnGround));
+        return log;
+    }
+
+    template <typename T>
+    void CInterpolationTraceRecorder::Ring<T>::append(const T &record, int capacity)
+    {
+        if (records.size() < capacity)
+        {
+            if (records.isEmpty()) { records.reserve(qMin(capacity, 64)); }
+            records.push_back(record);
+            return;
+        }
+        records[next] = record;
+        next = (next + 1) % capacity;
+    }
+
+    template <typename T>
+    QVector<T> CInterpolationTraceRecorder::Ring<T>::ordered() const
+    {
+        if (next == 0) { return records; }
+        QVector<T> ordered;
+        ordered.reserve(records.size());
+        ordered.append(records.mid(next));
+        ordered.append(records.mid(0, next));
+        return ordered;
+    }
+
+    CInterpolationTraceRecorder::CInterpolationTraceRecorder(int situationsPerCallsign, int partsPerCallsign) :
+        m_situationsPerCallsign(qMax(1, situationsPerCallsign)), m_partsPerCallsign(qMax(1, partsPerCallsign))
+    { }
+
+    void CInterpolationTraceRecorder::recordSituation(const CCallsign &callsign, const SituationTraceRecord &record)
+    {
+        const QSharedPointer<Channel> c = this->channel(callsign);
+        QMutexLocker l(&c->mutex);
+        c->situations.append(record, m_situationsPerCallsign);
+    }
+
+    void CInterpolationTraceRecorder::recordParts(const CCallsign &callsign, const PartsTraceRecord &record)
+    {
+        const QSharedPointer<Channel> c = this->channel(callsign);
+        QMutexLocker l(&c->mutex);
+        c->parts.append(record, m_partsPerCallsign);
+    }
+
+    void CInterpolationTraceRecorder::clear()
+    {
+        QWriteLocker l(&m_lock);
+        m_channels.clear();
+    }
+
+    void CInterpolationTraceRecorder::remove(const CCallsign &callsign)
+    {
+        QWriteLocker l(&m_lock);
+        m_channels.remove(callsign);
+    }
+
+    CCallsignSet CInterpolationTraceRecorder::getCallsigns() const
+    {
+        QReadLocker l(&m_lock);
+        CCallsignSet callsigns;
+        for (auto it = m_channels.cbegin(); it != m_channels.cend(); ++it) { callsigns.insert(it.key()); }
+        return callsigns;
+    }
+
+    CInterpolationTraceRecorder::Records CInterpolationTraceRecorder::getRecords(const CCallsign &callsign) const
+    {
+        QSharedPointer<Channel> c;
+        {
+            QReadLocker l(&m_lock);
+            c = m_channels.value(callsign);
+        }
+        if (!c) { return {}; }
+        QMutexLocker l(&c->mutex);
+        return { c->situations.ordered(), c->parts.ordered() };
+    }
+
+    QHash<CCallsign, CInterpolationTraceRecorder::Records> CInterpolationTraceRecorder::getAllRecords() const
+    {
+        QHash<CCallsign, QSharedPointer<Channel>> channels;
+        {
+            QReadLocker l(&m_lock);
+            channels = m_channels;
+        }
+        QHash<CCallsign, Records> records;
+        for (auto it = channels.cbegin(); it != channels.cend(); ++it)
+        {
+            QMutexLocker l(&it.value()->mutex);
+            records.insert(it.key(), { it.value()->situations.ordered(), it.value()->parts.ordered() });
+        }
+        return records;
+    }
+
+    qint64 CInterpolationTraceRecorder::getMemoryBytes() const
+    {
+        QReadLocker l(&m_lock);
+        qint64 bytes = 0;
+        for (const QSharedPointer<Channel> &c : m_channels)
+        {
+            QMutexLocker cl(&c->mutex);
+            bytes += c->situations.records.capacity() * static_cast<qint64>(sizeof(SituationTraceRecord)) +
+                     c->parts.records.capacity() * static_cast<qint64>(sizeof(PartsTraceRecord));
+        }
+        return bytes;
+    }
+
+    bool CInterpolationTraceRecorder::writeToFile(const QString &fileName) const
+    {
+        return CInterpolationTraceRecorder::writeToFile(this->getAllRecords(), fileName);
+    }
+
+    bool CInterpolationTraceRecorder::writeToFile(const QHash<CCallsign, Records> &records, const QString &fileName)
+    {
+        QSaveFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly)) { return false; }
+
+        // header in QDataStream format, records as raw data in host byte order
+        QDataStream stream(&file);
+        stream << TraceMagic << TraceVersion << static_cast<quint16>(sizeof(SituationTraceRecord)) << static_cast<quint16>(sizeof(PartsTraceRecord)) << static_cast<qint32>(records.size());
+        for (auto it = records.cbegin(); it != records.cend(); ++it)
+        {
+            const QVector<SituationTraceRecord> &situations = it.value().situations;
+            const QVector<PartsTraceRecord> &parts = it.value().parts;
+            stream << it.key().asString();
+            stream << static_cast<qint32>(situations.size());
+            stream.writeRawData(reinterpret_cast<const char *>(situations.constData()), situations.size() * static_cast<int>(sizeof(SituationTraceRecord)));
+            stream << static_cast<qint32>(parts.size());
+            stream.writeRawData(reinterpret_cast<const char *>(parts.constData()), parts.size() * static_cast<int>(sizeof(PartsTraceRecord)));
+        }
+        if (stream.status() != QDataStream::Ok) { file.cancelWriting(); return false; }
+        return file.commit();
+    }
+
+    bool CInterpolationTraceRecorder::readFromFile(const QString &fileName, QHash<CCallsign, Records> &records, QString *errorMessage)
+    {
+        const auto fail = [errorMessage](const QString &message)
+        {
+            if (errorMessage) { *errorMessage = message; }
+            return false;
+        };
+
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly)) { return fail(QStringLiteral("Cannot open '%1'").arg(fileName)); }
+        QDataStream stream(&file);
+        quint32 magic = 0;
+        quint16 version = 0;
+        quint16 situationSize = 0;
+        quint16 partsSize = 0;
+        qint32 channels = 0;
+        stream >> magic >> version >> situationSize >> partsSize >> channels;
+        if (magic != TraceMagic) { return fail(QStringLiteral("'%1' is no interpolation trace").arg(fileName)); }
+        if (version != TraceVersion || situationSize != sizeof(SituationTraceRecord) || partsSize != sizeof(PartsTraceRecord))
+        {
+            return fail(QStringLiteral("Unsupported trace version %1 (record sizes %2/%3)").arg(version).arg(situationSize).arg(partsSize));
+        }
+
+        records.clear();
+        for (int c = 0; c < channels && stream.status() == QDataStream::Ok; c++)
+        {
+            QString callsign;
+            qint32 count = 0;
+            Records channelRecords;
+            stream >> callsign >> count;
+            if (count < 0 || count > file.size() / static_cast<qint64>(sizeof(SituationTraceRecord))) { return fail(QStringLiteral("Corrupt trace, '%1'").arg(callsign)); }
+            channelRecords.situations.resize(count);
+            stream.readRawData(reinterpret_cast<char *>(channelRecords.situations.data()), count * static_cast<int>(sizeof(SituationTraceRecord)));
+            stream >> count;
+            if (count < 0 || count > file.size() / static_cast<qint64>(sizeof(PartsTraceRecord))) { return fail(QStringLiteral("Corrupt trace, '%1'").arg(callsign)); }
+            channelRecords.parts.resize(count);
+            stream.readRawData(reinterpret_cast<char *>(channelRecords.parts.data()), count * static_cast<int>(sizeof(PartsTraceRecord)));
+            records.insert(CCallsign(callsign), channelRecords);
+        }
+        if (stream.status() != QDataStream::Ok) { return fail(QStringLiteral("Truncated trace '%1'").arg(fileName)); }
+        return true;
+    }
+
+    QString CInterpolationTraceRecorder::toCsv(const CCallsign &callsign, const QVector<SituationTraceRecord> &records, bool withHeader)
+    {
+        QString csv;
+        csv.reserve(records.size() * 200);
+        if (withHeader)
+        {
+            csv += QStringLiteral("callsign;interpolator;ts;ts interpolated;ts old;ts new;fraction;sample dt ms;lat;lng;alt ft;lat old;lng old;alt old ft;lat new;lng new;alt new ft;"
+                                  "elv ft;gnd factor;on gnd old;on gnd new;on gnd;cg ft;recalc;parts;vtol;#situations;#invalid\n");
+        }
+        const QString cs = callsign.asString();
+        for (const SituationTraceRecord &r : records)
+        {
+            csv += cs % u';' % QChar::fromLatin1(static_cast<char>(r.interpolator)) % u';' %
+                   QString::number(r.tsCurrent) % u';' % QString::number(r.tsInterpolated) % u';' % QString::number(r.tsOld) % u';' % QString::number(r.tsNew) % u';' %
+                   csvNumber(static_cast<double>(r.simTimeFraction), 4) % u';' % csvNumber(static_cast<double>(r.deltaSampleTimesMs), 1) % u';' %
+                   csvNumber(r.latitudeDeg, 7) % u';' % csvNumber(r.longitudeDeg, 7) % u';' % csvNumber(r.altitudeFt, 1) % u';' %
+                   csvNumber(r.oldLatitudeDeg, 7) % u';' % csvNumber(r.oldLongitudeDeg, 7) % u';' % csvNumber(r.oldAltitudeFt, 1) % u';' %
+                   csvNumber(r.newLatitudeDeg, 7) % u';' % csvNumber(r.newLongitudeDeg, 7) % u';' % csvNumber(r.newAltitudeFt, 1) % u';';
+            csv += csvNumber(static_cast<double>(r.groundElevationFt), 1) % u';' % csvNumber(static_cast<double>(r.groundFactor), 3) % u';' %
+                   QString::number(r.onGroundOld) % u';' % QString::number(r.onGroundNew) % u';' % QString::number(r.onGroundCur) % u';' %
+                   csvNumber(static_cast<double>(r.cgFt), 1) % u';' %
+                   QString::number(r.hasFlag(SituationTraceRecord::InterpolantRecalc)) % u';' % QString::number(r.hasFlag(SituationTraceRecord::UseParts)) % u';' %
+                   QString::number(r.hasFlag(SituationTraceRecord::VtolAircraft)) % u';' %
+                   QString::number(r.noNetworkSituations) % u';' % QString::number(r.noInvalidSituations) % u'\n';
+        }
+        return csv;
+    }
+
+    QString CInterpolationTraceRecorder::toCsv(const CCallsign &callsign, const QVector<PartsTraceRecord> &records, bool withHeader)
+    {
+        QString csv;
+        if (withHeader) { csv += QStringLiteral("callsign;ts;empty;null;gear down;flaps %;spoilers out;on gnd;lights;engines on;engines;#parts\n"); }
+        const QString cs = callsign.asString();
+        for (const PartsTraceRecord &r : records)
+        {
+            csv += cs % u';' % QString::number(r.tsCurrent) % u';' %
+                   QString::number(r.hasFlag(PartsTraceRecord::Empty)) % u';' % QString::number(r.hasFlag(PartsTraceRecord::NullParts)) % u';' %
+                   QString::number(r.hasFlag(PartsTraceRecord::GearDown)) % u';' % QString::number(r.flapsPercent) % u';' %
+                   QString::number(r.hasFlag(PartsTraceRecord::SpoilersOut)) % u';' % QString::number(r.hasFlag(PartsTraceRecord::OnGround)) % u';' %
+                   QString::number(r.lights, 2).rightJustified(8, '0') % u';' % QString::number(r.engines, 2).rightJustified(8, '0') % u';' %
+                   QString::number(r.enginesCount) % u';' % QString::number(r.noNetworkParts) % u'\n';
+        }
+        return csv;
+    }
+
+    QSharedPointer<CInterpolationTraceRecorder::Channel> CInterpolationTraceRecorder::channel(const CCallsign &callsign)
+    {
+        {
+            QReadLocker l(&m_lock);
+            const auto it = m_channels.constFind(callsign);
+            if (it != m_channels.cend()) { return it.value(); }
+        }
+        QWriteLocker l(&m_lock);
+        QSharedPointer<Channel> &c = m_channels[callsign];
+        if (!c) { c = QSharedPointer<Channel>::create(); }
+        return c;
+    }
+} // ns
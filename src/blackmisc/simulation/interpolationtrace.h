@@ -0,0 +1,236 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_INTERPOLATIONTRACE_H
+#define BLACKMISC_SIMULATION_INTERPOLATIONTRACE_H
+
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QReadWriteLock>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+#include <type_traits>
+
+namespace BlackMisc::Simulation
+{
+    struct SituationLog;
+    struct PartsLog;
+
+    //! Compact fixed size record of one situation interpolation
+    //! \remark no implicitly shared members, so it can be copied in and out of the trace with memcpy
+    struct BLACKMISC_EXPORT SituationTraceRecord
+    {
+        //! Flags
+        enum Flag
+        {
+            UseParts          = 1 << 0, //!< supporting aircraft parts
+            VtolAircraft      = 1 << 1, //!< VTOL aircraft
+            InterpolantRecalc = 1 << 2  //!< interpolant recalculated
+        };
+
+        qint64 tsCurrent      = -1; //!< current timestamp
+        qint64 tsInterpolated = -1; //!< timestamp interpolated
+        qint64 tsOld          = -1; //!< timestamp oldest interpolation situation
+        qint64 tsNew          = -1; //!< timestamp newest interpolation situation
+        double latitudeDeg     = 0; //!< interpolated latitude
+        double longitudeDeg    = 0; //!< interpolated longitude
+        double altitudeFt      = 0; //!< interpolated altitude
+        double oldLatitudeDeg  = 0; //!< oldest situation latitude
+        double oldLongitudeDeg = 0; //!< oldest situation longitude
+        double oldAltitudeFt   = 0; //!< oldest situation altitude
+        double newLatitudeDeg  = 0; //!< newest situation latitude
+        double newLongitudeDeg = 0; //!< newest situation longitude
+        double newAltitudeFt   = 0; //!< newest situation altitude
+        float groundElevationFt  = 0;  //!< interpolated ground elevation, NaN if none
+        float groundFactor       = -1; //!< ground factor
+        float simTimeFraction    = -1; //!< time fraction, expected 0..1
+        float deltaSampleTimesMs = -1; //!< delta time between samples
+        float cgFt               = 0;  //!< center of gravity, NaN if none
+        qint32 timeOffsetOldMs   = 0;  //!< time offset oldest situation
+        qint32 timeOffsetNewMs   = 0;  //!< time offset newest situation
+        qint32 noNetworkSituations = 0; //!< available network situations
+        qint32 noInvalidSituations = 0; //!< invalid situations
+        quint8 interpolator = 0; //!< 's' spline, 'l' linear
+        quint8 flags        = 0; //!< Flag
+        quint8 onGroundOld  = 0; //!< BlackMisc::Aviation::CAircraftSituation::IsOnGround oldest situation
+        quint8 onGroundNew  = 0; //!< BlackMisc::Aviation::CAircraftSituation::IsOnGround newest situation
+        quint8 onGroundCur  = 0; //!< BlackMisc::Aviation::CAircraftSituation::IsOnGround interpolated
+
+        //! Flag set?
+        bool hasFlag(Flag flag) const { return flags & flag; }
+
+        //! From log entry
+        static SituationTraceRecord fromLog(const SituationLog &log);
+
+        //! Back to a log entry, as far as recorded
+        SituationLog toLog(const Aviation::CCallsign &callsign) const;
+    };
+
+    //! Compact fixed size record of one parts interpolation
+    struct BLACKMISC_EXPORT PartsTraceRecord
+    {
+        //! Flags
+        enum Flag
+        {
+            Empty       = 1 << 0, //!< empty parts
+            GearDown    = 1 << 1, //!< gear down
+            SpoilersOut = 1 << 2, //!< spoilers out
+            OnGround    = 1 << 3, //!< on ground
+            NullParts   = 1 << 4  //!< null parts
+        };
+
+        //! Lights, bit per light
+        enum Light
+        {
+            Strobe      = 1 << 0, //!< strobe
+            Landing     = 1 << 1, //!< landing
+            Taxi        = 1 << 2, //!< taxi
+            Beacon      = 1 << 3, //!< beacon
+            Nav         = 1 << 4, //!< nav
+            Logo        = 1 << 5, //!< logo
+            Recognition = 1 << 6, //!< recognition
+            Cabin       = 1 << 7  //!< cabin
+        };
+
+        qint64 tsCurrent = -1;    //!< current timestamp
+        qint32 noNetworkParts = 0; //!< available network parts
+        qint32 flapsPercent = 0;  //!< flaps
+        quint16 flags = 0;        //!< Flag
+        quint8 lights = 0;        //!< Light
+        quint8 engines = 0;       //!< bit per engine on, first 8 engines
+        quint8 enginesCount = 0;  //!< number of engines
+
+        //! Flag set?
+        bool hasFlag(Flag flag) const { return flags & flag; }
+
+        //! From log entry
+        static PartsTraceRecord fromLog(const PartsLog &log);
+
+        //! Back to a log entry
+        PartsLog toLog(const Aviation::CCallsign &callsign) const;
+    };
+
+    static_assert(std::is_trivially_copyable_v<SituationTraceRecord>, "Records are written as raw data");
+    static_assert(std::is_trivially_copyable_v<PartsTraceRecord>, "Records are written as raw data");
+
+    /*!
+     * Continuous binary trace of situation and parts interpolation, for all aircraft.
+     *
+     * Each callsign has fixed size ring buffers of records, so tracing can stay on during real sessions,
+     * the trace only keeps the latest records. The trace is dumped on demand and converted offline
+     * with CInterpolationLogger::convertTraceFile.
+     */
+    class BLACKMISC_EXPORT CInterpolationTraceRecorder
+    {
+    public:
+        //! Default records per callsign, 20secs at 50 updates per second
+        static constexpr int DefaultSituationsPerCallsign = 1000;
+
+        //! Default parts records per callsign
+        static constexpr int DefaultPartsPerCallsign = 500;
+
+        //! Records of a callsign, oldest first
+        struct Records
+        {
+            QVector<SituationTraceRecord> situations; //!< situation records
+            QVector<PartsTraceRecord> parts;          //!< parts records
+        };
+
+        //! Constructor
+        CInterpolationTraceRecorder(int situationsPerCallsign = DefaultSituationsPerCallsign, int partsPerCallsign = DefaultPartsPerCallsign);
+
+        //! Record a situation interpolation
+        //! \threadsafe
+        void recordSituation(const Aviation::CCallsign &callsign, const SituationTraceRecord &record);
+
+        //! Record a parts interpolation
+        //! \threadsafe
+        void recordParts(const Aviation::CCallsign &callsign, const PartsTraceRecord &record);
+
+        //! Remove all records
+        //! \threadsafe
+        void clear();
+
+        //! Remove the records of callsign
+        //! \threadsafe
+        void remove(const Aviation::CCallsign &callsign);
+
+        //! Callsigns with records
+        //! \threadsafe
+        Aviation::CCallsignSet getCallsigns() const;
+
+        //! Records of callsign, oldest first
+        //! \threadsafe
+        Records getRecords(const Aviation::CCallsign &callsign) const;
+
+        //! Records of all callsigns
+        //! \threadsafe
+        QHash<Aviation::CCallsign, Records> getAllRecords() const;
+
+        //! Bytes used by the ring buffers
+        //! \threadsafe
+        qint64 getMemoryBytes() const;
+
+        //! Dump all records to a binary file
+        //! \threadsafe
+        bool writeToFile(const QString &fileName) const;
+
+        //! Write records to a binary file
+        static bool writeToFile(const QHash<Aviation::CCallsign, Records> &records, const QString &fileName);
+
+        //! Read a binary file written by writeToFile
+        static bool readFromFile(const QString &fileName, QHash<Aviation::CCallsign, Records> &records, QString *errorMessage = nullptr);
+
+        //! Situation records as CSV, one line per interpolation
+        static QString toCsv(const Aviation::CCallsign &callsign, const QVector<SituationTraceRecord> &records, bool withHeader = true);
+
+        //! Parts records as CSV
+        static QString toCsv(const Aviation::CCallsign &callsign, const QVector<PartsTraceRecord> &records, bool withHeader = true);
+
+    private:
+        //! Fixed size ring, grows up to its capacity
+        template <typename T>
+        struct Ring
+        {
+            QVector<T> records; //!< records
+            int next = 0;       //!< next index to overwrite once full
+
+            //! Append, overwrite the oldest record if full
+            void append(const T &record, int capacity);
+
+            //! Oldest first
+            QVector<T> ordered() const;
+        };
+
+        //! Rings of one callsign
+        struct Channel
+        {
+            mutable QMutex mutex; //!< only contended while dumping
+            Ring<SituationTraceRecord> situations; //!< situations
+            Ring<PartsTraceRecord> parts;          //!< parts
+        };
+
+        //! Channel for callsign, created if not existing
+        QSharedPointer<Channel> channel(const Aviation::CCallsign &callsign);
+
+        int m_situationsPerCallsign = DefaultSituationsPerCallsign;
+        int m_partsPerCallsign = DefaultPartsPerCallsign;
+        mutable QReadWriteLock m_lock; //!< lock for the channels hash, not for the records
+        QHash<Aviation::CCallsign, QSharedPointer<Channel>> m_channels;
+    };
+} // ns
+
+#endif // guard
@@ -23,6 +23,7 @@
 #include "blackmisc/logmessage.h"
 #include "blackmisc/verify.h"
 #include "blackmisc/stringutils.h"
+#include "blackmisc/tracer.h"
 #include <QTimer>
 #include <QDateTime>
 #include <QStringBuilder>
@@ -220,6 +221,7 @@ namespace BlackMisc::Simulation
     template<typename Derived>
     CInterpolationResult CInterpolator<Derived>::getInterpolation(qint64 currentTimeSinceEpoc, const CInterpolationAndRenderingSetupPerCallsign &setup, int aircraftNumber)
     {
+        BLACK_TRACE_ZONE("Interpolation", "interpolation");
         CInterpolationResult result;
         do
         {
@@ -383,23 +385,29 @@ namespace BlackMisc::Simulation
             m_currentInterpolationStatus.setInterpolatedAndCheckSituation(valid, currentSituation);
         }
 
-        // logging
-        if (this->doLogging())
+        // logging, the trace only needs the values which go into its compact records
+        const bool logging = this->doLogging();
+        const bool tracing = this->doTracing();
+        if (logging || tracing)
         {
             log.tsCurrent = m_currentTimeMsSinceEpoch;
             log.callsign  = m_callsign;
             log.groundFactor      = currentSituation.getOnGroundFactor();
-            log.altCorrection     = CAircraftSituation::altitudeCorrectionToString(altCorrection);
             log.situationCurrent  = currentSituation;
             log.interpolantRecalc = interpolant.isRecalculated();
-            log.change        = m_pastSituationsChange;
-            log.usedSetup     = m_currentSetup;
-            log.elevationInfo = this->getElevationsFoundMissedInfo();
             log.cgAboveGround = currentSituation.getCG();
-            log.sceneryOffset = m_currentSceneryOffset;
             log.noInvalidSituations = m_invalidSituations;
             log.noNetworkSituations = m_currentSituations.sizeInt();
             log.useParts = this->isRemoteAircraftSupportingParts(m_callsign);
+            if (tracing) { m_logger->traceInterpolation(log); }
+        }
+        if (logging)
+        {
+            log.altCorrection = CAircraftSituation::altitudeCorrectionToString(altCorrection);
+            log.change        = m_pastSituationsChange;
+            log.usedSetup     = m_currentSetup;
+            log.elevationInfo = this->getElevationsFoundMissedInfo();
+            log.sceneryOffset = m_currentSceneryOffset;
             m_logger->logInterpolation(log);
 
             // if (log.interpolantRecalc) { CLogMessage(this).debug(u"Recalc %1") << log.callsign.asString(); }
@@ -518,6 +526,12 @@ namespace BlackMisc::Simulation
         return this->hasAttachedLogger() &&  m_currentSetup.logInterpolation();
     }
 
+    template<typename Derived>
+    bool CInterpolator<Derived>::doTracing() const
+    {
+        return this->hasAttachedLogger() && m_logger->isTracing();
+    }
+
     template<typename Derived>
     CAircraftParts CInterpolator<Derived>::guessParts(const CAircraftSituation &situation, const CAircraftSituationChange &change, const CAircraftModel &model)
     {
@@ -651,14 +665,17 @@ namespace BlackMisc::Simulation
     template<typename Derived>
     void CInterpolator<Derived>::logParts(const CAircraftParts &parts, int partsNo, bool empty) const
     {
-        if (!this->doLogging()) { return; }
+        const bool logging = this->doLogging();
+        const bool tracing = this->doTracing();
+        if (!logging && !tracing) { return; }
         PartsLog logInfo;
         logInfo.callsign = m_callsign;
         logInfo.noNetworkParts = partsNo;
         logInfo.tsCurrent = m_currentTimeMsSinceEpoch;
         logInfo.parts = parts;
         logInfo.empty = empty;
-        m_logger->logParts(logInfo);
+        if (tracing) { m_logger->traceParts(logInfo); }
+        if (logging) { m_logger->logParts(logInfo); }
     }
 
     template<typename Derived>
@@ -275,6 +275,9 @@ namespace BlackMisc
             //! Do logging
             bool doLogging() const;
 
+            //! Do binary tracing
+            bool doTracing() const;
+
             //! Decides threshold when situation is considered on ground
             //! \sa BlackMisc::Aviation::CAircraftSituation::setOnGroundFromGroundFactorFromInterpolation
             static double groundInterpolationFactor();
@@ -214,7 +214,7 @@ namespace BlackMisc::Simulation
         currentSituation.setMSecsSinceEpoch(interpolatedTime);
         m_currentInterpolationStatus.setInterpolatedAndCheckSituation(true, currentSituation);
 
-        if (this->doLogging())
+        if (this->doLogging() || this->doTracing())
         {
             log.tsCurrent = m_currentTimeMsSinceEpoch;
             log.deltaSampleTimesMs = sampleDeltaTimeMs;
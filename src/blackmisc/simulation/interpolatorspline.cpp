@@ -266,7 +266,7 @@ namespace BlackMisc::Simulation
         m_interpolant.setTimes(m_currentTimeMsSinceEpoch, timeFraction, interpolatedTime);
         m_interpolant.setRecalculated(recalculate);
 
-        if (this->doLogging())
+        if (this->doLogging() || this->doTracing())
         {
             log.interpolationSituations.clear();
             log.interpolationSituations.push_back(m_s[0]);
@@ -9,15 +9,14 @@
 #include "blackmisc/simulation/remoteaircraftprovider.h"
 #include "blackmisc/simulation/matchingutils.h"
 #include "blackmisc/logmessage.h"
-#include "blackmisc/json.h"
 #include "blackmisc/verify.h"
 #include "blackmisc/stringutils.h"
+#include "blackmisc/tracer.h"
 #include "blackconfig/buildconfig.h"
 
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::PhysicalQuantities;
 using namespace BlackMisc::Geo;
-using namespace BlackMisc::Json;
 using namespace BlackConfig;
 
 namespace BlackMisc::Simulation
@@ -209,6 +208,16 @@ namespace BlackMisc::Simulation
         m_reverseLookupMessages.remove(callsign);
     }
 
+    void CRemoteAircraftProvider::compactReverseLookupMessages(const CCallsign &callsign)
+    {
+        QWriteLocker l(&m_lockMessages);
+        if (m_enableReverseLookupMsgs.testFlag(RevLogEnabled) && !m_enableReverseLookupMsgs.testFlag(RevLogSimplifiedInfo)) { return; } // details wanted
+        const auto it = m_reverseLookupMessages.find(callsign);
+        if (it == m_reverseLookupMessages.end() || it->size() <= IRemoteAircraftProvider::MinMessagesPerCallsign) { return; }
+        it->erase(it->begin(), it->end() - IRemoteAircraftProvider::MinMessagesPerCallsign);
+        it->squeeze();
+    }
+
     bool CRemoteAircraftProvider::addNewAircraftInRange(const CSimulatedAircraft &aircraft)
     {
         if (this->isAircraftInRange(aircraft.getCallsign())) { return false; }
@@ -255,6 +264,7 @@ namespace BlackMisc::Simulation
 
     CAircraftSituation CRemoteAircraftProvider::storeAircraftSituation(const CAircraftSituation &situation, bool allowTestAltitudeOffset)
     {
+        BLACK_TRACE_ZONE("Store situation", "provider");
         const CCallsign cs = situation.getCallsign();
         if (cs.isEmpty()) { return situation; }
 
@@ -275,6 +285,9 @@ namespace BlackMisc::Simulation
             this->updateCG(cs, situation.getCG());
         }
 
+        // aircraft in range, but not rendered, only keep a compacted history
+        const int maxSituations = this->isFullHistoryAircraft(cs) ? IRemoteAircraftProvider::MaxSituationsPerCallsign : IRemoteAircraftProvider::MinSituationsPerCallsign;
+
         // list from new to old
         CAircraftSituationList updatedSituations; // copy of updated situations
         {
@@ -287,7 +300,8 @@ namespace BlackMisc::Simulation
             const int situations = newSituationsList.size();
             if (situations < 1)
             {
-                newSituationsList.prefillLatestAdjustedFirst(situationCorrected, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+                // only prefill what is needed to interpolate, the history grows with the following situations
+                newSituationsList.prefillLatestAdjustedFirst(situationCorrected, IRemoteAircraftProvider::MinSituationsPerCallsign);
             }
             else if (!situationCorrected.hasVelocity() && newSituationsList.front().hasVelocity())
             {
@@ -296,7 +310,7 @@ namespace BlackMisc::Simulation
             else
             {
                 // newSituationsList.push_frontKeepLatestFirstIgnoreOverlapping(situationCorrected, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
-                newSituationsList.push_frontKeepLatestFirstAdjustOffset(situationCorrected, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+                newSituationsList.push_frontKeepLatestFirstAdjustOffset(situationCorrected, true, maxSituations);
                 newSituationsList.setAdjustedSortHint(CAircraftSituationList::AdjustedTimestampLatestFirst);
                 newSituationsList.transferElevationForward(); // transfer elevations, will do nothing if elevations already exist
 
@@ -352,9 +366,13 @@ namespace BlackMisc::Simulation
 
     void CRemoteAircraftProvider::storeAircraftParts(const CCallsign &callsign, const CAircraftParts &parts, bool removeOutdated)
     {
+        BLACK_TRACE_ZONE("Store parts", "provider");
         BLACK_VERIFY_X(!callsign.isEmpty(), Q_FUNC_INFO, "empty callsign");
         if (callsign.isEmpty()) { return; }
 
+        // aircraft in range, but not rendered, only keep a compacted history
+        const int maxParts = this->isFullHistoryAircraft(callsign) ? IRemoteAircraftProvider::MaxPartsPerCallsign : IRemoteAircraftProvider::MinPartsPerCallsign;
+
         // list sorted from new to old
         const qint64 ts = QDateTime::currentMSecsSinceEpoch();
         CAircraftPartsList correctiveParts;
@@ -363,7 +381,7 @@ namespace BlackMisc::Simulation
             m_partsAdded++;
             m_partsLastModified[callsign] = ts;
             CAircraftPartsList &partsList = m_partsByCallsign[callsign];
-            partsList.push_frontKeepLatestFirstAdjustOffset(parts, true, IRemoteAircraftProvider::MaxPartsPerCallsign);
+            partsList.push_frontKeepLatestFirstAdjustOffset(parts, true, maxParts);
             partsList.setAdjustedSortHint(CAircraftPartsList::AdjustedTimestampLatestFirst);
 
             // remove outdated parts (but never remove the most recent one)
@@ -405,64 +423,46 @@ namespace BlackMisc::Simulation
         emit this->addedAircraftParts(callsign, parts);
     }
 
-    void CRemoteAircraftProvider::storeAircraftParts(const CCallsign &callsign, const QJsonObject &jsonObject, qint64 currentOffsetMs)
+    void CRemoteAircraftProvider::storeAircraftParts(const CCallsign &callsign, const CAircraftPartsDelta &delta, qint64 currentOffsetMs)
     {
-        const CSimulatedAircraft remoteAircraft(this->getAircraftInRangeForCallsign(callsign));
-        const bool isFull  = jsonObject.value(CAircraftParts::attributeNameIsFullJson()).toBool();
-        const bool validCs = remoteAircraft.hasValidCallsign();
-        if (!validCs)
+        if (!delta.isValid()) { return; }
+        const bool isFull = delta.isFullData();
         {
-            if (!isFull) { return; } // incremental parts broadcasting
-            return; // suspicious
-        }
+            // only the flags are needed, avoid copying the whole aircraft
+            QReadLocker l(&m_lockAircraft);
+            const auto it = m_aircraftInRange.constFind(callsign);
+            if (it == m_aircraftInRange.constEnd() || !it->hasValidCallsign()) { return; } // also incremental parts broadcasting
 
-        // If we are not yet synchronized, we throw away any incremental packet
-        if (!remoteAircraft.isPartsSynchronized() && !isFull) { return; }
+            // If we are not yet synchronized, we throw away any incremental packet
+            if (!it->isPartsSynchronized() && !isFull) { return; }
+        }
 
         CAircraftParts parts;
-        try
+        bool incremental = !isFull;
+        if (isFull && CBuildConfig::isLocalDeveloperDebugBuild())
         {
-            if (isFull)
+            // validation in dev.env.
+            const int  attributes = delta.getAttributesCount();
+            const bool correctCount = (attributes == CAircraftParts::attributesCountFullJson);
+            BLACK_VERIFY_X(correctCount || !CBuildConfig::isLocalDeveloperDebugBuild(), Q_FUNC_INFO, "Wrong full aircraft parts");
+            if (!correctCount)
             {
-                if (CBuildConfig::isLocalDeveloperDebugBuild())
+                CLogMessage(this).warning(u"Wrong full parts attributes, %1 (expected %2)") << attributes << CAircraftParts::attributesCountFullJson;
+                if (attributes < 3)
                 {
-                    // validation in dev.env.
-                    const int  attributes = jsonObject.size();
-                    const bool correctCount = (attributes == CAircraftParts::attributesCountFullJson);
-                    BLACK_VERIFY_X(correctCount || !CBuildConfig::isLocalDeveloperDebugBuild(), Q_FUNC_INFO, "Wrong full aircraft parts");
-                    if (!correctCount)
-                    {
-                        CLogMessage(this).warning(u"Wrong full parts attributes, %1 (expected %2)") << attributes << CAircraftParts::attributesCountFullJson;
-                        //! \todo KB 2020-04 ignore? make incremental?
-                        if (attributes < 3)
-                        {
-                            // EXPERIMENTAL
-                            if (attributes < 1) { return; }
-
-                            // treat as incremental
-                            CLogMessage(this).warning(u"Treating %1 attributes as incremental") << attributes;
-                            parts = this->remoteAircraftParts(callsign).frontOrDefault(); // latest
-                            const QJsonObject config = applyIncrementalObject(parts.toJson(), jsonObject);
-                            parts.convertFromJson(config);
-                        }
-                    }
+                    // EXPERIMENTAL
+                    if (attributes < 1) { return; }
+
+                    // treat as incremental
+                    CLogMessage(this).warning(u"Treating %1 attributes as incremental") << attributes;
+                    incremental = true;
                 }
-                parts.convertFromJson(jsonObject);
-            }
-            else
-            {
-                // incremental update
-                parts = this->remoteAircraftParts(callsign).frontOrDefault(); // latest
-                const QJsonObject config = applyIncrementalObject(parts.toJson(), jsonObject);
-                parts.convertFromJson(config);
             }
         }
-        catch (const CJsonException &ex)
-        {
-            CStatusMessage message = CStatusMessage::fromJsonException(ex, this, "Invalid parts packet");
-            message.setSeverity(CStatusMessage::SeverityDebug);
-            CLogMessage::preformatted(message);
-        }
+
+        // patch the latest parts in place, no JSON round trip
+        if (incremental) { parts = this->remoteAircraftParts(callsign).frontOrDefault(); } // latest
+        delta.applyTo(parts);
 
         // make sure in any case right time and correct details
         parts.setCurrentUtcTime();
@@ -475,20 +475,24 @@ namespace BlackMisc::Simulation
         // history
         if (this->isAircraftPartsHistoryEnabled())
         {
-            const QJsonDocument doc(jsonObject);
-            const QString partsAsString = doc.toJson(QJsonDocument::Compact);
-            const CStatusMessage message(this, CStatusMessage::SeverityInfo, callsign.isEmpty() ? callsign.toQString() + ": " + partsAsString.trimmed() : partsAsString.trimmed());
+            this->storeAircraftPartsHistory(callsign, delta.toJsonString());
+        }
+    }
 
-            QReadLocker l(&m_lockPartsHistory);
-            if (m_aircraftPartsMessages.contains(callsign))
-            {
-                CStatusMessageList &msgs = m_aircraftPartsMessages[callsign];
-                msgs.push_back(message);
-            }
-            else
-            {
-                m_aircraftPartsMessages.insert(callsign, message);
-            }
+    void CRemoteAircraftProvider::storeAircraftPartsHistory(const CCallsign &callsign, const QString &partsAsString)
+    {
+        const CStatusMessage message(this, CStatusMessage::SeverityInfo, callsign.isEmpty() ? callsign.toQString() + ": " + partsAsString.trimmed() : partsAsString.trimmed());
+
+        QWriteLocker l(&m_lockPartsHistory);
+        if (m_aircraftPartsMessages.contains(callsign))
+        {
+            CStatusMessageList &msgs = m_aircraftPartsMessages[callsign];
+            msgs.push_back(message);
+            if (msgs.size() > IRemoteAircraftProvider::MaxMessagesPerCallsign) { msgs.erase(msgs.begin(), msgs.end() - IRemoteAircraftProvider::MaxMessagesPerCallsign); }
+        }
+        else
+        {
+            m_aircraftPartsMessages.insert(callsign, message);
         }
     }
 
@@ -496,9 +500,59 @@ namespace BlackMisc::Simulation
     {
         // a change with the same timestamp will be replaced
         const CCallsign cs(change.getCallsign());
+        const int maxChanges = this->isFullHistoryAircraft(cs) ? IRemoteAircraftProvider::MaxSituationsPerCallsign : IRemoteAircraftProvider::MinSituationsPerCallsign;
         QWriteLocker lock(&m_lockChanges);
         CAircraftSituationChangeList &changeList = m_changesByCallsign[cs];
-        changeList.push_frontKeepLatestAdjustedFirst(change, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+        changeList.push_frontKeepLatestAdjustedFirst(change, true, maxChanges);
+    }
+
+    bool CRemoteAircraftProvider::isFullHistoryAircraft(const CCallsign &callsign) const
+    {
+        // unknown aircraft keep the full history, e.g. situations stored before the aircraft is added
+        QReadLocker l(&m_lockAircraft);
+        const auto it = m_aircraftInRange.constFind(callsign);
+        return it == m_aircraftInRange.constEnd() || it->isRendered();
+    }
+
+    void CRemoteAircraftProvider::compactHistories(const CCallsignSet &callsigns)
+    {
+        if (callsigns.isEmpty()) { return; }
+        {
+            QWriteLocker l(&m_lockSituations);
+            for (const CCallsign &cs : callsigns)
+            {
+                const auto it = m_situationsByCallsign.find(cs);
+                if (it != m_situationsByCallsign.end() && it->size() > IRemoteAircraftProvider::MinSituationsPerCallsign)
+                {
+                    it->truncate(IRemoteAircraftProvider::MinSituationsPerCallsign); // latest first
+                    it->squeeze();
+                }
+            }
+        }
+        {
+            QWriteLocker l(&m_lockParts);
+            for (const CCallsign &cs : callsigns)
+            {
+                const auto it = m_partsByCallsign.find(cs);
+                if (it != m_partsByCallsign.end() && it->size() > IRemoteAircraftProvider::MinPartsPerCallsign)
+                {
+                    it->truncate(IRemoteAircraftProvider::MinPartsPerCallsign);
+                    it->squeeze();
+                }
+            }
+        }
+        {
+            QWriteLocker l(&m_lockChanges);
+            for (const CCallsign &cs : callsigns)
+            {
+                const auto it = m_changesByCallsign.find(cs);
+                if (it != m_changesByCallsign.end() && it->size() > IRemoteAircraftProvider::MinSituationsPerCallsign)
+                {
+                    it->truncate(IRemoteAircraftProvider::MinSituationsPerCallsign);
+                    it->squeeze();
+                }
+            }
+        }
     }
 
     bool CRemoteAircraftProvider::guessOnGroundAndUpdateModelCG(CAircraftSituation &situation, const CAircraftSituationChange &change, const CAircraftModel &aircraftModel)
@@ -559,21 +613,30 @@ namespace BlackMisc::Simulation
 
     bool CRemoteAircraftProvider::updateAircraftRendered(const CCallsign &callsign, bool rendered)
     {
-        QWriteLocker l(&m_lockAircraft);
-        if (!m_aircraftInRange.contains(callsign)) { return false; }
-        return m_aircraftInRange[callsign].setRendered(rendered);
+        bool changed = false;
+        {
+            QWriteLocker l(&m_lockAircraft);
+            if (!m_aircraftInRange.contains(callsign)) { return false; }
+            changed = m_aircraftInRange[callsign].setRendered(rendered);
+        }
+        if (changed && !rendered) { this->compactHistories(callsign); }
+        return changed;
     }
 
     int CRemoteAircraftProvider::updateMultipleAircraftRendered(const CCallsignSet &callsigns, bool rendered)
     {
         if (callsigns.isEmpty()) { return 0; }
-        int c = 0;
-        for (const CCallsign &cs : callsigns)
+        CCallsignSet changed;
         {
-            if (!m_aircraftInRange.contains(cs)) { continue; }
-            if (m_aircraftInRange[cs].setRendered(rendered)) { c++; }
+            QWriteLocker l(&m_lockAircraft);
+            for (const CCallsign &cs : callsigns)
+            {
+                if (!m_aircraftInRange.contains(cs)) { continue; }
+                if (m_aircraftInRange[cs].setRendered(rendered)) { changed.insert(cs); }
+            }
         }
-        return c;
+        if (!rendered) { this->compactHistories(changed); }
+        return changed.size();
     }
 
     int CRemoteAircraftProvider::updateAircraftGroundElevation(const CCallsign &callsign, const CElevationPlane &elevation, CAircraftSituation::GndElevationInfo info, bool *setForOnGroundPosition)
@@ -680,11 +743,14 @@ namespace BlackMisc::Simulation
     void CRemoteAircraftProvider::updateMarkAllAsNotRendered()
     {
         const CCallsignSet callsigns = this->getAircraftInRangeCallsigns();
-        QWriteLocker l(&m_lockAircraft);
-        for (const CCallsign &cs : callsigns)
         {
-            m_aircraftInRange[cs].setRendered(false);
+            QWriteLocker l(&m_lockAircraft);
+            for (const CCallsign &cs : callsigns)
+            {
+                m_aircraftInRange[cs].setRendered(false);
+            }
         }
+        this->compactHistories(callsigns);
     }
 
     void CRemoteAircraftProvider::enableReverseLookupMessages(ReverseLookupLogging enable)
@@ -715,6 +781,7 @@ namespace BlackMisc::Simulation
         {
             CStatusMessageList &msgs = m_reverseLookupMessages[callsign];
             msgs.push_back(messages);
+            if (msgs.size() > IRemoteAircraftProvider::MaxMessagesPerCallsign) { msgs.erase(msgs.begin(), msgs.end() - IRemoteAircraftProvider::MaxMessagesPerCallsign); }
         }
         else
         {
@@ -742,6 +809,61 @@ namespace BlackMisc::Simulation
         this->removeAllAircraft();
     }
 
+    CRemoteAircraftProvider::HistoryStatistics CRemoteAircraftProvider::getHistoryStatistics() const
+    {
+        HistoryStatistics statistics;
+        {
+            QReadLocker l(&m_lockSituations);
+            statistics.aircraft = m_situationsByCallsign.size();
+            for (const CAircraftSituationList &situations : m_situationsByCallsign)
+            {
+                statistics.situations += situations.size();
+                if (situations.size() > IRemoteAircraftProvider::MinSituationsPerCallsign) { statistics.fullHistories++; }
+            }
+        }
+        {
+            QReadLocker l(&m_lockParts);
+            for (const CAircraftPartsList &parts : m_partsByCallsign) { statistics.parts += parts.size(); }
+        }
+        {
+            QReadLocker l(&m_lockChanges);
+            for (const CAircraftSituationChangeList &changes : m_changesByCallsign) { statistics.changes += changes.size(); }
+        }
+
+        // messages are mostly their text
+        qint64 messageBytes = 0;
+        const auto countMessages = [&](const CStatusMessageListPerCallsign &messagesPerCallsign)
+        {
+            for (const CStatusMessageList &messages : messagesPerCallsign)
+            {
+                statistics.messages += messages.size();
+                for (const CStatusMessage &message : messages) { messageBytes += message.getMessage().size() * static_cast<qint64>(sizeof(QChar)); }
+            }
+        };
+        {
+            QReadLocker l(&m_lockMessages);
+            countMessages(m_reverseLookupMessages);
+        }
+        {
+            QReadLocker l(&m_lockPartsHistory);
+            countMessages(m_aircraftPartsMessages);
+        }
+
+        statistics.bytes = statistics.situations * static_cast<qint64>(sizeof(CAircraftSituation)) +
+                           statistics.parts      * static_cast<qint64>(sizeof(CAircraftParts)) +
+                           statistics.changes    * static_cast<qint64>(sizeof(CAircraftSituationChange)) +
+                           statistics.messages   * static_cast<qint64>(sizeof(CStatusMessage)) + messageBytes;
+        return statistics;
+    }
+
+    QString CRemoteAircraftProvider::getHistoryStatisticsInfo(const QString &separator) const
+    {
+        const HistoryStatistics statistics = this->getHistoryStatistics();
+        static const QString info("Histories of %1 aircraft (%2 full): %3 situations, %4 parts, %5 changes, %6 messages" "%7" "%8KB, %9KB per aircraft");
+        return info.arg(statistics.aircraft).arg(statistics.fullHistories).arg(statistics.situations).arg(statistics.parts).arg(statistics.changes).arg(statistics.messages).
+               arg(separator).arg(statistics.bytes / 1024).arg(statistics.bytesPerAircraft() / 1024.0, 0, 'f', 1);
+    }
+
     bool CRemoteAircraftProvider::hasTestAltitudeOffset(const CCallsign &callsign) const
     {
         if (callsign.isEmpty()) { return false; }
@@ -16,6 +16,7 @@
 #include "blackmisc/simulation/reverselookup.h"
 #include "blackmisc/simulation/simulatedaircraftlist.h"
 #include "blackmisc/aviation/aircraftpartslist.h"
+#include "blackmisc/aviation/aircraftpartsdelta.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/aircraftsituationchangelist.h"
 #include "blackmisc/aviation/percallsign.h"
@@ -45,9 +46,13 @@ namespace BlackMisc
         class BLACKMISC_EXPORT IRemoteAircraftProvider : public IProvider
         {
         public:
-            static constexpr int MaxSituationsPerCallsign   = 50; //!< How many situations we keep per callsign
-            static constexpr int MaxPartsPerCallsign        = 50; //!< How many parts we keep per callsign
-            static constexpr int MaxPartsAgePerCallsignSecs = 60; //!< How many seconds to keep parts for interpolation
+            static constexpr int MaxSituationsPerCallsign   = 50;  //!< How many situations we keep per callsign
+            static constexpr int MinSituationsPerCallsign   = 6;   //!< How many situations we keep per callsign for aircraft in range, but not rendered
+            static constexpr int MaxPartsPerCallsign        = 50;  //!< How many parts we keep per callsign
+            static constexpr int MinPartsPerCallsign        = 3;   //!< How many parts we keep per callsign for aircraft in range, but not rendered
+            static constexpr int MaxPartsAgePerCallsignSecs = 60;  //!< How many seconds to keep parts for interpolation
+            static constexpr int MaxMessagesPerCallsign     = 100; //!< How many reverse lookup and parts history messages we keep per callsign
+            static constexpr int MinMessagesPerCallsign     = 10;  //!< How many reverse lookup messages we keep per callsign after matching
 
             //! Destructor
             virtual ~IRemoteAircraftProvider() override;
@@ -383,6 +388,29 @@ namespace BlackMisc::Simulation
         //! Clear all data
         void clear();
 
+        //! Memory used by the per callsign histories
+        struct HistoryStatistics
+        {
+            int aircraft      = 0; //!< aircraft with situations
+            int fullHistories = 0; //!< aircraft keeping the full history
+            int situations    = 0; //!< situations of all aircraft
+            int parts         = 0; //!< parts of all aircraft
+            int changes       = 0; //!< changes of all aircraft
+            int messages      = 0; //!< reverse lookup and parts history messages of all aircraft
+            qint64 bytes      = 0; //!< estimated bytes of all histories
+
+            //! Estimated bytes per aircraft
+            qint64 bytesPerAircraft() const { return aircraft > 0 ? bytes / aircraft : 0; }
+        };
+
+        //! Statistics of the per callsign histories
+        //! \threadsafe
+        HistoryStatistics getHistoryStatistics() const;
+
+        //! Statistics of the per callsign histories as string
+        //! \threadsafe
+        QString getHistoryStatisticsInfo(const QString &separator = "\n") const;
+
         // ------------------- testing ---------------
 
         //! Has test offset value?
@@ -426,6 +454,11 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         void removeReverseLookupMessages(const Aviation::CCallsign &callsign);
 
+        //! Matching has been requested, keep only the latest lookup messages
+        //! \remark all messages are kept if detailed reverse lookup messages are enabled
+        //! \threadsafe
+        void compactReverseLookupMessages(const Aviation::CCallsign &callsign);
+
         //! Add new aircraft, ignored if aircraft already exists
         //! \threadsafe
         bool addNewAircraftInRange(const CSimulatedAircraft &aircraft);
@@ -457,7 +490,7 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         //! @{
         void storeAircraftParts(const Aviation::CCallsign &callsign, const Aviation::CAircraftParts &parts, bool removeOutdated);
-        void storeAircraftParts(const Aviation::CCallsign &callsign, const QJsonObject &jsonObject, qint64 currentOffsetMs);
+        void storeAircraftParts(const Aviation::CCallsign &callsign, const Aviation::CAircraftPartsDelta &delta, qint64 currentOffsetMs);
         //! @}
 
         //! Guess situation "on ground" and update model's CG if applicable
@@ -481,6 +514,19 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         void storeChange(const Aviation::CAircraftSituationChange &change);
 
+        //! Add received parts packet to the parts history
+        //! \threadsafe
+        void storeAircraftPartsHistory(const Aviation::CCallsign &callsign, const QString &partsAsString);
+
+        //! Keep the full history of situations, parts and changes?
+        //! \remark aircraft in range, but not rendered, only keep what is needed to interpolate once rendered
+        //! \threadsafe
+        bool isFullHistoryAircraft(const Aviation::CCallsign &callsign) const;
+
+        //! Compact the histories of aircraft no longer rendered
+        //! \threadsafe
+        void compactHistories(const Aviation::CCallsignSet &callsigns);
+
         Aviation::CAircraftSituationListPerCallsign m_situationsByCallsign;        //!< situations, for performance reasons per callsign, thread safe access required
         Aviation::CAircraftSituationPerCallsign m_latestSituationByCallsign;       //!< latest situations, for performance reasons per callsign, thread safe access required
         Aviation::CAircraftSituationPerCallsign m_latestOnGroundProviderElevation; //!< situations on ground with elevation from provider
@@ -24,6 +24,11 @@ namespace BlackMisc::Simulation
     CRemoteAircraftProviderDummy::CRemoteAircraftProviderDummy(QObject *parent) : CRemoteAircraftProvider(parent)
     { }
 
+    void CRemoteAircraftProviderDummy::insertNewAircraft(const CSimulatedAircraft &aircraft)
+    {
+        this->addNewAircraftInRange(aircraft);
+    }
+
     void CRemoteAircraftProviderDummy::insertNewSituation(const CAircraftSituation &situation)
     {
         this->storeAircraftSituation(situation);
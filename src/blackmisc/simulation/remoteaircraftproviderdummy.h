@@ -33,6 +33,9 @@ namespace BlackMisc::Simulation
         //! Constructor
         CRemoteAircraftProviderDummy(QObject *parent = nullptr);
 
+        //! For testing, add new aircraft
+        void insertNewAircraft(const CSimulatedAircraft &aircraft);
+
         //! For testing, add new situation and fire signals
         //! @{
         void insertNewSituation(const Aviation::CAircraftSituation &situation);
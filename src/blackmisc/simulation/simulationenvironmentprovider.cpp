@@ -261,6 +261,14 @@ namespace BlackMisc::Simulation
         m_pendingElevationRequests.remove(cs);
     }
 
+    void ISimulationEnvironmentProvider::addPendingElevationRequest(const CCallsign &cs)
+    {
+        if (cs.isEmpty()) { return; }
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        QWriteLocker l(&m_lockElvCoordinates);
+        m_pendingElevationRequests[cs] = now;
+    }
+
     CLength ISimulationEnvironmentProvider::minRange(const CLength &range)
     {
         return (range.isNull() || range < CElevationPlane::singlePointRadius()) ?
@@ -368,6 +376,15 @@ namespace BlackMisc::Simulation
         return this->requestElevation(situation, situation.getCallsign());
     }
 
+    bool ISimulationEnvironmentProvider::isElevationRequestPending(const CCallsign &callsign, qint64 timeoutMs) const
+    {
+        if (callsign.isEmpty()) { return false; }
+        QReadLocker l(&m_lockElvCoordinates);
+        const auto it = m_pendingElevationRequests.constFind(callsign);
+        if (it == m_pendingElevationRequests.constEnd()) { return false; }
+        return (QDateTime::currentMSecsSinceEpoch() - it.value()) < timeoutMs;
+    }
+
     QPair<int, int> ISimulationEnvironmentProvider::getElevationsFoundMissed() const
     {
         QReadLocker l(&m_lockElvCoordinates);
@@ -64,6 +64,11 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         bool requestElevationBySituation(const BlackMisc::Aviation::CAircraftSituation &situation);
 
+        //! Is there a pending elevation request for callsign?
+        //! \remark requests older than timeoutMs are considered lost
+        //! \threadsafe
+        bool isElevationRequestPending(const Aviation::CCallsign &callsign, qint64 timeoutMs = 5000) const;
+
         //! Elevations found/missed statistics
         //! \threadsafe
         QPair<int, int> getElevationsFoundMissed() const;
@@ -277,6 +282,10 @@ namespace BlackMisc::Simulation
         //! \remark useful if we ignore the probe response on sim. side
         void removePendingElevationRequest(const Aviation::CCallsign &cs);
 
+        //! Mark an elevation request as pending
+        //! \threadsafe
+        void addPendingElevationRequest(const Aviation::CCallsign &cs);
+
         //! Min.range considered as single point
         static PhysicalQuantities::CLength minRange(const PhysicalQuantities::CLength &range);
 
@@ -116,7 +116,7 @@ namespace BlackMisc::Simulation::XPlane
             if (m_parserWorker && !m_parserWorker->isFinished()) { return; }
             emit this->diskLoadingStarted(simulator, mode);
 
-            m_parserWorker = CWorker::fromTask(this, "CAircraftModelLoaderXPlane::performParsing",
+            m_parserWorker = CWorker::fromTask(this, "CAircraftModelLoaderXPlane::performParsing", CTaskPool::LowPriority,
                                                 [this, modelDirs, excludedDirectoryPatterns, modelConsolidation]()
             {
                 auto models = this->performParsing(modelDirs, excludedDirectoryPatterns);
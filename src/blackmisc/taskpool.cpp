@@ -0,0 +1,438 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/taskpool.h"
+#include "blackmisc/verify.h"
+
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QEvent>
+#include <QObject>
+#include <QStringBuilder>
+#include <QThread>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace BlackMisc
+{
+    //! Queued task
+    struct CTaskPool::Job
+    {
+        quint64 id = 0;
+        QObject *owner = nullptr;
+        QString name;
+        Priority priority = NormalPriority;
+        std::function<void()> run;
+        std::function<void()> cancel;
+        qint64 queuedNs = 0;
+        bool interrupted = false;
+    };
+
+    namespace Private
+    {
+        //! Thread of CTaskPool
+        class CTaskPoolThread : public QThread
+        {
+        public:
+            //! Constructor
+            CTaskPoolThread(CTaskPool &pool) : m_pool(pool) {}
+
+            //! Own queues, guarded by the pool mutex
+            std::deque<CTaskPool::JobPtr> m_queues[CTaskPool::PriorityCount];
+
+        protected:
+            //! \copydoc QThread::run
+            virtual void run() override { m_pool.runThread(this); }
+
+        private:
+            CTaskPool &m_pool;
+        };
+
+        //! Pool thread running in this thread, if any
+        thread_local CTaskPoolThread *t_poolThread = nullptr;
+
+        //! Idle threads expire after this time
+        constexpr int IdleExpiryMs = 30 * 1000;
+    }
+
+    QString CTaskPool::Statistics::toQString() const
+    {
+        return QStringLiteral("threads: %1 alive, %2 idle, %3 created | tasks: %4 running, %5 queued (max %6), %7 submitted, %8 run, %9 cancelled, ").
+               arg(threadsAlive).arg(threadsIdle).arg(threadsCreated).arg(tasksRunning).arg(queueDepth).arg(maxQueueDepth).arg(tasksSubmitted).arg(tasksExecuted).arg(tasksCancelled) %
+               QStringLiteral("%1 stolen, %2 inline | latency: avg %3ms, max %4ms | run: avg %5ms").
+               arg(tasksStolen).arg(tasksInline).arg(avgLatencyMs, 0, 'f', 2).arg(maxLatencyMs, 0, 'f', 2).arg(avgRunMs, 0, 'f', 2);
+    }
+
+    CTaskPool &CTaskPool::instance()
+    {
+        static CTaskPool pool;
+        return pool;
+    }
+
+    quint64 CTaskPool::newTaskId()
+    {
+        static std::atomic<quint64> id { 0 };
+        return ++id;
+    }
+
+    bool CTaskPool::isPoolThread()
+    {
+        return Private::t_poolThread;
+    }
+
+    CTaskPool::CTaskPool() : m_maxThreads(qMax(4, QThread::idealThreadCount())), m_reservedThreads(qMax(1, m_maxThreads / 4))
+    {
+        m_clock.start();
+    }
+
+    CTaskPool::~CTaskPool()
+    {
+        QVector<Private::CTaskPoolThread *> threads;
+        {
+            QMutexLocker l(&m_mutex);
+            for (auto &queue : m_queues) { queue.clear(); }
+            for (Private::CTaskPoolThread *thread : std::as_const(m_threads))
+            {
+                for (auto &queue : thread->m_queues) { queue.clear(); }
+            }
+            m_pending = 0;
+            m_shutdown = true;
+            m_wakeup.wakeAll();
+            threads = m_threads;
+        }
+        for (Private::CTaskPoolThread *thread : std::as_const(threads)) { thread->wait(); }
+
+        QMutexLocker l(&m_mutex);
+        threads.swap(m_expired);
+        l.unlock();
+        reap(threads);
+    }
+
+    void CTaskPool::submit(quint64 id, QObject *owner, const QString &name, Priority priority, const std::function<void()> &run, const std::function<void()> &cancel)
+    {
+        Q_ASSERT_X(run, Q_FUNC_INFO, "Missing task");
+        Q_ASSERT_X(priority >= 0 && priority < PriorityCount, Q_FUNC_INFO, "Wrong priority");
+        auto job = std::make_shared<Job>();
+        job->id = id;
+        job->owner = owner;
+        job->name = name;
+        job->priority = priority;
+        job->run = run;
+        job->cancel = cancel;
+
+        bool watchOwner = false;
+        QVector<Private::CTaskPoolThread *> expired;
+        {
+            QMutexLocker l(&m_mutex);
+            job->queuedNs = m_clock.nsecsElapsed();
+
+            // tasks started by a task are queued with its thread
+            Private::CTaskPoolThread *self = Private::t_poolThread;
+            if (self && !m_shutdown) { self->m_queues[priority].push_back(job); }
+            else { m_queues[priority].push_back(job); }
+
+            m_pending++;
+            m_submitted++;
+            m_maxQueueDepth = qMax(m_maxQueueDepth, m_pending);
+            if (owner && !m_watchedOwners.contains(owner))
+            {
+                m_watchedOwners.insert(owner);
+                watchOwner = true;
+            }
+            if (m_pending > m_idle && m_threads.size() < m_maxThreads && !m_shutdown) { this->startThread(); }
+            m_wakeup.wakeOne();
+            expired.swap(m_expired);
+        }
+
+        if (watchOwner)
+        {
+            QObject::connect(owner, &QObject::destroyed, [this](QObject *destroyedOwner) { this->ownerDestroyed(destroyedOwner); });
+        }
+        reap(expired);
+    }
+
+    bool CTaskPool::tryRunInline(quint64 id)
+    {
+        if (!Private::t_poolThread) { return false; }
+        QMutexLocker l(&m_mutex);
+        const JobPtr job = this->takeQueued(id);
+        if (!job) { return false; }
+        m_pending--;
+        m_inline++;
+        this->runJob(job, l, true);
+        return true;
+    }
+
+    void CTaskPool::interrupt(quint64 id)
+    {
+        QMutexLocker l(&m_mutex);
+        const auto running = m_running.constFind(id);
+        if (running != m_running.constEnd())
+        {
+            running->job->interrupted = true;
+            if (!running->inlined) { running->thread->requestInterruption(); }
+            return;
+        }
+
+        // queued: run as soon as possible, so waiting for it does not take long
+        const JobPtr job = this->takeQueued(id);
+        if (!job) { return; }
+        job->interrupted = true;
+        job->priority = HighPriority;
+        m_queues[HighPriority].push_front(job);
+        m_wakeup.wakeOne();
+    }
+
+    void CTaskPool::cancelTasksOf(QObject *owner, bool waitForRunning)
+    {
+        if (!owner) { return; }
+        std::vector<JobPtr> cancelled;
+        QMutexLocker l(&m_mutex);
+        const auto takeOwned = [&](std::deque<JobPtr> &queue)
+        {
+            const auto owned = std::stable_partition(queue.begin(), queue.end(), [owner](const JobPtr & job) { return job->owner != owner; });
+            std::move(owned, queue.end(), std::back_inserter(cancelled));
+            queue.erase(owned, queue.end());
+        };
+        for (auto &queue : m_queues) { takeOwned(queue); }
+        for (Private::CTaskPoolThread *thread : std::as_const(m_threads))
+        {
+            for (auto &queue : thread->m_queues) { takeOwned(queue); }
+        }
+        m_pending -= static_cast<int>(cancelled.size());
+        m_cancelled += static_cast<qint64>(cancelled.size());
+
+        QThread *currentThread = QThread::currentThread();
+        const auto isRunningElsewhere = [&]
+        {
+            for (const Running &running : std::as_const(m_running))
+            {
+                if (running.job->owner == owner && running.thread != currentThread) { return true; }
+            }
+            return false;
+        };
+        for (Running &running : m_running)
+        {
+            if (running.job->owner != owner || running.thread == currentThread) { continue; }
+            running.job->interrupted = true;
+            if (!running.inlined) { running.thread->requestInterruption(); }
+        }
+        l.unlock();
+
+        for (const JobPtr &job : cancelled)
+        {
+            if (job->cancel) { job->cancel(); }
+        }
+        if (!waitForRunning) { return; }
+
+        // like the former thread per task, which was waited for when the owner was destroyed
+        const int timeoutMs = 5 * 1000;
+        QDeadlineTimer deadline(timeoutMs);
+        l.relock();
+        bool ok = true;
+        while (ok && isRunningElsewhere()) { ok = m_taskDone.wait(&m_mutex, deadline); }
+        l.unlock();
+
+        const QString as = QStringLiteral("Wait timeout after %1ms for tasks of '%2'").arg(timeoutMs).arg(owner->objectName());
+        const QByteArray asBA = as.toLatin1();
+        BLACK_AUDIT_X(ok, Q_FUNC_INFO, asBA);
+        Q_UNUSED(ok)
+    }
+
+    int CTaskPool::maxThreadCount() const
+    {
+        QMutexLocker l(&m_mutex);
+        return m_maxThreads;
+    }
+
+    int CTaskPool::reservedThreadCount() const
+    {
+        QMutexLocker l(&m_mutex);
+        return m_reservedThreads;
+    }
+
+    CTaskPool::Statistics CTaskPool::getStatistics() const
+    {
+        QMutexLocker l(&m_mutex);
+        Statistics s;
+        s.threadsCreated = m_threadsCreated;
+        s.threadsAlive = m_threads.size();
+        s.threadsIdle = m_idle;
+        s.tasksRunning = m_running.size();
+        s.queueDepth = m_pending;
+        s.maxQueueDepth = m_maxQueueDepth;
+        s.tasksSubmitted = m_submitted;
+        s.tasksExecuted = m_executed;
+        s.tasksCancelled = m_cancelled;
+        s.tasksStolen = m_stolen;
+        s.tasksInline = m_inline;
+        s.maxLatencyMs = m_latencyMaxNs / 1.0e6;
+        if (m_executed > 0)
+        {
+            s.avgLatencyMs = m_latencySumNs / 1.0e6 / m_executed;
+            s.avgRunMs = m_runSumNs / 1.0e6 / m_executed;
+        }
+        return s;
+    }
+
+    void CTaskPool::runThread(Private::CTaskPoolThread *self)
+    {
+        Private::t_poolThread = self;
+        QMutexLocker l(&m_mutex);
+        while (!m_shutdown)
+        {
+            const JobPtr job = this->takeNext(self);
+            if (!job)
+            {
+                m_idle++;
+                const bool woken = m_wakeup.wait(&m_mutex, Private::IdleExpiryMs);
+                m_idle--;
+                if (!woken && m_pending < 1) { break; } // expired
+                continue;
+            }
+
+            this->runJob(job, l, false);
+            if (self->isInterruptionRequested()) { break; } // retired, the flag can not be reset
+        }
+
+        // hand over what is left in the own queues
+        for (int p = 0; p < PriorityCount; p++)
+        {
+            std::deque<JobPtr> &own = self->m_queues[p];
+            m_queues[p].insert(m_queues[p].end(), own.begin(), own.end());
+            own.clear();
+        }
+        m_threads.removeOne(self);
+        m_expired.push_back(self);
+        if (!m_shutdown && m_pending > m_idle && m_threads.size() < m_maxThreads) { this->startThread(); }
+        m_wakeup.wakeOne();
+        Private::t_poolThread = nullptr;
+    }
+
+    CTaskPool::JobPtr CTaskPool::takeNext(Private::CTaskPoolThread *self)
+    {
+        if (m_pending < 1) { return {}; }
+        for (int p = 0; p < PriorityCount; p++)
+        {
+            // priorities do not preempt, so keep threads for tasks the user is waiting for
+            if (p != HighPriority && m_runningLower >= m_maxThreads - m_reservedThreads) { break; }
+
+            JobPtr job;
+            std::deque<JobPtr> &own = self->m_queues[p];
+            if (!own.empty())
+            {
+                job = own.back();
+                own.pop_back();
+            }
+            else if (!m_queues[p].empty())
+            {
+                job = m_queues[p].front();
+                m_queues[p].pop_front();
+            }
+            else
+            {
+                for (Private::CTaskPoolThread *other : std::as_const(m_threads))
+                {
+                    std::deque<JobPtr> &victim = other->m_queues[p];
+                    if (other == self || victim.empty()) { continue; }
+                    job = victim.front();
+                    victim.pop_front();
+                    m_stolen++;
+                    break;
+                }
+            }
+            if (job)
+            {
+                m_pending--;
+                return job;
+            }
+        }
+        return {};
+    }
+
+    CTaskPool::JobPtr CTaskPool::takeQueued(quint64 id)
+    {
+        const auto take = [id](std::deque<JobPtr> &queue) -> JobPtr
+        {
+            const auto it = std::find_if(queue.begin(), queue.end(), [id](const JobPtr & job) { return job->id == id; });
+            if (it == queue.end()) { return {}; }
+            JobPtr job = *it;
+            queue.erase(it);
+            return job;
+        };
+        for (auto &queue : m_queues)
+        {
+            if (JobPtr job = take(queue)) { return job; }
+        }
+        for (Private::CTaskPoolThread *thread : std::as_const(m_threads))
+        {
+            for (auto &queue : thread->m_queues)
+            {
+                if (JobPtr job = take(queue)) { return job; }
+            }
+        }
+        return {};
+    }
+
+    void CTaskPool::runJob(const JobPtr &job, QMutexLocker &lock, bool inlined)
+    {
+        const qint64 startNs = m_clock.nsecsElapsed();
+        const qint64 latencyNs = startNs - job->queuedNs;
+        m_latencySumNs += latencyNs;
+        m_latencyMaxNs = qMax(m_latencyMaxNs, latencyNs);
+        QThread *thread = QThread::currentThread();
+        m_running.insert(job->id, { job, thread, inlined });
+        const bool lower = job->priority != HighPriority && !inlined;
+        if (lower) { m_runningLower++; }
+        if (job->interrupted && !inlined) { thread->requestInterruption(); }
+        lock.unlock();
+
+        job->run();
+        if (!inlined)
+        {
+            // no event loop in pool threads, deliver what the task has posted to objects living here
+            QCoreApplication::sendPostedEvents();
+            QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        }
+
+        lock.relock();
+        m_runSumNs += m_clock.nsecsElapsed() - startNs;
+        m_executed++;
+        m_running.remove(job->id);
+        if (lower) { m_runningLower--; }
+        if (lower && m_pending > 0) { m_wakeup.wakeOne(); } // lower priority tasks may wait for this thread
+        m_taskDone.wakeAll();
+    }
+
+    void CTaskPool::startThread()
+    {
+        auto *thread = new Private::CTaskPoolThread(*this);
+        thread->setObjectName(QStringLiteral("swift task pool %1").arg(++m_threadsCreated));
+        m_threads.push_back(thread);
+        thread->start();
+    }
+
+    void CTaskPool::ownerDestroyed(QObject *owner)
+    {
+        {
+            QMutexLocker l(&m_mutex);
+            m_watchedOwners.remove(owner);
+        }
+        this->cancelTasksOf(owner, true);
+    }
+
+    void CTaskPool::reap(const QVector<Private::CTaskPoolThread *> &threads)
+    {
+        for (Private::CTaskPoolThread *thread : threads)
+        {
+            thread->wait();
+            delete thread;
+        }
+    }
+} // ns
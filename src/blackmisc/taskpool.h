@@ -0,0 +1,205 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_TASKPOOL_H
+#define BLACKMISC_TASKPOOL_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+#include <QString>
+#include <QVector>
+#include <QWaitCondition>
+#include <QtGlobal>
+#include <deque>
+#include <functional>
+#include <memory>
+
+class QObject;
+class QThread;
+
+namespace BlackMisc
+{
+    namespace Private { class CTaskPoolThread; }
+
+    /*!
+     * Shared, bounded pool of threads running the tasks of CWorker::fromTask.
+     *
+     * Every pool thread has its own queues: tasks submitted by a running task are queued with the
+     * submitting thread and taken LIFO by it, idle threads steal them from the other end (FIFO).
+     * Tasks submitted by other threads go to a shared queue. Higher priorities are always taken first.
+     *
+     * \remark Threads are created on demand up to maxThreadCount() and expire when idle.
+     * \remark reservedThreadCount() threads are kept for HighPriority tasks, lower priorities never occupy all threads.
+     * \remark Pool threads have no event loop, posted events are delivered after each task. Tasks which block on anything
+     *         but CWorker::waitForFinished or need timers are run by CWorker in a dedicated thread (LowPriority).
+     * \remark An interrupted (abandoned) task gets QThread::requestInterruption on its thread,
+     *         which is retired after the task, so the flag does not leak into other tasks.
+     * \remark When an owner is destroyed its queued tasks are cancelled, running ones are interrupted and waited for.
+     */
+    class BLACKMISC_EXPORT CTaskPool
+    {
+    public:
+        //! Task priority
+        enum Priority
+        {
+            HighPriority,   //!< user is waiting, e.g. sorting a view
+            NormalPriority, //!< default
+            LowPriority     //!< long or blocking background work like parsing or writing files, CWorker runs it in a dedicated thread
+        };
+
+        //! Number of priorities
+        static constexpr int PriorityCount = 3;
+
+        //! Diagnostics
+        struct BLACKMISC_EXPORT Statistics
+        {
+            int threadsCreated = 0;     //!< threads created since start
+            int threadsAlive = 0;       //!< threads currently existing
+            int threadsIdle = 0;        //!< threads waiting for work
+            int tasksRunning = 0;       //!< tasks currently running
+            int queueDepth = 0;         //!< tasks currently queued
+            int maxQueueDepth = 0;      //!< max. tasks queued at once
+            qint64 tasksSubmitted = 0;  //!< tasks submitted
+            qint64 tasksExecuted = 0;   //!< tasks run
+            qint64 tasksCancelled = 0;  //!< tasks cancelled before they were run
+            qint64 tasksStolen = 0;     //!< tasks taken from the queue of another pool thread
+            qint64 tasksInline = 0;     //!< tasks run by a pool thread waiting for them
+            double avgLatencyMs = 0.0;  //!< avg. time from submit to start
+            double maxLatencyMs = 0.0;  //!< max. time from submit to start
+            double avgRunMs = 0.0;      //!< avg. run time
+
+            //! As string
+            QString toQString() const;
+        };
+
+        //! The shared pool
+        static CTaskPool &instance();
+
+        //! New unique task id
+        //! \threadsafe
+        static quint64 newTaskId();
+
+        //! Current thread is a pool thread?
+        static bool isPoolThread();
+
+        //! Queue a task
+        //! \param id unique id from newTaskId()
+        //! \param owner queued tasks are cancelled when the owner is destroyed
+        //! \param name for diagnostics
+        //! \param priority queue priority
+        //! \param run the task
+        //! \param cancel called instead of run if the task is cancelled, in the cancelling thread
+        //! \threadsafe
+        void submit(quint64 id, QObject *owner, const QString &name, Priority priority, const std::function<void()> &run, const std::function<void()> &cancel);
+
+        //! Run a still queued task in the calling thread, used by pool threads waiting for another task
+        //! \remark only possible in a pool thread, so the task never runs in an owner's thread
+        //! \threadsafe
+        bool tryRunInline(quint64 id);
+
+        //! Request interruption of a task, a queued task is moved to the front of the queue
+        //! \threadsafe
+        void interrupt(quint64 id);
+
+        //! Cancel all queued tasks of owner, interrupt the running ones
+        //! \param owner owner of the tasks
+        //! \param waitForRunning block until the running tasks are finished (max. 5s)
+        //! \threadsafe
+        void cancelTasksOf(QObject *owner, bool waitForRunning);
+
+        //! Max. number of threads
+        int maxThreadCount() const;
+
+        //! Number of threads only used by HighPriority tasks
+        int reservedThreadCount() const;
+
+        //! Diagnostics
+        //! \threadsafe
+        Statistics getStatistics() const;
+
+        //! Destructor, waits for running tasks, queued tasks are dropped
+        ~CTaskPool();
+
+    private:
+        friend class Private::CTaskPoolThread;
+        struct Job;
+        using JobPtr = std::shared_ptr<Job>;
+
+        //! Running task
+        struct Running
+        {
+            JobPtr job;
+            QThread *thread = nullptr;
+            bool inlined = false;
+        };
+
+        //! Constructor
+        CTaskPool();
+
+        //! Loop of a pool thread
+        void runThread(Private::CTaskPoolThread *self);
+
+        //! Next job for the pool thread, by priority: own queue, shared queue, stolen
+        //! \remark lower priorities only if a thread is left for HighPriority tasks
+        //! \remark lock must be held
+        JobPtr takeNext(Private::CTaskPoolThread *self);
+
+        //! Remove a queued job
+        //! \remark lock must be held
+        JobPtr takeQueued(quint64 id);
+
+        //! Run the job, unlocks while running
+        void runJob(const JobPtr &job, QMutexLocker &lock, bool inlined);
+
+        //! Start a new thread
+        //! \remark lock must be held
+        void startThread();
+
+        //! Owner destroyed
+        void ownerDestroyed(QObject *owner);
+
+        //! Delete expired threads
+        static void reap(const QVector<Private::CTaskPoolThread *> &threads);
+
+        mutable QMutex m_mutex;
+        QWaitCondition m_wakeup;   //!< new work or shutdown
+        QWaitCondition m_taskDone; //!< a task has finished
+        std::deque<JobPtr> m_queues[PriorityCount]; //!< shared queues
+        QVector<Private::CTaskPoolThread *> m_threads; //!< alive threads
+        QVector<Private::CTaskPoolThread *> m_expired; //!< finished threads, to be deleted
+        QHash<quint64, Running> m_running;
+        QSet<QObject *> m_watchedOwners;
+        QElapsedTimer m_clock;
+        int m_maxThreads = 4;
+        int m_reservedThreads = 1; //!< threads only for HighPriority
+        int m_runningLower = 0;    //!< running tasks with lower than HighPriority, not inline
+        int m_pending = 0;
+        int m_idle = 0;
+        bool m_shutdown = false;
+
+        // diagnostics
+        int m_threadsCreated = 0;
+        int m_maxQueueDepth = 0;
+        qint64 m_submitted = 0;
+        qint64 m_executed = 0;
+        qint64 m_cancelled = 0;
+        qint64 m_stolen = 0;
+        qint64 m_inline = 0;
+        qint64 m_latencySumNs = 0;
+        qint64 m_latencyMaxNs = 0;
+        qint64 m_runSumNs = 0;
+    };
+} // ns
+
+#endif // guard
@@ -0,0 +1,224 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/test/trafficgenerator.h"
+#include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/aviation/aircraftengine.h"
+#include "blackmisc/aviation/aircraftenginelist.h"
+#include "blackmisc/aviation/aircraftlights.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/airlineicaocode.h"
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/aviation/heading.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/network/user.h"
+#include "blackmisc/math/mathutils.h"
+#include "blackmisc/pq/angle.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/units.h"
+
+#include <QStringList>
+#include <QtMath>
+#include <cmath>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::Math;
+using namespace BlackMisc::Network;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMisc::Test
+{
+    CTrafficGenerator::CTrafficGenerator(const CCoordinateGeodetic &center, int number, qint64 startTimeMs) :
+        m_startTimeMs(startTimeMs)
+    {
+        constexpr double GoldenAngleDeg = 137.50776;
+        constexpr double KtsToMps = 0.514444;
+        const double elevationFt = center.geodeticHeight().isNull() ? 0.0 : center.geodeticHeight().value(CLengthUnit::ft());
+
+        m_aircraft.reserve(number);
+        for (int i = 0; i < number; i++)
+        {
+            Aircraft a;
+            a.callsign = CCallsign(QStringLiteral("SWT%1").arg(i, 4, 10, QChar('0')));
+            a.profile = static_cast<Profile>(i % 5);
+            a.elevationFt = elevationFt;
+            a.phaseRad = CMathUtils::deg2rad(std::fmod(i * GoldenAngleDeg, 360.0));
+            a.sendOffsetMs = (i * 37) % 5000;
+
+            // spread the anchors on a spiral (ground traffic close to center, airborne traffic further out)
+            const bool onGround = a.profile == Parked || a.profile == Taxiing;
+            const double distanceNM = onGround ? 0.5 + std::fmod(i * 0.013, 2.0) : 5.0 + std::fmod(i * 0.37, 120.0);
+            a.anchor = center.calculatePosition(CLength(distanceNM, CLengthUnit::NM()), CAngle(std::fmod(i * GoldenAngleDeg, 360.0), CAngleUnit::deg()));
+
+            switch (a.profile)
+            {
+            case Parked:
+                a.radiusM = 50.0;
+                a.gsMps = 0.0;
+                a.altStartFt = elevationFt;
+                break;
+            case Taxiing:
+                a.radiusM = 400.0;
+                a.gsMps = (10.0 + i % 10) * KtsToMps;
+                a.altStartFt = elevationFt;
+                break;
+            case Climbing:
+                a.radiusM = 15000.0;
+                a.gsMps = (220.0 + i % 60) * KtsToMps;
+                a.altStartFt = elevationFt + 1500.0 + (i % 20) * 250.0;
+                a.vsFpm = 1500.0 + (i % 10) * 100.0;
+                break;
+            case Cruising:
+                a.radiusM = 40000.0;
+                a.gsMps = (420.0 + i % 80) * KtsToMps;
+                a.altStartFt = 30000.0 + (i % 9) * 1000.0;
+                break;
+            case Descending:
+                a.radiusM = 20000.0;
+                a.gsMps = (250.0 + i % 50) * KtsToMps;
+                a.altStartFt = 24000.0 + (i % 12) * 500.0;
+                a.vsFpm = -1200.0 - (i % 8) * 100.0;
+                break;
+            }
+            m_aircraft.push_back(a);
+        }
+    }
+
+    CCallsignSet CTrafficGenerator::getCallsigns() const
+    {
+        CCallsignSet callsigns;
+        for (const Aircraft &a : m_aircraft) { callsigns.insert(a.callsign); }
+        return callsigns;
+    }
+
+    CSimulatedAircraft CTrafficGenerator::getAircraft(int index) const
+    {
+        static const QStringList icaos({ "A320", "B738", "B77W", "E190", "C172" });
+        static const QStringList airlines({ "DLH", "BAW", "AFR", "KLM", "SWR" });
+
+        const Aircraft &a = m_aircraft.at(index);
+        const QString &icao = icaos.at(index % icaos.size());
+        const QString &airline = airlines.at((index / icaos.size()) % airlines.size());
+        const CAircraftIcaoCode aircraftIcao(icao, "L2J");
+        const CLivery livery(CLivery::getStandardCode(CAirlineIcaoCode(airline)), CAirlineIcaoCode(airline), "Standard");
+        CAircraftModel model(QStringLiteral("SYNTHETIC %1 %2").arg(icao, airline), CAircraftModel::TypeQueriedFromNetwork, aircraftIcao, livery);
+        model.setCallsign(a.callsign);
+        return CSimulatedAircraft(a.callsign, model, CUser(QString::number(100000 + index), a.callsign.asString()), this->getSituation(index, m_startTimeMs));
+    }
+
+    CSimulatedAircraftList CTrafficGenerator::getAircraft() const
+    {
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < m_aircraft.size(); i++) { aircraft.push_back(this->getAircraft(i)); }
+        return aircraft;
+    }
+
+    CAircraftSituation CTrafficGenerator::getSituation(int index, qint64 timestampMs) const
+    {
+        constexpr double G = 9.80665;
+        const Aircraft &a = m_aircraft.at(index);
+        const double dtSecs = (timestampMs - m_startTimeMs) / 1000.0;
+
+        // clockwise on a circle around the anchor
+        const double angularVelocity = a.radiusM > 0 ? a.gsMps / a.radiusM : 0.0;
+        const double angleRad = a.phaseRad + angularVelocity * dtSecs;
+        const double bearingDeg = CAngle::normalizeDegrees360(CMathUtils::rad2deg(angleRad));
+        const double headingDeg = CAngle::normalizeDegrees360(bearingDeg + 90.0);
+        const double bankDeg = a.radiusM > 0 ? CMathUtils::rad2deg(std::atan(a.gsMps * a.gsMps / (G * a.radiusM))) : 0.0;
+        const double gsKts = a.gsMps / 0.514444;
+        const double pitchDeg = (a.vsFpm > 0) ? 6.0 : (a.vsFpm < 0 ? -1.5 : (a.profile == Cruising ? 2.5 : 0.0));
+
+        CCoordinateGeodetic position = a.anchor.calculatePosition(CLength(a.radiusM, CLengthUnit::m()), CAngle(bearingDeg, CAngleUnit::deg()));
+        position.setGeodeticHeight(CAltitude(this->altitudeFt(a, timestampMs), CAltitude::MeanSeaLevel, CLengthUnit::ft()));
+
+        CAircraftSituation situation(a.callsign, position,
+                                     CHeading(headingDeg, CHeading::True, CAngleUnit::deg()),
+                                     CAngle(pitchDeg, CAngleUnit::deg()),
+                                     CAngle(bankDeg, CAngleUnit::deg()),
+                                     CSpeed(gsKts, CSpeedUnit::kts()));
+        situation.setGroundElevation(CAltitude(a.elevationFt, CAltitude::MeanSeaLevel, CLengthUnit::ft()), CAircraftSituation::Test);
+        situation.setOnGround(a.profile == Parked || a.profile == Taxiing);
+        situation.setMSecsSinceEpoch(timestampMs);
+        situation.setTimeOffsetMs(TimeOffsetMs);
+        return situation;
+    }
+
+    CAircraftParts CTrafficGenerator::getParts(int index, qint64 timestampMs) const
+    {
+        const Aircraft &a = m_aircraft.at(index);
+        const bool onGround = a.profile == Parked || a.profile == Taxiing;
+        const bool enginesOn = a.profile != Parked;
+        const bool low = this->altitudeFt(a, timestampMs) - a.elevationFt < 10000.0;
+        const int flaps = a.profile == Descending && low ? 25 : (a.profile == Climbing && low ? 10 : 0);
+
+        const CAircraftLights lights(!onGround, low && !onGround, a.profile == Taxiing, enginesOn, true, low);
+        const CAircraftEngineList engines({ enginesOn, enginesOn });
+        CAircraftParts parts(lights, onGround || (low && a.profile == Descending), flaps, false, engines, onGround, timestampMs);
+        parts.setTimeOffsetMs(TimeOffsetMs);
+        return parts;
+    }
+
+    int CTrafficGenerator::feedProvider(CRemoteAircraftProviderDummy &provider, qint64 fromMs, qint64 toMs, qint64 updateIntervalMs, bool withParts) const
+    {
+        if (updateIntervalMs < 1 || toMs <= fromMs) { return 0; }
+        int stored = 0;
+        for (int i = 0; i < m_aircraft.size(); i++)
+        {
+            const Aircraft &a = m_aircraft.at(i);
+
+            // first send time > fromMs for this aircraft
+            const qint64 base = m_startTimeMs + a.sendOffsetMs % updateIntervalMs;
+            qint64 ts = fromMs < base ? base : base + ((fromMs - base) / updateIntervalMs + 1) * updateIntervalMs;
+            for (; ts <= toMs; ts += updateIntervalMs)
+            {
+                provider.insertNewSituation(this->getSituation(i, ts));
+                if (withParts) { provider.insertNewAircraftParts(a.callsign, this->getParts(i, ts), false); }
+                stored++;
+            }
+        }
+        return stored;
+    }
+
+    int CTrafficGenerator::prefillProvider(CRemoteAircraftProviderDummy &provider, qint64 toMs, qint64 updateIntervalMs, int numberOfSituations, bool withParts) const
+    {
+        const qint64 fromMs = toMs - updateIntervalMs * numberOfSituations;
+        return this->feedProvider(provider, fromMs, toMs, updateIntervalMs, withParts);
+    }
+
+    double CTrafficGenerator::altitudeFt(const Aircraft &aircraft, qint64 timestampMs) const
+    {
+        const double dtMins = (timestampMs - m_startTimeMs) / 60000.0;
+        double altFt = aircraft.altStartFt + aircraft.vsFpm * dtMins;
+        if (aircraft.vsFpm > 0) { altFt = qMin(altFt, 37000.0); }
+        if (aircraft.vsFpm < 0) { altFt = qMax(altFt, aircraft.elevationFt + 2000.0); }
+        return altFt;
+    }
+
+    const QString &CTrafficGenerator::profileToString(Profile profile)
+    {
+        static const QString parked("parked");
+        static const QString taxiing("taxiing");
+        static const QString climbing("climbing");
+        static const QString cruising("cruising");
+        static const QString descending("descending");
+
+        switch (profile)
+        {
+        case Taxiing: return taxiing;
+        case Climbing: return climbing;
+        case Cruising: return cruising;
+        case Descending: return descending;
+        case Parked:
+        default: break;
+        }
+        return parked;
+    }
+} // ns
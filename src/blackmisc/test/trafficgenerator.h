@@ -0,0 +1,116 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_TEST_TRAFFICGENERATOR_H
+#define BLACKMISC_TEST_TRAFFICGENERATOR_H
+
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QVector>
+#include <QString>
+
+namespace BlackMisc::Simulation { class CRemoteAircraftProviderDummy; }
+namespace BlackMisc::Test
+{
+    /*!
+     * Synthetic remote traffic for load tests.
+     *
+     * Generates N aircraft around a center with deterministic, but realistic movement
+     * (parked, taxiing, climbing, cruising, descending) and feeds their situations and parts
+     * into a remote aircraft provider as the network would do.
+     */
+    class BLACKMISC_EXPORT CTrafficGenerator
+    {
+    public:
+        //! Movement profile
+        enum Profile
+        {
+            Parked,
+            Taxiing,
+            Climbing,
+            Cruising,
+            Descending
+        };
+
+        //! Constructor
+        //! \param center        center of the generated traffic
+        //! \param number        number of aircraft
+        //! \param startTimeMs   time when the generated traffic starts to move
+        CTrafficGenerator(const Geo::CCoordinateGeodetic &center, int number, qint64 startTimeMs);
+
+        //! Number of generated aircraft
+        int size() const { return m_aircraft.size(); }
+
+        //! Callsign for index
+        const Aviation::CCallsign &getCallsign(int index) const { return m_aircraft.at(index).callsign; }
+
+        //! All callsigns
+        Aviation::CCallsignSet getCallsigns() const;
+
+        //! Profile for index
+        Profile getProfile(int index) const { return m_aircraft.at(index).profile; }
+
+        //! Aircraft (with model) for index
+        Simulation::CSimulatedAircraft getAircraft(int index) const;
+
+        //! All aircraft
+        Simulation::CSimulatedAircraftList getAircraft() const;
+
+        //! Situation of aircraft at given time
+        Aviation::CAircraftSituation getSituation(int index, qint64 timestampMs) const;
+
+        //! Parts of aircraft at given time
+        Aviation::CAircraftParts getParts(int index, qint64 timestampMs) const;
+
+        //! Store all situations (and parts) which are due in the time range (fromMs, toMs]
+        //! \remark like on the network, each aircraft sends every updateIntervalMs, staggered per aircraft
+        //! \return number of situations stored
+        int feedProvider(Simulation::CRemoteAircraftProviderDummy &provider, qint64 fromMs, qint64 toMs, qint64 updateIntervalMs, bool withParts = true) const;
+
+        //! Pre-fill the provider with a history of situations/parts up to the given time
+        //! \return number of situations stored
+        int prefillProvider(Simulation::CRemoteAircraftProviderDummy &provider, qint64 toMs, qint64 updateIntervalMs, int numberOfSituations, bool withParts = true) const;
+
+        //! Time offset used for the generated situations
+        static constexpr qint64 TimeOffsetMs = 6000;
+
+        //! Profile as string
+        static const QString &profileToString(Profile profile);
+
+    private:
+        //! Generated aircraft
+        struct Aircraft
+        {
+            Aviation::CCallsign callsign;
+            Profile profile = Parked;
+            Geo::CCoordinateGeodetic anchor; //!< center of the circular track
+            double radiusM    = 0;  //!< track radius
+            double phaseRad   = 0;  //!< start angle on track
+            double gsMps      = 0;  //!< ground speed
+            double altStartFt = 0;  //!< altitude at start time
+            double vsFpm      = 0;  //!< vertical speed
+            double elevationFt = 0; //!< ground elevation
+            qint64 sendOffsetMs = 0; //!< stagger of the updates
+        };
+
+        //! Altitude in ft at given time
+        double altitudeFt(const Aircraft &aircraft, qint64 timestampMs) const;
+
+        QVector<Aircraft> m_aircraft;
+        qint64 m_startTimeMs = 0;
+    };
+} // ns
+
+#endif // guard
@@ -0,0 +1,168 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/timeline.h"
+#include "blackmisc/fileutils.h"
+#include "blackmisc/logcategories.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMutexLocker>
+#include <QThread>
+
+namespace BlackMisc
+{
+    CTimeline::Stage::Stage(CTimeline &timeline, const QString &name, const QString &category) : m_timeline(timeline)
+    {
+        m_info.name = name;
+        m_info.category = category;
+        m_info.startUs = CTimeline::nowUs();
+        m_ended = !timeline.isRecording();
+    }
+
+    void CTimeline::Stage::end()
+    {
+        if (m_ended) { return; }
+        m_ended = true;
+        m_info.endUs = CTimeline::nowUs();
+        m_info.threadId = CTimeline::currentThreadId();
+        m_info.threadName = CTimeline::currentThreadName();
+        m_timeline.addStage(m_info);
+    }
+
+    CTimeline &CTimeline::startup()
+    {
+        static CTimeline timeline(false);
+        return timeline;
+    }
+
+    void CTimeline::addStage(const StageInfo &stage)
+    {
+        QMutexLocker lock(&m_mutex);
+        if (!m_recording) { return; }
+        m_stages.push_back(stage);
+    }
+
+    void CTimeline::addStage(const QString &name, const QString &category, qint64 startUs, qint64 endUs, qint64 bytes)
+    {
+        StageInfo stage;
+        stage.name = name;
+        stage.category = category;
+        stage.startUs = startUs;
+        stage.endUs = endUs;
+        stage.threadId = currentThreadId();
+        stage.threadName = currentThreadName();
+        stage.bytes = bytes;
+        this->addStage(stage);
+    }
+
+    void CTimeline::setRecording(bool recording)
+    {
+        QMutexLocker lock(&m_mutex);
+        m_recording = recording;
+    }
+
+    bool CTimeline::isRecording() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_recording;
+    }
+
+    QVector<CTimeline::StageInfo> CTimeline::getStages() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_stages;
+    }
+
+    void CTimeline::clear()
+    {
+        QMutexLocker lock(&m_mutex);
+        m_stages.clear();
+    }
+
+    QJsonObject CTimeline::toChromeTrace() const
+    {
+        const QVector<StageInfo> stages = this->getStages();
+        const qint64 pid = QCoreApplication::applicationPid();
+        QJsonArray events;
+        QHash<quint64, QString> threadNames;
+        for (const StageInfo &stage : stages)
+        {
+            QJsonObject event
+            {
+                { "name", stage.name },
+                { "cat",  stage.category.isEmpty() ? QStringLiteral("default") : stage.category },
+                { "ph",   "X" },
+                { "ts",   static_cast<double>(stage.startUs) },
+                { "dur",  static_cast<double>(qMax(stage.endUs - stage.startUs, 0LL)) },
+                { "pid",  pid },
+                { "tid",  static_cast<double>(stage.threadId) }
+            };
+            if (stage.bytes >= 0) { event.insert("args", QJsonObject { { "bytes", static_cast<double>(stage.bytes) } }); }
+            events.push_back(event);
+            threadNames.insert(stage.threadId, stage.threadName);
+        }
+
+        // metadata events, so the viewer shows thread names
+        for (auto it = threadNames.cbegin(); it != threadNames.cend(); ++it)
+        {
+            events.push_back(QJsonObject
+            {
+                { "name", "thread_name" },
+                { "ph",   "M" },
+                { "pid",  pid },
+                { "tid",  static_cast<double>(it.key()) },
+                { "args", QJsonObject { { "name", it.value() } } }
+            });
+        }
+        return QJsonObject { { "traceEvents", events }, { "displayTimeUnit", "ms" } };
+    }
+
+    CStatusMessage CTimeline::writeChromeTraceFile(const QString &fileName) const
+    {
+        const QByteArray json = QJsonDocument(this->toChromeTrace()).toJson(QJsonDocument::Compact);
+        if (!CFileUtils::writeByteArrayToFile(json, fileName))
+        {
+            return CStatusMessage(this).error(u"Cannot write timeline to '%1'") << fileName;
+        }
+        return CStatusMessage(this).info(u"Written timeline with %1 stages to '%2'") << this->getStages().size() << fileName;
+    }
+
+    qint64 CTimeline::nowUs()
+    {
+        static const QElapsedTimer timer = []
+        {
+            QElapsedTimer t;
+            t.start();
+            return t;
+        }();
+        return timer.nsecsElapsed() / 1000;
+    }
+
+    quint64 CTimeline::currentThreadId()
+    {
+        return static_cast<quint64>(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+    }
+
+    QString CTimeline::currentThreadName()
+    {
+        const QThread *thread = QThread::currentThread();
+        if (thread && !thread->objectName().isEmpty()) { return thread->objectName(); }
+        if (qApp && thread == qApp->thread()) { return QStringLiteral("main"); }
+        return QString::number(currentThreadId());
+    }
+
+    const QStringList &CTimeline::getLogCategories()
+    {
+        static const QStringList cats { CLogCategories::startup() };
+        return cats;
+    }
+} // ns
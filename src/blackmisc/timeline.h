@@ -0,0 +1,133 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_TIMELINE_H
+#define BLACKMISC_TIMELINE_H
+
+#include "blackmisc/blackmiscexport.h"
+#include "blackmisc/statusmessage.h"
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+namespace BlackMisc
+{
+    /*!
+     * Timeline of stages (e.g. of the application startup) with start, end, thread and processed bytes.
+     * Can be written as Chrome trace JSON, to be viewed in chrome://tracing or https://ui.perfetto.dev
+     * \threadsafe
+     */
+    class BLACKMISC_EXPORT CTimeline
+    {
+    public:
+        //! One recorded stage
+        struct StageInfo
+        {
+            QString name;          //!< stage name
+            QString category;      //!< category, e.g. "cache"
+            qint64  startUs = 0;   //!< start, us since process start
+            qint64  endUs   = 0;   //!< end, us since process start
+            quint64 threadId = 0;  //!< thread the stage ran in
+            QString threadName;    //!< name of that thread
+            qint64  bytes = -1;    //!< bytes processed, -1 if not applicable
+        };
+
+        /*!
+         * Records a stage from construction to destruction (or end())
+         */
+        class BLACKMISC_EXPORT Stage
+        {
+        public:
+            //! Start stage
+            //! \remark nothing is recorded if the timeline is not recording when the stage starts
+            Stage(CTimeline &timeline, const QString &name, const QString &category = {});
+
+            //! End stage if not already ended
+            ~Stage() { this->end(); }
+
+            //! Not copyable
+            Stage(const Stage &) = delete;
+
+            //! Not copyable
+            Stage &operator =(const Stage &) = delete;
+
+            //! Bytes processed by the stage
+            void setBytes(qint64 bytes) { m_info.bytes = bytes; }
+
+            //! End the stage now
+            void end();
+
+        private:
+            CTimeline &m_timeline;
+            StageInfo m_info;
+            bool m_ended = false;
+        };
+
+        //! Constructor
+        explicit CTimeline(bool recording = true) : m_recording(recording) {}
+
+        //! Not copyable
+        CTimeline(const CTimeline &) = delete;
+
+        //! Not copyable
+        CTimeline &operator =(const CTimeline &) = delete;
+
+        //! Timeline of the application startup
+        //! \remark not recording until enabled by setRecording, e.g. by the startup trace option
+        static CTimeline &startup();
+
+        //! Add a stage which already ended
+        void addStage(const StageInfo &stage);
+
+        //! Add a stage which already ended, thread is the current thread
+        void addStage(const QString &name, const QString &category, qint64 startUs, qint64 endUs, qint64 bytes = -1);
+
+        //! Stop recording, e.g. when startup is completed
+        void setRecording(bool recording);
+
+        //! Recording?
+        bool isRecording() const;
+
+        //! All stages, in the order they ended
+        QVector<StageInfo> getStages() const;
+
+        //! Remove all stages
+        void clear();
+
+        //! Stages as Chrome trace, complete events ("ph": "X") and thread names
+        QJsonObject toChromeTrace() const;
+
+        //! Write as Chrome trace JSON file
+        CStatusMessage writeChromeTraceFile(const QString &fileName) const;
+
+        //! Monotonic time in us since process start, the clock of all stages
+        static qint64 nowUs();
+
+        //! Id of the current thread
+        static quint64 currentThreadId();
+
+        //! Name of the current thread, object name of QThread or the id
+        static QString currentThreadName();
+
+        //! Log categories
+        static const QStringList &getLogCategories();
+
+    private:
+        mutable QMutex m_mutex;
+        QVector<StageInfo> m_stages;
+        bool m_recording = true;
+    };
+} // ns
+
+#endif // guard
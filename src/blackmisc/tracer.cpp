@@ -0,0 +1,285 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/tracer.h"
+#include "blackmisc/fileutils.h"
+#include "blackmisc/lockfreeringbuffer.h"
+#include "blackmisc/logcategories.h"
+#include "blackmisc/timeline.h"
+
+#include <QCoreApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMutex>
+#include <QMutexLocker>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace BlackMisc
+{
+    namespace
+    {
+        //! Events of one thread, only the owning thread pushes
+        struct ThreadBuffer
+        {
+            explicit ThreadBuffer(int capacity) : events(capacity) {}
+            CLockFreeRingBuffer<CTracer::Event> events;
+            std::deque<CTracer::Event> store; //!< drained events, latest window, guarded by the registry mutex
+            quint64 threadId = 0;
+            QString threadName;
+            int sampleCounter = 0; //!< only used by the owning thread
+        };
+
+        //! All thread buffers and the settings
+        struct Registry
+        {
+            QMutex mutex;
+            std::vector<std::shared_ptr<ThreadBuffer>> buffers; //!< buffers outlive their threads until taken
+            std::atomic_int capacity { 1 << 14 };
+            std::atomic_int retained { 1 << 18 };
+            std::atomic_int samplingInterval { 1 };
+            std::atomic_int dropped { 0 };
+            qint64 discarded = 0; //!< guarded by mutex
+        };
+
+        Registry &registry()
+        {
+            static Registry r;
+            return r;
+        }
+
+        //! Move the events of the buffer to its store, keep the latest events
+        //! \remark registry mutex must be held, so there is only one consumer per buffer
+        void drainBuffer(Registry &r, ThreadBuffer &buffer)
+        {
+            CTracer::Event event;
+            while (buffer.events.tryPop(event)) { buffer.store.push_back(event); }
+            const size_t retained = static_cast<size_t>(r.retained.load(std::memory_order_relaxed));
+            if (buffer.store.size() <= retained) { return; }
+            const size_t discard = buffer.store.size() - retained;
+            buffer.store.erase(buffer.store.begin(), buffer.store.begin() + static_cast<std::ptrdiff_t>(discard));
+            r.discarded += static_cast<qint64>(discard);
+        }
+
+        //! Buffer of the current thread, registered on first use
+        ThreadBuffer &threadBuffer()
+        {
+            thread_local std::shared_ptr<ThreadBuffer> buffer;
+            if (!buffer)
+            {
+                Registry &r = registry();
+                buffer = std::make_shared<ThreadBuffer>(r.capacity.load(std::memory_order_relaxed));
+                buffer->threadId = CTimeline::currentThreadId();
+                buffer->threadName = CTimeline::currentThreadName();
+                QMutexLocker lock(&r.mutex);
+                r.buffers.push_back(buffer);
+            }
+            return *buffer;
+        }
+
+        void push(const CTracer::Event &event)
+        {
+            ThreadBuffer &buffer = threadBuffer();
+            if (buffer.events.tryPush(event)) { return; }
+
+            // full, drain it ourselves unless another thread is draining right now
+            Registry &r = registry();
+            if (r.mutex.tryLock())
+            {
+                drainBuffer(r, buffer);
+                r.mutex.unlock();
+                if (buffer.events.tryPush(event)) { return; }
+            }
+            r.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic_bool CTracer::s_enabled { false };
+
+    void CTracer::setEnabled(bool enabled)
+    {
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void CTracer::setSamplingInterval(int interval)
+    {
+        registry().samplingInterval.store(qMax(interval, 1), std::memory_order_relaxed);
+    }
+
+    int CTracer::getSamplingInterval()
+    {
+        return registry().samplingInterval.load(std::memory_order_relaxed);
+    }
+
+    void CTracer::setBufferCapacity(int capacity)
+    {
+        registry().capacity.store(qMax(capacity, 2), std::memory_order_relaxed);
+    }
+
+    void CTracer::setRetainedEvents(int events)
+    {
+        registry().retained.store(qMax(events, 1), std::memory_order_relaxed);
+    }
+
+    int CTracer::getRetainedEvents()
+    {
+        return registry().retained.load(std::memory_order_relaxed);
+    }
+
+    void CTracer::recordCounter(const char *name, double value, const char *category)
+    {
+        Event event;
+        event.name = name;
+        event.category = category;
+        event.startUs = CTimeline::nowUs();
+        event.value = value;
+        push(event);
+    }
+
+    void CTracer::recordZone(const char *name, const char *category, qint64 startUs, qint64 endUs)
+    {
+        Event event;
+        event.name = name;
+        event.category = category;
+        event.startUs = startUs;
+        event.durationUs = qMax(endUs - startUs, Q_INT64_C(0));
+        push(event);
+    }
+
+    int CTracer::getDroppedEvents()
+    {
+        return registry().dropped.load(std::memory_order_relaxed);
+    }
+
+    qint64 CTracer::getDiscardedEvents()
+    {
+        Registry &r = registry();
+        QMutexLocker lock(&r.mutex);
+        return r.discarded;
+    }
+
+    void CTracer::drain()
+    {
+        Registry &r = registry();
+        QMutexLocker lock(&r.mutex);
+        for (const auto &buffer : r.buffers) { drainBuffer(r, *buffer); }
+    }
+
+    QVector<CTracer::ThreadEvents> CTracer::takeEvents()
+    {
+        Registry &r = registry();
+        QMutexLocker lock(&r.mutex);
+        QVector<ThreadEvents> all;
+        for (auto it = r.buffers.begin(); it != r.buffers.end();)
+        {
+            ThreadBuffer &buffer = **it;
+            drainBuffer(r, buffer);
+            ThreadEvents threadEvents;
+            threadEvents.threadId = buffer.threadId;
+            threadEvents.threadName = buffer.threadName;
+            threadEvents.events = QVector<Event>(buffer.store.cbegin(), buffer.store.cend());
+            buffer.store.clear();
+            if (!threadEvents.events.isEmpty()) { all.push_back(threadEvents); }
+
+            // thread has ended and its buffer is drained
+            if (it->use_count() == 1) { it = r.buffers.erase(it); }
+            else { ++it; }
+        }
+        return all;
+    }
+
+    void CTracer::clear()
+    {
+        takeEvents();
+        Registry &r = registry();
+        r.dropped.store(0, std::memory_order_relaxed);
+        QMutexLocker lock(&r.mutex);
+        r.discarded = 0;
+    }
+
+    QJsonObject CTracer::toChromeTrace()
+    {
+        const QVector<ThreadEvents> all = takeEvents();
+        const int dropped = getDroppedEvents();
+        const qint64 discarded = getDiscardedEvents();
+        const qint64 pid = QCoreApplication::applicationPid();
+        QJsonArray events;
+        for (const ThreadEvents &threadEvents : all)
+        {
+            const double tid = static_cast<double>(threadEvents.threadId);
+            for (const Event &event : threadEvents.events)
+            {
+                const bool isZone = event.durationUs >= 0;
+                QJsonObject json
+                {
+                    { "name", QString::fromLatin1(event.name) },
+                    { "cat",  QString::fromLatin1(event.category) },
+                    { "ph",   isZone ? "X" : "C" },
+                    { "ts",   static_cast<double>(event.startUs) },
+                    { "pid",  pid },
+                    { "tid",  tid }
+                };
+                if (isZone) { json.insert("dur", static_cast<double>(event.durationUs)); }
+                else { json.insert("args", QJsonObject { { "value", event.value } }); }
+                events.push_back(json);
+            }
+
+            // metadata event, so the viewer shows the thread name
+            events.push_back(QJsonObject
+            {
+                { "name", "thread_name" },
+                { "ph",   "M" },
+                { "pid",  pid },
+                { "tid",  tid },
+                { "args", QJsonObject { { "name", threadEvents.threadName } } }
+            });
+        }
+        return QJsonObject
+        {
+            { "traceEvents", events },
+            { "displayTimeUnit", "ms" },
+            { "otherData", QJsonObject { { "droppedEvents", dropped }, { "discardedEvents", static_cast<double>(discarded) }, { "samplingInterval", getSamplingInterval() } } }
+        };
+    }
+
+    CStatusMessage CTracer::writeChromeTraceFile(const QString &fileName)
+    {
+        const QJsonObject trace = toChromeTrace();
+        const int events = trace.value("traceEvents").toArray().size();
+        const QByteArray json = QJsonDocument(trace).toJson(QJsonDocument::Compact);
+        if (!CFileUtils::writeByteArrayToFile(json, fileName))
+        {
+            return CStatusMessage(static_cast<CTracer *>(nullptr)).error(u"Cannot write trace to '%1'") << fileName;
+        }
+        return CStatusMessage(static_cast<CTracer *>(nullptr)).info(u"Written trace with %1 events to '%2'") << events << fileName;
+    }
+
+    const QStringList &CTracer::getLogCategories()
+    {
+        static const QStringList cats { CLogCategories::performance() };
+        return cats;
+    }
+
+    qint64 CTracer::beginZone()
+    {
+        const int interval = registry().samplingInterval.load(std::memory_order_relaxed);
+        if (interval > 1)
+        {
+            ThreadBuffer &buffer = threadBuffer();
+            if (++buffer.sampleCounter < interval) { return -1; }
+            buffer.sampleCounter = 0;
+        }
+        return CTimeline::nowUs();
+    }
+
+    void CTracer::endZone(const char *name, const char *category, qint64 startUs)
+    {
+        recordZone(name, category, startUs, CTimeline::nowUs());
+    }
+} // ns
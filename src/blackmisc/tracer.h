@@ -0,0 +1,176 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_TRACER_H
+#define BLACKMISC_TRACER_H
+
+#include "blackmisc/blackmiscexport.h"
+#include "blackmisc/statusmessage.h"
+
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QtGlobal>
+#include <atomic>
+
+namespace BlackMisc
+{
+    /*!
+     * Lightweight tracer for hot paths (FSD, provider, interpolation, simulator, audio, GUI).
+     *
+     * Zones and counters are recorded into a lock-free buffer per thread, so threads do not contend.
+     * The buffers are drained periodically (drain) or by the recording thread when its buffer is full,
+     * into a store keeping the latest events per thread, so a long session yields a trace of its last
+     * minutes rather than of its first seconds. Names and categories are string literals and are only
+     * converted when the trace is exported as Chrome trace / Perfetto JSON.
+     *
+     * Use the BLACK_TRACE_ZONE and BLACK_TRACE_COUNTER macros, they compile to nothing unless the build
+     * defines BLACK_USE_TRACING (swift config "tracing"). If compiled in, tracing is disabled until
+     * setEnabled is called, which costs one relaxed atomic load per zone.
+     * \threadsafe
+     */
+    class BLACKMISC_EXPORT CTracer
+    {
+    public:
+        //! One recorded event
+        struct Event
+        {
+            const char *name = nullptr;     //!< zone or counter name, string literal
+            const char *category = nullptr; //!< category, string literal
+            qint64 startUs = 0;             //!< start, us since process start (same clock as CTimeline)
+            qint64 durationUs = -1;         //!< zone duration, -1 for a counter
+            double value = 0.0;             //!< counter value
+        };
+
+        //! Events recorded by one thread
+        struct ThreadEvents
+        {
+            quint64 threadId = 0;  //!< thread id, as CTimeline::currentThreadId
+            QString threadName;    //!< thread name, as CTimeline::currentThreadName
+            QVector<Event> events; //!< events in the order they ended
+        };
+
+        /*!
+         * Records a zone from construction to destruction
+         */
+        class Zone
+        {
+        public:
+            //! Start zone if tracing is enabled and the zone is sampled
+            Zone(const char *name, const char *category) : m_name(name), m_category(category)
+            {
+                if (CTracer::isEnabled()) { m_startUs = CTracer::beginZone(); }
+            }
+
+            //! End zone
+            ~Zone()
+            {
+                if (m_startUs >= 0) { CTracer::endZone(m_name, m_category, m_startUs); }
+            }
+
+            //! Not copyable
+            Zone(const Zone &) = delete;
+
+            //! Not copyable
+            Zone &operator =(const Zone &) = delete;
+
+        private:
+            const char *m_name = nullptr;
+            const char *m_category = nullptr;
+            qint64 m_startUs = -1; //!< -1 if not recorded
+        };
+
+        //! Enabled?
+        static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+        //! Enable or disable recording at runtime
+        static void setEnabled(bool enabled);
+
+        //! Record only every n-th zone per thread (1 records all), counters are always recorded
+        static void setSamplingInterval(int interval);
+
+        //! \copydoc setSamplingInterval
+        static int getSamplingInterval();
+
+        //! Events per thread buffer, applies to threads recording for the first time
+        static void setBufferCapacity(int capacity);
+
+        //! Events kept per thread once drained, older events are discarded
+        static void setRetainedEvents(int events);
+
+        //! \copydoc setRetainedEvents
+        static int getRetainedEvents();
+
+        //! Record a counter value, e.g. queue length
+        static void recordCounter(const char *name, double value, const char *category = "counter");
+
+        //! Record a zone which already ended
+        static void recordZone(const char *name, const char *category, qint64 startUs, qint64 endUs);
+
+        //! Events lost because a thread buffer was full while another thread was draining, since start or clear
+        static int getDroppedEvents();
+
+        //! Oldest events discarded to keep the latest getRetainedEvents() per thread, since start or clear
+        static qint64 getDiscardedEvents();
+
+        //! Move the events of the thread buffers to the store, call periodically while tracing
+        static void drain();
+
+        //! Take the stored and recorded events of all threads
+        static QVector<ThreadEvents> takeEvents();
+
+        //! Discard the recorded events and reset the dropped and discarded events
+        static void clear();
+
+        //! Drain the recorded events as Chrome trace, complete events ("ph": "X"), counters ("ph": "C") and thread names
+        static QJsonObject toChromeTrace();
+
+        //! Drain the recorded events and write them as Chrome trace JSON file
+        static CStatusMessage writeChromeTraceFile(const QString &fileName);
+
+        //! Log categories
+        static const QStringList &getLogCategories();
+
+    private:
+        //! Start a zone, returns start time or -1 if the zone is not sampled
+        static qint64 beginZone();
+
+        //! End a zone started with beginZone
+        static void endZone(const char *name, const char *category, qint64 startUs);
+
+        static std::atomic_bool s_enabled;
+    };
+} // ns
+
+//! \cond PRIVATE
+#define BLACK_TRACE_CONCAT_IMPL(a, b) a##b
+#define BLACK_TRACE_CONCAT(a, b) BLACK_TRACE_CONCAT_IMPL(a, b)
+//! \endcond
+
+#ifdef BLACK_USE_TRACING
+
+//! Trace the enclosing scope as zone, name and category are string literals
+#define BLACK_TRACE_ZONE(name, category) const BlackMisc::CTracer::Zone BLACK_TRACE_CONCAT(blackTraceZone, __LINE__)(name, category)
+
+//! Trace a counter value, name is a string literal
+#define BLACK_TRACE_COUNTER(name, value) do { if (BlackMisc::CTracer::isEnabled()) { BlackMisc::CTracer::recordCounter(name, static_cast<double>(value)); } } while (false)
+
+#else
+
+//! Trace the enclosing scope as zone, not compiled in
+#define BLACK_TRACE_ZONE(name, category) do {} while (false)
+
+//! Trace a counter value, not compiled in
+#define BLACK_TRACE_COUNTER(name, value) do {} while (false)
+
+#endif
+
+#endif // guard
@@ -12,9 +12,13 @@
 #include "blackmisc/atomicfile.h"
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/identifier.h"
+#include "blackmisc/jsonstreamreader.h"
+#include "blackmisc/jsonstreamwriter.h"
 #include "blackmisc/lockfree.h"
 #include "blackmisc/logcategories.h"
 #include "blackmisc/logmessage.h"
+#include "blackmisc/parallel.h"
+#include "blackmisc/timeline.h"
 
 #include <QByteArray>
 #include <QCoreApplication>
@@ -24,17 +28,19 @@
 #include <QFileInfo>
 #include <QFlags>
 #include <QIODevice>
-#include <QJsonDocument>
 #include <QList>
 #include <QMetaMethod>
 #include <QMutexLocker>
+#include <QPair>
 #include <QStandardPaths>
 #include <QThread>
+#include <QVector>
 #include <Qt>
 #include <atomic>
 #include <exception>
 #include <functional>
 #include <limits>
+#include <utility>
 
 namespace BlackMisc
 {
@@ -381,15 +387,42 @@ namespace BlackMisc
             {
                 return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
             }
-            auto json = QJsonDocument::fromJson(file.readAll());
-            if (json.isArray() || (json.isNull() && ! json.isEmpty()))
+            // values of other keys in the file are copied unchanged, without parsing them into value objects
+            const QByteArray existing = file.readAll();
+            QVector<QPair<QString, QByteArray>> otherValues;
+            if (! existing.trimmed().isEmpty())
             {
-                return CStatusMessage(this).error(u"Invalid JSON format in %1") << file.fileName();
+                CJsonStreamReader reader(existing);
+                if (reader.readNext() == CJsonStreamReader::StartArray)
+                {
+                    return CStatusMessage(this).error(u"Invalid JSON format in %1") << file.fileName();
+                }
+                if (reader.tokenType() == CJsonStreamReader::StartObject)
+                {
+                    while (reader.readNext() == CJsonStreamReader::Name)
+                    {
+                        const QString key = reader.stringValue();
+                        const QByteArray value = reader.rawValue();
+                        if (! it->contains(key)) { otherValues.push_back({ key, value }); }
+                    }
+                }
+                if (reader.hasError()) { otherValues.clear(); } // damaged file is overwritten, as before
             }
-            auto object = json.object();
-            json.setObject(it->mergeToMemoizedJson(object));
 
-            if (!(file.seek(0) && file.resize(0) && file.write(json.toJson()) > 0 && file.checkedClose()))
+            if (!(file.seek(0) && file.resize(0)))
+            {
+                return CStatusMessage(this).error(u"Failed to write to %1: %2") << file.fileName() << file.errorString();
+            }
+            CJsonStreamWriter writer(&file);
+            writer.beginObject();
+            for (const auto &other : std::as_const(otherValues))
+            {
+                writer.writeName(other.first);
+                writer.writeRawValue(other.second);
+            }
+            it->writeMemoizedJsonMembers(writer);
+            writer.endObject();
+            if (!(writer.flush() && file.checkedClose()))
             {
                 return CStatusMessage(this).error(u"Failed to write to %1: %2") << file.fileName() << file.errorString();
             }
@@ -432,43 +465,88 @@ namespace BlackMisc
                 keysInFiles.insert(QDir(dir).relativeFilePath(iter.next()), {});
             }
         }
-        bool ok = true;
-        for (auto it = keysInFiles.cbegin(); it != keysInFiles.cend(); ++it)
+        // files are read and deserialized in parallel, results are applied in file order
+        struct LoadedFile
         {
-            QFile file(QDir(dir).absoluteFilePath(it.key()));
-            if (! file.exists())
-            {
-                continue;
-            }
-            if (! file.open(QFile::ReadOnly | QFile::Text))
-            {
-                return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
-            }
-            auto json = QJsonDocument::fromJson(file.readAll());
-            if (json.isArray() || (json.isNull() && ! json.isEmpty()))
+            bool exists = false;
+            CStatusMessage error;
+            CStatusMessageList messages;
+            CVariantMap values;
+            qint64 timestamp = 0;
+        };
+        const QVector<QString> fileNames(keysInFiles.keyBegin(), keysInFiles.keyEnd());
+        QVector<LoadedFile> loadedFiles(fileNames.size());
+        CParallel::forEachChunk(fileNames.size(), 1, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
             {
-                return CStatusMessage(this).error(u"Invalid JSON format in %1") << file.fileName();
-            }
+                LoadedFile &loaded = loadedFiles[i];
+                QFile file(QDir(dir).absoluteFilePath(fileNames[i]));
+                if (! file.exists()) { continue; }
+                loaded.exists = true;
+                CTimeline::Stage stage(CTimeline::startup(), QStringLiteral("Load cache %1").arg(fileNames[i]), QStringLiteral("cache"));
+                if (! file.open(QFile::ReadOnly | QFile::Text))
+                {
+                    loaded.error = CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
+                    continue;
+                }
+                const QByteArray data = file.readAll();
+                stage.setBytes(data.size());
 
-            CVariantMap temp;
-            if (keysOnly)
-            {
-                for (const auto &key : json.object().keys()) { temp.insert(key, {}); } // clazy:exclude=range-loop
-            }
-            else
-            {
-                const QString messagePrefix = QStringLiteral("Parsing %1").arg(it.key());
-                auto messages = temp.convertFromMemoizedJsonNoThrow(json.object(), it.value(), this, messagePrefix);
-                if (it.value().isEmpty()) { messages.push_back(temp.convertFromMemoizedJsonNoThrow(json.object(), this, messagePrefix)); }
-                if (! messages.isEmpty())
+                // values are read directly from the file data, without a QJsonDocument
+                CJsonStreamReader reader(data);
+                const bool empty = data.trimmed().isEmpty();
+                if (! empty && reader.readNext() == CJsonStreamReader::StartArray)
+                {
+                    loaded.error = CStatusMessage(this).error(u"Invalid JSON format in %1") << file.fileName();
+                    continue;
+                }
+
+                const QStringList keysInFile = keysInFiles.value(fileNames[i]);
+                if (empty || reader.tokenType() != CJsonStreamReader::StartObject)
                 {
-                    ok = false;
-                    backupFile(file);
-                    CLogMessage::preformatted(messages);
+                    // no values
                 }
+                else if (keysOnly)
+                {
+                    while (reader.readNext() == CJsonStreamReader::Name)
+                    {
+                        loaded.values.insert(reader.stringValue(), {});
+                        reader.skipValue();
+                    }
+                }
+                else
+                {
+                    const QString messagePrefix = QStringLiteral("Parsing %1").arg(fileNames[i]);
+                    loaded.messages = keysInFile.isEmpty() ?
+                                      loaded.values.readMemoizedJsonNoThrow(reader, this, messagePrefix) :
+                                      loaded.values.readMemoizedJsonNoThrow(reader, keysInFile, this, messagePrefix);
+                }
+                if (! empty && ! reader.hasError()) { reader.readNext(); } // only whitespace may follow
+                if (! empty && reader.tokenType() != CJsonStreamReader::EndDocument)
+                {
+                    loaded.values.clear();
+                    loaded.messages.push_back(CStatusMessage(this).error(u"Invalid JSON format in %1: %2") << file.fileName() << reader.errorString());
+                }
+                loaded.timestamp = QFileInfo(file).lastModified().toMSecsSinceEpoch();
+            }
+        });
+
+        bool ok = true;
+        for (int i = 0; i < fileNames.size(); i++)
+        {
+            LoadedFile &loaded = loadedFiles[i];
+            if (! loaded.exists) { continue; }
+            if (! loaded.error.isEmpty()) { return loaded.error; }
+            if (! loaded.messages.isEmpty())
+            {
+                ok = false;
+                QFile file(QDir(dir).absoluteFilePath(fileNames[i]));
+                backupFile(file);
+                CLogMessage::preformatted(loaded.messages);
             }
-            temp.removeDuplicates(currentValues);
-            o_values.insert(temp, QFileInfo(file).lastModified().toMSecsSinceEpoch());
+            loaded.values.removeDuplicates(currentValues);
+            o_values.insert(loaded.values, loaded.timestamp);
         }
         return CStatusMessage(this).info(u"Loaded cache values '%1' from '%2' '%3'") <<
             (keysMessage.isEmpty() ? o_values.keys().to<QStringList>().join(",") : keysMessage) << dir << (ok ? "successfully" : "with errors");
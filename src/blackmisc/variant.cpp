@@ -362,6 +362,97 @@ namespace BlackMisc
         return {};
     }
 
+    void CVariant::writeMemoizedJson(CJsonStreamWriter &writer) const
+    {
+        auto *meta = getValueObjectMetaInfo();
+        if (!meta)
+        {
+            writer.writeValue(toJson());
+            return;
+        }
+        writer.beginObject();
+        writer.writeName(QLatin1String("type"));
+        writer.writeString(QString::fromLatin1(this->typeName()));
+        writer.writeName(QLatin1String("value"));
+        try
+        {
+            meta->writeMemoizedJson(writer, data());
+        }
+        catch (const Private::CVariantException &ex)
+        {
+            // unsupported types throw before anything is written
+            CLogMessage(this).debug() << ex.what();
+            writer.writeNull();
+        }
+        writer.endObject();
+    }
+
+    void CVariant::readMemoizedJson(CJsonStreamReader &reader, bool allowFallbackToJson)
+    {
+        if (reader.tokenType() != CJsonStreamReader::StartObject)
+        {
+            reader.skipValue();
+            throw CJsonException("Missing 'type'");
+        }
+
+        QJsonObject json; // members which are not streamed
+        Private::IValueObjectMetaInfo *meta = nullptr;
+        int typeId = QMetaType::UnknownType;
+        bool valueRead = false;
+        while (reader.readNext() == CJsonStreamReader::Name)
+        {
+            if (reader.isName(QLatin1String("type")))
+            {
+                const QString typeName = reader.readValue().toString();
+                json.insert(QStringLiteral("type"), typeName);
+                typeId = typeName.isEmpty() ? QMetaType::UnknownType : QMetaType::type(qPrintable(typeName));
+                meta = Private::getValueObjectMetaInfo(typeId);
+            }
+            else if (meta && reader.isName(QLatin1String("value")))
+            {
+                reader.readNext();
+                CJsonScope scope("value");
+                Q_UNUSED(scope)
+                m_v = QVariant(typeId, nullptr);
+                try
+                {
+                    meta->readMemoizedJson(reader, data(), allowFallbackToJson);
+                }
+                catch (const Private::CVariantException &ex)
+                {
+                    throw CJsonException(ex.what());
+                }
+                valueRead = true;
+            }
+            else
+            {
+                const QString name = reader.stringValue();
+                json.insert(name, reader.readValue());
+            }
+        }
+        if (reader.hasError()) { throw CJsonException(reader.errorString()); }
+        if (valueRead) { return; }
+
+        // value before type, or not a value object
+        this->convertFromMemoizedJson(json, allowFallbackToJson);
+    }
+
+    CStatusMessage CVariant::readMemoizedJsonNoThrow(CJsonStreamReader &reader, const CLogCategoryList &categories, const QString &prefix)
+    {
+        const bool container = reader.tokenType() == CJsonStreamReader::StartObject || reader.tokenType() == CJsonStreamReader::StartArray;
+        const int depth = reader.depth() - (container ? 1 : 0);
+        try
+        {
+            readMemoizedJson(reader, false);
+        }
+        catch (const CJsonException &ex)
+        {
+            reader.skipToDepth(depth);
+            return CStatusMessage::fromJsonException(ex, categories, prefix);
+        }
+        return {};
+    }
+
     uint CVariant::getValueHash() const
     {
         switch (m_v.type())
@@ -251,6 +251,17 @@ namespace BlackMisc
         //! Call convertFromMemoizedJson, catch any CJsonException that is thrown and return it as CStatusMessage.
         CStatusMessage convertFromMemoizedJsonNoThrow(const QJsonObject &json, const CLogCategoryList &categories, const QString &prefix);
 
+        //! Write compact JSON format, value objects without building their QJsonObject
+        void writeMemoizedJson(CJsonStreamWriter &writer) const;
+
+        //! Read compact JSON format, the reader is on the first token of the object
+        //! \remark the value is read without building its QJsonObject if the type precedes it, as written by writeMemoizedJson
+        void readMemoizedJson(CJsonStreamReader &reader, bool allowFallbackToJson);
+
+        //! Call readMemoizedJson, catch any CJsonException that is thrown and return it as CStatusMessage.
+        //! \remark after an error the rest of the value is skipped
+        CStatusMessage readMemoizedJsonNoThrow(CJsonStreamReader &reader, const CLogCategoryList &categories, const QString &prefix);
+
         //! \copydoc BlackMisc::Mixin::DBusByMetaClass::marshallToDbus
         void marshallToDbus(QDBusArgument &argument) const;
 
@@ -174,4 +174,58 @@ namespace BlackMisc
         }
         return messages;
     }
+
+    void CVariantMap::writeMemoizedJsonMembers(CJsonStreamWriter &writer) const
+    {
+        for (auto it = cbegin(); it != cend(); ++it)
+        {
+            writer.writeName(it.key());
+            it.value().writeMemoizedJson(writer);
+        }
+    }
+
+    void CVariantMap::writeMemoizedJson(CJsonStreamWriter &writer) const
+    {
+        writer.beginObject();
+        writeMemoizedJsonMembers(writer);
+        writer.endObject();
+    }
+
+    CStatusMessageList CVariantMap::readMemoizedJsonNoThrow(CJsonStreamReader &reader, const CLogCategoryList &categories, const QString &prefix)
+    {
+        return readMemoizedJsonNoThrowImpl(reader, {}, categories, prefix, false);
+    }
+
+    CStatusMessageList CVariantMap::readMemoizedJsonNoThrow(CJsonStreamReader &reader, const QStringList &keys, const CLogCategoryList &categories, const QString &prefix)
+    {
+        return readMemoizedJsonNoThrowImpl(reader, keys, categories, prefix, true);
+    }
+
+    CStatusMessageList CVariantMap::readMemoizedJsonNoThrowImpl(CJsonStreamReader &reader, const QStringList &keys, const CLogCategoryList &categories, const QString &prefix, bool onlyKeys)
+    {
+        CStatusMessageList messages;
+        clear();
+        if (reader.tokenType() != CJsonStreamReader::StartObject)
+        {
+            reader.skipValue();
+            return messages;
+        }
+        while (reader.readNext() == CJsonStreamReader::Name)
+        {
+            const QString key = reader.stringValue();
+            if (onlyKeys && !keys.contains(key))
+            {
+                reader.skipValue();
+                continue;
+            }
+            CJsonScope scope(key);
+            Q_UNUSED(scope);
+            reader.readNext();
+            CVariant var;
+            auto message = var.readMemoizedJsonNoThrow(reader, categories, prefix);
+            if (message.isSuccess()) { insert(key, var); }
+            else { messages.push_back(message); }
+        }
+        return messages;
+    }
 }
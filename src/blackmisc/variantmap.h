@@ -96,6 +96,24 @@ namespace BlackMisc
 
         //! Call convertFromMemoizedJson, catch any CJsonException that are thrown and return them as CStatusMessage.
         CStatusMessageList convertFromMemoizedJsonNoThrow(const QJsonObject &json, const QStringList &keys, const CLogCategoryList &categories, const QString &prefix);
+
+        //! Write the values of this map as members of an object begun by the writer, like mergeToMemoizedJson
+        void writeMemoizedJsonMembers(CJsonStreamWriter &writer) const;
+
+        //! Write compact JSON format, without building the QJsonObject
+        void writeMemoizedJson(CJsonStreamWriter &writer) const;
+
+        //! Read compact JSON format value by value, the reader is on the first token of the object.
+        //! Catch any CJsonException that are thrown and return them as CStatusMessage.
+        CStatusMessageList readMemoizedJsonNoThrow(CJsonStreamReader &reader, const CLogCategoryList &categories, const QString &prefix);
+
+        //! Read compact JSON format value by value, the reader is on the first token of the object.
+        //! Read only keys present in list argument, catch any CJsonException that are thrown and return them as CStatusMessage.
+        CStatusMessageList readMemoizedJsonNoThrow(CJsonStreamReader &reader, const QStringList &keys, const CLogCategoryList &categories, const QString &prefix);
+
+    private:
+        //! Implementation of readMemoizedJsonNoThrow
+        CStatusMessageList readMemoizedJsonNoThrowImpl(CJsonStreamReader &reader, const QStringList &keys, const CLogCategoryList &categories, const QString &prefix, bool onlyKeys);
     };
 
 }
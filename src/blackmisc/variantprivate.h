@@ -13,6 +13,7 @@
 
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/inheritancetraits.h"
+#include "blackmisc/jsonstream.h"
 #include "blackmisc/propertyindexref.h"
 #include <QString>
 #include <QMetaType>
@@ -45,6 +46,8 @@ namespace BlackMisc
             virtual void convertFromJson(const QJsonObject &json, void *object) const = 0;
             virtual QJsonObject toMemoizedJson(const void *object) const = 0;
             virtual void convertFromMemoizedJson(const QJsonObject &json, void *object, bool allowFallbackToJson) const = 0;
+            virtual void writeMemoizedJson(CJsonStreamWriter &writer, const void *object) const = 0;
+            virtual void readMemoizedJson(CJsonStreamReader &reader, void *object, bool allowFallbackToJson) const = 0;
             virtual void unmarshall(const QDBusArgument &arg, void *object) const = 0;
             virtual uint getValueHash(const void *object) const = 0;
             virtual int getMetaTypeId() const = 0;
@@ -102,6 +105,36 @@ namespace BlackMisc
             template <typename T>
             static void convertFromMemoizedJson(const QJsonObject &json, T &object, bool allowFallbackToJson, ...) { convertFromJson(json, object, 0); Q_UNUSED(allowFallbackToJson) }
 
+            template <typename T>
+            static void writeJson(CJsonStreamWriter &writer, const T &object, decltype(static_cast<void>(object.toJson()), 0)) { Json::writeToStream(writer, object); }
+            template <typename T>
+            static void writeJson(CJsonStreamWriter &, const T &object, ...) { throw CVariantException(object, "toJson"); }
+
+            template <typename T>
+            static void readJson(CJsonStreamReader &reader, T &object, decltype(static_cast<void>(object.convertFromJson(std::declval<const QJsonObject &>())), 0)) { Json::readFromStream(reader, object); }
+            template <typename T>
+            static void readJson(CJsonStreamReader &, T &object, ...) { throw CVariantException(object, "convertFromJson"); }
+
+            template <typename T>
+            static void writeMemoizedJsonDom(CJsonStreamWriter &writer, const T &object, decltype(static_cast<void>(object.toMemoizedJson()), 0)) { writer.writeValue(object.toMemoizedJson()); }
+            template <typename T>
+            static void writeMemoizedJsonDom(CJsonStreamWriter &writer, const T &object, ...) { writeJson(writer, object, 0); }
+
+            template <typename T>
+            static void writeMemoizedJson(CJsonStreamWriter &writer, const T &object, decltype(static_cast<void>(object.writeMemoizedJson(writer)), 0)) { object.writeMemoizedJson(writer); }
+            template <typename T>
+            static void writeMemoizedJson(CJsonStreamWriter &writer, const T &object, ...) { writeMemoizedJsonDom(writer, object, 0); }
+
+            template <typename T>
+            static void readMemoizedJsonDom(CJsonStreamReader &reader, T &object, bool allowFallbackToJson, decltype(static_cast<void>(object.convertFromMemoizedJson(std::declval<const QJsonObject &>(), allowFallbackToJson)), 0)) { object.convertFromMemoizedJson(reader.readValue().toObject(), allowFallbackToJson); }
+            template <typename T>
+            static void readMemoizedJsonDom(CJsonStreamReader &reader, T &object, bool allowFallbackToJson, ...) { readJson(reader, object, 0); Q_UNUSED(allowFallbackToJson) }
+
+            template <typename T>
+            static void readMemoizedJson(CJsonStreamReader &reader, T &object, bool allowFallbackToJson, decltype(static_cast<void>(object.readMemoizedJson(reader, allowFallbackToJson)), 0)) { object.readMemoizedJson(reader, allowFallbackToJson); }
+            template <typename T>
+            static void readMemoizedJson(CJsonStreamReader &reader, T &object, bool allowFallbackToJson, ...) { readMemoizedJsonDom(reader, object, allowFallbackToJson, 0); }
+
             template <typename T>
             static uint getValueHash(const T &object, decltype(static_cast<void>(qHash(object)), 0)) { return qHash(object); }
             template <typename T>
@@ -154,6 +187,8 @@ namespace BlackMisc
             virtual void convertFromJson(const QJsonObject &json, void *object) const override;
             virtual QJsonObject toMemoizedJson(const void *object) const override;
             virtual void convertFromMemoizedJson(const QJsonObject &json, void *object, bool allowFallbackToJson) const override;
+            virtual void writeMemoizedJson(CJsonStreamWriter &writer, const void *object) const override;
+            virtual void readMemoizedJson(CJsonStreamReader &reader, void *object, bool allowFallbackToJson) const override;
             virtual void unmarshall(const QDBusArgument &arg, void *object) const override;
             virtual uint getValueHash(const void *object) const override;
             virtual int getMetaTypeId() const override;
@@ -198,6 +233,14 @@ namespace BlackMisc
         {
             CValueObjectMetaInfoHelper::convertFromMemoizedJson(json, cast(object), allowFallbackToJson, 0);
         }
+        template <typename T> void CValueObjectMetaInfo<T>::writeMemoizedJson(CJsonStreamWriter &writer, const void *object) const
+        {
+            CValueObjectMetaInfoHelper::writeMemoizedJson(writer, cast(object), 0);
+        }
+        template <typename T> void CValueObjectMetaInfo<T>::readMemoizedJson(CJsonStreamReader &reader, void *object, bool allowFallbackToJson) const
+        {
+            CValueObjectMetaInfoHelper::readMemoizedJson(reader, cast(object), allowFallbackToJson, 0);
+        }
         template <typename T> void CValueObjectMetaInfo<T>::unmarshall(const QDBusArgument &arg, void *object) const
         {
             arg >> cast(object);
@@ -11,6 +11,7 @@
 #include "blackmisc/aviation/airporticaocode.h"
 #include "blackmisc/aviation/altitude.h"
 #include "blackmisc/logmessage.h"
+#include "blackmisc/parallel.h"
 #include "blackmisc/pq/angle.h"
 #include "blackmisc/pq/length.h"
 #include "blackmisc/pq/measurementunit.h"
@@ -25,11 +26,13 @@
 #include "blackmisc/weather/presentweather.h"
 #include "blackmisc/weather/windlayer.h"
 
+#include <QByteArray>
 #include <QHash>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
 #include <QStringList>
 #include <QtGlobal>
+#include <cstddef>
 
 using namespace BlackMisc::PhysicalQuantities;
 using namespace BlackMisc::Aviation;
@@ -948,6 +951,528 @@ namespace BlackMisc::Weather
         }
     };
 
+    //! Entry of a lookup table used by the single pass decoder
+    template <class T>
+    struct CMetarCode
+    {
+        const char *code; //!< ASCII code
+        T value;          //!< decoded value
+    };
+
+    //! Present weather intensity, '-' and '+' are matched separately
+    const CMetarCode<CPresentWeather::Intensity> metarIntensities[] =
+    {
+        { "VC", CPresentWeather::InVincinity }
+    };
+
+    //! Present weather descriptors, same codes as CMetarDecoderPresentWeather
+    const CMetarCode<CPresentWeather::Descriptor> metarDescriptors[] =
+    {
+        { "MI", CPresentWeather::Shallow },
+        { "BC", CPresentWeather::Patches },
+        { "PR", CPresentWeather::Partial },
+        { "DR", CPresentWeather::Drifting },
+        { "BL", CPresentWeather::Blowing },
+        { "SH", CPresentWeather::Showers },
+        { "TS", CPresentWeather::Thunderstorm },
+        { "FR", CPresentWeather::Freezing }
+    };
+
+    //! Weather phenomena, same codes as CMetarDecoderPresentWeather ("FC" is a funnel cloud there)
+    const CMetarCode<int> metarPhenomena[] =
+    {
+        { "DZ", CPresentWeather::Drizzle },
+        { "RA", CPresentWeather::Rain },
+        { "SN", CPresentWeather::Snow },
+        { "SG", CPresentWeather::SnowGrains },
+        { "IC", CPresentWeather::IceCrystals },
+        { "PC", CPresentWeather::IcePellets },
+        { "GR", CPresentWeather::Hail },
+        { "GS", CPresentWeather::SnowPellets },
+        { "UP", CPresentWeather::Unknown },
+        { "BR", CPresentWeather::Mist },
+        { "FG", CPresentWeather::Fog },
+        { "FU", CPresentWeather::Smoke },
+        { "VA", CPresentWeather::VolcanicAsh },
+        { "DU", CPresentWeather::Dust },
+        { "SA", CPresentWeather::Sand },
+        { "HZ", CPresentWeather::Haze },
+        { "PO", CPresentWeather::DustSandWhirls },
+        { "SQ", CPresentWeather::Squalls },
+        { "FC", CPresentWeather::FunnelCloud },
+        { "SS", CPresentWeather::Sandstorm },
+        { "DS", CPresentWeather::Duststorm },
+        { "//", CPresentWeather::NoPhenomena }
+    };
+
+    //! Cloud coverage
+    const CMetarCode<CCloudLayer::Coverage> metarCoverages[] =
+    {
+        { "///", CCloudLayer::None },
+        { "FEW", CCloudLayer::Few },
+        { "SCT", CCloudLayer::Scattered },
+        { "BKN", CCloudLayer::Broken },
+        { "OVC", CCloudLayer::Overcast }
+    };
+
+    //! Kind of wind speed unit
+    enum MetarWindUnit { Knots, MetersPerSecond, KilometersPerHour };
+
+    //! Wind speed units
+    const CMetarCode<MetarWindUnit> metarWindUnits[] =
+    {
+        { "KT", Knots },
+        { "MPS", MetersPerSecond },
+        { "KPH", KilometersPerHour },
+        { "KMH", KilometersPerHour }
+    };
+
+    //! Codes without value
+    const CMetarCode<bool> metarClearSky[] = { { "SKC", true }, { "NSC", true }, { "CLR", true }, { "NCD", true } };
+    const CMetarCode<bool> metarCardinalDirections[] =
+    {
+        { "N", true }, { "NE", true }, { "E", true }, { "SE", true }, { "S", true }, { "SW", true }, { "W", true }, { "NW", true }
+    };
+    const CMetarCode<bool> metarCloudTypes[] = { { "CB", true }, { "TCU", true }, { "///", true } };
+
+    /*!
+     * Single pass METAR decoder.
+     *
+     * Scans the simplified report once from left to right, the groups are classified by hand written matchers
+     * working on the scan position, no regular expressions and no copies of the remaining report.
+     * The groups are matched in the order and with the rules of the IMetarDecoderPart chain:
+     * a group normally ends with a space, but some groups span a space ("1 1/2SM") or end without one
+     * (wind, temperature), so the matchers do not rely on a split into tokens.
+     */
+    class CMetarScanner
+    {
+    public:
+        //! Constructor
+        //! \param report simplified METAR report
+        explicit CMetarScanner(const QString &report) : m_report(report), m_size(report.size()) {}
+
+        //! Decode the report
+        //! \param metar decoded values
+        //! \param failedGroup name of the group which made the report invalid
+        //! \return false if the report is invalid
+        bool decode(CMetar &metar, const char *&failedGroup)
+        {
+            failedGroup = "ReportType";
+            this->reportType(metar);
+            failedGroup = "Airport";
+            if (!this->airport(metar)) { return false; }
+            failedGroup = "DayTime";
+            if (!this->dayTime(metar)) { return false; }
+            failedGroup = "Status";
+            if (!this->status(metar)) { return false; }
+            failedGroup = "Wind";
+            this->wind(metar);
+            failedGroup = "WindDirection";
+            this->windDirectionVariations(metar);
+            failedGroup = "Visibility";
+            if (!this->visibility(metar)) { return false; }
+            failedGroup = "RunwayVisualRange";
+            this->runwayVisualRange();
+            failedGroup = "PresentWeather";
+            while (this->presentWeather(metar)) {}
+            failedGroup = "Cloud";
+            while (this->cloud(metar)) {}
+            failedGroup = "VerticalVisibility";
+            this->verticalVisibility();
+            failedGroup = "Temperature";
+            this->temperature(metar);
+            failedGroup = "Pressure";
+            this->pressure(metar);
+
+            // recent weather and wind shear are not used
+            failedGroup = nullptr;
+            return true;
+        }
+
+    private:
+        //! Character at position, 0 beyond the end
+        ushort at(int pos) const { return pos < m_size ? m_report[pos].unicode() : 0; }
+
+        //! Character classes
+        bool isDigit(int pos) const { const ushort c = this->at(pos); return c >= '0' && c <= '9'; }
+        bool isUpper(int pos) const { const ushort c = this->at(pos); return c >= 'A' && c <= 'Z'; }
+        bool isSpace(int pos) const { return this->at(pos) == ' '; }
+        bool isWord(int pos) const { const ushort c = this->at(pos); return this->isDigit(pos) || this->isUpper(pos) || (c >= 'a' && c <= 'z') || c == '_'; }
+
+        //! Count digits at position
+        bool isDigits(int pos, int count) const
+        {
+            for (int i = 0; i < count; ++i) { if (!this->isDigit(pos + i)) { return false; } }
+            return true;
+        }
+
+        //! ASCII code at position?
+        bool isCode(int pos, const char *code) const
+        {
+            for (int i = 0; code[i]; ++i) { if (this->at(pos + i) != static_cast<uchar>(code[i])) { return false; } }
+            return true;
+        }
+
+        //! Value of count digits at position
+        int toInt(int pos, int count) const
+        {
+            int value = 0;
+            for (int i = 0; i < count; ++i) { value = value * 10 + (this->at(pos + i) - '0'); }
+            return value;
+        }
+
+        //! Lookup a code at position
+        //! \return length of the code, 0 if there is none
+        template <class T, std::size_t N>
+        int lookup(int pos, const CMetarCode<T> (&table)[N], T &value) const
+        {
+            for (const CMetarCode<T> &entry : table)
+            {
+                if (this->isCode(pos, entry.code)) { value = entry.value; return static_cast<int>(qstrlen(entry.code)); }
+            }
+            return 0;
+        }
+
+        //! Lookup a code without value at position
+        template <std::size_t N>
+        int lookup(int pos, const CMetarCode<bool> (&table)[N]) const
+        {
+            bool dummy = false;
+            return this->lookup(pos, table, dummy);
+        }
+
+        //! Wind speed unit
+        static CSpeedUnit speedUnit(MetarWindUnit unit)
+        {
+            switch (unit)
+            {
+            case MetersPerSecond: return CSpeedUnit::m_s();
+            case KilometersPerHour: return CSpeedUnit::km_h();
+            default: break;
+            }
+            return CSpeedUnit::kts();
+        }
+
+        //! METAR or SPECI
+        void reportType(CMetar &metar)
+        {
+            if (!this->isSpace(m_pos + 5)) { return; }
+            if (this->isCode(m_pos, "METAR")) { metar.setReportType(CMetar::METAR); m_pos += 6; }
+            else if (this->isCode(m_pos, "SPECI")) { metar.setReportType(CMetar::SPECI); m_pos += 6; }
+        }
+
+        //! ICAO code, mandatory
+        bool airport(CMetar &metar)
+        {
+            for (int i = 0; i < 4; ++i) { if (!this->isWord(m_pos + i)) { return false; } }
+            if (!this->isSpace(m_pos + 4)) { return false; }
+            metar.setAirportIcaoCode(CAirportIcaoCode(m_report.mid(m_pos, 4)));
+            m_pos += 5;
+            return true;
+        }
+
+        //! DDHHMMZ, mandatory
+        bool dayTime(CMetar &metar)
+        {
+            if (!this->isDigits(m_pos, 6) || this->at(m_pos + 6) != 'Z' || !this->isSpace(m_pos + 7)) { return false; }
+            const int day = this->toInt(m_pos, 2);
+            const int hour = this->toInt(m_pos + 2, 2);
+            const int minute = this->toInt(m_pos + 4, 2);
+            if (day < 1 || day > 31 || hour > 23 || minute > 59) { return false; }
+            metar.setDayTime(day, CTime(hour, minute, 0));
+            m_pos += 8;
+            return true;
+        }
+
+        //! AUTO, NIL or correction, other words make the report invalid
+        bool status(CMetar &metar)
+        {
+            int length = 0;
+            while (this->isUpper(m_pos + length)) { length++; }
+            if (length < 1 || !this->isSpace(m_pos + length)) { return true; }
+            if (length == 4 && this->isCode(m_pos, "AUTO")) { metar.setAutomated(true); }
+            else if (length != 3) { return false; } // NIL or correction (e.g. COR), not used
+            m_pos += length + 1;
+            return true;
+        }
+
+        //! Optional gust G(d)dd and unit after the wind speed
+        //! \return end of the unit, 0 if not matching
+        int windGustAndUnit(int pos, int &gustDigits, MetarWindUnit &unit) const
+        {
+            if (this->at(pos) == 'G')
+            {
+                for (gustDigits = 3; gustDigits >= 2; --gustDigits)
+                {
+                    if (!this->isDigits(pos + 1, gustDigits)) { continue; }
+                    const int unitLength = this->lookup(pos + 1 + gustDigits, metarWindUnits, unit);
+                    if (unitLength > 0) { return pos + 1 + gustDigits + unitLength; }
+                }
+            }
+            gustDigits = 0;
+            const int unitLength = this->lookup(pos, metarWindUnits, unit);
+            return unitLength > 0 ? pos + unitLength : 0;
+        }
+
+        //! dddff(f)(Gff(f))unit, direction also VRB or ///, speed also //
+        void wind(CMetar &metar)
+        {
+            const int p = m_pos;
+            const bool directionVariable = this->isCode(p, "VRB");
+            const bool directionMissing = this->isCode(p, "///");
+            if (!directionVariable && !directionMissing && !this->isDigits(p, 3)) { return; }
+
+            // speed with 3 digits is tried first
+            const int speedPos = p + 3;
+            const bool speedMissing = this->isCode(speedPos, "//");
+            MetarWindUnit unit = Knots;
+            int speedDigits = 2;
+            int gustDigits = 0;
+            int end = 0;
+            if (speedMissing) { end = this->windGustAndUnit(speedPos + 2, gustDigits, unit); }
+            else
+            {
+                for (speedDigits = 3; speedDigits >= 2; --speedDigits)
+                {
+                    if (!this->isDigits(speedPos, speedDigits)) { continue; }
+                    end = this->windGustAndUnit(speedPos + speedDigits, gustDigits, unit);
+                    if (end > 0) { break; }
+                }
+            }
+            if (end < 1) { return; }
+            m_pos = this->isSpace(end) ? end + 1 : end;
+            if (directionMissing || speedMissing) { return; }
+
+            const int direction = directionVariable ? 0 : this->toInt(p, 3);
+            const int speed = this->toInt(speedPos, speedDigits);
+            const int gustSpeed = gustDigits > 0 ? this->toInt(speedPos + speedDigits + 1, gustDigits) : 0;
+            const CSpeedUnit speedUnit = CMetarScanner::speedUnit(unit);
+            CWindLayer windLayer(CAltitude(0, CAltitude::AboveGround, CLengthUnit::ft()), CAngle(direction, CAngleUnit::deg()),
+                                 CSpeed(speed, speedUnit), CSpeed(gustSpeed, speedUnit));
+            windLayer.setDirectionVariable(directionVariable);
+            metar.setWindLayer(windLayer);
+        }
+
+        //! dddVddd
+        void windDirectionVariations(CMetar &metar)
+        {
+            if (!this->isDigits(m_pos, 3) || this->at(m_pos + 3) != 'V' || !this->isDigits(m_pos + 4, 3) || !this->isSpace(m_pos + 7)) { return; }
+            CWindLayer windLayer = metar.getWindLayer();
+            windLayer.setDirection(CAngle(this->toInt(m_pos, 3), CAngleUnit::deg()), CAngle(this->toInt(m_pos + 4, 3), CAngleUnit::deg()));
+            metar.setWindLayer(windLayer);
+            m_pos += 8;
+        }
+
+        //! CAVOK, dddd(NDV)(direction) or US/Canada statute miles, invalid fractions make the report invalid
+        bool visibility(CMetar &metar)
+        {
+            const int p = m_pos;
+            if (this->isCode(p, "CAVOK") && this->isSpace(p + 5))
+            {
+                metar.setCavok();
+                m_pos += 6;
+                return true;
+            }
+
+            // European version in meters, rest of the group is empty, NDV, a direction or both
+            const bool visibilityMissing = this->isCode(p, "////");
+            if (visibilityMissing || this->isDigits(p, 4))
+            {
+                int end = p + 4;
+                while (end < m_size && !this->isSpace(end)) { end++; }
+                if (this->isSpace(end) && this->isEuropeanVisibilityRest(p + 4, end))
+                {
+                    if (!visibilityMissing) { metar.setVisibility(CLength(this->toInt(p, 4), CLengthUnit::m())); }
+                    m_pos = end + 1;
+                    return true;
+                }
+            }
+
+            // US/Canada version: (distance)( )(M)(n/d)SM|KM, alternatives tried in order of the regular expression
+            int distanceDigits = 0;
+            while (distanceDigits < 2 && this->isDigit(p + distanceDigits)) { distanceDigits++; }
+            for (int d = distanceDigits; d >= 0; --d)
+            {
+                const int p1 = p + d;
+                for (int space = this->isSpace(p1) ? 1 : 0; space >= 0; --space)
+                {
+                    const int p2 = p1 + space;
+                    for (int lessThan = this->at(p2) == 'M' ? 1 : 0; lessThan >= 0; --lessThan)
+                    {
+                        const int p3 = p2 + lessThan;
+                        const bool hasFraction = this->isDigit(p3) && this->at(p3 + 1) == '/' && this->isDigit(p3 + 2);
+                        for (int fraction = hasFraction ? 1 : 0; fraction >= 0; --fraction)
+                        {
+                            const int p4 = p3 + 3 * fraction;
+                            const bool km = this->isCode(p4, "KM");
+                            if (!(km || this->isCode(p4, "SM")) || !this->isSpace(p4 + 2)) { continue; }
+
+                            double visibility = 0;
+                            if (d > 0) { visibility += this->toInt(p, d); }
+                            if (fraction)
+                            {
+                                const double numerator = this->toInt(p3, 1);
+                                const double denominator = this->toInt(p3 + 2, 1);
+                                if (denominator < 1 || numerator < 1) { return false; }
+                                visibility += (numerator / denominator);
+                            }
+                            metar.setVisibility(CLength(visibility, km ? CLengthUnit::km() : CLengthUnit::SM()));
+                            m_pos = p4 + 3;
+                            return true;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        //! Rest of a European visibility group: empty, NDV, a direction or NDV and a direction
+        bool isEuropeanVisibilityRest(int begin, int end) const
+        {
+            if (begin == end) { return true; }
+            int p = begin;
+            if (this->isCode(p, "NDV")) { p += 3; }
+            if (p == end) { return true; }
+            for (const CMetarCode<bool> &direction : metarCardinalDirections)
+            {
+                if (p + static_cast<int>(qstrlen(direction.code)) == end && this->isCode(p, direction.code)) { return true; }
+            }
+            return false;
+        }
+
+        //! Rdd(LCR)/(PM)dddd(Vdddd)(FT)(/)(DNU), only the first group, not used
+        void runwayVisualRange()
+        {
+            int p = m_pos;
+            if (this->at(p) != 'R' || !this->isDigits(p + 1, 2)) { return; }
+            p += 3;
+            while (this->at(p) == 'L' || this->at(p) == 'C' || this->at(p) == 'R') { p++; }
+            if (this->at(p++) != '/') { return; }
+            if (this->at(p) == 'P' || this->at(p) == 'M') { p++; }
+            if (!this->isDigits(p, 4)) { return; }
+            p += 4;
+            if (this->at(p) == 'V') { p++; }
+            if (this->isDigits(p, 4)) { p += 4; }
+            if (this->isCode(p, "FT")) { p += 2; }
+            if (this->at(p) == '/') { p++; }
+            if (this->at(p) == 'D' || this->at(p) == 'N' || this->at(p) == 'U') { p++; }
+            if (!this->isSpace(p)) { return; }
+            m_pos = p + 1;
+        }
+
+        //! (intensity)(descriptor)(up to 4 phenomena), repeatable
+        bool presentWeather(CMetar &metar)
+        {
+            int p = m_pos;
+            CPresentWeather::Intensity intensity = CPresentWeather::Moderate;
+            if (this->at(p) == '-') { intensity = CPresentWeather::Light; p++; }
+            else if (this->at(p) == '+') { intensity = CPresentWeather::Heavy; p++; }
+            else { p += this->lookup(p, metarIntensities, intensity); }
+
+            CPresentWeather::Descriptor descriptor = CPresentWeather::None;
+            p += this->lookup(p, metarDescriptors, descriptor);
+
+            // only the first 2 phenomena are used
+            int weatherPhenomena = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                int phenomenon = 0;
+                const int length = this->lookup(p, metarPhenomena, phenomenon);
+                if (length < 1) { break; }
+                if (i < 2) { weatherPhenomena |= phenomenon; }
+                p += length;
+            }
+            if (!this->isSpace(p)) { return false; }
+
+            metar.addPresentWeather(CPresentWeather(intensity, descriptor, weatherPhenomena));
+            m_pos = p + 1;
+            return true;
+        }
+
+        //! Clear sky or coverage and base (CB/TCU), repeatable
+        bool cloud(CMetar &metar)
+        {
+            const int p = m_pos;
+            const int clearSky = this->lookup(p, metarClearSky);
+            if (clearSky > 0 && this->isSpace(p + clearSky))
+            {
+                metar.removeAllClouds();
+                m_pos = p + clearSky + 1;
+                return true;
+            }
+
+            CCloudLayer::Coverage coverage = CCloudLayer::None;
+            if (this->lookup(p, metarCoverages, coverage) < 1) { return false; }
+            const bool baseMissing = this->isCode(p + 3, "///");
+            if (!baseMissing && !this->isDigits(p + 3, 3)) { return false; }
+            int end = p + 6;
+            if (!this->isSpace(end)) { end += this->lookup(end, metarCloudTypes); }
+            if (!this->isSpace(end)) { return false; }
+
+            m_pos = end + 1;
+            if (baseMissing) { return true; }
+            const int base = this->toInt(p + 3, 3) * 100;
+            metar.addCloudLayer(CCloudLayer(CAltitude(base, CAltitude::AboveGround, CLengthUnit::ft()), {}, coverage));
+            return true;
+        }
+
+        //! VVddd, not used
+        void verticalVisibility()
+        {
+            if (!this->isCode(m_pos, "VV")) { return; }
+            if ((this->isDigits(m_pos + 2, 3) || this->isCode(m_pos + 2, "///")) && this->isSpace(m_pos + 5)) { m_pos += 6; }
+        }
+
+        //! Temperature or dew point (M)dd or //
+        //! \return length, 0 if not matching
+        int temperatureValue(int pos, bool &missing, int &value) const
+        {
+            missing = false;
+            if (this->at(pos) == 'M' && this->isDigits(pos + 1, 2)) { value = -this->toInt(pos + 1, 2); return 3; }
+            if (this->isDigits(pos, 2)) { value = this->toInt(pos, 2); return 2; }
+            if (this->isCode(pos, "//")) { missing = true; return 2; }
+            return 0;
+        }
+
+        //! Temperature/dew point
+        void temperature(CMetar &metar)
+        {
+            int p = m_pos;
+            bool temperatureMissing = false;
+            bool dewPointMissing = false;
+            int temperature = 0;
+            int dewPoint = 0;
+            const int temperatureLength = this->temperatureValue(p, temperatureMissing, temperature);
+            if (temperatureLength < 1 || this->at(p + temperatureLength) != '/') { return; }
+            p += temperatureLength + 1;
+            const int dewPointLength = this->temperatureValue(p, dewPointMissing, dewPoint);
+            if (dewPointLength < 1) { return; }
+            p += dewPointLength;
+            m_pos = this->isSpace(p) ? p + 1 : p;
+            if (temperatureMissing || dewPointMissing) { return; }
+
+            metar.setTemperature(CTemperature(temperature, CTemperatureUnit::C()));
+            metar.setDewPoint(CTemperature(dewPoint, CTemperatureUnit::C()));
+        }
+
+        //! Qdddd (hPa) or Adddd (inHg)
+        void pressure(CMetar &metar)
+        {
+            const ushort unit = this->at(m_pos);
+            if (unit != 'Q' && unit != 'A') { return; }
+            if (this->isCode(m_pos + 1, "////")) { return; } // no value
+            if (!this->isDigits(m_pos + 1, 4)) { return; }
+            double pressure = this->toInt(m_pos + 1, 4);
+            if (unit == 'A') { pressure /= 100; }
+            metar.setAltimeter(CPressure(pressure, unit == 'A' ? CPressureUnit::inHg() : CPressureUnit::hPa()));
+            m_pos += this->isSpace(m_pos + 5) ? 6 : 5;
+        }
+
+        const QString &m_report;
+        const int m_size = 0;
+        int m_pos = 0;
+    };
+
     CMetarDecoder::CMetarDecoder()
     {
         allocateDecoders();
@@ -957,6 +1482,22 @@ namespace BlackMisc::Weather
     { }
 
     CMetar CMetarDecoder::decode(const QString &metarString) const
+    {
+        CMetar metar;
+        const QString report = metarString.simplified();
+        const char *failedGroup = nullptr;
+        CMetarScanner scanner(report);
+        if (!scanner.decode(metar, failedGroup))
+        {
+            CLogMessage(this).debug() << "Invalid METAR:" << metarString << QLatin1String(failedGroup);
+            return CMetar();
+        }
+
+        metar.setMessage(metarString);
+        return metar;
+    }
+
+    CMetar CMetarDecoder::decodeWithRegularExpressions(const QString &metarString) const
     {
         CMetar metar;
         QString metarStringCopy = metarString.simplified();
@@ -975,6 +1516,25 @@ namespace BlackMisc::Weather
         return metar;
     }
 
+    CMetarList CMetarDecoder::decodeAll(const QStringList &metarStrings, int *invalid) const
+    {
+        QVector<CMetarList> chunks = CParallel::mapChunks<CMetarList>(metarStrings.size(), MinReportsPerThread, [&](int begin, int end)
+        {
+            CMetarList metars;
+            for (int i = begin; i < end; ++i)
+            {
+                CMetar metar = this->decode(metarStrings[i]);
+                if (metar.hasMessage()) { metars.push_back(std::move(metar)); }
+            }
+            return metars;
+        });
+
+        CMetarList metars;
+        for (CMetarList &chunk : chunks) { metars.push_back(std::move(chunk)); }
+        if (invalid) { *invalid = metarStrings.size() - metars.size(); }
+        return metars;
+    }
+
     void CMetarDecoder::allocateDecoders()
     {
         m_decoders.clear();
@@ -13,9 +13,11 @@
 
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/weather/metar.h"
+#include "blackmisc/weather/metarlist.h"
 
 #include <QObject>
 #include <QString>
+#include <QStringList>
 #include <memory>
 #include <vector>
 
@@ -23,7 +25,12 @@ namespace BlackMisc::Weather
 {
     class IMetarDecoderPart;
 
-    //! Metar Decoder
+    /*!
+     * Metar Decoder
+     * \remark decode() scans a report once, group by group, with hand written matchers.
+     *         The chain of regular expression decoder parts is kept as reference implementation,
+     *         both yield the same results.
+     */
     class BLACKMISC_EXPORT CMetarDecoder : public QObject
     {
         Q_OBJECT
@@ -36,8 +43,24 @@ namespace BlackMisc::Weather
         virtual ~CMetarDecoder() override;
 
         //! Decode metar
+        //! \return decoded METAR, or a default CMetar if the report is invalid
+        //! \threadsafe
         CMetar decode(const QString &metarString) const;
 
+        //! Decode metar with the chain of regular expression decoder parts
+        //! \remark reference implementation for decode(), slower
+        CMetar decodeWithRegularExpressions(const QString &metarString) const;
+
+        //! Decode many metars, in parallel for larger numbers
+        //! \param metarStrings one report per string
+        //! \param invalid optional, number of invalid reports
+        //! \return valid METARs in order of metarStrings
+        //! \threadsafe
+        CMetarList decodeAll(const QStringList &metarStrings, int *invalid = nullptr) const;
+
+        //! Min. number of reports decoded per thread by decodeAll
+        static constexpr int MinReportsPerThread = 250;
+
     private:
         void allocateDecoders();
         std::vector<std::unique_ptr<IMetarDecoderPart>> m_decoders;
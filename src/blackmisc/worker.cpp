@@ -12,6 +12,7 @@
 #include "blackmisc/logmessage.h"
 
 #include <future>
+#include <QCoreApplication>
 #include <QTimer>
 #include <QPointer>
 
@@ -66,42 +67,54 @@ namespace BlackMisc
         Q_UNUSED(ok)
     }
 
-    CWorker *CWorker::fromTaskImpl(QObject *owner, const QString &name, int typeId, const std::function<QVariant()> &task)
+    CWorker *CWorker::fromTaskImpl(QObject *owner, const QString &name, int typeId, CTaskPool::Priority priority, const std::function<QVariant()> &task)
     {
         auto *worker = new CWorker(task);
         emit worker->aboutToStart();
         worker->setStarted();
-        auto *thread = new CRegularThread(owner);
 
         if (typeId != QMetaType::Void) { worker->m_result = QVariant(typeId, nullptr); }
 
         const QString ownerName = owner->objectName().isEmpty() ? owner->metaObject()->className() : owner->objectName();
-        thread->setObjectName(ownerName + ":" + name);
         worker->setObjectName(name);
+        worker->m_ownerThread = worker->thread();
 
-        worker->moveToThread(thread);
-        const bool s = QMetaObject::invokeMethod(worker, &CWorker::ps_runTask);
-        Q_ASSERT_X(s, Q_FUNC_INFO, "cannot invoke");
-        Q_UNUSED(s)
-        thread->start();
+        if (priority == CTaskPool::LowPriority)
+        {
+            // long or blocking tasks would starve the bounded pool, they get a thread with an event loop
+            auto *thread = new CRegularThread(owner);
+            thread->setObjectName(ownerName + ":" + name);
+            QObject::connect(owner, &QObject::destroyed, thread, &QThread::requestInterruption, Qt::DirectConnection); // abandoned, thread is waited for
+            worker->moveToThread(thread);
+            const bool s = QMetaObject::invokeMethod(worker, &CWorker::runTaskInThread);
+            Q_ASSERT_X(s, Q_FUNC_INFO, "cannot invoke");
+            Q_UNUSED(s)
+            thread->start();
+            return worker;
+        }
+
+        worker->m_taskId = CTaskPool::newTaskId();
+
+        // no thread affinity while queued, the thread running the task pulls the worker
+        worker->moveToThread(nullptr);
+        CTaskPool::instance().submit(worker->m_taskId, owner, ownerName + ":" + name, priority,
+                                     [worker] { worker->runTask(); },
+                                     [worker, owner] { worker->cancelTask(owner); });
         return worker;
     }
 
-    void CWorker::ps_runTask()
+    void CWorker::runTask()
     {
+        this->moveToThread(QThread::currentThread());
         m_result = m_task();
+        this->finishTask();
+    }
 
-        this->setFinished();
-
+    void CWorker::runTaskInThread()
+    {
         QThread *workerThread = this->thread();
-        Q_ASSERT_X(workerThread->thread()->isRunning(), Q_FUNC_INFO, "Owner thread's event loop already ended");
-
-        // MS 2018-09 Now we post the DeferredDelete event from within the worker thread, but rely on it being dispatched
-        //            by the owner thread. Posted events are moved along with the object when moveToThread is called.
-        this->deleteLater();
-
-        this->moveToThread(workerThread->thread()); // move worker back to the thread which constructed it, so there is no race on deletion
-        // must not access the worker beyond this point, as it now lives in the owner's thread and could be deleted at any moment
+        m_result = m_task();
+        this->finishTask();
 
         QMetaObject::invokeMethod(workerThread, [workerThread]
         {
@@ -116,6 +129,48 @@ namespace BlackMisc
         });
     }
 
+    void CWorker::cancelTask(QObject *owner)
+    {
+        this->moveToThread(QThread::currentThread());
+        QObject::disconnect(this, nullptr, owner, nullptr); // owner is being destroyed, its continuations must not be called
+        this->finishTask();
+    }
+
+    void CWorker::finishTask()
+    {
+        this->setFinished();
+
+        const QCoreApplication *app = QCoreApplication::instance();
+        QThread *ownerThread = m_ownerThread ? m_ownerThread.data() : (app ? app->thread() : nullptr);
+        if (!ownerThread)
+        {
+            // owner thread gone and no application (shutdown), deleted by the thread which has run the task
+            this->deleteLater();
+            return;
+        }
+        Q_ASSERT_X(ownerThread->isRunning(), Q_FUNC_INFO, "Owner thread's event loop already ended");
+
+        // MS 2018-09 Now we post the DeferredDelete event from within the worker thread, but rely on it being dispatched
+        //            by the owner thread. Posted events are moved along with the object when moveToThread is called.
+        this->deleteLater();
+
+        this->moveToThread(ownerThread); // move worker back to the thread which constructed it, so there is no race on deletion
+        // must not access the worker beyond this point, as it now lives in the owner's thread and could be deleted at any moment
+    }
+
+    void CWorker::interruptTask() noexcept
+    {
+        if (m_taskId == 0) { CWorkerBase::interruptTask(); }
+        else { CTaskPool::instance().interrupt(m_taskId); }
+    }
+
+    bool CWorker::runInlineIfQueued() noexcept
+    {
+        if (m_taskId == 0) { return false; }
+        // a pool thread waiting for a queued task runs it, so the bounded pool can not deadlock
+        return CTaskPool::instance().tryRunInline(m_taskId);
+    }
+
     CWorkerBase::CWorkerBase()
     {
         s_allWorkers.insert(this);
@@ -134,6 +189,7 @@ namespace BlackMisc
 
     void CWorkerBase::waitForFinished() noexcept
     {
+        if (this->runInlineIfQueued()) { return; }
         std::promise<void> promise;
         then([ & ] { promise.set_value(); });
         promise.get_future().wait();
@@ -141,16 +197,21 @@ namespace BlackMisc
 
     void CWorkerBase::abandon() noexcept
     {
-        if (thread() != thread()->thread()) { thread()->requestInterruption(); }
+        interruptTask();
         quit();
     }
 
     void CWorkerBase::abandonAndWait() noexcept
     {
-        if (thread() != thread()->thread()) { thread()->requestInterruption(); }
+        interruptTask();
         quitAndWait();
     }
 
+    void CWorkerBase::interruptTask() noexcept
+    {
+        if (thread() != thread()->thread()) { thread()->requestInterruption(); }
+    }
+
     bool CWorkerBase::isAbandoned() const
     {
         Q_ASSERT(thread() == QThread::currentThread());
@@ -17,6 +17,7 @@
 #include "blackmisc/invoke.h"
 #include "blackmisc/promise.h"
 #include "blackmisc/stacktrace.h"
+#include "blackmisc/taskpool.h"
 
 #include <QFuture>
 #include <QMetaObject>
@@ -182,6 +183,13 @@ namespace BlackMisc
         virtual void quit() noexcept {}
         virtual void quitAndWait() noexcept { waitForFinished(); }
 
+        //! Request interruption of the thread running the task
+        virtual void interruptTask() noexcept;
+
+        //! Called before waiting, a task can be run in the waiting thread
+        //! \return true if the task was run, the worker must not be accessed anymore
+        virtual bool runInlineIfQueued() noexcept { return false; }
+
         bool m_started = false;
         bool m_finished = false;
         mutable QRecursiveMutex m_finishedMutex;
@@ -189,7 +197,8 @@ namespace BlackMisc
     };
 
     /*!
-     * Class for doing some arbitrary parcel of work in its own thread.
+     * Class for doing some arbitrary parcel of work in a thread of the shared CTaskPool.
+     * LowPriority tasks, which are long or may block, are run in a dedicated thread with an event loop instead.
      *
      * The task is exposed as a function object, so could be a lambda or a hand-written closure.
      * CWorker can not be subclassed, instead it can be extended with rich callable task objects.
@@ -200,18 +209,27 @@ namespace BlackMisc
 
     public:
         /*!
-         * Returns a new worker object which lives in a new thread.
+         * Returns a new worker object whose task is run by the shared task pool.
          * \note The worker calls its own deleteLater method when finished.
          *       Typically assign it to a QPointer if you want to store it.
-         * \param owner Will be the parent of the new thread (the worker has no parent).
-         * \param name A name for the task, which will be used to create a name for the thread.
-         * \param task A function object which will be run by the worker in its thread.
+         * \param owner When the owner is destroyed a queued task is cancelled (finished with a default constructed result
+         *              and without the continuations of the owner), a running task is abandoned and waited for.
+         * \param name A name for the task, used for diagnostics.
+         * \param task A function object which will be run by the worker in a pool thread.
          */
         template <typename F>
         static CWorker *fromTask(QObject *owner, const QString &name, F &&task)
+        {
+            return fromTask(owner, name, CTaskPool::NormalPriority, std::forward<F>(task));
+        }
+
+        //! Returns a new worker object whose task is run with the given priority.
+        //! \remark LowPriority tasks get a dedicated thread with an event loop, so timers and queued connections work
+        template <typename F>
+        static CWorker *fromTask(QObject *owner, const QString &name, CTaskPool::Priority priority, F &&task)
         {
             int typeId = qMetaTypeId<std::decay_t<decltype(std::forward<F>(task)())>>();
-            return fromTaskImpl(owner, name, typeId, [task = std::forward<F>(task)]() mutable
+            return fromTaskImpl(owner, name, typeId, priority, [task = std::forward<F>(task)]() mutable
             {
                 if constexpr (std::is_void_v<decltype(task())>) { std::move(task)(); return QVariant(); }
                 else { return QVariant::fromValue(std::move(task)()); }
@@ -251,19 +269,35 @@ namespace BlackMisc
         template <typename R>
         R result() { waitForFinished(); return this->resultNoWait<R>(); }
 
-    private slots:
-        //! Called when the worker has been moved into its new thread.
-        void ps_runTask();
-
     private:
         CWorker(const std::function<QVariant()> &task) : m_task(task) {}
-        static CWorker *fromTaskImpl(QObject *owner, const QString &name, int typeId, const std::function<QVariant()> &task);
+        static CWorker *fromTaskImpl(QObject *owner, const QString &name, int typeId, CTaskPool::Priority priority, const std::function<QVariant()> &task);
+
+        //! Run the task, called in a pool thread
+        void runTask();
+
+        //! Run the task, called in the dedicated thread of a LowPriority task
+        void runTaskInThread();
+
+        //! Task cancelled before it was run, owner is being destroyed
+        void cancelTask(QObject *owner);
+
+        //! Finished, move back to the owner thread and delete later
+        void finishTask();
+
+        //! \copydoc CWorkerBase::interruptTask
+        virtual void interruptTask() noexcept override;
+
+        //! \copydoc CWorkerBase::runInlineIfQueued
+        virtual bool runInlineIfQueued() noexcept override;
 
         template <typename R>
         R resultNoWait() { Q_ASSERT(m_result.canConvert<R>()); return m_result.value<R>(); }
 
         std::function<QVariant()> m_task;
         QVariant m_result;
+        quint64 m_taskId = 0; //!< id in the task pool, 0 for a dedicated thread
+        QPointer<QThread> m_ownerThread; //!< thread which created the worker
     };
 
     /*!
@@ -12,6 +12,7 @@
 #include "blackmisc/simulation/simulatorplugininfo.h"
 #include "blackmisc/aviation/altitude.h"
 #include "blackmisc/math/mathutils.h"
+#include "blackmisc/tracer.h"
 
 #include <QPointer>
 #include <QTimer>
@@ -552,8 +553,10 @@ namespace BlackSimPlugin::Emulated
 
     void CSimulatorEmulated::updateRemoteAircraft()
     {
+        BLACK_TRACE_ZONE("Update remote aircraft", "simulator");
         const qint64 now = QDateTime::currentMSecsSinceEpoch();
         const bool updateAllAircraft = this->isUpdateAllRemoteAircraft(now);
+        const CCoordinateGeodetic ownPosition = this->getOwnAircraftPosition();
         int aircraftNumber = 0;
 
         for (const CSimulatedAircraft &aircraft : m_renderedAircraft)
@@ -561,6 +564,15 @@ namespace BlackSimPlugin::Emulated
             const CCallsign callsign = aircraft.getCallsign();
             if (!m_interpolators.contains(callsign)) { continue; }
             const CInterpolationAndRenderingSetupPerCallsign setup = this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
+
+            // far and parked aircraft are not interpolated every run
+            if (!this->isRemoteAircraftUpdateDue(callsign, ownPosition, updateAllAircraft || setup.isForcingFullInterpolation()))
+            {
+                aircraftNumber++;
+                m_countSkippedSituations++;
+                continue;
+            }
+
             CInterpolatorMulti *im = m_interpolators[callsign];
             Q_ASSERT_X(im, Q_FUNC_INFO, "interpolator missing");
             const CInterpolationResult result = im->getInterpolation(now, setup, aircraftNumber++);
@@ -568,7 +580,7 @@ namespace BlackSimPlugin::Emulated
             const CAircraftParts p = result;
             m_countInterpolatedParts++;
             m_countInterpolatedSituations++;
-            Q_UNUSED(s)
+            if (result.getInterpolationStatus().hasValidSituation()) { this->rememberLastSent(s); }
             Q_UNUSED(p)
         }
 
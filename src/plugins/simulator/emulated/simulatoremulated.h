@@ -178,6 +178,7 @@ namespace BlackSimPlugin::Emulated
         bool m_timeSyncronized = false;
         int m_countInterpolatedSituations = 0;
         int m_countInterpolatedParts      = 0;
+        int m_countSkippedSituations      = 0; //!< not due in an update run
         QTimer m_interpolatorFetchTimer; //!< fetch data from interpolator
         BlackMisc::PhysicalQuantities::CTime            m_offsetTime;
         BlackMisc::Simulation::CSimulatedAircraft       m_myAircraft;       //!< represents own aircraft of simulator
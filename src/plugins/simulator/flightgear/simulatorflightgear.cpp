@@ -45,6 +45,7 @@
 #include "blackmisc/pq/pressure.h"
 #include "blackmisc/pq/speed.h"
 #include "blackmisc/pq/temperature.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/verify.h"
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/dbusserver.h"
@@ -638,6 +639,7 @@ namespace BlackSimPlugin::Flightgear
 
     void CSimulatorFlightgear::updateRemoteAircraft()
     {
+        BLACK_TRACE_ZONE("Update remote aircraft", "simulator");
         Q_ASSERT_X(CThreadUtils::isInThisThread(this), Q_FUNC_INFO, "thread");
 
         const int remoteAircraftNo = this->getAircraftInRangeCount();
@@ -26,6 +26,7 @@
 #include "blackmisc/logmessage.h"
 #include "blackmisc/statusmessagelist.h"
 #include "blackmisc/threadutils.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/verify.h"
 #include "blackconfig/buildconfig.h"
 
@@ -1950,6 +1951,7 @@ namespace BlackSimPlugin::FsxCommon
 
     void CSimulatorFsxCommon::updateRemoteAircraft()
     {
+        BLACK_TRACE_ZONE("Update remote aircraft", "simulator");
         static_assert(sizeof(DataDefinitionRemoteAircraftPartsWithoutLights) == sizeof(double) * 10, "DataDefinitionRemoteAircraftPartsWithoutLights has an incorrect size.");
         Q_ASSERT_X(CThreadUtils::isInThisThread(this), Q_FUNC_INFO, "thread");
 
@@ -1975,6 +1977,7 @@ namespace BlackSimPlugin::FsxCommon
         int simObjectNumber = 0;
         const bool traceSendId       = this->isTracingSendId();
         const bool updateAllAircraft = this->isUpdateAllRemoteAircraft(currentTimestamp);
+        const CCoordinateGeodetic ownPosition = this->getOwnAircraftPosition();
         for (const CSimConnectObject &simObject : simObjects)
         {
             // happening if aircraft is not yet added to simulator or to be deleted
@@ -1993,6 +1996,27 @@ namespace BlackSimPlugin::FsxCommon
             const CInterpolationAndRenderingSetupPerCallsign setup = this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
             const bool sendGround = setup.isSendingGndFlagToSimulator();
 
+            // far and parked aircraft are not interpolated every run, in between they are moved on by dead reckoning
+            if (!this->isRemoteAircraftUpdateDue(callsign, ownPosition, updateAllAircraft || setup.isForcingFullInterpolation()))
+            {
+                simObjectNumber++;
+                const CAircraftSituation extrapolated = this->extrapolateLastSent(callsign, currentTimestamp);
+                if (extrapolated.isNull() || !extrapolated.isMoving()) { continue; }
+
+                CAircraftSituation situation = extrapolated;
+                const CLength relativeAltitude = situation.geodeticHeight() - ownPosition.geodeticHeight();
+                const double altitudeDeltaWeight = 2 - qBound(3000.0, relativeAltitude.abs().value(CLengthUnit::ft()), 6000.0) / 3000;
+                situation.setAltitude({ situation.getAltitude() + m_altitudeDelta * altitudeDeltaWeight, situation.getAltitude().getReferenceDatum() });
+
+                SIMCONNECT_DATA_INITPOSITION position = this->aircraftSituationToFsxPosition(situation, sendGround);
+                this->logAndTraceSendId(
+                    SimConnect_SetDataOnSimObject(
+                        m_hSimConnect, CSimConnectDefinitions::DataRemoteAircraftSetPosition,
+                        static_cast<SIMCONNECT_OBJECT_ID>(objectId), 0, 0, sizeof(SIMCONNECT_DATA_INITPOSITION), &position),
+                    traceSendId, simObject, "Failed to set extrapolated position", Q_FUNC_INFO, "SimConnect_SetDataOnSimObject");
+                continue;
+            }
+
             // Interpolated situation
             // simObjectNumber is passed to equally distributed steps like guessing parts
             const bool slowUpdate = (((m_statsUpdateAircraftRuns + simObjectNumber) % 40) == 0);
@@ -2005,7 +2029,7 @@ namespace BlackSimPlugin::FsxCommon
                 {
                     // adjust altitude to compensate for FS2020 temperature effect
                     CAircraftSituation situation = result;
-                    const CLength relativeAltitude = situation.geodeticHeight() - getOwnAircraftPosition().geodeticHeight();
+                    const CLength relativeAltitude = situation.geodeticHeight() - ownPosition.geodeticHeight();
                     const double altitudeDeltaWeight = 2 - qBound(3000.0, relativeAltitude.abs().value(CLengthUnit::ft()), 6000.0) / 3000;
                     situation.setAltitude({ situation.getAltitude() + m_altitudeDelta * altitudeDeltaWeight, situation.getAltitude().getReferenceDatum() });
 
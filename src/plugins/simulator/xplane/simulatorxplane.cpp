@@ -47,6 +47,7 @@
 #include "blackmisc/pq/pressure.h"
 #include "blackmisc/pq/speed.h"
 #include "blackmisc/pq/temperature.h"
+#include "blackmisc/tracer.h"
 #include "blackmisc/verify.h"
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/dbusserver.h"
@@ -141,7 +142,7 @@ namespace BlackSimPlugin::XPlane
 
     QString CSimulatorXPlane::getStatisticsSimulatorSpecific() const
     {
-        return QStringLiteral("Add-time: %1ms/%2ms").arg(m_statsAddCurrentTimeMs).arg(m_statsAddMaxTimeMs);
+        return QStringLiteral("Add-time: %1ms/%2ms %3").arg(m_statsAddCurrentTimeMs).arg(m_statsAddMaxTimeMs).arg(this->getStatisticsElevationBatchInfo());
     }
 
     void CSimulatorXPlane::resetAircraftStatistics()
@@ -282,17 +283,38 @@ namespace BlackSimPlugin::XPlane
             pos.setGeodeticHeight(alt);
         }
 
+        // collected and sent as one batch, see sendElevationRequests
+        return this->queueElevationRequest(pos, callsign);
+    }
+
+    QPair<int, int> CSimulatorXPlane::sendElevationRequests(const CAircraftSituationList &situations)
+    {
+        if (this->isShuttingDownOrDisconnected() || !m_trafficProxy) { return { 0, 0 }; }
+
+        QStringList callsigns;
+        QDoubleList latitudesDeg;
+        QDoubleList longitudesDeg;
+        QDoubleList altitudesM;
+        for (const CAircraftSituation &situation : situations)
+        {
+            callsigns.push_back(situation.getCallsign().asString());
+            latitudesDeg.push_back(situation.latitude().value(CAngleUnit::deg()));
+            longitudesDeg.push_back(situation.longitude().value(CAngleUnit::deg()));
+            altitudesM.push_back(situation.geodeticHeight().value(CLengthUnit::m()));
+        }
+        if (callsigns.isEmpty()) { return { 0, 0 }; }
+
         using namespace std::placeholders;
         auto callback = std::bind(&CSimulatorXPlane::callbackReceivedRequestedElevation, this, _1, _2, _3);
 
-        // Request
-        m_trafficProxy->getElevationAtPosition(callsign,
-                                                pos.latitude().value(CAngleUnit::deg()),
-                                                pos.longitude().value(CAngleUnit::deg()),
-                                                pos.geodeticHeight().value(CLengthUnit::m()),
-                                                callback);
-        emit this->requestedElevation(callsign);
-        return true;
+        // Request, one round trip for all positions
+        m_trafficProxy->getElevationsAtPositions(callsigns, latitudesDeg, longitudesDeg, altitudesM, callback);
+        for (const CAircraftSituation &situation : situations)
+        {
+            this->addPendingElevationRequest(situation.getCallsign());
+            emit this->requestedElevation(situation.getCallsign());
+        }
+        return { callsigns.size(), 1 };
     }
 
     // convert xplane squawk mode to swift squawk mode
@@ -1045,6 +1067,7 @@ namespace BlackSimPlugin::XPlane
 
     void CSimulatorXPlane::updateRemoteAircraft()
     {
+        BLACK_TRACE_ZONE("Update remote aircraft", "simulator");
         Q_ASSERT_X(CThreadUtils::isInThisThread(this), Q_FUNC_INFO, "thread");
 
         const int remoteAircraftNo = this->getAircraftInRangeCount();
@@ -1062,6 +1085,7 @@ namespace BlackSimPlugin::XPlane
         int aircraftNumber = 0;
         const bool updateAllAircraft = this->isUpdateAllRemoteAircraft(currentTimestamp);
         const CCallsignSet callsignsInRange = this->getAircraftInRangeCallsigns();
+        const CCoordinateGeodetic ownPosition = this->getOwnAircraftPosition();
         for (const CXPlaneMPAircraft &xplaneAircraft : std::as_const(m_xplaneAircraftObjects))
         {
             const CCallsign callsign(xplaneAircraft.getCallsign());
@@ -1085,6 +1109,13 @@ namespace BlackSimPlugin::XPlane
             // setup
             const CInterpolationAndRenderingSetupPerCallsign setup = this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
 
+            // far and parked aircraft are not interpolated every run, xswiftbus moves them on in between
+            if (!this->isRemoteAircraftUpdateDue(callsign, ownPosition, updateAllAircraft || setup.isForcingFullInterpolation()))
+            {
+                aircraftNumber++;
+                continue;
+            }
+
             // interpolated situation/parts
             const CInterpolationResult result = xplaneAircraft.getInterpolation(currentTimestamp, setup, aircraftNumber++);
             if (result.getInterpolationStatus().hasValidSituation())
@@ -1092,7 +1123,7 @@ namespace BlackSimPlugin::XPlane
                 CAircraftSituation interpolatedSituation(result);
 
                 // adjust altitude to compensate for XP12 temperature effect
-                const CLength relativeAltitude = interpolatedSituation.geodeticHeight() - getOwnAircraftPosition().geodeticHeight();
+                const CLength relativeAltitude = interpolatedSituation.geodeticHeight() - ownPosition.geodeticHeight();
                 const double altitudeDeltaWeight = 2 - qBound(3000.0, relativeAltitude.abs().value(CLengthUnit::ft()), 6000.0) / 3000;
                 const CLength alt = interpolatedSituation.getAltitude() + m_altitudeDelta * altitudeDeltaWeight * (1 - interpolatedSituation.getOnGroundFactor());
                 interpolatedSituation.setAltitude({ alt, interpolatedSituation.getAltitude().getReferenceDatum() });
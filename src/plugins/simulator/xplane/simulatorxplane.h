@@ -157,6 +157,7 @@ namespace BlackSimPlugin::XPlane
         //! @}
 
         //! \copydoc BlackMisc::Simulation::ISimulationEnvironmentProvider::requestElevation
+        //! \remark queued and sent as batch
         virtual bool requestElevation(const BlackMisc::Geo::ICoordinateGeodetic &reference, const BlackMisc::Aviation::CCallsign &callsign) override;
 
     protected:
@@ -167,6 +168,7 @@ namespace BlackSimPlugin::XPlane
         virtual bool physicallyRemoveRemoteAircraft(const BlackMisc::Aviation::CCallsign &callsign) override;
         virtual int physicallyRemoveAllRemoteAircraft() override;
         virtual void clearAllRemoteAircraftData() override;
+        virtual QPair<int, int> sendElevationRequests(const BlackMisc::Aviation::CAircraftSituationList &situations) override;
         virtual bool isPaused() const override
         {
             //! \todo XP: provide correct pause state
@@ -192,6 +192,59 @@ namespace BlackSimPlugin::XPlane
         // CLogMessage(this).debug(u"XPlane elv. request: '%1' %2 %3 %4") << callsign.asString() << latitudeDeg << longitudeDeg << altitudeMeters;
     }
 
+    void CXSwiftBusTrafficProxy::getElevationsAtPositions(const QStringList &callsigns, const QDoubleList &latitudesDeg, const QDoubleList &longitudesDeg, const QDoubleList &altitudesMeters,
+            const ElevationCallback &setter) const
+    {
+        if (callsigns.isEmpty()) { return; }
+        Q_ASSERT_X(callsigns.size() == latitudesDeg.size() && callsigns.size() == longitudesDeg.size() && callsigns.size() == altitudesMeters.size(), Q_FUNC_INFO, "Size mismatch");
+
+        std::function<void(QDBusPendingCallWatcher *)> callback = [ = ](QDBusPendingCallWatcher * watcher)
+        {
+            QDBusPendingReply<QStringList, QList<double>, QList<double>, QList<double>, QList<bool>> reply = *watcher;
+            if (!reply.isError())
+            {
+                const QStringList replyCallsigns  = reply.argumentAt<0>();
+                const QList<double> elevationsM   = reply.argumentAt<1>();
+                const QList<double> probedLatsDeg = reply.argumentAt<2>();
+                const QList<double> probedLngsDeg = reply.argumentAt<3>();
+                const QList<bool>   waterFlags    = reply.argumentAt<4>();
+                const int size = replyCallsigns.size();
+                if (elevationsM.size() != size || probedLatsDeg.size() != size || probedLngsDeg.size() != size || waterFlags.size() != size)
+                {
+                    CLogMessage(this).warning(u"XSwiftBus getElevationsAtPositions size mismatch");
+                }
+                else
+                {
+                    for (int i = 0; i < size; ++i)
+                    {
+                        const double elevationMeters = elevationsM.at(i);
+                        const CAltitude elevationAlt = std::isnan(elevationMeters) ? CAltitude::null() : CAltitude(elevationMeters, CLengthUnit::m(), CLengthUnit::ft());
+                        const CElevationPlane elevation(CLatitude(probedLatsDeg.at(i), CAngleUnit::deg()),
+                                                        CLongitude(probedLngsDeg.at(i), CAngleUnit::deg()),
+                                                        elevationAlt, CElevationPlane::singlePointRadius());
+                        setter(elevation, CCallsign(replyCallsigns.at(i)), waterFlags.at(i));
+                    }
+                }
+            }
+            else if (reply.error().type() == QDBusError::UnknownMethod)
+            {
+                // older xswiftbus, one request per position
+                CLogMessage(this).debug(u"XSwiftBus without batched elevations, using single requests");
+                for (int i = 0; i < callsigns.size(); ++i)
+                {
+                    this->getElevationAtPosition(CCallsign(callsigns.at(i)), latitudesDeg.at(i), longitudesDeg.at(i), altitudesMeters.at(i), setter);
+                }
+            }
+            else
+            {
+                const QString errorMsg = reply.error().message();
+                CLogMessage(this).warning(u"XSwiftBus DBus error getElevationsAtPositions: %1") << errorMsg;
+            }
+            watcher->deleteLater();
+        };
+        m_dbusInterface->callDBusAsync(QLatin1String("getElevationsAtPositions"), callback, callsigns, latitudesDeg, longitudesDeg, altitudesMeters);
+    }
+
     void CXSwiftBusTrafficProxy::setFollowedAircraft(const QString &callsign)
     {
         m_dbusInterface->callDBus(QLatin1String("setFollowedAircraft"), callsign);
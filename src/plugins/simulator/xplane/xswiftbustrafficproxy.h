@@ -245,6 +245,11 @@ namespace BlackSimPlugin::XPlane
         void getElevationAtPosition(const BlackMisc::Aviation::CCallsign &callsign, double latitudeDeg, double longitudeDeg, double altitudeMeters,
                                     const ElevationCallback &setter) const;
 
+        //! \copydoc XSwiftBus::CTraffic::getElevationsAtPositions
+        //! \remark setter is called once per position, falls back to single requests if xswiftbus does not support batches
+        void getElevationsAtPositions(const QStringList &callsigns, const QDoubleList &latitudesDeg, const QDoubleList &longitudesDeg, const QDoubleList &altitudesMeters,
+                                      const ElevationCallback &setter) const;
+
         //! \copydoc XSwiftBus::CTraffic::setFollowedAircraft
         void setFollowedAircraft(const QString &callsign);
 
@@ -170,7 +170,7 @@ namespace BlackWxPlugin::Gfs
         {
             CLogMessage(this).debug() << "Using cached data";
             Q_ASSERT_X(!m_parseGribFileWorker, Q_FUNC_INFO, "Worker already running");
-            m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", [this]()
+            m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", CTaskPool::LowPriority, [this]()
             {
                 parseGfsFileImpl(m_gribData);
             });
@@ -188,7 +188,7 @@ namespace BlackWxPlugin::Gfs
         m_gribData = file.readAll();
 
         Q_ASSERT_X(!m_parseGribFileWorker, Q_FUNC_INFO, "Worker already running");
-        m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", [this]()
+        m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", CTaskPool::LowPriority, [this]()
         {
             parseGfsFileImpl(m_gribData);
         });
@@ -228,7 +228,7 @@ namespace BlackWxPlugin::Gfs
 
         m_gribData = nwReply->readAll();
         Q_ASSERT_X(!m_parseGribFileWorker, Q_FUNC_INFO, "Worker already running");
-        m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", [this]()
+        m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", CTaskPool::LowPriority, [this]()
         {
             parseGfsFileImpl(m_gribData);
         });
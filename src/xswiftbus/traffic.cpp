@@ -27,6 +27,8 @@
 #include <ctime>
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <utility>
 
 // clazy:excludeall=reserve-candidates
 
@@ -531,6 +533,47 @@ namespace XSwiftBus
         }
     }
 
+    void CTraffic::getElevationsAtPositions(const std::vector<std::string> &callsigns, std::vector<double> &latitudesDeg, std::vector<double> &longitudesDeg,
+                                            const std::vector<double> &altitudesM, std::vector<double> &elevationsM, std::vector<bool> &waterFlags) const
+    {
+        const size_t size = callsigns.size();
+        elevationsM.assign(size, std::numeric_limits<double>::quiet_NaN());
+        waterFlags.assign(size, false);
+        if (latitudesDeg.size() != size || longitudesDeg.size() != size || altitudesM.size() != size)
+        {
+            WARNING_LOG("getElevationsAtPositions: size mismatch");
+            elevationsM.clear();
+            waterFlags.clear();
+            return;
+        }
+        if (!getSettings().isTerrainProbeEnabled()) { return; }
+
+        // aircraft on the same spot (e.g. parked or tested) are only probed once
+        std::map<std::pair<double, double>, size_t> probed;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto position = std::make_pair(latitudesDeg[i], longitudesDeg[i]);
+            const auto probedIt = probed.find(position);
+            if (probedIt != probed.end())
+            {
+                const size_t p = probedIt->second;
+                latitudesDeg[i]  = latitudesDeg[p];
+                longitudesDeg[i] = longitudesDeg[p];
+                elevationsM[i]   = elevationsM[p];
+                waterFlags[i]    = waterFlags[p];
+                continue;
+            }
+
+            bool isWater = false;
+            const std::array<double, 3> elevation = getElevationAtPosition(callsigns[i], latitudesDeg[i], longitudesDeg[i], altitudesM[i], isWater);
+            elevationsM[i]   = elevation[0];
+            latitudesDeg[i]  = elevation[1];
+            longitudesDeg[i] = elevation[2];
+            waterFlags[i]    = isWater;
+            probed.emplace(position, i);
+        }
+    }
+
     void CTraffic::setFollowedAircraft(const std::string &callsign)
     {
         this->switchToFollowPlaneView(callsign);
@@ -807,6 +850,34 @@ namespace XSwiftBus
                     sendDBusMessage(reply);
                 });
             }
+            else if (message.getMethodName() == "getElevationsAtPositions")
+            {
+                std::vector<std::string> callsigns;
+                std::vector<double> latitudesDeg;
+                std::vector<double> longitudesDeg;
+                std::vector<double> altitudesM;
+                message.beginArgumentRead();
+                message.getArgument(callsigns);
+                message.getArgument(latitudesDeg);
+                message.getArgument(longitudesDeg);
+                message.getArgument(altitudesM);
+                queueDBusCall([ = ]()
+                {
+                    std::vector<double> probedLatitudesDeg  = latitudesDeg;
+                    std::vector<double> probedLongitudesDeg = longitudesDeg;
+                    std::vector<double> elevationsM;
+                    std::vector<bool>   waterFlags;
+                    getElevationsAtPositions(callsigns, probedLatitudesDeg, probedLongitudesDeg, altitudesM, elevationsM, waterFlags);
+                    CDBusMessage reply = CDBusMessage::createReply(sender, serial);
+                    reply.beginArgumentWrite();
+                    reply.appendArgument(callsigns);
+                    reply.appendArgument(elevationsM);
+                    reply.appendArgument(probedLatitudesDeg);
+                    reply.appendArgument(probedLongitudesDeg);
+                    reply.appendArgument(waterFlags);
+                    sendDBusMessage(reply);
+                });
+            }
             else if (message.getMethodName() == "setFollowedAircraft")
             {
                 maybeSendEmptyDBusReply(wantsReply, sender, serial);
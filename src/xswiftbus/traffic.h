@@ -118,6 +118,11 @@ namespace XSwiftBus
         //! Get the ground elevation at an arbitrary position
         std::array<double, 3> getElevationAtPosition(const std::string &callsign, double latitudeDeg, double longitudeDeg, double altitudeMeters, bool &o_isWater) const;
 
+        //! Get the ground elevation at many positions, answered in one reply
+        //! \remark latitudes and longitudes are replaced by the probed positions, identical positions are probed once
+        void getElevationsAtPositions(const std::vector<std::string> &callsigns, std::vector<double> &latitudesDeg, std::vector<double> &longitudesDeg,
+                                      const std::vector<double> &altitudesM, std::vector<double> &elevationsM, std::vector<bool> &waterFlags) const;
+
         //! Sets the aircraft with callsign to be followed in plane view
         void setFollowedAircraft(const std::string &callsign);
 
@@ -0,0 +1,153 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution and at http://www.swift-project.org/license.html. No part of swift project,
+ * including this file, may be copied, modified, propagated, or distributed except according to the terms
+ * contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+* \file
+* \ingroup testblackfsd
+*/
+
+#include "blackcore/fsd/fsdsendqueue.h"
+#include "test.h"
+
+#include <QObject>
+#include <QTest>
+#include <QTextCodec>
+
+using namespace BlackCore::Fsd;
+
+namespace BlackFsdTest
+{
+    //! Testing the FSD send queue
+    class CTestFsdSendQueue : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Classes are sent by priority, FIFO within a class
+        void testPriorities();
+
+        //! Superseded messages are dropped, the newer ones queued at the tail
+        void testCoalescing();
+
+        //! Batch limit, control messages always sent
+        void testBatchLimit();
+
+        //! Latency and byte metrics
+        void testStatistics();
+    };
+
+    void CTestFsdSendQueue::testPriorities()
+    {
+        CFsdSendQueue queue;
+        queue.enqueue("#TMtext1\r\n", CFsdSendQueue::PriorityText, {}, 0);
+        queue.enqueue("$CQquery1\r\n", CFsdSendQueue::PriorityQuery, {}, 0);
+        queue.enqueue("@pos1\r\n", CFsdSendQueue::PriorityPosition, {}, 0);
+        queue.enqueue("$CQquery2\r\n", CFsdSendQueue::PriorityQuery, {}, 0);
+        queue.enqueue("#APlogin\r\n", CFsdSendQueue::PriorityControl, {}, 0);
+        QCOMPARE(queue.size(), 5);
+        QCOMPARE(queue.size(CFsdSendQueue::PriorityQuery), 2);
+
+        QByteArray buffer;
+        QStringList sent;
+        const int taken = queue.takeBatch(QTextCodec::codecForName("latin1"), buffer, 10, &sent, 0);
+        QCOMPARE(taken, 5);
+        QVERIFY(queue.isEmpty());
+        const QStringList expected({ "#APlogin\r\n", "@pos1\r\n", "$CQquery1\r\n", "$CQquery2\r\n", "#TMtext1\r\n" });
+        QCOMPARE(sent, expected);
+        QCOMPARE(buffer, expected.join("").toLatin1());
+    }
+
+    void CTestFsdSendQueue::testCoalescing()
+    {
+        CFsdSendQueue queue;
+        queue.enqueue("#SLperiodic\r\n", CFsdSendQueue::PriorityPosition, "#SL", 0);
+        queue.enqueue("@pos1\r\n", CFsdSendQueue::PriorityPosition, "@", 0);
+        queue.enqueue("#SBinterimA\r\n", CFsdSendQueue::PriorityPosition, "#SBA", 0);
+        queue.enqueue("@pos2\r\n", CFsdSendQueue::PriorityPosition, "@", 0);
+        queue.enqueue("#SBinterimB\r\n", CFsdSendQueue::PriorityPosition, "#SBB", 0);
+        queue.enqueue("$CQ1\r\n", CFsdSendQueue::PriorityQuery, {}, 0);
+        queue.enqueue("$CQ1\r\n", CFsdSendQueue::PriorityQuery, {}, 0); // no key, not coalesced
+        QCOMPARE(queue.size(), 6);
+        QCOMPARE(queue.getStatistics().coalesced, qint64(1));
+
+        QByteArray buffer;
+        QStringList sent;
+        queue.takeBatch(nullptr, buffer, 10, &sent, 0);
+        const QStringList expected({ "#SLperiodic\r\n", "#SBinterimA\r\n", "@pos2\r\n", "#SBinterimB\r\n", "$CQ1\r\n", "$CQ1\r\n" });
+        QCOMPARE(sent, expected);
+
+        // once sent, the key can be queued again
+        queue.enqueue("@pos3\r\n", CFsdSendQueue::PriorityPosition, "@", 0);
+        QCOMPARE(queue.size(), 1);
+
+        // latency of the newer message
+        queue.enqueue("@pos4\r\n", CFsdSendQueue::PriorityPosition, "@", 90);
+        queue.resetStatistics();
+        queue.takeBatch(nullptr, buffer, 10, &sent, 100);
+        QCOMPARE(queue.getStatistics().latencyMaxMs, qint64(10));
+    }
+
+    void CTestFsdSendQueue::testBatchLimit()
+    {
+        CFsdSendQueue queue;
+        for (int i = 0; i < 5; i++) { queue.enqueue(QStringLiteral("$CQ%1\r\n").arg(i), CFsdSendQueue::PriorityQuery, {}, 0); }
+        queue.enqueue("#APlogin\r\n", CFsdSendQueue::PriorityControl, {}, 0);
+        queue.enqueue("$IDident\r\n", CFsdSendQueue::PriorityControl, {}, 0);
+
+        QByteArray buffer;
+        QStringList sent;
+        QCOMPARE(queue.takeBatch(nullptr, buffer, 1, &sent, 0), 2);
+        QCOMPARE(sent, QStringList({ "#APlogin\r\n", "$IDident\r\n" }));
+
+        sent.clear();
+        QCOMPARE(queue.takeBatch(nullptr, buffer, 3, &sent, 0), 3);
+        QCOMPARE(sent, QStringList({ "$CQ0\r\n", "$CQ1\r\n", "$CQ2\r\n" }));
+        QCOMPARE(queue.size(), 2);
+
+        queue.clear();
+        QVERIFY(queue.isEmpty());
+        QCOMPARE(queue.takeBatch(nullptr, buffer, 3, nullptr, 0), 0);
+        QVERIFY(buffer.isEmpty());
+    }
+
+    void CTestFsdSendQueue::testStatistics()
+    {
+        CFsdSendQueue queue;
+        queue.enqueue("@pos1\r\n", CFsdSendQueue::PriorityPosition, "@", 1000);
+        queue.enqueue("$CQ1\r\n", CFsdSendQueue::PriorityQuery, {}, 1100);
+
+        QByteArray buffer;
+        queue.takeBatch(nullptr, buffer, 10, nullptr, 1200);
+        queue.enqueue("$CQ2\r\n", CFsdSendQueue::PriorityQuery, {}, 2000);
+        queue.takeBatch(nullptr, buffer, 10, nullptr, 2200);
+
+        const CFsdSendQueue::Statistics &stats = queue.getStatistics();
+        QCOMPARE(stats.enqueued, qint64(3));
+        QCOMPARE(stats.sentMessages, qint64(3));
+        QCOMPARE(stats.flushes, qint64(2));
+        QCOMPARE(stats.sentBytes, qint64(7 + 6 + 6));
+        QCOMPARE(stats.latencyMaxMs, qint64(200));
+        QCOMPARE(stats.averageLatencyMs(), 500.0 / 3);
+        QCOMPARE(stats.bytesPerSecond(), 19.0);
+        QCOMPARE(stats.maxQueueSize, 2);
+        QVERIFY(!stats.toQString().isEmpty());
+
+        queue.resetStatistics();
+        QCOMPARE(queue.getStatistics().sentMessages, qint64(0));
+    }
+}
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackFsdTest::CTestFsdSendQueue);
+
+#include "testfsdsendqueue.moc"
+
+//! \endcond
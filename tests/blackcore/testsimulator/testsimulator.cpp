@@ -0,0 +1,186 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackcore
+
+#include "blackcore/simulator.h"
+#include "blackmisc/simulation/ownaircraftproviderdummy.h"
+#include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/simulation/simulatorplugininfo.h"
+#include "blackmisc/network/clientprovider.h"
+#include "blackmisc/weather/weathergridprovider.h"
+#include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/geo/elevationplane.h"
+#include "test.h"
+
+#include <QObject>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::Network;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+using namespace BlackMisc::Weather;
+using namespace BlackCore;
+
+namespace BlackCoreTest
+{
+    //! No weather
+    class CTestWeatherGridProvider : public IWeatherGridProvider
+    {
+    public:
+        //! IWeatherGridProvider::requestWeatherGrid
+        virtual void requestWeatherGrid(const ICoordinateGeodetic &, const CIdentifier &) override {}
+
+        //! IWeatherGridProvider::requestWeatherGrid
+        virtual void requestWeatherGrid(const CWeatherGrid &, const CSlot<void(const CWeatherGrid &)> &) override {}
+
+        //! IWeatherGridProvider::requestWeatherGridFromFile
+        virtual void requestWeatherGridFromFile(const QString &, const CWeatherGrid &, const CSlot<void(const CWeatherGrid &)> &) override {}
+    };
+
+    //! Simulator queueing elevation requests like the X-Plane driver, records the sent requests
+    class CTestSimulator : public ISimulator
+    {
+    public:
+        //! Constructor
+        CTestSimulator(IRemoteAircraftProvider *remoteAircraftProvider, IWeatherGridProvider *weatherGridProvider) :
+            ISimulator(CSimulatorPluginInfo("org.swift-project.plugins.simulator.test", "Test", "xplane", "Test driver", true),
+                       COwnAircraftProviderDummy::instance(), remoteAircraftProvider, weatherGridProvider, CClientProviderDummy::instance())
+        {}
+
+        //! Sent requests
+        const CAircraftSituationList &getSentRequests() const { return m_sent; }
+
+        //! Batches sent
+        int getSentBatches() const { return m_batches; }
+
+        //! Test access
+        //! @{
+        using ISimulationEnvironmentProvider::addPendingElevationRequest;
+        using ISimulationEnvironmentProvider::rememberGroundElevation;
+        //! @}
+
+        //! ISimulator::requestElevation
+        virtual bool requestElevation(const ICoordinateGeodetic &reference, const CCallsign &callsign) override
+        {
+            return this->queueElevationRequest(reference, callsign);
+        }
+
+        //! \name ISimulator functions not used by the test
+        //! @{
+        virtual bool isShuttingDown() const override { return false; }
+        virtual bool isTimeSynchronized() const override { return false; }
+        virtual bool connectTo() override { return true; }
+        virtual bool updateOwnSimulatorCockpit(const CSimulatedAircraft &, const CIdentifier &) override { return false; }
+        virtual bool updateOwnSimulatorSelcal(const CSelcal &, const CIdentifier &) override { return false; }
+        virtual void displayStatusMessage(const CStatusMessage &) const override {}
+        virtual void displayTextMessage(const CTextMessage &) const override {}
+        virtual bool setTimeSynchronization(bool, const CTime &) override { return false; }
+        virtual CTime getTimeSynchronizationOffset() const override { return CTime(0, CTimeUnit::hrmin()); }
+        virtual bool isPhysicallyRenderedAircraft(const CCallsign &) const override { return false; }
+        virtual CCallsignSet physicallyRenderedAircraft() const override { return {}; }
+        virtual bool isConnected() const override { return true; }
+        virtual bool isPaused() const override { return false; }
+        virtual bool testSendSituationAndParts(const CCallsign &, const CAircraftSituation &, const CAircraftParts &) override { return false; }
+        virtual CStatusMessageList getInterpolationMessages(const CCallsign &) const override { return {}; }
+        //! @}
+
+    protected:
+        //! ISimulator::sendElevationRequests
+        virtual QPair<int, int> sendElevationRequests(const CAircraftSituationList &situations) override
+        {
+            m_sent.push_back(situations);
+            m_batches++;
+            for (const CAircraftSituation &situation : situations) { this->addPendingElevationRequest(situation.getCallsign()); }
+            return { situations.size(), 1 };
+        }
+
+        //! \name ISimulator functions not used by the test
+        //! @{
+        virtual bool parseDetails(const CSimpleCommandParser &) override { return false; }
+        virtual bool physicallyAddRemoteAircraft(const CSimulatedAircraft &) override { return false; }
+        virtual bool physicallyRemoveRemoteAircraft(const CCallsign &) override { return false; }
+        //! @}
+
+    private:
+        CAircraftSituationList m_sent;
+        int m_batches = 0;
+    };
+
+    //! Simulator driver base class tests
+    class CTestSimulatorElevation : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Requests queued by the interpolation are sent in one batch
+        void queuedRequests();
+
+        //! Pending and known elevations are not requested again
+        void batchCoalescing();
+
+    private:
+        //! Position of aircraft
+        static CCoordinateGeodetic position(int i) { return CCoordinateGeodetic(48.0 + i * 0.1, 11.0, 0.0); }
+    };
+
+    void CTestSimulatorElevation::queuedRequests()
+    {
+        CRemoteAircraftProviderDummy provider;
+        CTestWeatherGridProvider weather;
+        CTestSimulator simulator(&provider, &weather);
+
+        // as requested by the interpolator, which marks the callsign pending after the request was queued
+        const CLength range = CElevationPlane::singlePointRadius();
+        QVERIFY(simulator.findClosestElevationWithinRangeOrRequest(position(1), range, "CS1").isNull());
+        QVERIFY(simulator.findClosestElevationWithinRangeOrRequest(position(1), range, "CS1").isNull());
+        QVERIFY(simulator.findClosestElevationWithinRangeOrRequest(position(2), range, "CS2").isNull());
+        QVERIFY(simulator.isElevationRequestPending("CS1"));
+        QVERIFY(simulator.getSentRequests().isEmpty());
+
+        // sent with the next event loop cycle, once per callsign
+        QTRY_COMPARE(simulator.getSentRequests().size(), 2);
+        QCOMPARE(simulator.getSentBatches(), 1);
+        QVERIFY(simulator.getSentRequests().containsCallsign("CS1"));
+        QVERIFY(simulator.getSentRequests().containsCallsign("CS2"));
+        QCOMPARE(simulator.getStatisticsElevationRequestsCoalesced(), 1);
+    }
+
+    void CTestSimulatorElevation::batchCoalescing()
+    {
+        CRemoteAircraftProviderDummy provider;
+        CTestWeatherGridProvider weather;
+        CTestSimulator simulator(&provider, &weather);
+
+        // CS1 is pending, CS2 known
+        simulator.addPendingElevationRequest("CS1");
+        QVERIFY(simulator.rememberGroundElevation("CS2", true, CElevationPlane(position(2), CElevationPlane::singlePointRadius())));
+        const CAircraftSituationList situations
+        {
+            CAircraftSituation("CS1", position(1)),
+            CAircraftSituation("CS2", position(2)),
+            CAircraftSituation("CS3", position(3))
+        };
+        QCOMPARE(simulator.requestElevationBatch(situations), 1);
+        QCOMPARE(simulator.getSentRequests().size(), 1);
+        QCOMPARE(simulator.getSentRequests().front().getCallsign(), CCallsign("CS3"));
+        QCOMPARE(simulator.getStatisticsElevationRequestsCoalesced(), 2);
+    }
+} // ns
+
+//! main
+BLACKTEST_MAIN(BlackCoreTest::CTestSimulatorElevation);
+
+#include "testsimulator.moc"
+
+//! \endcond
@@ -0,0 +1,197 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackcore
+
+#include "blackcore/vatsim/vatsimdatafileparser.h"
+#include "blackmisc/aviation/atcstation.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+#include "blackmisc/pq/units.h"
+#include "blackmisc/registermetadata.h"
+#include "test.h"
+
+#include <QByteArray>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QTest>
+
+using namespace BlackCore::Vatsim;
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackCoreTest
+{
+    //! Streaming and incremental VATSIM data file parsing
+    class CTestVatsimDataFileParser : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case data
+        void initTestCase();
+
+        //! Values of the first file
+        void firstParse();
+
+        //! Same timestamp is detected in the "general" section
+        void sameTimestamp();
+
+        //! Only changed entries are decoded
+        void incremental();
+
+        //! Invalid files keep the last results
+        void invalid();
+
+    private:
+        //! Pilot JSON
+        static QString pilot(const QString &callsign, int cid, double latitude, const QString &flightPlan = "null", const QString &logonTime = "2021-06-01T09:00:00Z");
+
+        //! Controller JSON
+        static QString controller(const QString &callsign, int cid, const QString &textAtis = "null");
+
+        //! Data file JSON
+        static QByteArray dataFile(const QString &timestamp, const QStringList &pilots, const QStringList &controllers, const QStringList &atis);
+    };
+
+    void CTestVatsimDataFileParser::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CTestVatsimDataFileParser::firstParse()
+    {
+        const QByteArray json = dataFile("2021-06-01T10:00:00.123Z",
+        {
+            pilot("DLH123", 1000001, 50.0325, R"({"flight_rules": "I", "aircraft": "H/A320/L", "remarks": " /V/ PBN/A1B1 ", "route": "DCT"})"),
+            pilot("BAW1", 1000002, 51.47),
+            pilot("AFR7", 1000003, 49.01, R"({"aircraft": "XXXXXXXX/L", "remarks": ""})")
+        },
+        { controller("EDDF_TWR", 1000010) },
+        { controller("EDDF_ATIS", 1000011, R"(["EDDF ATIS A", "RWY 25R"])") });
+
+        CVatsimDataFileParser parser;
+        QCOMPARE(parser.parse(json), CVatsimDataFileParser::Parsed);
+        QVERIFY(parser.getUpdateTimestamp().isValid());
+        QCOMPARE(parser.getAircraft().size(), 3);
+        QCOMPARE(parser.getAtcStations().size(), 2);
+        QCOMPARE(parser.getFsdServers().size(), 1);
+        QCOMPARE(parser.getChangedAircraft().size(), 3);
+        QCOMPARE(parser.getChangedAtcStations().size(), 2);
+        QVERIFY(parser.getRemovedAircraft().isEmpty());
+        QCOMPARE(parser.getCreatedObjects(), 5);
+        QCOMPARE(parser.getReusedObjects(), 0);
+        QCOMPARE(parser.getIllegalEquipmentCodes(), QStringList({ "XXXXXXXX/L" }));
+
+        const CSimulatedAircraft dlh = parser.getAircraft().findFirstByCallsign(CCallsign("DLH123"));
+        QCOMPARE(dlh.getPilot().getId(), QString("1000001"));
+        QCOMPARE(dlh.getPilot().getRealName(), QString("Pilot DLH123"));
+        QCOMPARE(dlh.getAircraftIcaoCodeDesignator(), QString("A320"));
+        QCOMPARE(dlh.getSituation().getGroundSpeed().valueInteger(CSpeedUnit::kts()), 450);
+        QCOMPARE(dlh.getTransponderCode(), 2000);
+        QCOMPARE(parser.getFlightPlanRemarks().value(CCallsign("DLH123")).getRemarks(), QString("/V/ PBN/A1B1"));
+
+        const CAtcStation atis = parser.getAtcStations().findFirstByCallsign(CCallsign("EDDF_ATIS"));
+        QCOMPARE(atis.getAtis().getMessage(), QString("EDDF ATIS A\nRWY 25R"));
+        QCOMPARE(atis.getRange().valueInteger(CLengthUnit::NM()), 50);
+    }
+
+    void CTestVatsimDataFileParser::sameTimestamp()
+    {
+        const QByteArray json = dataFile("2021-06-01T10:00:00.123Z", { pilot("DLH123", 1000001, 50.0) }, {}, {});
+        CVatsimDataFileParser parser;
+        QCOMPARE(parser.parse(json), CVatsimDataFileParser::Parsed);
+        const QByteArray same = dataFile("2021-06-01T10:00:00.123Z", { pilot("DLH123", 1000001, 51.0) }, {}, {});
+        QCOMPARE(parser.parse(same), CVatsimDataFileParser::SameTimestamp);
+        QCOMPARE(parser.getAircraft().size(), 1);
+        QVERIFY(qAbs(parser.getAircraft().front().getSituation().latitude().value(CAngleUnit::deg()) - 50.0) < 1e-6);
+    }
+
+    void CTestVatsimDataFileParser::incremental()
+    {
+        CVatsimDataFileParser parser;
+        const QByteArray first = dataFile("2021-06-01T10:00:00Z",
+                                          { pilot("DLH123", 1000001, 50.0), pilot("BAW1", 1000002, 51.0), pilot("AFR7", 1000003, 49.0), pilot("EZY5", 1000004, 48.0) },
+                                          { controller("EDDF_TWR", 1000010) }, { controller("EDDF_ATIS", 1000011, R"(["A"])") });
+        QCOMPARE(parser.parse(first), CVatsimDataFileParser::Parsed);
+
+        // DLH123 moved, BAW1 only an unused member changed, AFR7 left, EZY5 new CID, KLM9 joined
+        const QByteArray second = dataFile("2021-06-01T10:00:15Z",
+                                           { pilot("DLH123", 1000001, 50.1), pilot("BAW1", 1000002, 51.0, "null", "2021-06-01T09:30:00Z"), pilot("EZY5", 1000005, 48.0), pilot("KLM9", 1000006, 52.0) },
+                                           { controller("EDDF_TWR", 1000010) }, {});
+        QCOMPARE(parser.parse(second), CVatsimDataFileParser::Parsed);
+        QCOMPARE(parser.getAircraft().size(), 4);
+        QCOMPARE(parser.getChangedAircraft().getCallsigns(), CCallsignSet({ CCallsign("DLH123"), CCallsign("EZY5"), CCallsign("KLM9") }));
+        QCOMPARE(parser.getRemovedAircraft(), CCallsignSet({ CCallsign("AFR7") }));
+        QVERIFY(parser.getChangedAtcStations().isEmpty());
+        QCOMPARE(parser.getRemovedAtcStations(), CCallsignSet({ CCallsign("EDDF_ATIS") }));
+        QCOMPARE(parser.getCreatedObjects(), 3);
+        QCOMPARE(parser.getReusedObjects(), 2);
+        QCOMPARE(parser.getAircraft().findFirstByCallsign(CCallsign("EZY5")).getPilot().getId(), QString("1000005"));
+
+        // unchanged file with new timestamp, nothing decoded
+        const QByteArray third = QByteArray(second).replace("10:00:15Z", "10:00:30Z");
+        QCOMPARE(parser.parse(third), CVatsimDataFileParser::Parsed);
+        QVERIFY(parser.getChangedAircraft().isEmpty());
+        QVERIFY(parser.getRemovedAircraft().isEmpty());
+        QCOMPARE(parser.getCreatedObjects(), 0);
+        QCOMPARE(parser.getReusedObjects(), 5);
+        QCOMPARE(parser.getStringsDecoded(), 4); // timestamp, server (always decoded)
+        QCOMPARE(parser.getAircraft().size(), 4);
+    }
+
+    void CTestVatsimDataFileParser::invalid()
+    {
+        CVatsimDataFileParser parser;
+        const QByteArray json = dataFile("2021-06-01T10:00:00Z", { pilot("DLH123", 1000001, 50.0) }, {}, {});
+        QCOMPARE(parser.parse(json), CVatsimDataFileParser::Parsed);
+        const QByteArray other = dataFile("2021-06-01T10:01:00Z", { pilot("DLH123", 1000001, 50.0), pilot("BAW1", 1000002, 51.0) }, {}, {});
+        QCOMPARE(parser.parse(other.left(other.size() / 2)), CVatsimDataFileParser::Invalid);
+        QVERIFY(!parser.getErrorString().isEmpty());
+        QCOMPARE(parser.parse("[1, 2]"), CVatsimDataFileParser::Invalid);
+        QCOMPARE(parser.getAircraft().size(), 1);
+
+        QCOMPARE(parser.parse(other, [] { return false; }), CVatsimDataFileParser::Aborted);
+        QCOMPARE(parser.getUpdateTimestamp(), QDateTime::fromString("2021-06-01T10:00:00Z", Qt::ISODateWithMs));
+    }
+
+    QString CTestVatsimDataFileParser::pilot(const QString &callsign, int cid, double latitude, const QString &flightPlan, const QString &logonTime)
+    {
+        return QStringLiteral(R"({"cid": %1, "name": "Pilot %2", "callsign": "%2", "server": "GERMANY", "pilot_rating": 0, "latitude": %3, "longitude": 8.57, "altitude": 35000, )"
+                              R"("groundspeed": 450, "transponder": "2000", "heading": 270, "qnh_i_hg": 29.92, "qnh_mb": 1013, "flight_plan": %4, "logon_time": "%5", "last_updated": "%5"})")
+               .arg(cid).arg(callsign).arg(latitude, 0, 'f', 4).arg(flightPlan, logonTime);
+    }
+
+    QString CTestVatsimDataFileParser::controller(const QString &callsign, int cid, const QString &textAtis)
+    {
+        return QStringLiteral(R"({"cid": %1, "name": "Controller %2", "callsign": "%2", "frequency": "119.900", "facility": 4, "rating": 3, "server": "GERMANY", )"
+                              R"("visual_range": 50, "text_atis": %3, "last_updated": "2021-06-01T09:00:00Z", "logon_time": "2021-06-01T08:00:00Z"})")
+               .arg(cid).arg(callsign, textAtis);
+    }
+
+    QByteArray CTestVatsimDataFileParser::dataFile(const QString &timestamp, const QStringList &pilots, const QStringList &controllers, const QStringList &atis)
+    {
+        return QStringLiteral(R"({"general": {"version": 3, "reload": 1, "update": "20210601100000", "update_timestamp": "%1", "connected_clients": %2, "unique_users": %2},)"
+                              R"( "pilots": [%3], "controllers": [%4], "atis": [%5],)"
+                              R"( "servers": [{"ident": "GERMANY", "hostname_or_ip": "1.2.3.4", "location": "Germany", "name": "GERMANY", "clients_connection_allowed": 1}],)"
+                              R"( "prefiles": [{"cid": 1, "name": "P", "callsign": "X", "flight_plan": {"aircraft": "B738"}}], "facilities": [{"id": 0, "short": "OBS"}]})")
+               .arg(timestamp).arg(pilots.size() + controllers.size() + atis.size())
+               .arg(pilots.join(','), controllers.join(','), atis.join(',')).toUtf8();
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackCoreTest::CTestVatsimDataFileParser);
+
+#include "testvatsimdatafileparser.moc"
+
+//! \endcond
@@ -0,0 +1,202 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackgui
+
+#include "blackgui/models/aircraftmodelfilter.h"
+#include "blackgui/models/aircraftmodelfilterindex.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/airlineicaocode.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/distributor.h"
+#include "blackmisc/simulation/simulatorinfo.h"
+#include "blackmisc/country.h"
+#include "test.h"
+
+#include <QObject>
+#include <QString>
+#include <QTest>
+#include <QVector>
+#include <vector>
+
+using namespace BlackGui::Models;
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Db;
+using namespace BlackMisc::Simulation;
+
+namespace BlackGuiTest
+{
+    //! Aircraft model filter with and without index
+    class CTestAircraftModelFilter : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Text filters with wildcards
+        void textFilters();
+
+        //! Flag, enum, distributor and combined type filters
+        void otherFilters();
+
+        //! Filter by id
+        void idFilter();
+
+        //! Index of a changed list
+        void isIndexOf();
+
+    private:
+        //! Models with some variety, deterministic
+        static CAircraftModelList models(int number);
+
+        //! Filter with text criteria only
+        static CAircraftModelFilter textFilter(const QString &modelKey, const QString &description = {}, const QString &aircraftIcao = {},
+                                               const QString &manufacturer = {}, const QString &airlineName = {}, const QString &fileName = {});
+
+        //! Same result with and without index
+        static void compare(const CAircraftModelList &models, const CAircraftModelFilterIndex &index, const CAircraftModelFilter &filter);
+    };
+
+    void CTestAircraftModelFilter::textFilters()
+    {
+        const CAircraftModelList list = models(2000);
+        const CAircraftModelFilterIndex index(list);
+        QCOMPARE(index.size(), list.size());
+
+        compare(list, index, textFilter("B738 LUFTHANSA 17"));
+        compare(list, index, textFilter("b738*"));
+        compare(list, index, textFilter("*17"));
+        compare(list, index, textFilter("*AIR*"));
+        compare(list, index, textFilter("*RA*"));
+        compare(list, index, textFilter("A3*7"));
+        compare(list, index, textFilter("*"));
+        compare(list, index, textFilter("NOTHING*"));
+        compare(list, index, textFilter({}, "*freeware*"));
+        compare(list, index, textFilter({}, "Model Boeing"));
+        compare(list, index, textFilter({}, {}, "A3*"));
+        compare(list, index, textFilter({}, {}, {}, "*bus"));
+        compare(list, index, textFilter({}, {}, "B7*", "Boeing", "*Lufthansa*"));
+        compare(list, index, textFilter({}, {}, {}, {}, {}, "*/aircraft1*"));
+        compare(list, index, textFilter({}, {}, {}, {}, "*xyz*"));
+
+        // wildcard in the middle
+        QCOMPARE(textFilter("B7*17").filter(index).size(), textFilter("B7*17").filter(list).size());
+        QVERIFY(!textFilter("B7*17").filter(list).isEmpty());
+    }
+
+    void CTestAircraftModelFilter::otherFilters()
+    {
+        const CAircraftModelList list = models(2000);
+        const CAircraftModelFilterIndex index(list);
+
+        for (Qt::CheckState military : { Qt::Checked, Qt::Unchecked, Qt::PartiallyChecked })
+        {
+            for (Qt::CheckState color : { Qt::Checked, Qt::Unchecked, Qt::PartiallyChecked })
+            {
+                compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::All, All, military, color, {}, {}, {}, {}, {}, {}, {}));
+            }
+        }
+
+        compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::Exclude, All, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, {}));
+        compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::All, Valid, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, {}));
+        compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::All, Invalid, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, {}));
+        compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::All, All, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, "L2J"));
+        compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::All, All, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, "L*J"));
+        compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::All, All, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, {}, CSimulatorInfo::xplane()));
+        compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::All, All, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, {}, CSimulatorInfo::allSimulators(), CDistributor("FOO")));
+        compare(list, index, CAircraftModelFilter(-1, {}, {}, CAircraftModel::All, All, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, {}, CSimulatorInfo::allSimulators(), CDistributor("BARALIAS")));
+        compare(list, index, CAircraftModelFilter(-1, "A3*", {}, CAircraftModel::Include, Valid, Qt::Unchecked, Qt::Unchecked, {}, {}, "DLH", {}, {}, {}, "L2J", CSimulatorInfo::fsx()));
+    }
+
+    void CTestAircraftModelFilter::idFilter()
+    {
+        const CAircraftModelList list = models(100);
+        const CAircraftModelFilterIndex index(list);
+        for (int id : { 2, 3, 50, 1000 })
+        {
+            compare(list, index, CAircraftModelFilter(id, {}, {}, CAircraftModel::All, All, Qt::PartiallyChecked, Qt::PartiallyChecked, {}, {}, {}, {}, {}, {}, {}));
+        }
+        QCOMPARE(index.rowByDbKey(2), 1);
+        QCOMPARE(index.rowByDbKey(3), -1);
+    }
+
+    void CTestAircraftModelFilter::isIndexOf()
+    {
+        CAircraftModelList list = models(10);
+        const CAircraftModelFilterIndex index(list);
+        const CAircraftModelList copy = list;
+        QVERIFY(index.isIndexOf(copy));
+
+        list[3].setDescription("changed");
+        QVERIFY(!index.isIndexOf(list));
+        QVERIFY(index.isIndexOf(copy));
+    }
+
+    CAircraftModelList CTestAircraftModelFilter::models(int number)
+    {
+        const QStringList designators   { "B738", "A320", "B744", "C172", "F16", "A388" };
+        const QStringList combinedTypes { "L2J", "L2J", "L4J", "L1P", "L1J", "L4J" };
+        const QStringList manufacturers { "Boeing", "Airbus", "Boeing", "Cessna", "General Dynamics", "Airbus" };
+        const QStringList airlines      { "DLH", "BAW", "AFR", "" };
+        const QStringList airlineNames  { "Lufthansa", "British Airways", "Air France", "" };
+        const QVector<CDistributor> distributors
+        {
+            CDistributor("FOO", "Foo", "FOOALIAS", {}, CSimulatorInfo::fsx()),
+            CDistributor("BAR", "Bar", "BARALIAS", "BARALIAS2", CSimulatorInfo::xplane()),
+            CDistributor()
+        };
+        const QVector<CSimulatorInfo> simulators { CSimulatorInfo::fsx(), CSimulatorInfo::p3d(), CSimulatorInfo::xplane(), CSimulatorInfo(CSimulatorInfo::FSX | CSimulatorInfo::P3D) };
+
+        CAircraftModelList list;
+        for (int i = 0; i < number; i++)
+        {
+            const int a = (i * 7) % designators.size();
+            const int l = (i * 3) % airlines.size();
+            const bool military = designators[a] == "F16";
+            const CAircraftIcaoCode icao(designators[a], combinedTypes[a], manufacturers[a], "model", "M", true, false, military, 0);
+            const CAirlineIcaoCode airline(airlines[l], airlineNames[l], CCountry("DE", "Germany"), "tel", false, true);
+            const QString liveryCode = (i % 5 == 0) ? CLivery::colorLiveryMarker() + "FF0000" : airlines[l] + ".STD";
+            const CLivery livery(liveryCode, airline, "livery", "red", "blue", false);
+            const QString description = "Model " + manufacturers[a] + (i % 7 == 0 ? " freeware" : "");
+
+            CAircraftModel model(designators[a] + " " + airlineNames[l] + " " + QString::number(i), CAircraftModel::TypeOwnSimulatorModel,
+                                 simulators[i % simulators.size()], "name", description, icao, livery);
+            model.setFileName("c:/sim/" + designators[a].toLower() + "/aircraft" + QString::number(i % 50) + ".cfg");
+            model.setDistributor(distributors[i % distributors.size()]);
+            model.setModelMode(i % 4 == 0 ? CAircraftModel::Exclude : CAircraftModel::Include);
+            if (i % 3 != 2) { model.setDbKey(i + 1); }
+            list.push_back(model);
+        }
+        return list;
+    }
+
+    CAircraftModelFilter CTestAircraftModelFilter::textFilter(const QString &modelKey, const QString &description, const QString &aircraftIcao,
+            const QString &manufacturer, const QString &airlineName, const QString &fileName)
+    {
+        return CAircraftModelFilter(-1, modelKey, description, CAircraftModel::All, All, Qt::PartiallyChecked, Qt::PartiallyChecked,
+                                    aircraftIcao, manufacturer, {}, airlineName, {}, fileName, {});
+    }
+
+    void CTestAircraftModelFilter::compare(const CAircraftModelList &models, const CAircraftModelFilterIndex &index, const CAircraftModelFilter &filter)
+    {
+        const CAircraftModelList linear = filter.filter(models);
+        const CAircraftModelList indexed = filter.filter(index);
+        QCOMPARE(indexed, linear);
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackGuiTest::CTestAircraftModelFilter);
+
+#include "testaircraftmodelfilter.moc"
+
+//! \endcond
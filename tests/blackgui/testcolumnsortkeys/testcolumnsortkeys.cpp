@@ -0,0 +1,130 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackgui
+
+#include "blackgui/models/columnsortkeys.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/units.h"
+#include "blackmisc/registermetadata.h"
+#include "blackmisc/variant.h"
+#include "test.h"
+
+#include <QDateTime>
+#include <QObject>
+#include <QString>
+#include <QTest>
+#include <QVector>
+
+using namespace BlackGui::Models;
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackGuiTest
+{
+    //! Sort keys of list model columns
+    class CTestColumnSortKeys : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case data
+        void initTestCase();
+
+        //! Integer and date/time keys
+        void integerKeys();
+
+        //! Real and physical quantity keys
+        void realKeys();
+
+        //! String ranks
+        void stringRanks();
+
+        //! Other values
+        void variantKeys();
+
+        //! Equal keys by tie breaker, then stable
+        void tieBreaker();
+    };
+
+    void CTestColumnSortKeys::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CTestColumnSortKeys::integerKeys()
+    {
+        CColumnSortKeys keys({ CVariant::from(3), CVariant::from(-1), CVariant::from(7), CVariant::from(3) }, Qt::CaseInsensitive);
+        QCOMPARE(keys.getKeyType(), CColumnSortKeys::IntegerKeys);
+        QCOMPARE(keys.sortedRows(Qt::AscendingOrder), QVector<int>({ 1, 0, 3, 2 }));
+        QCOMPARE(keys.sortedRows(Qt::DescendingOrder), QVector<int>({ 2, 0, 3, 1 }));
+
+        const QDateTime now = QDateTime::currentDateTimeUtc();
+        CColumnSortKeys dates({ CVariant::from(now), CVariant::from(now.addSecs(-10)), CVariant::from(QDateTime()) }, Qt::CaseInsensitive);
+        QCOMPARE(dates.getKeyType(), CColumnSortKeys::IntegerKeys);
+        QCOMPARE(dates.sortedRows(Qt::AscendingOrder), QVector<int>({ 2, 1, 0 }));
+    }
+
+    void CTestColumnSortKeys::realKeys()
+    {
+        CColumnSortKeys reals({ CVariant::from(1.5), CVariant::from(-0.5), CVariant::from(1.25) }, Qt::CaseInsensitive);
+        QCOMPARE(reals.getKeyType(), CColumnSortKeys::RealKeys);
+        QCOMPARE(reals.sortedRows(Qt::AscendingOrder), QVector<int>({ 1, 2, 0 }));
+
+        // different units, null values last like CPhysicalQuantity::lessThan
+        CColumnSortKeys lengths({ CVariant::from(CLength(1, CLengthUnit::km())), CVariant::from(CLength(0, nullptr)),
+                                  CVariant::from(CLength(900, CLengthUnit::m())), CVariant::from(CLength(1, CLengthUnit::NM()))
+                                }, Qt::CaseInsensitive);
+        QCOMPARE(lengths.getKeyType(), CColumnSortKeys::RealKeys);
+        QCOMPARE(lengths.sortedRows(Qt::AscendingOrder), QVector<int>({ 2, 0, 3, 1 }));
+    }
+
+    void CTestColumnSortKeys::stringRanks()
+    {
+        const QVector<CVariant> values({ CVariant::from(QString("b")), CVariant::from(QString("A")), CVariant::from(QString("a")), CVariant::from(QString("C")) });
+        CColumnSortKeys insensitive(QVector<CVariant>(values), Qt::CaseInsensitive);
+        QCOMPARE(insensitive.getKeyType(), CColumnSortKeys::StringRankKeys);
+        QCOMPARE(insensitive.sortedRows(Qt::AscendingOrder), QVector<int>({ 1, 2, 0, 3 })); // "A", "a" equal, stable
+
+        CColumnSortKeys sensitive(QVector<CVariant>(values), Qt::CaseSensitive);
+        QCOMPARE(sensitive.sortedRows(Qt::AscendingOrder), QVector<int>({ 1, 3, 2, 0 }));
+    }
+
+    void CTestColumnSortKeys::variantKeys()
+    {
+        CColumnSortKeys callsigns({ CVariant::from(CCallsign("DLH2")), CVariant::from(CCallsign("AFR1")), CVariant::from(CCallsign("BAW3")) }, Qt::CaseInsensitive);
+        QCOMPARE(callsigns.getKeyType(), CColumnSortKeys::VariantKeys);
+        QCOMPARE(callsigns.sortedRows(Qt::AscendingOrder), QVector<int>({ 1, 2, 0 }));
+
+        // mixed types
+        CColumnSortKeys mixed({ CVariant::from(1), CVariant::from(QString("x")) }, Qt::CaseInsensitive);
+        QCOMPARE(mixed.getKeyType(), CColumnSortKeys::VariantKeys);
+        QCOMPARE(mixed.sortedRows(Qt::AscendingOrder).size(), 2);
+    }
+
+    void CTestColumnSortKeys::tieBreaker()
+    {
+        CColumnSortKeys keys({ CVariant::from(1), CVariant::from(0), CVariant::from(1), CVariant::from(1) }, Qt::CaseInsensitive);
+        QCOMPARE(keys.sortedRows(Qt::AscendingOrder), QVector<int>({ 1, 0, 2, 3 }));
+
+        const QVector<int> secondary({ 0, 0, 5, 2 });
+        const auto tieBreaker = [&](int a, int b) { return secondary[a] > secondary[b]; };
+        QCOMPARE(keys.sortedRows(Qt::AscendingOrder, tieBreaker), QVector<int>({ 1, 2, 3, 0 }));
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackGuiTest::CTestColumnSortKeys);
+
+#include "testcolumnsortkeys.moc"
+
+//! \endcond
@@ -11,9 +11,11 @@
 //! \ingroup testblackmisc
 
 #include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/aircraftpartsdelta.h"
 #include "blackmisc/json.h"
 #include "test.h"
 #include <QTest>
+#include <QJsonDocument>
 #include <QJsonObject>
 
 using namespace BlackMisc::Aviation;
@@ -30,6 +32,12 @@ namespace BlackMiscTest
         //! Test ground flag
         void groundFlag();
 
+        //! Incremental parts parser yields the same parts as the JSON merge
+        void deltaEqualsJsonMerge();
+
+        //! Invalid and special aircraft config packets
+        void deltaSpecialPackets();
+
     private:
         //! Test parts
         BlackMisc::Aviation::CAircraftParts testParts1() const;
@@ -76,6 +84,81 @@ namespace BlackMiscTest
         // const QString json2 = stringFromJsonObject(deltaJson21);
     }
 
+    void CTestAircraftParts::deltaEqualsJsonMerge()
+    {
+        const QStringList packets(
+        {
+            R"({"config":{"lights":{"landing_on":false}}})",
+            R"({"config":{"flaps_pct":25,"gear_down":false}})",
+            R"({ "config" : { "spoilers_out" : true , "on_ground" : false } })",
+            R"({"config":{"engines":{"2":{"on":false},"5":{"on":true}}}})",
+            R"({"config":{"engines":{"6":{}}}})",
+            R"({"config":{"flaps_pct":12.0,"unknown":[1,{"a":"b\"c"}],"lights":{"nav_on":false,"foo":null}}})",
+            R"({"config":{"flaps_pct":12.5,"gear_down":"yes"}})",
+            R"({"config":{"engines":"none"}})",
+            R"({"config":{"gear_down":true,"flaps_pct":10,"gear_down":false}})",
+            R"({"config":{"is_full_data":true,"lights":{"strobe_on":true,"landing_on":true,"taxi_on":false,"beacon_on":true,"nav_on":true,"logo_on":false},"gear_down":true,"flaps_pct":100,"spoilers_out":false,"engines":{"1":{"on":true},"2":{"on":false}},"on_ground":true}})"
+        });
+
+        CAircraftParts jsonParts = this->testParts1();
+        CAircraftParts deltaParts = jsonParts;
+        for (const QString &packet : packets)
+        {
+            const QJsonObject config = QJsonDocument::fromJson(packet.toUtf8()).object().value("config").toObject();
+            const CAircraftPartsDelta delta = CAircraftPartsDelta::fromPacket(packet);
+            QVERIFY2(delta.isValid(), qPrintable(delta.getErrorMessage()));
+            QCOMPARE(delta.getAttributesCount(), config.size());
+
+            const bool isFull = config.value(CAircraftParts::attributeNameIsFullJson()).toBool();
+            QCOMPARE(delta.isFullData(), isFull);
+            if (isFull)
+            {
+                jsonParts = CAircraftParts();
+                jsonParts.convertFromJson(config);
+                deltaParts = CAircraftParts();
+            }
+            else
+            {
+                jsonParts.convertFromJson(applyIncrementalObject(jsonParts.toJson(), config));
+            }
+            delta.applyTo(deltaParts);
+            QVERIFY2(jsonParts == deltaParts, qPrintable(packet));
+
+            // the history string is valid JSON with the known attributes
+            const QJsonObject history = QJsonDocument::fromJson(delta.toJsonString().toUtf8()).object();
+            QVERIFY2(!history.isEmpty(), qPrintable(delta.toJsonString()));
+            for (const QString &key : history.keys()) { QVERIFY2(config.contains(key), qPrintable(key)); }
+        }
+
+        // round trip via parts
+        const CAircraftParts parts = this->testParts1();
+        CAircraftParts fromDelta;
+        CAircraftPartsDelta::fromParts(parts, true).applyTo(fromDelta);
+        QVERIFY2(fromDelta == parts, "Full delta shall reproduce parts");
+    }
+
+    void CTestAircraftParts::deltaSpecialPackets()
+    {
+        CAircraftPartsDelta delta = CAircraftPartsDelta::fromPacket(u"{\"request\":\"full\"}");
+        QVERIFY(delta.isValid());
+        QVERIFY(delta.isFullDataRequest());
+        QVERIFY(!delta.hasConfig());
+        QVERIFY(delta.isEmpty());
+
+        delta = CAircraftPartsDelta::fromPacket(u"{\"config\":{}}");
+        QVERIFY(delta.isValid());
+        QVERIFY(delta.hasConfig());
+        QCOMPARE(delta.getAttributesCount(), 0);
+
+        const QStringList invalid({ "", "{", "{\"config\":{\"gear_down\":tru}}", "{\"config\":{\"flaps_pct\":}}", "{\"config\":{}} x", "[1,2]", "{\"config\":{\"lights\":{\"nav_on\":true}}" });
+        for (const QString &packet : invalid)
+        {
+            delta = CAircraftPartsDelta::fromPacket(packet);
+            QVERIFY2(!delta.isValid(), qPrintable(packet));
+            QVERIFY2(QJsonDocument::fromJson(packet.toUtf8()).isNull() || !QJsonDocument::fromJson(packet.toUtf8()).isObject(), qPrintable(packet));
+        }
+    }
+
     CAircraftParts CTestAircraftParts::testParts1() const
     {
         const CAircraftLights lights = CAircraftLights::allLightsOn();
@@ -13,6 +13,7 @@
 #include "blackconfig/buildconfig.h"
 #include "blackmisc/aviation/aircraftsituationchange.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/aircraftsituationstatistics.h"
 #include "blackmisc/network/fsdsetup.h"
 #include "blackmisc/cputime.h"
 // #include "blackmisc/math/mathutils.h"
@@ -64,6 +65,9 @@ namespace BlackMiscTest
         //! Using sort hint
         void sortHint();
 
+        //! Single pass and incremental statistics
+        void statistics();
+
     private:
         //! Test situations (ascending)
         static BlackMisc::Aviation::CAircraftSituationList testSituations();
@@ -303,6 +307,70 @@ namespace BlackMiscTest
         }
     }
 
+    void CTestAircraftSituation::statistics()
+    {
+        CAircraftSituationList situations = testSituations();
+        int i = 0;
+        for (CAircraftSituation &s : situations)
+        {
+            s.setGroundSpeed(CSpeed(100 + 3 * i, CSpeedUnit::kts()));
+            s.setPitch(CAngle(i % 3, CAngleUnit::deg()));
+            s.setGroundElevation(CAltitude(500 + 7 * (i % 4), CAltitude::MeanSeaLevel, CLengthUnit::ft()), CAircraftSituation::Test);
+            i++;
+        }
+
+        // same values as calculated from the value lists
+        const CAircraftSituationStatistics statistics(situations);
+        QCOMPARE(statistics.getSituationsCount(), situations.size());
+        const QPair<double, double> gsKts = CMathUtils::standardDeviationAndMean(situations.groundSpeedValues(CSpeedUnit::kts()));
+        QVERIFY(qAbs(statistics.groundSpeedStandardDeviationAndMean().first.value(CSpeedUnit::kts()) - gsKts.first) < 1e-9);
+        QVERIFY(qAbs(statistics.groundSpeedStandardDeviationAndMean().second.value(CSpeedUnit::kts()) - gsKts.second) < 1e-9);
+        const QPair<double, double> altFt = CMathUtils::standardDeviationAndMean(situations.altitudeValues(CLengthUnit::ft()));
+        QVERIFY(qAbs(statistics.altitudeStandardDeviationAndMean().first.value(CLengthUnit::ft()) - altFt.first) < 1e-6);
+        QVERIFY(qAbs(statistics.altitudeStandardDeviationAndMean().second.value(CLengthUnit::ft()) - altFt.second) < 1e-6);
+        const QPair<double, double> pitchDeg = CMathUtils::standardDeviationAndMean(situations.pitchValues(CAngleUnit::deg()));
+        QVERIFY(qAbs(statistics.pitchStandardDeviationAndMean().first.value(CAngleUnit::deg()) - pitchDeg.first) < 1e-9);
+
+        const CRunningStatistics &elv = statistics.getStatistics(CAircraftSituationStatistics::Elevation);
+        QVERIFY(qAbs(elv.minValue() - 500.0) < 1e-9);
+        QVERIFY(qAbs(elv.maxValue() - 521.0) < 1e-9);
+        QVERIFY(statistics.isComplete(CAircraftSituationStatistics::GroundDistance));
+
+        // incremental, latest first and limited as the situations per callsign
+        constexpr int Max = 4;
+        CAircraftSituationStatistics incremental;
+        for (int s = situations.size() - 1; s >= 0; s--)
+        {
+            incremental.pushFront(situations[s], Max);
+            CAircraftSituationList window;
+            for (int w = s; w < situations.size() && w < s + Max; w++) { window.push_back(situations[w]); }
+            const CAircraftSituationStatistics batch(window);
+            QCOMPARE(incremental.getSituationsCount(), batch.getSituationsCount());
+            for (int f = 0; f < CAircraftSituationStatistics::NumberOfFields; f++)
+            {
+                const auto field = static_cast<CAircraftSituationStatistics::Field>(f);
+                const CRunningStatistics &inc = incremental.getStatistics(field);
+                const CRunningStatistics &all = batch.getStatistics(field);
+                QCOMPARE(inc.count(), all.count());
+                QVERIFY(qAbs(inc.mean() - all.mean()) < 1e-6);
+                QVERIFY(qAbs(inc.standardDeviation() - all.standardDeviation()) < 1e-6);
+                QCOMPARE(inc.minValue(), all.minValue());
+                QCOMPARE(inc.maxValue(), all.maxValue());
+            }
+        }
+
+        // NULL values make the field incomplete
+        situations.front().setGroundSpeed(CSpeed::null());
+        const CAircraftSituationStatistics withNull(situations);
+        QVERIFY(!withNull.isComplete(CAircraftSituationStatistics::GroundSpeed));
+        QVERIFY(withNull.groundSpeedStandardDeviationAndMean().first.isNull());
+        QVERIFY(situations.groundSpeedStandardDeviationAndMean().first.isNull());
+
+        incremental.clear();
+        QCOMPARE(incremental.getSituationsCount(), 0);
+        QVERIFY(!incremental.isComplete(CAircraftSituationStatistics::Pitch));
+    }
+
     CAircraftSituationList CTestAircraftSituation::testSituations()
     {
         // "Kugaaruk Airport","Pelly Bay","Canada","YBB","CYBB",68.534401,-89.808098,56,-7,"A","America/Edmonton","airport","OurAirports"
@@ -22,10 +22,12 @@
 #include "blackmisc/aviation/informationmessage.h"
 #include "blackmisc/aviation/navsystem.h"
 #include "blackmisc/aviation/transponder.h"
+#include "blackmisc/aviation/livery.h"
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/geo/coordinategeodetic.h"
 #include "blackmisc/geo/latitude.h"
 #include "blackmisc/geo/longitude.h"
+#include "blackmisc/internedstring.h"
 #include "blackmisc/network/server.h"
 #include "blackmisc/network/user.h"
 #include "blackmisc/pq/angle.h"
@@ -35,7 +37,10 @@
 #include "blackmisc/pq/units.h"
 #include "test.h"
 
+#include <QByteArray>
+#include <QDataStream>
 #include <QDateTime>
+#include <QJsonObject>
 #include <QString>
 #include <QTest>
 
@@ -67,6 +72,9 @@ namespace BlackMiscTest
         //! Callsigns and callsign containers
         void callsignWithContainers();
 
+        //! Interned callsigns and designators
+        void internedStrings();
+
         //! Testing copying and equality of objects
         void copyAndEqual();
 
@@ -212,6 +220,63 @@ namespace BlackMiscTest
         QVERIFY2(set.size() == 0, "Last should be gone");
     }
 
+    void CTestAviation::internedStrings()
+    {
+        const CCallsign cs1("dlh123");
+        const CCallsign cs2(QStringLiteral("DLH") + QString::number(123));
+        const CCallsign cs3("DLH124");
+        QVERIFY2(cs1 == cs2 && qHash(cs1) == qHash(cs2), "Same interned callsign");
+        QVERIFY2(cs1.asString().isSharedWith(cs2.asString()), "Interned strings share the buffer");
+        QVERIFY2(cs1 < cs3 && !(cs3 < cs1) && compare(cs1, cs3) < 0, "Ordering by string");
+        QVERIFY2(CCallsign() == CCallsign(""), "Empty callsigns are equal");
+
+        // marshalled as strings and interned again
+        CCallsign fromJson;
+        fromJson.convertFromJson(cs1.toJson());
+        QVERIFY2(fromJson == cs1 && fromJson.asString() == "DLH123", "JSON round trip");
+
+        QByteArray bytes;
+        QDataStream out(&bytes, QIODevice::WriteOnly);
+        out << cs3;
+        QDataStream in(bytes);
+        CCallsign fromStream;
+        in >> fromStream;
+        QVERIFY2(fromStream == cs3, "Data stream round trip");
+
+        // not normalized when unmarshalled, still equal and same hash
+        QJsonObject lowerJson = cs1.toJson();
+        lowerJson.insert("callsign", "dlh123");
+        CCallsign fromLowerJson;
+        fromLowerJson.convertFromJson(lowerJson);
+        QVERIFY2(fromLowerJson == cs1 && qHash(fromLowerJson) == qHash(cs1), "Case insensitive callsign");
+        CLivery livery;
+        livery.setCombinedCode("DLH.STD");
+        QJsonObject liveryJson = livery.toJson();
+        liveryJson.insert("combinedCode", "dlh.std");
+        CLivery fromLiveryJson;
+        fromLiveryJson.convertFromJson(liveryJson);
+        QVERIFY2(fromLiveryJson == livery, "Case insensitive livery code");
+
+        // unused strings are pruned
+        const int count = CInternedString::getInternedCount();
+        {
+            const CInternedString temp(QStringLiteral("PRUNE") + QString::number(count));
+            QVERIFY2(CInternedString::getInternedCount() == count + 1, "Interned");
+            CInternedString::pruneInterned();
+            QVERIFY2(CInternedString::getInternedCount() >= 1 && temp.toQString().startsWith("PRUNE"), "Used strings are kept");
+            QVERIFY2(CInternedString(temp.toQString()) == temp, "Still interned");
+        }
+        CInternedString::pruneInterned();
+        QVERIFY2(CInternedString::getInternedCount() < count + 1, "Unused strings are pruned");
+
+        const CAircraftIcaoCode icao1("b737");
+        const CAircraftIcaoCode icao2("B737");
+        QVERIFY2(icao1.getDesignator() == "B737" && icao1 == icao2, "Same interned designator");
+        const CAirlineIcaoCode virtualAirline("VDLH");
+        QVERIFY2(virtualAirline.getDesignator() == "DLH" && virtualAirline.isVirtualAirline(), "Virtual airline designator");
+        QVERIFY2(virtualAirline.getVDesignator() == "VDLH", "V designator");
+    }
+
     void CTestAviation::copyAndEqual()
     {
         const CFrequency f1(123.45, CFrequencyUnit::MHz());
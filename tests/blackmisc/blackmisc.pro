@@ -10,10 +10,15 @@ SUBDIRS += \
     testcompress \
     testcontainers \
     testdatastream \
+    testdbsnapshot \
     testdbus \
     testicon \
     testidentifier \
+    testjsonstream \
+    testjsonstreamreader \
     testlibrarypath \
+    testlockfreeringbuffer \
+    testparallel \
     testprocess \
     testpropertyindex \
     testsharedstate \
@@ -21,6 +26,9 @@ SUBDIRS += \
     testslot \
     teststatusmessage \
     teststringutils \
+    testtimeline \
+    testtracer \
     testvaluecache \
     testvariantandmap \
+    testworker \
     weather \
@@ -13,12 +13,15 @@
 #include "blackmisc/geo/coordinategeodetic.h"
 #include "blackmisc/geo/earthangle.h"
 #include "blackmisc/geo/latitude.h"
+#include "blackmisc/aviation/atcstationlist.h"
+#include "blackmisc/math/mathutils.h"
 #include "blackmisc/pq/physicalquantity.h"
 #include "blackmisc/pq/units.h"
 #include "test.h"
 
 #include <QTest>
 
+using namespace BlackMisc::Aviation;
 using namespace BlackMisc::Geo;
 using namespace BlackMisc::PhysicalQuantities;
 using namespace BlackMisc::Math;
@@ -36,6 +39,9 @@ namespace BlackMiscTest
 
         //! CCoordinateGeodetic unit tests
         void coordinateGeodetic();
+
+        //! Relative distances and bearings of a list, same as for single objects
+        void relativePositions();
     };
 
     void CTestGeo::geoBasics()
@@ -79,6 +85,58 @@ namespace BlackMiscTest
         latValue = testCoordinate.latitude().value(CAngleUnit::deg());
         QCOMPARE(latValue, newLat.value(CAngleUnit::deg()));
     }
+
+    void CTestGeo::relativePositions()
+    {
+        CAtcStationList stations;
+        for (int i = 0; i < 250; i++)
+        {
+            CAtcStation station("STATION" + QString::number(i) + "_TWR");
+            if (i % 10 != 0)
+            {
+                station.setPosition(CCoordinateGeodetic(CMathUtils::randomDouble(178.0) - 89.0, CMathUtils::randomDouble(358.0) - 179.0, 0.0));
+            }
+            stations.push_back(station);
+        }
+        stations.push_back(CAtcStation("NORTH_TWR"));
+        stations.back().setPosition(CCoordinateGeodetic(90.0, 0.0, 0.0));
+
+        const CCoordinateGeodetic position(48.353783, 11.786086, 0.0);
+        stations.calculcateAndUpdateRelativeDistanceAndBearing(position);
+        for (const CAtcStation &station : std::as_const(stations))
+        {
+            const CLength distance = calculateGreatCircleDistance(station, position);
+            const CAngle bearing = calculateBearing(station, position);
+            QCOMPARE(station.getRelativeDistance().isNull(), distance.isNull());
+            QCOMPARE(station.getRelativeBearing().isNull(), bearing.isNull());
+            if (distance.isNull()) { continue; }
+            QVERIFY(std::abs(station.getRelativeDistance().value(CLengthUnit::m()) - distance.value(CLengthUnit::m())) < 1.0 + 1.0e-5 * distance.value(CLengthUnit::m()));
+            QVERIFY(std::abs(station.getRelativeBearing().value(CAngleUnit::rad()) - bearing.value(CAngleUnit::rad())) < 1.0e-4);
+        }
+
+        // filtered and sorted like before
+        CAtcStationList inRange = stations;
+        const CLength range(2000, CLengthUnit::km());
+        inRange.removeIfOutsideRange(position, range, true);
+        QVERIFY(!inRange.isEmpty());
+        for (const CAtcStation &station : std::as_const(inRange))
+        {
+            QVERIFY(station.getRelativeDistance() <= range);
+        }
+        inRange.sortByRange(position, true);
+        for (int i = 1; i < inRange.size(); i++)
+        {
+            QVERIFY(inRange[i - 1].getRelativeDistance() <= inRange[i].getRelativeDistance());
+        }
+
+        // null reference
+        stations.calculcateAndUpdateRelativeDistanceAndBearing(CCoordinateGeodetic());
+        for (const CAtcStation &station : std::as_const(stations))
+        {
+            QVERIFY(station.getRelativeDistance().isNull());
+            QVERIFY(station.getRelativeBearing().isNull());
+        }
+    }
 } // ns
 
 //! main
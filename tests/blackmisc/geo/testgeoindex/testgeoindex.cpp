@@ -0,0 +1,136 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/coordinategeodeticlist.h"
+#include "blackmisc/geo/geoindex.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/units.h"
+#include "test.h"
+
+#include <QTest>
+
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMiscTest
+{
+    //! Spatial index tests
+    class CTestGeoIndex : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! k nearest as the linear search
+        void closest();
+
+        //! Within range as the linear search
+        void withinRange();
+
+        //! Empty index, NULL positions
+        void emptyAndNull();
+
+    private:
+        //! Positions spread over the earth, deterministic
+        static CCoordinateGeodeticList positions(int number);
+    };
+
+    void CTestGeoIndex::closest()
+    {
+        const CCoordinateGeodeticList list = positions(5000);
+        const CGeoObjectIndex<CCoordinateGeodetic, CCoordinateGeodeticList> index(list);
+        QCOMPARE(index.size(), list.size());
+
+        for (const CCoordinateGeodetic &reference : positions(50))
+        {
+            for (int k : { 1, 5, 20 })
+            {
+                const CCoordinateGeodeticList linear = list.findClosest(k, reference);
+                const CCoordinateGeodeticList indexed = index.findClosest(k, reference);
+                QCOMPARE(indexed.size(), linear.size());
+                for (int i = 0; i < k; i++)
+                {
+                    // same distances, positions with the same distance can be in any order
+                    const double dl = calculateGreatCircleDistance(linear[i], reference).value(CLengthUnit::m());
+                    const double di = calculateGreatCircleDistance(indexed[i], reference).value(CLengthUnit::m());
+                    QVERIFY2(qAbs(dl - di) < 1.0, qPrintable(QStringLiteral("%1 %2").arg(dl).arg(di)));
+                }
+            }
+        }
+    }
+
+    void CTestGeoIndex::withinRange()
+    {
+        const CCoordinateGeodeticList list = positions(5000);
+        const CGeoObjectIndex<CCoordinateGeodetic, CCoordinateGeodeticList> index(list);
+        const CCoordinateGeodetic munich(48.353889, 11.786111, 0);
+
+        for (double rangeNM : { 10.0, 250.0, 1000.0, 20000.0 })
+        {
+            const CLength range(rangeNM, CLengthUnit::NM());
+            const CCoordinateGeodeticList linear = list.findWithinRange(munich, range);
+            const CCoordinateGeodeticList indexed = index.findWithinRange(munich, range);
+            QCOMPARE(indexed.size(), linear.size());
+            for (const CCoordinateGeodetic &c : indexed) { QVERIFY(linear.contains(c)); }
+
+            // closest first
+            for (int i = 1; i < indexed.size(); i++)
+            {
+                QVERIFY(calculateEuclideanDistanceSquared(indexed[i - 1], munich) <= calculateEuclideanDistanceSquared(indexed[i], munich) + 1e-6);
+            }
+        }
+
+        const CCoordinateGeodetic closest = index.findClosestWithinRange(munich, CLength(20000, CLengthUnit::NM()));
+        QCOMPARE(closest, list.findClosestWithinRange(munich, CLength(20000, CLengthUnit::NM())));
+        QVERIFY(index.findClosestWithinRange(munich, CLength(1, CLengthUnit::m())).isNull());
+    }
+
+    void CTestGeoIndex::emptyAndNull()
+    {
+        const CGeoObjectIndex<CCoordinateGeodetic, CCoordinateGeodeticList> empty;
+        QVERIFY(empty.findClosest(5, CCoordinateGeodetic(48.0, 11.0, 0)).isEmpty());
+        QVERIFY(empty.findWithinRange(CCoordinateGeodetic(48.0, 11.0, 0), CLength(100, CLengthUnit::km())).isEmpty());
+
+        CCoordinateGeodeticList list = positions(10);
+        list.push_back(CCoordinateGeodetic::null());
+        const CGeoObjectIndex<CCoordinateGeodetic, CCoordinateGeodeticList> index(list);
+        QCOMPARE(index.findClosest(100, CCoordinateGeodetic(48.0, 11.0, 0)).size(), 10);
+        QVERIFY(index.findClosest(5, CCoordinateGeodetic::null()).isEmpty());
+    }
+
+    CCoordinateGeodeticList CTestGeoIndex::positions(int number)
+    {
+        // linear congruential generator, same positions for every run
+        quint32 state = 12345;
+        const auto next = [&state]()
+        {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<double>(state) / 4294967296.0;
+        };
+
+        CCoordinateGeodeticList list;
+        for (int i = 0; i < number; i++)
+        {
+            const double lat = next() * 180.0 - 90.0;
+            const double lng = next() * 360.0 - 180.0;
+            list.push_back(CCoordinateGeodetic(lat, lng, 0));
+        }
+        return list;
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestGeoIndex);
+
+#include "testgeoindex.moc"
+
+//! \endcond
@@ -83,6 +83,9 @@ namespace BlackMiscTest
         //! Basic arithmetic such as +/-
         void basicArithmetic();
 
+        //! Same unit and default unit fast paths, comparisons with NULL
+        void sameUnitFastPath();
+
         //! Test user-defined literals
         void literalsTest();
     };
@@ -339,6 +342,42 @@ namespace BlackMiscTest
 
     }
 
+    void CTestPhysicalQuantities::sameUnitFastPath()
+    {
+        QVERIFY(CLengthUnit::m().hasIdentityConversion());
+        QVERIFY(!CLengthUnit::ft().hasIdentityConversion());
+        QVERIFY(CPressureUnit::mbar().hasIdentityConversion());
+
+        // same unit, value unchanged
+        const CLength l1(1000.0, CLengthUnit::ft());
+        QCOMPARE(l1.value(CLengthUnit::ft()), 1000.0);
+        QCOMPARE(l1.switchedUnit(CLengthUnit::ft()).value(), 1000.0);
+
+        // from and to the default unit
+        QVERIFY(qAbs(l1.value(CLengthUnit::m()) - 304.8) < 1e-9);
+        QVERIFY(qAbs(CLength(304.8, CLengthUnit::m()).value(CLengthUnit::ft()) - 1000.0) < 1e-9);
+        QVERIFY(qAbs(l1.value(CLengthUnit::NM()) - 304.8 / 1852.0) < 1e-9);
+        QVERIFY(qAbs(CSpeed(100, CSpeedUnit::kts()).value(CSpeedUnit::km_h()) - 185.2) < 1e-9);
+        QCOMPARE(CPressure(1013, CPressureUnit::hPa()).value(CPressureUnit::mbar()), 1013.0);
+
+        // comparisons, mixed units and NULL
+        const CLength l2(304.8, CLengthUnit::m());
+        const CLength l3(1001.0, CLengthUnit::ft());
+        QVERIFY(l1 == l2);
+        QVERIFY(!(l1 < l2) && !(l2 < l1));
+        QVERIFY(l1 < l3 && l2 < l3);
+        QVERIFY(l3 > l1 && l3 >= l2);
+        QVERIFY(l1 < CLength::null());
+        QVERIFY(!(CLength::null() < l1));
+        QVERIFY(!(CLength::null() < CLength::null()));
+        QCOMPARE(CLength::null().value(CLengthUnit::m()), 0.0);
+
+        // arithmetic keeps the unit of the left operand
+        const CLength sum = l1 + l2;
+        QCOMPARE(sum.getUnit(), CLengthUnit::ft());
+        QVERIFY(qAbs(sum.value() - 2000.0) < 1e-9);
+    }
+
     void CTestPhysicalQuantities::literalsTest()
     {
         using namespace BlackMisc::PhysicalQuantities::Literals;
@@ -1,6 +1,10 @@
 TEMPLATE = subdirs
 SUBDIRS += \
+    testaircraftmodelsetimage \
+    testframebudgetscheduler \
+    testinterpolationtrace \
     testinterpolatorlinear \
     testinterpolatormisc \
     testinterpolatorparts \
+    testremoteaircraftprovider \
     testxplane \
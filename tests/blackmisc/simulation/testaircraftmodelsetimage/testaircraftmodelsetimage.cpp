@@ -0,0 +1,224 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/aircraftmodelsetimage.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/distributor.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/units.h"
+#include "test.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Memory-mapped model set image
+    class CTestAircraftModelSetImage : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Materialized models equal the written models
+        void roundTrip();
+
+        //! Views without materializing
+        void views();
+
+        //! Lookups by model string
+        void lookups();
+
+        //! Damaged or missing images
+        void invalid();
+
+        //! Shared image, mapped again if changed
+        void shared();
+
+    private:
+        //! Models sharing ICAO codes, liveries and distributors
+        static CAircraftModelList models(int number);
+    };
+
+    void CTestAircraftModelSetImage::roundTrip()
+    {
+        QTemporaryDir dir;
+        const QString fileName = dir.filePath("set.modelsetimage");
+        const CAircraftModelList set = models(100);
+        const qint64 modelSetTimestamp = Q_INT64_C(1620000000000);
+        QVERIFY(CAircraftModelSetImage::writeImage(set, CSimulatorInfo::fsx(), modelSetTimestamp, fileName).isSuccess());
+
+        const CAircraftModelSetImage image(fileName);
+        QVERIFY2(image.isValid(), qPrintable(image.getStatus().getMessage()));
+        QCOMPARE(image.size(), set.size());
+        QCOMPARE(image.getSimulator(), CSimulatorInfo::fsx());
+        QCOMPARE(image.getModelSetTimestamp(), modelSetTimestamp);
+
+        const CAircraftModelList materialized = image.toAircraftModelList();
+        QCOMPARE(materialized, set);
+        for (int i = 0; i < set.size(); ++i)
+        {
+            // not part of the comparison
+            QCOMPARE(materialized[i].getDescription(), set[i].getDescription());
+            QCOMPARE(materialized[i].getFileName(), set[i].getFileName());
+            QCOMPARE(materialized[i].getIconFile(), set[i].getIconFile());
+            QCOMPARE(materialized[i].getFileTimestamp(), set[i].getFileTimestamp());
+            QCOMPARE(materialized[i].getLivery().getCombinedCode(), set[i].getLivery().getCombinedCode());
+            QCOMPARE(materialized[i].getDistributor().getDbKey(), set[i].getDistributor().getDbKey());
+        }
+
+        // empty set
+        QVERIFY(CAircraftModelSetImage::writeImage({}, CSimulatorInfo::fsx(), 0, fileName).isSuccess());
+        const CAircraftModelSetImage empty(fileName);
+        QVERIFY(empty.isValid());
+        QVERIFY(empty.isEmpty());
+        QVERIFY(!empty.containsModelString("MODEL 1"));
+    }
+
+    void CTestAircraftModelSetImage::views()
+    {
+        QTemporaryDir dir;
+        const QString fileName = dir.filePath("set.modelsetimage");
+        const CAircraftModelList set = models(20);
+        QVERIFY(CAircraftModelSetImage::writeImage(set, CSimulatorInfo::xplane(), 0, fileName).isSuccess());
+        const CAircraftModelSetImage image(fileName);
+        QVERIFY(image.isValid());
+
+        for (int i = 0; i < set.size(); ++i)
+        {
+            const CAircraftModelImageView view = image.at(i);
+            const CAircraftModel &model = set[i];
+            QVERIFY(view.isValid());
+            QCOMPARE(view.getIndex(), i);
+            QCOMPARE(view.getModelString().toString(), model.getModelString());
+            QCOMPARE(view.getName().toString(), model.getName());
+            QCOMPARE(view.getAircraftIcaoCodeDesignator().toString(), model.getAircraftIcaoCodeDesignator());
+            QCOMPARE(view.getAirlineIcaoCodeDesignator().toString(), model.getAirlineIcaoCodeDesignator());
+            QCOMPARE(view.getLiveryCombinedCode().toString(), model.getLivery().getCombinedCode());
+            QCOMPARE(view.getDistributorKey().toString(), model.getDistributor().getDbKey());
+            QCOMPARE(view.getDbKey(), model.getDbKey());
+            QCOMPARE(view.getModelMode(), model.getModelMode());
+            QCOMPARE(view.toAircraftModel(), model);
+        }
+
+        const CAircraftModelImageView invalid;
+        QVERIFY(!invalid.isValid());
+        QVERIFY(invalid.getModelString().isEmpty());
+        QCOMPARE(invalid.toAircraftModel(), CAircraftModel());
+    }
+
+    void CTestAircraftModelSetImage::lookups()
+    {
+        QTemporaryDir dir;
+        const QString fileName = dir.filePath("set.modelsetimage");
+        const CAircraftModelList set = models(200);
+        QVERIFY(CAircraftModelSetImage::writeImage(set, CSimulatorInfo::fsx(), 0, fileName).isSuccess());
+        const CAircraftModelSetImage image(fileName);
+
+        for (const QString &modelString : { "MODEL 0", "model 17", " Model 199 ", "MODEL 200", "MODEL", "" })
+        {
+            const CAircraftModelImageView view = image.findByModelString(modelString);
+            QCOMPARE(view.isValid(), set.containsModelString(modelString.trimmed()));
+            if (view.isValid()) { QCOMPARE(view.toAircraftModel(), set.findFirstByModelStringOrDefault(modelString.trimmed())); }
+        }
+
+        for (const QString &start : { "MODEL 1", "model 19", "MODEL 5", "X" })
+        {
+            const CAircraftModelList found = CAircraftModelSetImage::toAircraftModelList(image.findModelsStartingWith(start));
+            QCOMPARE(found, set.findModelsStartingWith(start));
+        }
+        QCOMPARE(image.getModelStringList(), set.getModelStringList(false));
+    }
+
+    void CTestAircraftModelSetImage::invalid()
+    {
+        QTemporaryDir dir;
+        const CAircraftModelSetImage missing(dir.filePath("missing.modelsetimage"));
+        QVERIFY(!missing.isValid());
+        QVERIFY(missing.getStatus().isWarningOrAbove());
+        QVERIFY(!missing.findByModelString("MODEL 1").isValid());
+
+        const QString fileName = dir.filePath("set.modelsetimage");
+        QVERIFY(CAircraftModelSetImage::writeImage(models(10), CSimulatorInfo::fsx(), 0, fileName).isSuccess());
+
+        // truncated
+        QFile file(fileName);
+        QVERIFY(file.resize(file.size() / 2));
+        const CAircraftModelSetImage truncated(fileName);
+        QVERIFY(!truncated.isValid());
+
+        // not an image
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write(QByteArray(500, 'x'));
+        file.close();
+        const CAircraftModelSetImage garbage(fileName);
+        QVERIFY(!garbage.isValid());
+        QVERIFY(CAircraftModelSetImage::mapShared(fileName).isNull());
+    }
+
+    void CTestAircraftModelSetImage::shared()
+    {
+        QTemporaryDir dir;
+        const QString fileName = dir.filePath("set.modelsetimage");
+        QVERIFY(CAircraftModelSetImage::mapShared(fileName).isNull());
+
+        QVERIFY(CAircraftModelSetImage::writeImage(models(10), CSimulatorInfo::fsx(), 0, fileName).isSuccess());
+        const QSharedPointer<const CAircraftModelSetImage> image1 = CAircraftModelSetImage::mapShared(fileName);
+        QVERIFY(image1);
+        QCOMPARE(CAircraftModelSetImage::mapShared(fileName), image1);
+
+        // a new image (of another size, as file times might have a low resolution), the old one stays valid for its users
+        QVERIFY(CAircraftModelSetImage::writeImage(models(20), CSimulatorInfo::fsx(), 0, fileName).isSuccess());
+        const QSharedPointer<const CAircraftModelSetImage> image2 = CAircraftModelSetImage::mapShared(fileName);
+        QVERIFY(image2);
+        QVERIFY(image2 != image1);
+        QCOMPARE(image2->size(), 20);
+        QCOMPARE(image1->size(), 10);
+        QCOMPARE(image1->at(9).getModelString().toString(), QString("MODEL 9"));
+    }
+
+    CAircraftModelList CTestAircraftModelSetImage::models(int number)
+    {
+        CAircraftModelList models;
+        for (int i = 0; i < number; ++i)
+        {
+            const QString part = QString::number(i % 7);
+            const CAircraftIcaoCode aircraftIcao("A" + part, "A" + part, "L1P", "Lego", "Foo", "M", false, false, false, 0);
+            const CLivery livery("A" + part, CAirlineIcaoCode("A" + part, "Foo", CCountry("DE", "Germany"), "Foo", false, false), "Foo", "red", "blue", false);
+            CAircraftModel model("Model " + QString::number(i), CAircraftModel::TypeOwnSimulatorModel, CSimulatorInfo::FSX, "Name " + part, QString::fromUtf8("Beschreibung \xc3\xa4 ") + part, aircraftIcao, livery);
+            model.setDistributor(CDistributor("D" + part, "Foo", {}, {}, CSimulatorInfo::FSX));
+            model.setFileName("C:/models/" + QString::number(i) + "/aircraft.cfg");
+            model.setFileTimestamp(Q_INT64_C(1600000000000) + i);
+            model.setMSecsSinceEpoch(Q_INT64_C(1610000000000) + i);
+            model.setOrder(i);
+            if (i % 3 == 0) { model.setDbKey(i + 1); }
+            if (i % 2 == 0) { model.setCG(CLength(i, CLengthUnit::ft())); }
+            if (i % 5 == 0) { model.setModelMode(CAircraftModel::Exclude); }
+            models.push_back(model);
+        }
+        return models;
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestAircraftModelSetImage);
+
+#include "testaircraftmodelsetimage.moc"
+
+//! \endcond
@@ -0,0 +1,183 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/framebudgetscheduler.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/heading.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/units.h"
+#include "test.h"
+
+#include <QHash>
+#include <QTest>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Frame budget scheduler for remote aircraft updates
+    class CTestFrameBudgetScheduler : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Tiers by distance, speed and parked
+        void tiers();
+
+        //! Reduced rates per tier, staggered
+        void rates();
+
+        //! Rates follow the measured update time
+        void adaption();
+
+        //! Disabled scheduler updates all
+        void disabled();
+
+        //! Dead reckoning of skipped aircraft
+        void extrapolate();
+    };
+
+    void CTestFrameBudgetScheduler::tiers()
+    {
+        QCOMPARE(CFrameBudgetScheduler::tier(1.0, 0.0, false), CFrameBudgetScheduler::Near);
+        QCOMPARE(CFrameBudgetScheduler::tier(10.0, 100.0, false), CFrameBudgetScheduler::Medium);
+        QCOMPARE(CFrameBudgetScheduler::tier(10.0, 250.0, false), CFrameBudgetScheduler::Near);
+        QCOMPARE(CFrameBudgetScheduler::tier(50.0, 450.0, false), CFrameBudgetScheduler::Near);
+        QCOMPARE(CFrameBudgetScheduler::tier(50.0, 100.0, false), CFrameBudgetScheduler::Far);
+        QCOMPARE(CFrameBudgetScheduler::tier(1.0, 0.0, true), CFrameBudgetScheduler::Parked);
+
+        const CCoordinateGeodetic own(48.353889, 11.786111, 1487.0);
+        CAircraftSituation situation(CCallsign("DAMBZ"), CCoordinateGeodetic(48.5, 11.786111, 5000.0)); // ~9NM
+        situation.setGroundSpeed(CSpeed(120, CSpeedUnit::kts()));
+        QCOMPARE(CFrameBudgetScheduler::tier(situation, own), CFrameBudgetScheduler::Medium);
+        QCOMPARE(CFrameBudgetScheduler::tier(situation, CCoordinateGeodetic::null()), CFrameBudgetScheduler::Near);
+    }
+
+    void CTestFrameBudgetScheduler::rates()
+    {
+        constexpr int Frames = 64;
+        CFrameBudgetScheduler scheduler(1.0);
+
+        // over budget, level 1 uses the reduced rates
+        for (int f = 0; f < CFrameBudgetScheduler::AdaptionFrames; f++) { scheduler.endFrame(1000 + f * 20, 1.5); }
+        QCOMPARE(scheduler.getLevel(), 1);
+        QHash<QString, int> dueFar;
+        QHash<QString, int> dueParked;
+        int dueNear = 0;
+        for (int f = 0; f < Frames; f++)
+        {
+            int dueFarInFrame = 0;
+            for (int i = 0; i < 16; i++)
+            {
+                const CCallsign cs(QStringLiteral("DLH%1").arg(i));
+                if (scheduler.isDue(cs, CFrameBudgetScheduler::Near))   { dueNear++; }
+                if (scheduler.isDue(cs, CFrameBudgetScheduler::Far))    { dueFar[cs.asString()]++; dueFarInFrame++; }
+                if (scheduler.isDue(cs, CFrameBudgetScheduler::Parked)) { dueParked[cs.asString()]++; }
+            }
+            QVERIFY2(dueFarInFrame < 16, "far aircraft are staggered");
+            scheduler.endFrame(1000 + (CFrameBudgetScheduler::AdaptionFrames + f) * 20, 0.75); // between half and full budget, level kept
+        }
+        QCOMPARE(scheduler.getLevel(), 1);
+
+        QCOMPARE(dueNear, 16 * Frames);
+        for (int i = 0; i < 16; i++)
+        {
+            const QString cs = QStringLiteral("DLH%1").arg(i);
+            QCOMPARE(dueFar.value(cs), Frames / 4);
+            QCOMPARE(dueParked.value(cs), Frames / 8);
+        }
+
+        QCOMPARE(scheduler.getStatistics(CFrameBudgetScheduler::Far).considered, qint64(16 * Frames));
+        QCOMPARE(scheduler.getStatistics(CFrameBudgetScheduler::Far).updated, qint64(16 * Frames / 4));
+        QVERIFY(qAbs(scheduler.getUpdateRateHz(CFrameBudgetScheduler::Near) - 50.0) < 0.01);
+        QVERIFY(qAbs(scheduler.getUpdateRateHz(CFrameBudgetScheduler::Far) - 12.5) < 0.01);
+        QVERIFY(scheduler.getUpdateRateHz(CFrameBudgetScheduler::Medium) < 0);
+        QVERIFY(!scheduler.getStatisticsInfo().isEmpty());
+    }
+
+    void CTestFrameBudgetScheduler::adaption()
+    {
+        CFrameBudgetScheduler scheduler(2.0);
+
+        // within the budget all aircraft are updated every frame
+        for (int f = 0; f < 2 * CFrameBudgetScheduler::AdaptionFrames; f++)
+        {
+            QVERIFY(scheduler.isDue(CCallsign("DAMBZ"), CFrameBudgetScheduler::Parked));
+            scheduler.endFrame(f * 20, 1.5);
+        }
+        QCOMPARE(scheduler.getLevel(), 0);
+        QCOMPARE(scheduler.interval(CFrameBudgetScheduler::Far), 1);
+        scheduler.resetStatistics();
+
+        // over budget
+        for (int f = 0; f < 2 * CFrameBudgetScheduler::AdaptionFrames; f++) { scheduler.endFrame(f * 20, 10.0); }
+        QCOMPARE(scheduler.getLevel(), 2);
+        QCOMPARE(scheduler.interval(CFrameBudgetScheduler::Near), 1);
+        QCOMPARE(scheduler.interval(CFrameBudgetScheduler::Medium), 4);
+        QCOMPARE(scheduler.interval(CFrameBudgetScheduler::Far), 8);
+
+        // never beyond max level
+        for (int f = 0; f < 10 * CFrameBudgetScheduler::AdaptionFrames; f++) { scheduler.endFrame(f * 20, 10.0); }
+        QCOMPARE(scheduler.getLevel(), CFrameBudgetScheduler::MaxLevel);
+
+        // well below budget again
+        for (int f = 0; f < 10 * CFrameBudgetScheduler::AdaptionFrames; f++) { scheduler.endFrame(f * 20, 0.0); }
+        QCOMPARE(scheduler.getLevel(), 0);
+
+        scheduler.resetStatistics();
+        QCOMPARE(scheduler.getFrames(), qint64(0));
+    }
+
+    void CTestFrameBudgetScheduler::disabled()
+    {
+        CFrameBudgetScheduler scheduler;
+        scheduler.setEnabled(false);
+        for (int f = 0; f < 8; f++)
+        {
+            QVERIFY(scheduler.isDue(CCallsign("DAMBZ"), CFrameBudgetScheduler::Parked));
+            scheduler.endFrame(f * 20, 100.0);
+        }
+        QCOMPARE(scheduler.getLevel(), 0);
+    }
+
+    void CTestFrameBudgetScheduler::extrapolate()
+    {
+        CAircraftSituation situation(CCallsign("DAMBZ"), CCoordinateGeodetic(48.0, 11.0, 5000.0));
+        situation.setMSecsSinceEpoch(10000);
+        situation.setGroundSpeed(CSpeed(100, CSpeedUnit::m_s()));
+        situation.setHeading(CHeading(0, CHeading::True, CAngleUnit::deg()));
+
+        // 10secs north at 100m/s
+        const CAircraftSituation extrapolated = CFrameBudgetScheduler::extrapolate(situation, 20000);
+        QCOMPARE(extrapolated.getAdjustedMSecsSinceEpoch(), qint64(20000));
+        QVERIFY(qAbs(calculateGreatCircleDistance(situation, extrapolated).value(CLengthUnit::m()) - 1000.0) < 1.0);
+        QVERIFY(extrapolated.latitude().value(CAngleUnit::deg()) > 48.0);
+        QVERIFY(qAbs(extrapolated.longitude().value(CAngleUnit::deg()) - 11.0) < 1e-6);
+
+        // not moving, only the time changes
+        situation.setGroundSpeed(CSpeed(0, CSpeedUnit::m_s()));
+        const CAircraftSituation parked = CFrameBudgetScheduler::extrapolate(situation, 20000);
+        QCOMPARE(parked.getAdjustedMSecsSinceEpoch(), qint64(20000));
+        QVERIFY(calculateGreatCircleDistance(situation, parked).value(CLengthUnit::m()) < 0.01);
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestFrameBudgetScheduler);
+
+#include "testframebudgetscheduler.moc"
+
+//! \endcond
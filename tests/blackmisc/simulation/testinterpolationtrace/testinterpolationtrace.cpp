@@ -0,0 +1,232 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/interpolationlogger.h"
+#include "blackmisc/simulation/interpolationtrace.h"
+#include "blackmisc/simulation/interpolatorlinear.h"
+#include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/pq/units.h"
+#include "test.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QEventLoop>
+#include <QTemporaryDir>
+#include <QTest>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Binary interpolation trace
+    class CTestInterpolationTrace : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Ring buffers keep the latest records, oldest first
+        void ring();
+
+        //! Log entry to record and back
+        void records();
+
+        //! Dump, read and convert
+        void fileRoundTrip();
+
+        //! Real interpolator with tracing but without logging
+        void interpolatorTracing();
+
+    private:
+        //! Log entry for time
+        static SituationLog situationLog(const CCallsign &callsign, qint64 ts);
+    };
+
+    void CTestInterpolationTrace::ring()
+    {
+        CInterpolationTraceRecorder recorder(4, 2);
+        const CCallsign cs("DAMBZ");
+        for (int i = 0; i < 10; i++)
+        {
+            SituationTraceRecord r;
+            r.tsCurrent = i;
+            recorder.recordSituation(cs, r);
+        }
+        PartsTraceRecord p;
+        p.tsCurrent = 1;
+        recorder.recordParts(cs, p);
+
+        const CInterpolationTraceRecorder::Records records = recorder.getRecords(cs);
+        QCOMPARE(records.situations.size(), 4);
+        for (int i = 0; i < 4; i++) { QCOMPARE(records.situations[i].tsCurrent, qint64(6 + i)); }
+        QCOMPARE(records.parts.size(), 1);
+        QCOMPARE(recorder.getCallsigns(), CCallsignSet(cs));
+        QVERIFY(recorder.getMemoryBytes() > 0);
+        QVERIFY(recorder.getRecords(CCallsign("OTHER")).situations.isEmpty());
+
+        recorder.clear();
+        QVERIFY(recorder.getCallsigns().isEmpty());
+    }
+
+    void CTestInterpolationTrace::records()
+    {
+        const CCallsign cs("DAMBZ");
+        const SituationLog log = situationLog(cs, 1000);
+        const SituationTraceRecord r = SituationTraceRecord::fromLog(log);
+        QCOMPARE(r.interpolator, quint8('s'));
+        QVERIFY(r.hasFlag(SituationTraceRecord::InterpolantRecalc));
+        QVERIFY(!r.hasFlag(SituationTraceRecord::UseParts));
+
+        const SituationLog back = r.toLog(cs);
+        QCOMPARE(back.tsCurrent, log.tsCurrent);
+        QCOMPARE(back.tsInterpolated, log.tsInterpolated);
+        QCOMPARE(back.interpolationType(), log.interpolationType());
+        QCOMPARE(back.noNetworkSituations, 3);
+        QCOMPARE(back.interpolationSituations.size(), 2);
+        QCOMPARE(back.newestInterpolationSituation().getMSecsSinceEpoch(), log.newestInterpolationSituation().getMSecsSinceEpoch());
+        QVERIFY(qAbs(back.situationCurrent.latitude().value(CAngleUnit::deg()) - 48.353889) < 1e-9);
+        QVERIFY(qAbs(back.situationCurrent.getAltitude().value(CLengthUnit::ft()) - 1500.0) < 1e-6);
+
+        PartsLog partsLog;
+        partsLog.callsign = cs;
+        partsLog.tsCurrent = 2000;
+        partsLog.parts = CAircraftParts(CAircraftLights(true, false, true, true, true, false), true, 20, false, CAircraftEngineList({ true, false }), true);
+        const PartsLog partsBack = PartsTraceRecord::fromLog(partsLog).toLog(cs);
+        QCOMPARE(partsBack.parts.getLights(), partsLog.parts.getLights());
+        QCOMPARE(partsBack.parts.getFlapsPercent(), 20);
+        QVERIFY(partsBack.parts.isGearDown());
+        QVERIFY(partsBack.parts.isOnGround());
+        QCOMPARE(partsBack.parts.getEnginesCount(), 2);
+        QVERIFY(partsBack.parts.isEngineOn(1));
+        QVERIFY(!partsBack.parts.isEngineOn(2));
+    }
+
+    void CTestInterpolationTrace::fileRoundTrip()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString file = dir.filePath("test interpolation.trace");
+
+        CInterpolationTraceRecorder recorder;
+        for (const CCallsign &cs : { CCallsign("DAMBZ"), CCallsign("DLH123") })
+        {
+            for (qint64 ts = 1000; ts < 2000; ts += 20) { recorder.recordSituation(cs, SituationTraceRecord::fromLog(situationLog(cs, ts))); }
+            recorder.recordParts(cs, PartsTraceRecord());
+        }
+        QVERIFY(recorder.writeToFile(file));
+
+        QHash<CCallsign, CInterpolationTraceRecorder::Records> read;
+        QString error;
+        QVERIFY2(CInterpolationTraceRecorder::readFromFile(file, read, &error), qPrintable(error));
+        QCOMPARE(read.size(), 2);
+        QCOMPARE(read.value(CCallsign("DLH123")).situations.size(), 50);
+        QCOMPARE(read.value(CCallsign("DLH123")).situations.last().tsCurrent, qint64(1980));
+        QCOMPARE(read.value(CCallsign("DAMBZ")).parts.size(), 1);
+
+        // header plus one line per record
+        const QString csv = CInterpolationTraceRecorder::toCsv(CCallsign("DAMBZ"), read.value(CCallsign("DAMBZ")).situations);
+        QCOMPARE(csv.count('\n'), 51);
+
+        // not a trace
+        QVERIFY(!CInterpolationTraceRecorder::readFromFile(dir.filePath("missing.trace"), read, &error));
+
+        const BlackMisc::CStatusMessageList msgs = CInterpolationLogger::convertTraceFile(file, CCallsignSet(CCallsign("DAMBZ")), dir.path());
+        QVERIFY(!msgs.hasErrorMessages());
+        QVERIFY(QDir(dir.path()).exists("test interpolation_situations.csv"));
+        QVERIFY(QDir(dir.path()).exists("test interpolation_parts.csv"));
+    }
+
+    void CTestInterpolationTrace::interpolatorTracing()
+    {
+        const CCallsign cs("DAMBZ");
+        CRemoteAircraftProviderDummy provider;
+        CInterpolationLogger logger;
+        logger.setTracing(true);
+        CInterpolatorLinear interpolator(cs, nullptr, nullptr, &provider, &logger);
+        interpolator.markAsUnitTest();
+
+        const qint64 ts = 1425000000000;
+        const qint64 deltaT = 5000;
+        for (int i = 4; i >= 0; i--)
+        {
+            CAircraftSituation situation(cs, CCoordinateGeodetic(48.0 + i, 11.0 + i, 1000.0 * (i + 1)));
+            situation.setGroundElevation(CAltitude(0, CAltitude::MeanSeaLevel, CLengthUnit::m()), CAircraftSituation::Test);
+            situation.setMSecsSinceEpoch(ts - deltaT * i);
+            situation.setTimeOffsetMs(deltaT);
+            provider.insertNewSituation(situation);
+        }
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+        // logging is off, only the trace gets the values
+        const CInterpolationAndRenderingSetupPerCallsign setup;
+        QVERIFY(!setup.logInterpolation());
+        constexpr int steps = 10;
+        for (int i = 0; i < steps; i++)
+        {
+            const CInterpolationResult result = interpolator.getInterpolation(ts - deltaT + i * deltaT / steps, setup);
+            QVERIFY(result.getInterpolationStatus().isInterpolated());
+        }
+
+        const CInterpolationTraceRecorder::Records records = logger.getTraceRecorder().getRecords(cs);
+        QCOMPARE(records.situations.size(), steps);
+        for (const SituationTraceRecord &r : records.situations)
+        {
+            QCOMPARE(r.interpolator, quint8('l'));
+            QVERIFY(r.tsCurrent >= ts - deltaT);
+            QVERIFY(r.tsInterpolated > 0);
+            QVERIFY(r.tsOld > 0);
+            QVERIFY(r.tsNew > r.tsOld);
+            QVERIFY(r.deltaSampleTimesMs > 0);
+            QVERIFY(r.simTimeFraction >= 0 && r.simTimeFraction <= 1);
+            QVERIFY(r.oldLatitudeDeg >= 48.0);
+            QVERIFY(r.newLatitudeDeg >= 48.0);
+            QVERIFY(r.oldAltitudeFt != r.newAltitudeFt);
+        }
+
+        // removed aircraft
+        logger.removeTrace(cs);
+        QVERIFY(logger.getTraceRecorder().getCallsigns().isEmpty());
+    }
+
+    SituationLog CTestInterpolationTrace::situationLog(const CCallsign &callsign, qint64 ts)
+    {
+        SituationLog log;
+        log.callsign = callsign;
+        log.interpolator = 's';
+        log.tsCurrent = ts;
+        log.tsInterpolated = ts - 5000;
+        log.interpolantRecalc = true;
+        log.noNetworkSituations = 3;
+        log.simTimeFraction = 0.5;
+        for (qint64 offset : { 10000, 5000 })
+        {
+            CAircraftSituation situation(callsign, CCoordinateGeodetic(48.35, 11.78, 1400.0));
+            situation.setMSecsSinceEpoch(ts - offset);
+            log.interpolationSituations.push_back(situation);
+        }
+        log.situationCurrent = CAircraftSituation(callsign, CCoordinateGeodetic(48.353889, 11.786111, 1500.0));
+        return log;
+    }
+} // ns
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestInterpolationTrace);
+
+#include "testinterpolationtrace.moc"
+
+//! \endcond
@@ -0,0 +1,172 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+#include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/network/user.h"
+#include "blackmisc/pq/units.h"
+#include "test.h"
+
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::Network;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Remote aircraft provider histories
+    class CTestRemoteAircraftProvider : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Full history only for rendered aircraft
+        void adaptiveHistory();
+
+        //! Messages per callsign are limited
+        void messages();
+
+        //! Statistics of the histories
+        void statistics();
+
+    private:
+        static constexpr int Updates = 60; //!< more than the full history
+
+        //! Aircraft in range, with situations and parts
+        static void addAircraft(CRemoteAircraftProviderDummy &provider, const CCallsign &callsign, bool inRange, bool rendered);
+
+        //! Situations and parts
+        static void addUpdates(CRemoteAircraftProviderDummy &provider, const CCallsign &callsign, int updates, qint64 startMs);
+    };
+
+    void CTestRemoteAircraftProvider::adaptiveHistory()
+    {
+        const CCallsign rendered("REND1");
+        const CCallsign notRendered("NREND1");
+        const CCallsign unknown("UNKNOWN");
+        CRemoteAircraftProviderDummy provider;
+        addAircraft(provider, rendered, true, true);
+        addAircraft(provider, notRendered, true, false);
+        addAircraft(provider, unknown, false, false);
+
+        QCOMPARE(provider.remoteAircraftSituationsCount(rendered), IRemoteAircraftProvider::MaxSituationsPerCallsign);
+        QCOMPARE(provider.remoteAircraftPartsCount(rendered), IRemoteAircraftProvider::MaxPartsPerCallsign);
+        QCOMPARE(provider.remoteAircraftSituationChangesCount(rendered), IRemoteAircraftProvider::MaxSituationsPerCallsign);
+        QCOMPARE(provider.remoteAircraftSituationsCount(notRendered), IRemoteAircraftProvider::MinSituationsPerCallsign);
+        QCOMPARE(provider.remoteAircraftPartsCount(notRendered), IRemoteAircraftProvider::MinPartsPerCallsign);
+        QCOMPARE(provider.remoteAircraftSituationChangesCount(notRendered), IRemoteAircraftProvider::MinSituationsPerCallsign);
+        QCOMPARE(provider.remoteAircraftSituationsCount(unknown), IRemoteAircraftProvider::MaxSituationsPerCallsign);
+
+        // compacted history still has the latest situation first
+        const CAircraftSituationList situations = provider.remoteAircraftSituations(notRendered);
+        QVERIFY(situations.isSortedAdjustedLatestFirstWithoutNullPositions());
+        QCOMPARE(situations.front().getMSecsSinceEpoch(), provider.remoteAircraftSituations(rendered).front().getMSecsSinceEpoch());
+
+        // no longer rendered, compacted at once
+        QVERIFY(provider.updateAircraftRendered(rendered, false));
+        QCOMPARE(provider.remoteAircraftSituationsCount(rendered), IRemoteAircraftProvider::MinSituationsPerCallsign);
+        QCOMPARE(provider.remoteAircraftPartsCount(rendered), IRemoteAircraftProvider::MinPartsPerCallsign);
+        QCOMPARE(provider.remoteAircraftSituationChangesCount(rendered), IRemoteAircraftProvider::MinSituationsPerCallsign);
+
+        // rendered, the history grows again
+        QVERIFY(provider.updateAircraftRendered(notRendered, true));
+        addUpdates(provider, notRendered, 10, provider.remoteAircraftSituations(notRendered).front().getMSecsSinceEpoch() + 5000);
+        QCOMPARE(provider.remoteAircraftSituationsCount(notRendered), IRemoteAircraftProvider::MinSituationsPerCallsign + 10);
+
+        // only aircraft in range are compacted
+        provider.updateMarkAllAsNotRendered();
+        QCOMPARE(provider.remoteAircraftSituationsCount(notRendered), IRemoteAircraftProvider::MinSituationsPerCallsign);
+        QCOMPARE(provider.remoteAircraftSituationsCount(unknown), IRemoteAircraftProvider::MaxSituationsPerCallsign);
+    }
+
+    void CTestRemoteAircraftProvider::messages()
+    {
+        const CCallsign cs("MSG1");
+        CRemoteAircraftProviderDummy provider;
+        provider.enableReverseLookupMessages(RevLogEnabled);
+        for (int i = 0; i < 2 * IRemoteAircraftProvider::MaxMessagesPerCallsign; i++)
+        {
+            provider.addReverseLookupMessage(cs, QStringLiteral("Message %1").arg(i));
+        }
+        const CStatusMessageList messages = provider.getReverseLookupMessages(cs);
+        QCOMPARE(messages.size(), IRemoteAircraftProvider::MaxMessagesPerCallsign);
+        QVERIFY(messages.back().getMessage().endsWith(QString::number(2 * IRemoteAircraftProvider::MaxMessagesPerCallsign - 1)));
+    }
+
+    void CTestRemoteAircraftProvider::statistics()
+    {
+        CRemoteAircraftProviderDummy provider;
+        QCOMPARE(provider.getHistoryStatistics().bytesPerAircraft(), Q_INT64_C(0));
+
+        addAircraft(provider, "REND1", true, true);
+        addAircraft(provider, "REND2", true, true);
+        addAircraft(provider, "NREND1", true, false);
+        const CRemoteAircraftProvider::HistoryStatistics statistics = provider.getHistoryStatistics();
+        QCOMPARE(statistics.aircraft, 3);
+        QCOMPARE(statistics.fullHistories, 2);
+        QCOMPARE(statistics.situations, 2 * IRemoteAircraftProvider::MaxSituationsPerCallsign + IRemoteAircraftProvider::MinSituationsPerCallsign);
+        QCOMPARE(statistics.parts, 2 * IRemoteAircraftProvider::MaxPartsPerCallsign + IRemoteAircraftProvider::MinPartsPerCallsign);
+        QVERIFY(statistics.bytesPerAircraft() > 0);
+        QVERIFY(!provider.getHistoryStatisticsInfo().isEmpty());
+
+        // compacting frees history
+        provider.updateMarkAllAsNotRendered();
+        const CRemoteAircraftProvider::HistoryStatistics compacted = provider.getHistoryStatistics();
+        QCOMPARE(compacted.fullHistories, 0);
+        QCOMPARE(compacted.situations, 3 * IRemoteAircraftProvider::MinSituationsPerCallsign);
+        QVERIFY(compacted.bytes < statistics.bytes);
+    }
+
+    void CTestRemoteAircraftProvider::addAircraft(CRemoteAircraftProviderDummy &provider, const CCallsign &callsign, bool inRange, bool rendered)
+    {
+        if (inRange)
+        {
+            CSimulatedAircraft aircraft(callsign, CUser("123456", "Joe Doe"), CAircraftSituation(callsign));
+            aircraft.setRendered(rendered);
+            provider.insertNewAircraft(aircraft);
+        }
+        addUpdates(provider, callsign, Updates, 1425000000000);
+    }
+
+    void CTestRemoteAircraftProvider::addUpdates(CRemoteAircraftProviderDummy &provider, const CCallsign &callsign, int updates, qint64 startMs)
+    {
+        for (int i = 0; i < updates; i++)
+        {
+            const qint64 ts = startMs + i * 5000;
+            CAircraftSituation situation(callsign, CCoordinateGeodetic(48.0 + i * 0.01, 11.0, 3000.0));
+            situation.setMSecsSinceEpoch(ts);
+            situation.setTimeOffsetMs(6000);
+            provider.insertNewSituation(situation);
+
+            CAircraftParts parts(i % 100);
+            parts.setMSecsSinceEpoch(ts);
+            parts.setTimeOffsetMs(6000);
+            provider.insertNewAircraftParts(callsign, parts, false);
+        }
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestRemoteAircraftProvider);
+
+#include "testremoteaircraftprovider.moc"
+
+//! \endcond
@@ -0,0 +1,151 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/db/dbsnapshot.h"
+#include "blackmisc/aviation/airport.h"
+#include "blackmisc/aviation/airportlist.h"
+#include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "test.h"
+
+#include <QObject>
+#include <QSharedPointer>
+#include <QString>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Db;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! DB snapshot tests
+    class CTestDbSnapshot : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Lookup by DB key
+        void dbKey();
+
+        //! Lookup by name, same results as the list functions
+        void name();
+
+        //! Airports by ICAO code
+        void airports();
+
+        //! Snapshot rebuilt only if the data changed
+        void holder();
+
+    private:
+        //! Models, some without DB key and some with the same model string
+        static CAircraftModelList models(int number);
+
+        //! Model snapshot by model string
+        static CAircraftModelSnapshot modelSnapshot(const CAircraftModelList &models, qint64 timestamp = -1);
+    };
+
+    void CTestDbSnapshot::dbKey()
+    {
+        const CAircraftModelList list = models(100);
+        const CAircraftModelSnapshot snapshot = modelSnapshot(list);
+        QCOMPARE(snapshot.size(), list.size());
+        for (int key : { 1, 2, 4, 50, 100, 101, -1 })
+        {
+            QCOMPARE(snapshot.findByDbKey(key), list.findByKey(key));
+            QCOMPARE(snapshot.containsDbKey(key), list.containsDbKey(key));
+        }
+        QVERIFY(!snapshot.containsDbKey(3));
+        QVERIFY(!snapshot.findByDbKey(3).hasValidDbKey());
+    }
+
+    void CTestDbSnapshot::name()
+    {
+        const CAircraftModelList list = models(100);
+        const CAircraftModelSnapshot snapshot = modelSnapshot(list);
+        for (const QString &modelString : { "MODEL 7", "model 7", " Model 7 ", "DUPLICATE", "MISSING", "" })
+        {
+            QCOMPARE(snapshot.findByName(modelString).findFirstByModelStringOrDefault(modelString), list.findFirstByModelStringOrDefault(modelString));
+            QCOMPARE(snapshot.findByName(modelString).containsModelString(modelString), list.containsModelString(modelString));
+        }
+
+        // all candidates, in the order of the list
+        const CAircraftModelList duplicates = snapshot.findByName("duplicate");
+        QCOMPARE(duplicates.size(), 10);
+        QCOMPARE(duplicates, list.findByModelString("DUPLICATE"));
+        QVERIFY(snapshot.containsName("duplicate"));
+        QVERIFY(!snapshot.containsName(""));
+    }
+
+    void CTestDbSnapshot::airports()
+    {
+        CAirportList list;
+        for (const QString &icao : { "EDDM", "KSFO", "LOWW", "EDDF" }) { list.push_back(CAirport(icao)); }
+        const CAirportSnapshot snapshot(list, [](const CAirport &airport) { return airport.getIcaoAsString(); });
+        for (const QString &designator : { "EDDF", "eddf", "KLAX" })
+        {
+            const CAirportIcaoCode icao(designator);
+            QCOMPARE(snapshot.findByName(icao.asString()).findFirstByIcao(icao), list.findFirstByIcao(icao));
+        }
+    }
+
+    void CTestDbSnapshot::holder()
+    {
+        CDbSnapshotHolder<CAircraftModelSnapshot> holder;
+        int builds = 0;
+        CAircraftModelList list = models(10);
+        const auto build = [&] { builds++; return modelSnapshot(list, 1000); };
+
+        const QSharedPointer<const CAircraftModelSnapshot> first = holder.get(1000, build);
+        QCOMPARE(builds, 1);
+        QVERIFY(holder.get(1000, build) == first);
+        QCOMPARE(builds, 1);
+
+        // changed data, the old snapshot stays as it is
+        list.push_back(CAircraftModel("NEW", CAircraftModel::TypeDatabaseEntry));
+        const QSharedPointer<const CAircraftModelSnapshot> second = holder.get(2000, build);
+        QCOMPARE(builds, 2);
+        QVERIFY(second != first);
+        QCOMPARE(second->size(), 11);
+        QCOMPARE(first->size(), 10);
+        QVERIFY(second->containsName("new"));
+        QVERIFY(!first->containsName("new"));
+    }
+
+    CAircraftModelList CTestDbSnapshot::models(int number)
+    {
+        CAircraftModelList list;
+        for (int i = 0; i < number; i++)
+        {
+            CAircraftModel model(i % 10 == 9 ? QStringLiteral("DUPLICATE") : QStringLiteral("Model %1").arg(i), CAircraftModel::TypeDatabaseEntry);
+            if (i % 3 != 2) { model.setDbKey(i + 1); }
+            list.push_back(model);
+        }
+        return list;
+    }
+
+    CAircraftModelSnapshot CTestDbSnapshot::modelSnapshot(const CAircraftModelList &models, qint64 timestamp)
+    {
+        return CAircraftModelSnapshot(models, [](const CAircraftModel &model) { return model.getModelString(); }, timestamp);
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestDbSnapshot);
+
+#include "testdbsnapshot.moc"
+
+//! \endcond
@@ -0,0 +1,262 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/jsonstream.h"
+#include "blackmisc/jsonstreamreader.h"
+#include "blackmisc/jsonstreamwriter.h"
+#include "blackmisc/registermetadata.h"
+#include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/distributor.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/statusmessagelist.h"
+#include "blackmisc/variant.h"
+#include "blackmisc/variantmap.h"
+#include "test.h"
+
+#include <QBuffer>
+#include <QByteArray>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QObject>
+#include <QString>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! JSON stream writer and value object streaming tests
+    class CTestJsonStream : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Register metadata
+        void initTestCase();
+
+        //! Same output as QJsonDocument
+        void writerFormat();
+
+        //! Value object written and read like toJson and convertFromJson
+        void valueObject();
+
+        //! Model list in memoized format, compatible with toMemoizedJson and convertFromMemoizedJson
+        void memoizedModelList();
+
+        //! Variant map as written to the cache files
+        void variantMap();
+
+    private:
+        //! Models sharing ICAO codes, liveries and distributors
+        static CAircraftModelList models(int number);
+
+        //! Write with a stream writer
+        template <class F>
+        static QByteArray write(F &&function, QJsonDocument::JsonFormat format = QJsonDocument::Indented)
+        {
+            QByteArray json;
+            QBuffer buffer(&json);
+            buffer.open(QIODevice::WriteOnly);
+            {
+                CJsonStreamWriter writer(&buffer, format);
+                function(writer);
+            }
+            return json;
+        }
+    };
+
+    void CTestJsonStream::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CTestJsonStream::writerFormat()
+    {
+        const QJsonObject object
+        {
+            { "string", QString::fromUtf8("quote \" backslash \\ tab \t newline \n control \x01 umlaut \xc3\xa4 euro \xe2\x82\xac") },
+            { "integer", 42 },
+            { "negative", -7 },
+            { "large", 9007199254740992.0 },
+            { "double", 0.1 },
+            { "bool", true },
+            { "null", QJsonValue() },
+            { "emptyObject", QJsonObject() },
+            { "emptyArray", QJsonArray() },
+            { "nested", QJsonObject { { "array", QJsonArray { 1, "two", QJsonObject { { "three", 3.5 } }, QJsonArray() } } } }
+        };
+        for (QJsonDocument::JsonFormat format : { QJsonDocument::Indented, QJsonDocument::Compact })
+        {
+            const QByteArray json = write([&](CJsonStreamWriter &writer) { writer.writeValue(object); }, format);
+            QCOMPARE(json, QJsonDocument(object).toJson(format));
+
+            const QJsonArray array { object, QJsonArray { QJsonObject() } };
+            const QByteArray jsonArray = write([&](CJsonStreamWriter &writer) { writer.writeValue(array); }, format);
+            QCOMPARE(jsonArray, QJsonDocument(array).toJson(format));
+        }
+
+        // raw values copied from a reader
+        CJsonStreamReader reader(QJsonDocument(object).toJson());
+        reader.readNext();
+        const QByteArray copy = write([&](CJsonStreamWriter &writer)
+        {
+            writer.beginObject();
+            while (reader.readNext() == CJsonStreamReader::Name)
+            {
+                writer.writeName(reader.stringValue());
+                writer.writeRawValue(reader.rawValue());
+            }
+            writer.endObject();
+        });
+        QVERIFY(!reader.hasError());
+        QCOMPARE(QJsonDocument::fromJson(copy).object(), object);
+    }
+
+    void CTestJsonStream::valueObject()
+    {
+        const CAircraftModel model = models(1).front();
+        const QByteArray json = write([&](CJsonStreamWriter &writer) { Json::writeToStream(writer, model); });
+
+        // readable by the DOM
+        const QJsonObject dom = QJsonDocument::fromJson(json).object();
+        QCOMPARE(dom, model.toJson());
+
+        // DOM output readable by the stream
+        CAircraftModel streamed;
+        CJsonStreamReader reader(QJsonDocument(model.toJson()).toJson());
+        reader.readNext();
+        Json::readFromStream(reader, streamed);
+        QVERIFY(!reader.hasError());
+        CAircraftModel converted;
+        converted.convertFromJson(model.toJson());
+        QCOMPARE(streamed, converted);
+
+        // round trip
+        CAircraftModel roundTrip;
+        CJsonStreamReader reader2(json);
+        reader2.readNext();
+        Json::readFromStream(reader2, roundTrip);
+        QCOMPARE(roundTrip, converted);
+
+        // unknown members are ignored
+        CAircraftModel unknown;
+        CJsonStreamReader reader3(R"({"foo": {"bar": [1, 2]}, "modelstring": "TEST"})");
+        reader3.readNext();
+        Json::readFromStream(reader3, unknown);
+        QCOMPARE(unknown.getModelString(), QString("TEST"));
+    }
+
+    void CTestJsonStream::memoizedModelList()
+    {
+        const CAircraftModelList list = models(50);
+        const QByteArray json = write([&](CJsonStreamWriter &writer) { list.writeMemoizedJson(writer); });
+
+        // stream written, DOM read
+        CAircraftModelList dom;
+        dom.convertFromMemoizedJson(QJsonDocument::fromJson(json).object());
+        CAircraftModelList expected;
+        expected.convertFromMemoizedJson(list.toMemoizedJson());
+        QCOMPARE(dom, expected);
+
+        // DOM written (tables before the models), stream read
+        CAircraftModelList streamed;
+        CJsonStreamReader reader(QJsonDocument(list.toMemoizedJson()).toJson(QJsonDocument::Compact));
+        reader.readNext();
+        streamed.readMemoizedJson(reader);
+        QCOMPARE(streamed, expected);
+
+        // missing tables
+        CAircraftModelList plain;
+        CJsonStreamReader reader2(QJsonDocument(list.toJson()).toJson());
+        reader2.readNext();
+        QVERIFY_EXCEPTION_THROWN(plain.readMemoizedJson(reader2), CJsonException);
+
+        CJsonStreamReader reader3(QJsonDocument(list.toJson()).toJson());
+        reader3.readNext();
+        plain.readMemoizedJson(reader3, true);
+        CAircraftModelList expectedPlain;
+        expectedPlain.convertFromJson(list.toJson());
+        QCOMPARE(plain, expectedPlain);
+    }
+
+    void CTestJsonStream::variantMap()
+    {
+        const CVariantMap map
+        {
+            { "int", CVariant::from(5) },
+            { "string", CVariant::from(QString("foo")) },
+            { "models", CVariant::from(models(10)) }
+        };
+        const QByteArray json = write([&](CJsonStreamWriter &writer) { map.writeMemoizedJson(writer); });
+
+        CVariantMap expected;
+        expected.convertFromMemoizedJson(QJsonDocument::fromJson(json).object());
+        QCOMPARE(expected.keys(), map.keys());
+
+        CVariantMap streamed;
+        CJsonStreamReader reader(json);
+        reader.readNext();
+        QVERIFY(streamed.readMemoizedJsonNoThrow(reader, {}, {}).isEmpty());
+        QCOMPARE(streamed, expected);
+
+        // damaged values are reported, the other values are still read
+        QByteArray damaged = json;
+        damaged.insert(damaged.lastIndexOf('}'), R"(, "bad1": 5, "bad2": {"type": "BlackMisc::Simulation::CAircraftModelList", "value": {"foo": [1]}}, "after": {"type": "int", "value": 7})");
+        CVariantMap partial;
+        CJsonStreamReader reader2(damaged);
+        reader2.readNext();
+        const CStatusMessageList messages = partial.readMemoizedJsonNoThrow(reader2, {}, {});
+        QCOMPARE(messages.size(), 2);
+        QVERIFY(!reader2.hasError());
+        QVERIFY(partial.contains("models"));
+        QVERIFY(partial.contains("after"));
+        QVERIFY(!partial.contains("bad1"));
+
+        // only selected keys
+        CVariantMap selected;
+        CJsonStreamReader reader3(json);
+        reader3.readNext();
+        QVERIFY(selected.readMemoizedJsonNoThrow(reader3, { "int" }, {}, {}).isEmpty());
+        QCOMPARE(selected.size(), 1);
+        QVERIFY(selected.contains("int"));
+    }
+
+    CAircraftModelList CTestJsonStream::models(int number)
+    {
+        CAircraftModelList models;
+        for (int i = 0; i < number; ++i)
+        {
+            const QString part = QString::number(i % 5);
+            const CAircraftIcaoCode aircraftIcao("A" + part, "A" + part, "L1P", "Lego", "Foo", "M", false, false, false, 0);
+            const CLivery livery("A" + part, CAirlineIcaoCode("A" + part, "Foo", CCountry("DE", "Germany"), "Foo", false, false), "Foo", "red", "blue", false);
+            models.push_back(CAircraftModel(QString::number(i), CAircraftModel::TypeUnknown, CSimulatorInfo::FSX, "Model " + QString::number(i), "Description \"" + part + "\"", aircraftIcao, livery));
+            models.back().setDistributor(CDistributor(part, "Foo", {}, {}, CSimulatorInfo::FSX));
+        }
+        return models;
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestJsonStream);
+
+#include "testjsonstream.moc"
+
+//! \endcond
@@ -0,0 +1,131 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/jsonstreamreader.h"
+#include "test.h"
+
+#include <QByteArray>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QObject>
+#include <QTest>
+#include <QVector>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! JSON pull parser tests
+    class CTestJsonStreamReader : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Token sequence of a document
+        void tokens();
+
+        //! Strings and numbers like QJsonDocument
+        void values();
+
+        //! Skipping nested values
+        void skipValue();
+
+        //! Syntax errors
+        void errors();
+    };
+
+    void CTestJsonStreamReader::tokens()
+    {
+        CJsonStreamReader reader(R"({"a": 1, "b": [true, null, {}], "c": "x"})");
+        const QVector<CJsonStreamReader::TokenType> expected(
+        {
+            CJsonStreamReader::StartObject,
+            CJsonStreamReader::Name, CJsonStreamReader::Number,
+            CJsonStreamReader::Name, CJsonStreamReader::StartArray, CJsonStreamReader::Bool, CJsonStreamReader::Null,
+            CJsonStreamReader::StartObject, CJsonStreamReader::EndObject, CJsonStreamReader::EndArray,
+            CJsonStreamReader::Name, CJsonStreamReader::String,
+            CJsonStreamReader::EndObject, CJsonStreamReader::EndDocument
+        });
+        QVector<CJsonStreamReader::TokenType> tokens;
+        while (!reader.atEnd()) { tokens.push_back(reader.readNext()); }
+        QCOMPARE(tokens, expected);
+        QVERIFY(!reader.hasError());
+    }
+
+    void CTestJsonStreamReader::values()
+    {
+        // escapes, surrogate pair escape, UTF-8 (u umlaut)
+        const QByteArray json = R"({"s": "a\"b\\c\/d\n\u00e4\ud83d\ude00 )" "\xc3\xbc" R"(", "u": "Z)" "\xc3\xbc" R"(rich", "n": [0, -12.375, 3e2, 12345678901234567, 0.1]})";
+        const QJsonObject dom = QJsonDocument::fromJson(json).object();
+
+        CJsonStreamReader reader(json);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::StartObject);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::Name);
+        QVERIFY(reader.isName(QLatin1String("s")));
+        QCOMPARE(reader.readNext(), CJsonStreamReader::String);
+        QCOMPARE(reader.stringValue(), dom.value("s").toString());
+
+        QCOMPARE(reader.readNext(), CJsonStreamReader::Name);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::String);
+        QCOMPARE(reader.stringValue(), dom.value("u").toString());
+
+        QCOMPARE(reader.readNext(), CJsonStreamReader::Name);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::StartArray);
+        const QJsonArray numbers = dom.value("n").toArray();
+        for (const QJsonValue &number : numbers)
+        {
+            QCOMPARE(reader.readNext(), CJsonStreamReader::Number);
+            QCOMPARE(reader.numberValue(), number.toDouble());
+        }
+        QCOMPARE(reader.readNext(), CJsonStreamReader::EndArray);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::EndObject);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::EndDocument);
+    }
+
+    void CTestJsonStreamReader::skipValue()
+    {
+        CJsonStreamReader reader(R"({"skip": {"a": [1, {"b": [[], {}]}], "c": "}"}, "keep": 42})");
+        QCOMPARE(reader.readNext(), CJsonStreamReader::StartObject);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::Name);
+        QVERIFY(reader.skipValue());
+        QCOMPARE(reader.depth(), 1);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::Name);
+        QVERIFY(reader.isName(QLatin1String("keep")));
+        QCOMPARE(reader.readNext(), CJsonStreamReader::Number);
+        QCOMPARE(reader.stringValue(), QString("42"));
+        QCOMPARE(reader.readNext(), CJsonStreamReader::EndObject);
+        QCOMPARE(reader.readNext(), CJsonStreamReader::EndDocument);
+    }
+
+    void CTestJsonStreamReader::errors()
+    {
+        for (const char *json : { "", "{", "{,}", "[1,]", "{\"a\"}", "{\"a\":}", "{\"a\":1,}", "[1 2]", "[}", "[tru]", "{} {}", "\"open" })
+        {
+            CJsonStreamReader reader(json);
+            while (!reader.atEnd()) { reader.readNext(); }
+            QVERIFY2(reader.hasError(), json);
+            QVERIFY(!reader.errorString().isEmpty());
+        }
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestJsonStreamReader);
+
+#include "testjsonstreamreader.moc"
+
+//! \endcond
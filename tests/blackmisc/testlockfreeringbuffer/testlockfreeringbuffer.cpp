@@ -0,0 +1,123 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/lockfreeringbuffer.h"
+#include "test.h"
+
+#include <QObject>
+#include <QString>
+#include <QTest>
+#include <QThread>
+#include <QVector>
+#include <vector>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! Lock-free ring buffer tests
+    class CTestLockFreeRingBuffer : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Capacity is rounded up to a power of 2
+        void capacity();
+
+        //! Full and empty buffer, FIFO order
+        void fullAndEmpty();
+
+        //! Several producers, one consumer, order per producer is kept
+        void multipleProducers();
+    };
+
+    void CTestLockFreeRingBuffer::capacity()
+    {
+        QCOMPARE(CLockFreeRingBuffer<int>(0).capacity(), 2);
+        QCOMPARE(CLockFreeRingBuffer<int>(8).capacity(), 8);
+        QCOMPARE(CLockFreeRingBuffer<int>(9).capacity(), 16);
+        QCOMPARE(CLockFreeRingBuffer<int>(1000).capacity(), 1024);
+    }
+
+    void CTestLockFreeRingBuffer::fullAndEmpty()
+    {
+        CLockFreeRingBuffer<QString> buffer(4);
+        QString value;
+        QVERIFY(buffer.isEmpty());
+        QVERIFY(!buffer.tryPop(value));
+
+        // wrap around several times
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int i = 0; i < 4; ++i) { QVERIFY(buffer.tryPush(QString::number(i))); }
+            QVERIFY(!buffer.tryPush(QStringLiteral("full")));
+            QCOMPARE(buffer.sizeApprox(), 4);
+            for (int i = 0; i < 4; ++i)
+            {
+                QVERIFY(buffer.tryPop(value));
+                QCOMPARE(value, QString::number(i));
+            }
+            QVERIFY(!buffer.tryPop(value));
+            QVERIFY(buffer.isEmpty());
+        }
+    }
+
+    void CTestLockFreeRingBuffer::multipleProducers()
+    {
+        constexpr int Producers = 4;
+        constexpr int PerProducer = 50000;
+        CLockFreeRingBuffer<int> buffer(256);
+
+        std::vector<QThread *> threads;
+        for (int p = 0; p < Producers; ++p)
+        {
+            threads.push_back(QThread::create([&buffer, p]
+            {
+                for (int i = 0; i < PerProducer; ++i)
+                {
+                    while (!buffer.tryPush(p * PerProducer + i)) { QThread::yieldCurrentThread(); }
+                }
+            }));
+            threads.back()->start();
+        }
+
+        QVector<int> next(Producers, 0);
+        int received = 0;
+        int value = 0;
+        while (received < Producers * PerProducer)
+        {
+            if (!buffer.tryPop(value)) { QThread::yieldCurrentThread(); continue; }
+            const int producer = value / PerProducer;
+            QCOMPARE(value % PerProducer, next[producer]);
+            next[producer]++;
+            received++;
+        }
+
+        for (QThread *thread : threads)
+        {
+            thread->wait();
+            delete thread;
+        }
+        QVERIFY(buffer.isEmpty());
+        QCOMPARE(next, QVector<int>(Producers, PerProducer));
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestLockFreeRingBuffer);
+
+#include "testlockfreeringbuffer.moc"
+
+//! \endcond
@@ -0,0 +1,116 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/parallel.h"
+#include "blackmisc/taskpool.h"
+#include "test.h"
+
+#include <QObject>
+#include <QTest>
+#include <QVector>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! Parallel chunk processing tests
+    class CTestParallel : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Every index is processed exactly once
+        void allIndexesOnce();
+
+        //! Chunk results are in order
+        void mapChunksInOrder();
+
+        //! Nested calls complete
+        void nested();
+
+        //! Chunks run on the shared task pool
+        void sharedPool();
+    };
+
+    void CTestParallel::allIndexesOnce()
+    {
+        for (int count : { 0, 1, 7, 100, 10007 })
+        {
+            QVector<int> hits(count, 0);
+            int *data = hits.data();
+            CParallel::forEachChunk(count, 10, [&](int begin, int end, int)
+            {
+                for (int i = begin; i < end; i++) { data[i]++; }
+            });
+            QVERIFY2(std::all_of(hits.cbegin(), hits.cend(), [](int h) { return h == 1; }), "Index not processed once");
+        }
+        QCOMPARE(CParallel::chunkCount(0, 10), 0);
+        QCOMPARE(CParallel::chunkCount(5, 10), 1);
+        QVERIFY(CParallel::chunkCount(100000, 10) <= CParallel::maxThreads());
+    }
+
+    void CTestParallel::mapChunksInOrder()
+    {
+        const int count = 5000;
+        const QVector<QVector<int>> chunks = CParallel::mapChunks<QVector<int>>(count, 100, [](int begin, int end)
+        {
+            QVector<int> indexes;
+            for (int i = begin; i < end; i++) { indexes.push_back(i); }
+            return indexes;
+        });
+
+        QVector<int> merged;
+        for (const QVector<int> &chunk : chunks) { merged += chunk; }
+        QVector<int> expected(count);
+        std::iota(expected.begin(), expected.end(), 0);
+        QCOMPARE(merged, expected);
+    }
+
+    void CTestParallel::nested()
+    {
+        std::atomic_int sum { 0 };
+        CParallel::forEachChunk(64, 1, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                CParallel::forEachChunk(100, 1, [&](int b, int e, int) { sum += e - b; });
+            }
+        });
+        QCOMPARE(sum.load(), 6400);
+    }
+
+    void CTestParallel::sharedPool()
+    {
+        QVERIFY(CParallel::maxThreads() <= CTaskPool::instance().maxThreadCount());
+        const int chunks = CParallel::chunkCount(1000, 1);
+        if (chunks < 2) { QSKIP("Single core"); }
+
+        const qint64 submitted = CTaskPool::instance().getStatistics().tasksSubmitted;
+        std::atomic_int sum { 0 };
+        CParallel::forEachChunk(1000, 1, [&](int begin, int end, int) { sum += end - begin; });
+        QCOMPARE(sum.load(), 1000);
+        QCOMPARE(CTaskPool::instance().getStatistics().tasksSubmitted - submitted, static_cast<qint64>(chunks - 1));
+    }
+}
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestParallel);
+
+#include "testparallel.moc"
+
+//! \endcond
@@ -0,0 +1,156 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/timeline.h"
+#include "blackmisc/parallel.h"
+#include "test.h"
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QObject>
+#include <QSet>
+#include <QTest>
+#include <QThread>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! Timeline tests
+    class CTestTimeline : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Scoped stages
+        void stages();
+
+        //! Stages from several threads
+        void threads();
+
+        //! Chrome trace format
+        void chromeTrace();
+
+        //! Not recording
+        void recording();
+    };
+
+    void CTestTimeline::stages()
+    {
+        CTimeline timeline;
+        {
+            CTimeline::Stage outer(timeline, "outer", "test");
+            {
+                CTimeline::Stage inner(timeline, "inner");
+                inner.setBytes(42);
+                QThread::msleep(2);
+            }
+        }
+        const QVector<CTimeline::StageInfo> stages = timeline.getStages();
+        QCOMPARE(stages.size(), 2);
+        QCOMPARE(stages[0].name, QString("inner"));
+        QCOMPARE(stages[0].bytes, Q_INT64_C(42));
+        QCOMPARE(stages[1].name, QString("outer"));
+        QCOMPARE(stages[1].bytes, Q_INT64_C(-1));
+        QVERIFY(stages[0].endUs - stages[0].startUs >= 2000);
+        QVERIFY(stages[1].startUs <= stages[0].startUs);
+        QVERIFY(stages[1].endUs >= stages[0].endUs);
+        QCOMPARE(stages[0].threadId, CTimeline::currentThreadId());
+
+        // ended explicitly only once
+        CTimeline::Stage stage(timeline, "ended");
+        stage.end();
+        stage.end();
+        QCOMPARE(timeline.getStages().size(), 3);
+    }
+
+    void CTestTimeline::threads()
+    {
+        CTimeline timeline;
+        CParallel::forEachChunk(1000, 10, [&](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++) { CTimeline::Stage stage(timeline, QString::number(i)); }
+        });
+        const QVector<CTimeline::StageInfo> stages = timeline.getStages();
+        QCOMPARE(stages.size(), 1000);
+        QSet<QString> names;
+        for (const CTimeline::StageInfo &stage : stages) { names.insert(stage.name); }
+        QCOMPARE(names.size(), 1000);
+    }
+
+    void CTestTimeline::chromeTrace()
+    {
+        CTimeline timeline;
+        timeline.addStage("load", "cache", 1000, 3500, 1024);
+        timeline.addStage("parse", {}, 2000, 2500);
+        const QJsonObject trace = timeline.toChromeTrace();
+        const QJsonArray events = trace.value("traceEvents").toArray();
+        QCOMPARE(events.size(), 3); // 2 stages, 1 thread name
+
+        const QJsonObject load = events[0].toObject();
+        QCOMPARE(load.value("name").toString(), QString("load"));
+        QCOMPARE(load.value("cat").toString(), QString("cache"));
+        QCOMPARE(load.value("ph").toString(), QString("X"));
+        QCOMPARE(load.value("ts").toDouble(), 1000.0);
+        QCOMPARE(load.value("dur").toDouble(), 2500.0);
+        QCOMPARE(load.value("args").toObject().value("bytes").toDouble(), 1024.0);
+
+        const QJsonObject parse = events[1].toObject();
+        QCOMPARE(parse.value("cat").toString(), QString("default"));
+        QVERIFY(!parse.contains("args"));
+
+        const QJsonObject threadName = events[2].toObject();
+        QCOMPARE(threadName.value("ph").toString(), QString("M"));
+        QCOMPARE(threadName.value("args").toObject().value("name").toString(), CTimeline::currentThreadName());
+        QCOMPARE(threadName.value("tid"), load.value("tid"));
+    }
+
+    void CTestTimeline::recording()
+    {
+        CTimeline timeline;
+        timeline.setRecording(false);
+        {
+            CTimeline::Stage stage(timeline, "ignored");
+        }
+        QVERIFY(timeline.getStages().isEmpty());
+        timeline.setRecording(true);
+        timeline.addStage("recorded", {}, 0, 1);
+        QCOMPARE(timeline.getStages().size(), 1);
+        timeline.clear();
+        QVERIFY(timeline.getStages().isEmpty());
+
+        // a stage started while not recording is not recorded
+        timeline.setRecording(false);
+        {
+            CTimeline::Stage stage(timeline, "started before");
+            timeline.setRecording(true);
+        }
+        QVERIFY(timeline.getStages().isEmpty());
+
+        // startup timeline only records if enabled
+        QVERIFY(!CTimeline::startup().isRecording());
+        {
+            CTimeline::Stage stage(CTimeline::startup(), "not enabled");
+        }
+        QVERIFY(CTimeline::startup().getStages().isEmpty());
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestTimeline);
+
+#include "testtimeline.moc"
+
+//! \endcond
@@ -0,0 +1,220 @@
+/* Copyright (C) 2021
+ * swift Project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+// the macros are tested, independent of the swift config
+#ifndef BLACK_USE_TRACING
+#define BLACK_USE_TRACING
+#endif
+
+#include "blackmisc/tracer.h"
+#include "blackmisc/parallel.h"
+#include "test.h"
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QObject>
+#include <QSet>
+#include <QTest>
+#include <QThread>
+#include <algorithm>
+#include <thread>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! Tracer tests
+    class CTestTracer : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Reset tracer before each test
+        void init();
+
+        //! Disable tracer after each test
+        void cleanup();
+
+        //! Nothing recorded if disabled
+        void disabled();
+
+        //! Scoped zones
+        void zones();
+
+        //! Every n-th zone
+        void sampling();
+
+        //! Zones from several threads
+        void threads();
+
+        //! Full buffers are drained, the latest events are kept
+        void latestEvents();
+
+        //! Chrome trace format
+        void chromeTrace();
+
+    private:
+        //! All events, regardless of thread
+        static QVector<CTracer::Event> allEvents();
+    };
+
+    void CTestTracer::init()
+    {
+        CTracer::clear();
+        CTracer::setSamplingInterval(1);
+        CTracer::setEnabled(true);
+    }
+
+    void CTestTracer::cleanup()
+    {
+        CTracer::setEnabled(false);
+        CTracer::clear();
+    }
+
+    void CTestTracer::disabled()
+    {
+        CTracer::setEnabled(false);
+        {
+            BLACK_TRACE_ZONE("zone", "test");
+            BLACK_TRACE_COUNTER("counter", 1);
+        }
+        QVERIFY(allEvents().isEmpty());
+    }
+
+    void CTestTracer::zones()
+    {
+        {
+            BLACK_TRACE_ZONE("outer", "test");
+            {
+                BLACK_TRACE_ZONE("inner", "test");
+                QThread::msleep(2);
+            }
+        }
+        const QVector<CTracer::Event> events = allEvents();
+        QCOMPARE(events.size(), 2);
+        QCOMPARE(QString(events[0].name), QString("inner"));
+        QCOMPARE(QString(events[1].name), QString("outer"));
+        QCOMPARE(QString(events[0].category), QString("test"));
+        QVERIFY(events[0].durationUs >= 2000);
+        QVERIFY(events[1].startUs <= events[0].startUs);
+        QVERIFY(events[1].startUs + events[1].durationUs >= events[0].startUs + events[0].durationUs);
+
+        // drained
+        QVERIFY(allEvents().isEmpty());
+    }
+
+    void CTestTracer::sampling()
+    {
+        CTracer::setSamplingInterval(4);
+        for (int i = 0; i < 100; i++)
+        {
+            BLACK_TRACE_ZONE("sampled", "test");
+            BLACK_TRACE_COUNTER("counter", i);
+        }
+        const QVector<CTracer::Event> events = allEvents();
+        const int zones = static_cast<int>(std::count_if(events.begin(), events.end(), [](const CTracer::Event &e) { return e.durationUs >= 0; }));
+        QCOMPARE(zones, 25);
+        QCOMPARE(events.size() - zones, 100); // counters are not sampled
+    }
+
+    void CTestTracer::threads()
+    {
+        CParallel::forEachChunk(1000, 10, [](int begin, int end, int)
+        {
+            for (int i = begin; i < end; i++) { BLACK_TRACE_ZONE("zone", "test"); }
+        });
+        const QVector<CTracer::ThreadEvents> threadEvents = CTracer::takeEvents();
+        int events = 0;
+        QSet<quint64> threadIds;
+        for (const CTracer::ThreadEvents &t : threadEvents)
+        {
+            events += t.events.size();
+            QVERIFY(!threadIds.contains(t.threadId));
+            threadIds.insert(t.threadId);
+        }
+        QCOMPARE(events, 1000);
+        QCOMPARE(CTracer::getDroppedEvents(), 0);
+    }
+
+    void CTestTracer::latestEvents()
+    {
+        // capacity applies to new threads
+        const int retained = CTracer::getRetainedEvents();
+        CTracer::setBufferCapacity(8);
+        CTracer::setRetainedEvents(10);
+        std::thread thread([]
+        {
+            for (int i = 0; i < 30; i++) { CTracer::recordZone("zone", "test", i, i + 1); }
+        });
+        thread.join();
+        CTracer::setBufferCapacity(1 << 14);
+
+        // buffer drained 3 times when full, store keeps 10 events, 6 events still in the buffer
+        QCOMPARE(CTracer::getDiscardedEvents(), Q_INT64_C(14));
+        CTracer::drain();
+        const QVector<CTracer::Event> events = allEvents();
+        CTracer::setRetainedEvents(retained);
+        QCOMPARE(events.size(), 10);
+        QCOMPARE(events.front().startUs, Q_INT64_C(20));
+        QCOMPARE(events.back().startUs, Q_INT64_C(29));
+        QCOMPARE(CTracer::getDroppedEvents(), 0);
+        QCOMPARE(CTracer::getDiscardedEvents(), Q_INT64_C(20));
+        CTracer::clear();
+        QCOMPARE(CTracer::getDiscardedEvents(), Q_INT64_C(0));
+    }
+
+    void CTestTracer::chromeTrace()
+    {
+        CTracer::recordZone("parse", "fsd", 1000, 3500);
+        CTracer::recordCounter("aircraft", 42);
+        const QJsonObject trace = CTracer::toChromeTrace();
+        const QJsonArray events = trace.value("traceEvents").toArray();
+        QCOMPARE(events.size(), 3); // zone, counter, thread name
+
+        const QJsonObject zone = events[0].toObject();
+        QCOMPARE(zone.value("name").toString(), QString("parse"));
+        QCOMPARE(zone.value("cat").toString(), QString("fsd"));
+        QCOMPARE(zone.value("ph").toString(), QString("X"));
+        QCOMPARE(zone.value("ts").toDouble(), 1000.0);
+        QCOMPARE(zone.value("dur").toDouble(), 2500.0);
+
+        const QJsonObject counter = events[1].toObject();
+        QCOMPARE(counter.value("ph").toString(), QString("C"));
+        QCOMPARE(counter.value("args").toObject().value("value").toDouble(), 42.0);
+        QVERIFY(!counter.contains("dur"));
+
+        const QJsonObject threadName = events[2].toObject();
+        QCOMPARE(threadName.value("ph").toString(), QString("M"));
+        QCOMPARE(threadName.value("tid"), zone.value("tid"));
+        QCOMPARE(trace.value("otherData").toObject().value("droppedEvents").toInt(), 0);
+
+        // drained
+        QVERIFY(CTracer::toChromeTrace().value("traceEvents").toArray().isEmpty());
+    }
+
+    QVector<CTracer::Event> CTestTracer::allEvents()
+    {
+        QVector<CTracer::Event> events;
+        for (const CTracer::ThreadEvents &t : CTracer::takeEvents()) { events += t.events; }
+        return events;
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestTracer);
+
+#include "testtracer.moc"
+
+//! \endcond
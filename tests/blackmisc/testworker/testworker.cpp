@@ -15,8 +15,20 @@
 
 #include "blackmisc/worker.h"
 #include "blackmisc/eventloop.h"
+#include "blackmisc/taskpool.h"
+#include "test.h"
+
+#include <QMutex>
+#include <QMutexLocker>
 #include <QObject>
+#include <QPointer>
+#include <QSemaphore>
+#include <QStringList>
 #include <QTest>
+#include <QThread>
+#include <QVector>
+#include <atomic>
+#include <memory>
 
 using namespace BlackMisc;
 
@@ -34,6 +46,28 @@ namespace BlackMiscTest
     private slots:
         //! Testing single shot
         void singleShot();
+
+        //! Worker result and continuations
+        void workerResult();
+
+        //! Higher priorities are run first
+        void poolPriorities();
+
+        //! Queued tasks are cancelled when the owner is destroyed
+        void ownerCancellation();
+
+        //! Pool threads waiting for queued tasks do not deadlock
+        void nestedWait();
+
+        //! High priority tasks are run while lower priorities occupy the pool
+        void reservedThreads();
+
+        //! Low priority tasks run in a dedicated thread with an event loop
+        void dedicatedThread();
+
+    private:
+        //! Occupy all pool threads until released
+        static void blockPool(QSemaphore &started, QSemaphore &release);
     };
 
     CTestWorker::CTestWorker(QObject *parent) : QObject(parent)
@@ -49,10 +83,145 @@ namespace BlackMiscTest
         QVERIFY2(future.result() == 123, "Future provides access to slot's return value");
     }
 
+    void CTestWorker::workerResult()
+    {
+        QObject owner;
+        std::atomic_int continuation { 0 };
+        CWorker *worker = CWorker::fromTask(&owner, "result", [] { return 42; });
+        worker->thenWithResult<int>([&](int result) { continuation = result; });
+        QCOMPARE(worker->result<int>(), 42);
+        QCOMPARE(continuation.load(), 42);
+
+        int contextResult = 0;
+        QPointer<CWorker> contextWorker = CWorker::fromTask(&owner, "context", CTaskPool::HighPriority, [] { return 7; });
+        contextWorker->thenWithResult<int>(this, [&](int result) { contextResult = result; });
+        QTRY_COMPARE(contextResult, 7);
+        QTRY_VERIFY2(!contextWorker, "Worker deletes itself");
+    }
+
+    void CTestWorker::blockPool(QSemaphore &started, QSemaphore &release)
+    {
+        const int threads = CTaskPool::instance().maxThreadCount();
+        for (int i = 0; i < threads; i++)
+        {
+            CTaskPool::instance().submit(CTaskPool::newTaskId(), nullptr, "block", CTaskPool::HighPriority, [&] { started.release(); release.acquire(); }, {});
+        }
+        started.acquire(threads);
+    }
+
+    void CTestWorker::poolPriorities()
+    {
+        QSemaphore started;
+        QSemaphore release;
+        blockPool(started, release);
+
+        QMutex mutex;
+        QStringList order;
+        QSemaphore done;
+        const auto task = [&](const QString & name)
+        {
+            return [&, name] { QMutexLocker l(&mutex); order.push_back(name); done.release(); };
+        };
+        CTaskPool &pool = CTaskPool::instance();
+        pool.submit(CTaskPool::newTaskId(), nullptr, "low", CTaskPool::LowPriority, task("low"), {});
+        pool.submit(CTaskPool::newTaskId(), nullptr, "normal", CTaskPool::NormalPriority, task("normal"), {});
+        pool.submit(CTaskPool::newTaskId(), nullptr, "high", CTaskPool::HighPriority, task("high"), {});
+        QVERIFY(pool.getStatistics().queueDepth >= 3);
+
+        release.release(1); // one thread takes the queued tasks in priority order
+        done.acquire(3);
+        release.release(pool.maxThreadCount() - 1);
+        QCOMPARE(order, QStringList({ "high", "normal", "low" }));
+    }
+
+    void CTestWorker::ownerCancellation()
+    {
+        QSemaphore started;
+        QSemaphore release;
+        blockPool(started, release);
+
+        std::atomic_int run { 0 };
+        std::atomic_int cancelled { 0 };
+        auto owner = std::make_unique<QObject>();
+        CTaskPool &pool = CTaskPool::instance();
+        const qint64 cancelledBefore = pool.getStatistics().tasksCancelled;
+        for (int i = 0; i < 10; i++)
+        {
+            pool.submit(CTaskPool::newTaskId(), owner.get(), "owned", CTaskPool::NormalPriority, [&] { run++; }, [&] { cancelled++; });
+        }
+        owner.reset();
+        release.release(pool.maxThreadCount());
+
+        QCOMPARE(cancelled.load(), 10);
+        QCOMPARE(run.load(), 0);
+        QCOMPARE(pool.getStatistics().tasksCancelled - cancelledBefore, 10LL);
+    }
+
+    void CTestWorker::nestedWait()
+    {
+        // more waiting tasks than pool threads, every one waits for a task it has queued
+        QObject owner;
+        const int tasks = 4 * CTaskPool::instance().maxThreadCount();
+        QVector<QPointer<CWorker>> workers;
+        for (int i = 0; i < tasks; i++)
+        {
+            workers.push_back(CWorker::fromTask(&owner, "outer", [&owner, i]
+            {
+                CWorker *inner = CWorker::fromTask(&owner, "inner", [i] { return i; });
+                return inner->result<int>() + 1;
+            }));
+        }
+        for (int i = 0; i < tasks; i++)
+        {
+            QVERIFY(workers[i]);
+            QCOMPARE(workers[i]->result<int>(), i + 1);
+        }
+
+        const CTaskPool::Statistics statistics = CTaskPool::instance().getStatistics();
+        QVERIFY(statistics.threadsCreated >= 1);
+        QVERIFY(statistics.threadsAlive <= CTaskPool::instance().maxThreadCount());
+        QVERIFY(statistics.tasksExecuted >= 2 * tasks);
+        QVERIFY(!statistics.toQString().isEmpty());
+    }
+
+    void CTestWorker::reservedThreads()
+    {
+        CTaskPool &pool = CTaskPool::instance();
+        const int threads = pool.maxThreadCount();
+        const int lowerThreads = threads - pool.reservedThreadCount();
+        QVERIFY(lowerThreads > 0 && lowerThreads < threads);
+
+        QSemaphore started;
+        QSemaphore release;
+        for (int i = 0; i < threads; i++)
+        {
+            pool.submit(CTaskPool::newTaskId(), nullptr, "normal", CTaskPool::NormalPriority, [&] { started.release(); release.acquire(); }, {});
+        }
+        started.acquire(lowerThreads);
+        QVERIFY2(!started.tryAcquire(1, 100), "Reserved threads are not used");
+
+        QSemaphore done;
+        pool.submit(CTaskPool::newTaskId(), nullptr, "high", CTaskPool::HighPriority, [&] { done.release(); }, {});
+        QVERIFY2(done.tryAcquire(1, 5000), "High priority task is not starved");
+
+        release.release(threads);
+        started.acquire(threads - lowerThreads);
+    }
+
+    void CTestWorker::dedicatedThread()
+    {
+        QObject owner;
+        CWorker *worker = CWorker::fromTask(&owner, "eventLoop", CTaskPool::LowPriority, []
+        {
+            return !CTaskPool::isPoolThread() && QThread::currentThread()->loopLevel() > 0;
+        });
+        QVERIFY2(worker->result<bool>(), "Event loop running in a dedicated thread");
+    }
+
 } // namespace
 
 //! main
-BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestWorker);
+BLACKTEST_MAIN(BlackMiscTest::CTestWorker);
 
 #include "testworker.moc"
 
@@ -2,7 +2,7 @@ load(common_pre)
 
 QT += core testlib
 
-TARGET = testslot
+TARGET = testworker
 CONFIG   -= app_bundle
 CONFIG   += blackconfig
 CONFIG   += blackmisc
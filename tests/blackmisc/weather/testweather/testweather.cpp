@@ -12,6 +12,7 @@
 
 #include "blackmisc/aviation/airporticaocode.h"
 #include "blackmisc/aviation/altitude.h"
+#include "blackmisc/fileutils.h"
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/pq/angle.h"
 #include "blackmisc/pq/length.h"
@@ -21,10 +22,12 @@
 #include "blackmisc/pq/temperature.h"
 #include "blackmisc/pq/time.h"
 #include "blackmisc/pq/units.h"
+#include "blackmisc/swiftdirectories.h"
 #include "blackmisc/weather/cloudlayer.h"
 #include "blackmisc/weather/cloudlayerlist.h"
 #include "blackmisc/weather/metar.h"
 #include "blackmisc/weather/metardecoder.h"
+#include "blackmisc/weather/metarlist.h"
 #include "blackmisc/weather/presentweather.h"
 #include "blackmisc/weather/presentweatherlist.h"
 #include "blackmisc/weather/temperaturelayer.h"
@@ -35,8 +38,10 @@
 #include "blackmisc/weather/windlayerlist.h"
 #include "test.h"
 
+#include <QStringList>
 #include <QTest>
 
+using namespace BlackMisc;
 using namespace BlackMisc::Weather;
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::PhysicalQuantities;
@@ -63,6 +68,16 @@ namespace BlackMiscTest
 
         //! Testing METAR decoder
         void metarDecoder();
+
+        //! Single pass decoder yields the same METARs as the regular expression decoder
+        void metarDecoderEquivalence();
+
+        //! Decoding many METARs in parallel
+        void metarDecoderAll();
+
+    private:
+        //! Recorded METARs and special cases
+        static QStringList testMetars();
     };
 
     void CTestWeather::cloudLayer()
@@ -215,6 +230,68 @@ namespace BlackMiscTest
         QVERIFY2(cloudLayers2.findByBase(CAltitude(30000, CAltitude::AboveGround, CLengthUnit::ft())).getCoverage() == CCloudLayer::Scattered, "Failed to parse cloud layer in 30000 ft");
     }
 
+    void CTestWeather::metarDecoderEquivalence()
+    {
+        const CMetarDecoder metarDecoder;
+        const QStringList metars = testMetars();
+        QVERIFY2(metars.size() > 1000, "Missing METAR test file");
+        for (const QString &metarString : metars)
+        {
+            const CMetar metar = metarDecoder.decode(metarString);
+            const CMetar reference = metarDecoder.decodeWithRegularExpressions(metarString);
+            QVERIFY2(metar == reference, qPrintable("Different results for: " + metarString));
+        }
+
+        // special cases
+        QVERIFY2(metarDecoder.decode("EDDM 321260Z 24010KT 9999 Q1013") == CMetar(), "Invalid day/time should be invalid");
+        QVERIFY2(metarDecoder.decode("EDDF 011200Z 24010KT 0/2SM 10/09 Q1013") == CMetar(), "Invalid fraction should be invalid");
+        const CMetar metar = metarDecoder.decode("METAR KJFK 011200Z AUTO VRB03G15KT 1 1/2SM R04R/P2000V3000FT/U +TSRAGR FEW020CB BKN/// M05/M07 A2992 RMK AO2");
+        QVERIFY2(metar.getReportType() == CMetar::METAR, "Failed to parse report type");
+        QVERIFY2(metar.isAutomated(), "Failed to parse AUTO");
+        QVERIFY2(metar.getWindLayer().isDirectionVariable(), "Wind direction should be variable");
+        QVERIFY2(metar.getWindLayer().getGustSpeed() == CSpeed(15, CSpeedUnit::kts()), "Failed to parse wind gust speed");
+        QVERIFY2(metar.getVisibility() == CLength(1.5, CLengthUnit::SM()), "Failed to parse visibility");
+        QVERIFY2(metar.getPresentWeather().size() == 1, "Present weather has an incorrect size");
+        QVERIFY2(metar.getCloudLayers().size() == 1, "Cloud layer with missing base should be skipped");
+        QVERIFY2(metar.getTemperature() == CTemperature(-5, CTemperatureUnit::C()), "Failed to parse temperature");
+        QVERIFY2(metar.getDewPoint() == CTemperature(-7, CTemperatureUnit::C()), "Failed to parse dew point");
+    }
+
+    void CTestWeather::metarDecoderAll()
+    {
+        const CMetarDecoder metarDecoder;
+        const QStringList metars = testMetars();
+        CMetarList expected;
+        for (const QString &metarString : metars)
+        {
+            const CMetar metar = metarDecoder.decode(metarString);
+            if (metar.hasMessage()) { expected.push_back(metar); }
+        }
+
+        int invalid = -1;
+        const CMetarList decoded = metarDecoder.decodeAll(metars, &invalid);
+        QCOMPARE(decoded.size(), expected.size());
+        QCOMPARE(invalid, metars.size() - expected.size());
+        QVERIFY2(decoded == expected, "Parallel decoding should keep the order");
+        QVERIFY(metarDecoder.decodeAll({}).isEmpty());
+    }
+
+    QStringList CTestWeather::testMetars()
+    {
+        QStringList metars = CFileUtils::readFileToString(CSwiftDirectories::testFilesDirectory(), "metars.txt").split('\n', Qt::SkipEmptyParts);
+        metars << ""
+               << "EDDF"
+               << "EDDF 011200Z CAVOK 15/10 Q1013"
+               << "EDDF  011200Z\t24010KT   9999 FEW020  12/10 Q1013 "
+               << "EDDF 011200Z 2401015KT 9999NDVSW -RA NSC FEW020 12// Q////"
+               << "EDDF 011200Z /////KT 9999NDVX FZFG SCT020TCUX 12/10Q1013"
+               << "KXYZ 011200Z 00000KT 10SM CLR 21/10 QFE 987.5 A3001"
+               << "KXYZ 011200Z 24010KTX 10SM RASNDZGRSA FEW020 21/10 A3001"
+               << "KXYZ 011200Z COR 24010KT M1/4SM // VV001 21/10"
+               << "UUEE 011200Z 24005MPS 110V170 5000NDV R25L/1200N R25R/1200N BR OVC003 M02/M03 Q1013 R25/190095";
+        return metars;
+    }
+
 } // namespace
 
 //! main